@@ -55,12 +55,25 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 뷰 공간 깊이 → 클러스터 깊이 슬라이스 (TileLightCuller.cpp의 GetDepthSlice와 같은 식)
+uint CalculateDepthSlice(float viewDepth)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    float slice = floor(log2(max(viewDepth, 1e-4f)) * DepthSliceScale + DepthSliceBias);
+    return (uint) clamp(slice, 0.0f, (float) (DepthSliceCount - 1));
+}
+
+// 클러스터 인덱스 계산 (픽셀 위치 + 뷰 공간 깊이)
+uint CalculateClusterIndex(float4 screenPos, float viewDepth, float viewportStartX, float viewportStartY)
+{
+    uint tileIndex = CalculateTileIndex(screenPos, viewportStartX, viewportStartY);
+    return CalculateDepthSlice(viewDepth) * (TileCountX * TileCountY) + tileIndex;
+}
+
+// 클러스터에 배정된 라이트 인덱스 리스트의 범위
+void GetClusterLightRange(uint clusterIndex, out uint lightOffset, out uint lightCount)
+{
+    lightOffset = g_TileLightIndices[clusterIndex * 2];
+    lightCount = g_TileLightIndices[clusterIndex * 2 + 1];
 }
 
 //================================================================================================
@@ -859,13 +872,13 @@ float3 CalculateAllLights(
     // Point + Spot with 타일 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint clusterIndex = CalculateClusterIndex(screenPos, viewPos.z, ViewportStartX, ViewportStartY);
+        uint lightOffset, lightCount;
+        GetClusterLightRange(clusterIndex, lightOffset, lightCount);
 
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
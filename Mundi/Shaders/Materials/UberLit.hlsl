@@ -121,6 +121,18 @@ struct VS_INPUT
     uint4 BoneIndices : BLENDINDICES;    // 영향을 주는 본 인덱스 (최대 4개)
     float4 BoneWeights : BLENDWEIGHT;    // 본 가중치 (합=1.0)
 #endif
+#ifdef INSTANCED_WORLD
+    // 자동 인스턴싱: 슬롯 1 인스턴스 스트림 (FMeshInstanceData와 일치)
+    float4 InstanceWorld0 : INSTANCE_WORLD0;
+    float4 InstanceWorld1 : INSTANCE_WORLD1;
+    float4 InstanceWorld2 : INSTANCE_WORLD2;
+    float4 InstanceWorld3 : INSTANCE_WORLD3;
+    float4 InstanceNormal0 : INSTANCE_NORMAL0;
+    float4 InstanceNormal1 : INSTANCE_NORMAL1;
+    float4 InstanceNormal2 : INSTANCE_NORMAL2;
+    float4 InstanceNormal3 : INSTANCE_NORMAL3;
+    uint InstanceObjectID : INSTANCE_ID;
+#endif
 };
 
 struct PS_INPUT
@@ -131,6 +143,9 @@ struct PS_INPUT
     row_major float3x3 TBN : TBN;
     float4 Color : COLOR;
     float2 TexCoord : TEXCOORD0;
+#ifdef INSTANCED_WORLD
+    nointerpolation uint ObjectID : OBJECT_ID;   // 인스턴스별 피킹 ID (ColorBuffer.UUID 대신)
+#endif
 };
 
 struct PS_OUTPUT
@@ -181,8 +196,18 @@ PS_INPUT mainVS(VS_INPUT Input)
     float3 localTangent = Input.Tangent.xyz;
 #endif
 
+#ifdef INSTANCED_WORLD
+    // 자동 인스턴싱: 월드 행렬을 인스턴스 스트림에서 읽음 (각 요소가 FMatrix의 한 행)
+    float4x4 World = float4x4(Input.InstanceWorld0, Input.InstanceWorld1, Input.InstanceWorld2, Input.InstanceWorld3);
+    float4x4 WorldInvTranspose = float4x4(Input.InstanceNormal0, Input.InstanceNormal1, Input.InstanceNormal2, Input.InstanceNormal3);
+    Out.ObjectID = Input.InstanceObjectID;
+#else
+    float4x4 World = WorldMatrix;
+    float4x4 WorldInvTranspose = WorldInverseTranspose;
+#endif
+
     // 위치를 월드 공간으로 먼저 변환
-    float4 worldPos = mul(float4(localPosition, 1.0f), WorldMatrix);
+    float4 worldPos = mul(float4(localPosition, 1.0f), World);
     Out.WorldPos = worldPos.xyz;
     
     // 뷰 공간으로 변환
@@ -194,9 +219,9 @@ PS_INPUT mainVS(VS_INPUT Input)
     // 노멀을 월드 공간으로 변환
     // 비균등 스케일에서 올바른 노멀 변환을 위해 WorldInverseTranspose 사용
     // 노멀 벡터는 transpose(inverse(WorldMatrix))로 변환됨
-    float3 worldNormal = normalize(mul(localNormal, (float3x3) WorldInverseTranspose));
+    float3 worldNormal = normalize(mul(localNormal, (float3x3) WorldInvTranspose));
     Out.Normal = worldNormal;
-    float3 Tangent = normalize(mul(localTangent, (float3x3) WorldMatrix));
+    float3 Tangent = normalize(mul(localTangent, (float3x3) World));
     Tangent = normalize(Tangent - worldNormal * dot(worldNormal, Tangent));  // 그람-슈미트 재직교화
     float3 BiTangent = normalize(cross(Tangent, worldNormal) * Input.Tangent.w);
     row_major float3x3 TBN;
@@ -284,7 +309,11 @@ PS_INPUT mainVS(VS_INPUT Input)
 PS_OUTPUT mainPS(PS_INPUT Input)
 {
     PS_OUTPUT Output;
+#ifdef INSTANCED_WORLD
+    Output.UUID = Input.ObjectID;
+#else
     Output.UUID = UUID;
+#endif
     
     //CSM 구간 시각화
     float3 Color[2] =
@@ -447,18 +476,18 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 뷰 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 클러스터에 영향을 주는 라이트 리스트
+        uint lightOffset, lightCount;
+        GetClusterLightRange(clusterIndex, lightOffset, lightCount);
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -559,18 +588,18 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // 타일 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터 계산 (타일 + 뷰 깊이 슬라이스)
+        uint clusterIndex = CalculateClusterIndex(Input.Position, ViewPos.z, ViewportStartX, ViewportStartY);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 클러스터에 영향을 주는 라이트 리스트
+        uint lightOffset, lightCount;
+        GetClusterLightRange(clusterIndex, lightOffset, lightCount);
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
         for (uint i = 0; i < lightCount; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightOffset + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
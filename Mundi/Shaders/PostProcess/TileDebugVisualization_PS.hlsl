@@ -13,16 +13,20 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint DepthSliceCount;   // 클러스터 깊이 슬라이스 개수
+    uint TileCullingPadding;
+    float DepthSliceScale;  // Slice = log2(ViewDepth) * Scale + Bias (지수 분포)
+    float DepthSliceBias;
+    float2 TileCullingPadding2;
 };
 
 // t0: 원본 씬 텍스처
 Texture2D g_SceneTexture : register(t0);
 SamplerState g_SamplerLinear : register(s0);
 
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조: [TileIndex * MaxLightsPerTile] = LightCount
-//       [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices
+// t2: 클러스터별 라이트 인덱스 Structured Buffer
+// 구조: [ClusterIndex * 2] = 시작 오프셋, [ClusterIndex * 2 + 1] = LightCount
+//       ClusterIndex = Slice * (TileCountX * TileCountY) + TileIndex
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // 타일 인덱스 계산
@@ -38,11 +42,18 @@ uint CalculateTileIndex(float2 screenPos)
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 타일 기둥의 모든 깊이 슬라이스 중 가장 많은 라이트 개수
+uint GetMaxClusterLightCount(uint tileIndex)
 {
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileCount = TileCountX * TileCountY;
+    uint maxCount = 0;
+
+    [loop]
+    for (uint slice = 0; slice < DepthSliceCount; slice++)
+    {
+        maxCount = max(maxCount, g_TileLightIndices[(slice * tileCount + tileIndex) * 2 + 1]);
+    }
+    return maxCount;
 }
 
 // 라이트 개수를 색상으로 변환 (히트맵)
@@ -98,10 +109,9 @@ float4 mainPS(float4 Pos : SV_Position, float2 TexCoord : TEXCOORD0) : SV_Target
 
     // 현재 픽셀이 속한 타일 계산
     uint tileIndex = CalculateTileIndex(Pos.xy);
-    uint tileDataOffset = GetTileDataOffset(tileIndex);
 
-    // 타일의 라이트 개수
-    uint lightCount = g_TileLightIndices[tileDataOffset];
+    // 타일의 라이트 개수 (깊이 정보가 없으므로 슬라이스 중 최댓값)
+    uint lightCount = GetMaxClusterLightCount(tileIndex);
 
     // 히트맵 색상 계산
     float3 heatmapColor = LightCountToHeatmap(lightCount);
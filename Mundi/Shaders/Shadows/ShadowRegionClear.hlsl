@@ -0,0 +1,21 @@
+// 섀도우 아틀라스의 한 영역(현재 뷰포트)만 초기화하는 셰이더
+// D3D11은 DSV 일부만 지울 수 없으므로, far 평면(z = 1)의 사각형을 GreaterEqual(쓰기)로 그려 깊이를 1로 되돌립니다.
+// C++ 코드에서 D3D11RHI::DrawFullScreenQuad() (Draw(6, 0))로 호출해야 합니다.
+
+float4 mainVS(uint VertexID : SV_VertexID) : SV_POSITION
+{
+    const float2 Positions[6] =
+    {
+        float2(-1, 1), float2(1, 1), float2(-1, -1), // 첫 번째 삼각형
+        float2(-1, -1), float2(1, 1), float2(1, -1) // 두 번째 삼각형
+    };
+
+    return float4(Positions[VertexID], 1.0f, 1.0f);
+}
+
+// VSM 모멘트 초기값 (깊이 1 → Moment1 = 1, Moment2 = 1)
+// PCF일 때는 렌더 타겟이 없으므로 출력은 무시됨
+float2 mainPS(float4 Position : SV_POSITION) : SV_TARGET
+{
+    return float2(1.0f, 1.0f);
+}
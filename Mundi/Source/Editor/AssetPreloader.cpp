@@ -0,0 +1,343 @@
+﻿#include "pch.h"
+#include "AssetPreloader.h"
+#include "ObjManager.h"
+#include "FBXLoader.h"
+#include "PhysicalMaterialLoader.h"
+#include "Texture.h"
+#include "Sound.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include "PathUtils.h"
+#include <filesystem>
+#include <objbase.h>
+
+namespace fs = std::filesystem;
+
+FAssetPreloader::FReport FAssetPreloader::LastReport;
+
+namespace
+{
+	/** 단일 스캔 결과 (정규화된 경로) */
+	struct FScanResult
+	{
+		TArray<FString> Textures;
+		TArray<FString> ObjFiles;
+		TArray<FString> FbxFiles;
+		TArray<FString> SoundFiles;
+		TArray<FString> PhysicalMaterials;
+	};
+
+	/** 워커에서 실행되는 CPU 단계 하나 */
+	struct FPrepareTask
+	{
+		FString Path;
+		FJobHandle Job;
+		double PrepareMS = 0.0;
+	};
+
+	struct FObjTask : FPrepareTask
+	{
+		FStaticMesh* StaticMesh = nullptr;
+		TArray<FMaterialInfo> MaterialInfos;
+	};
+
+	struct FSoundTask : FPrepareTask
+	{
+		USound* Sound = nullptr;
+	};
+
+	const char* GetAssetTypeName(EPreloadAssetType Type)
+	{
+		switch (Type)
+		{
+		case EPreloadAssetType::Texture:			return "Texture";
+		case EPreloadAssetType::Obj:				return "OBJ";
+		case EPreloadAssetType::Fbx:				return "FBX";
+		case EPreloadAssetType::Sound:				return "Sound";
+		case EPreloadAssetType::PhysicalMaterial:	return "PhysicalMaterial";
+		default:									return "Unknown";
+		}
+	}
+
+	bool HasPathPrefix(const FString& Path, const FString& Prefix)
+	{
+		return Path.length() >= Prefix.length() && _strnicmp(Path.c_str(), Prefix.c_str(), Prefix.length()) == 0;
+	}
+
+	double MillisecondsSince(uint64 StartCycles)
+	{
+		return FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - StartCycles);
+	}
+
+	/** 기존 로더들이 각각 돌던 recursive_directory_iterator를 한 번으로 합침 */
+	void ScanDataDirectory(FScanResult& OutResult)
+	{
+		const fs::path DataDir(UTF8ToWide(GDataDir));
+		if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
+		{
+			UE_LOG("FAssetPreloader: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
+			return;
+		}
+
+		// 기존 로더와 같은 범위: 사운드는 Data/Audio, 물리 재질은 Data/PhysicalMaterials 하위만
+		const FString AudioPrefix = NormalizePath(GDataDir + "/Audio/");
+		const FString PhysicalMaterialPrefix = NormalizePath(GDataDir + "/PhysicalMaterials/");
+
+		for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+		{
+			if (!Entry.is_regular_file())
+				continue;
+
+			const fs::path& Path = Entry.path();
+			FString Extension = WideToUTF8(Path.extension().wstring());
+			std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
+
+			if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
+			{
+				OutResult.Textures.Add(PathStr);
+			}
+			else if (Extension == ".obj")
+			{
+				OutResult.ObjFiles.Add(PathStr);
+			}
+			else if (Extension == ".fbx")
+			{
+				OutResult.FbxFiles.Add(PathStr);
+			}
+			else if (Extension == ".wav" && HasPathPrefix(PathStr, AudioPrefix))
+			{
+				OutResult.SoundFiles.Add(PathStr);
+			}
+			else if (Extension == ".phxmtl" && HasPathPrefix(PathStr, PhysicalMaterialPrefix))
+			{
+				OutResult.PhysicalMaterials.Add(PathStr);
+			}
+		}
+	}
+
+	/** DDS 변환이 WIC를 쓰므로 워커 스레드마다 한 번 COM 초기화 (게임 스레드는 이미 STA라 실패해도 무시) */
+	void EnsureComInitializedOnThisThread()
+	{
+		thread_local bool bComInitialized = false;
+		if (!bComInitialized)
+		{
+			CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+			bComInitialized = true;
+		}
+	}
+
+	void WaitForTask(const FPrepareTask& Task, double& InOutWaitMS)
+	{
+		const uint64 WaitStart = FWindowsPlatformTime::Cycles64();
+		FJobSystem::Wait(Task.Job);
+		InOutWaitMS += MillisecondsSince(WaitStart);
+	}
+}
+
+void FAssetPreloader::PreloadAll()
+{
+	LastReport = FReport();
+	LastReport.NumWorkers = FJobSystem::GetNumWorkers();
+
+	auto GetStats = [](EPreloadAssetType Type) -> FTypeStats&
+	{
+		return LastReport.Types[static_cast<int32>(Type)];
+	};
+
+	const uint64 PreloadStart = FWindowsPlatformTime::Cycles64();
+
+	// ────────────────────────────────────────────────
+	// 1. 단일 디렉토리 스캔
+	// ────────────────────────────────────────────────
+	FScanResult Scan;
+	ScanDataDirectory(Scan);
+	LastReport.ScanMS = MillisecondsSince(PreloadStart);
+
+	// ────────────────────────────────────────────────
+	// 2. CPU 단계 디스패치 (태스크 배열은 디스패치 전에 크기를 확정해 주소를 고정)
+	// ────────────────────────────────────────────────
+	TArray<FPrepareTask> TextureTasks;
+	TextureTasks.SetNum(Scan.Textures.Num());
+	for (int32 Index = 0; Index < Scan.Textures.Num(); ++Index)
+	{
+		FPrepareTask& Task = TextureTasks[Index];
+		Task.Path = Scan.Textures[Index];
+		Task.Job = FJobSystem::Dispatch([&Task]()
+		{
+			const uint64 JobStart = FWindowsPlatformTime::Cycles64();
+			EnsureComInitializedOnThisThread();
+
+			// 게임 스레드의 UTexture::Load와 같은 sRGB 기본값으로 캐시를 만들어야 재변환되지 않음
+			FString CacheFilePath;
+			UTexture::PrepareLoadPath(Task.Path, true, CacheFilePath);
+			Task.PrepareMS = MillisecondsSince(JobStart);
+		});
+	}
+
+	// 기본 머티리얼 이름은 ResourceManager 조회라 게임 스레드에서 미리 가져옴
+	FString DefaultMaterialName;
+	if (UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial())
+	{
+		DefaultMaterialName = DefaultMaterial->GetMaterialInfo().MaterialName;
+	}
+
+	TArray<FObjTask> ObjTasks;
+	ObjTasks.SetNum(Scan.ObjFiles.Num());
+	for (int32 Index = 0; Index < Scan.ObjFiles.Num(); ++Index)
+	{
+		FObjTask& Task = ObjTasks[Index];
+		Task.Path = Scan.ObjFiles[Index];
+		Task.Job = FJobSystem::Dispatch([&Task, &DefaultMaterialName]()
+		{
+			const uint64 JobStart = FWindowsPlatformTime::Cycles64();
+			try
+			{
+				Task.StaticMesh = FObjManager::PrepareObjStaticMeshAsset(Task.Path, DefaultMaterialName, Task.MaterialInfos);
+			}
+			catch (const std::exception& e)
+			{
+				// 워커 밖으로 예외가 나가면 프로세스가 종료되므로 실패로 처리
+				UE_LOG("FAssetPreloader: Exception while preparing '%s': %s", Task.Path.c_str(), e.what());
+				Task.StaticMesh = nullptr;
+			}
+			Task.PrepareMS = MillisecondsSince(JobStart);
+		});
+	}
+
+	// USound 생성/등록은 게임 스레드, WAV 읽기만 워커에서
+	TArray<FSoundTask> SoundTasks;
+	SoundTasks.SetNum(Scan.SoundFiles.Num());
+	for (int32 Index = 0; Index < Scan.SoundFiles.Num(); ++Index)
+	{
+		FSoundTask& Task = SoundTasks[Index];
+		Task.Path = Scan.SoundFiles[Index];
+		if (UResourceManager::GetInstance().Get<USound>(Task.Path))
+		{
+			continue;
+		}
+
+		Task.Sound = NewObject<USound>();
+		Task.Job = FJobSystem::Dispatch([&Task]()
+		{
+			const uint64 JobStart = FWindowsPlatformTime::Cycles64();
+			Task.Sound->LoadWavFromFile(UTF8ToWide(Task.Path));
+			Task.PrepareMS = MillisecondsSince(JobStart);
+		});
+	}
+
+	// ────────────────────────────────────────────────
+	// 3. 게임 스레드 직렬 단계 (워커와 겹쳐 실행)
+	// ────────────────────────────────────────────────
+
+	// 3-1. 물리 재질: 다른 에셋과 의존성이 없으므로 가장 먼저
+	{
+		const uint64 StageStart = FWindowsPlatformTime::Cycles64();
+		FPhysicalMaterialLoader::Preload(Scan.PhysicalMaterials);
+
+		FTypeStats& Stats = GetStats(EPreloadAssetType::PhysicalMaterial);
+		Stats.NumFiles = Scan.PhysicalMaterials.Num();
+		Stats.FinishMS = MillisecondsSince(StageStart);
+	}
+
+	// 3-2. 텍스처 GPU 생성 (DDS 캐시가 준비된 순서대로)
+	{
+		FTypeStats& Stats = GetStats(EPreloadAssetType::Texture);
+		Stats.NumFiles = TextureTasks.Num();
+		for (FPrepareTask& Task : TextureTasks)
+		{
+			WaitForTask(Task, LastReport.WaitMS);
+
+			const uint64 FinishStart = FWindowsPlatformTime::Cycles64();
+			UResourceManager::GetInstance().Load<UTexture>(Task.Path);
+			Stats.FinishMS += MillisecondsSince(FinishStart);
+			Stats.PrepareMS += Task.PrepareMS;
+		}
+	}
+
+	// 3-3. FBX: SDK가 스레드 안전하지 않아 게임 스레드에서 순차 처리
+	// 머티리얼이 텍스처를 참조하므로 텍스처 단계 이후, 애니메이션 전용 FBX는 메시 FBX의 스켈레톤 이후
+	{
+		const uint64 StageStart = FWindowsPlatformTime::Cycles64();
+
+		TArray<FString> MeshFbxFiles;
+		TArray<FString> AnimationOnlyFbxFiles;
+		for (const FString& PathStr : Scan.FbxFiles)
+		{
+			// 메시 없는 FBX는 StaticMesh/SkeletalMesh로 로드하지 않음 (ResourceManager에 빈 메시 등록 방지)
+			if (UFbxLoader::GetInstance().HasMeshInFbx(PathStr))
+			{
+				MeshFbxFiles.Add(PathStr);
+				FObjManager::LoadObjStaticMesh(PathStr);
+			}
+			else
+			{
+				AnimationOnlyFbxFiles.Add(PathStr);
+			}
+		}
+		UFbxLoader::PreLoad(MeshFbxFiles, AnimationOnlyFbxFiles);
+
+		FTypeStats& Stats = GetStats(EPreloadAssetType::Fbx);
+		Stats.NumFiles = Scan.FbxFiles.Num();
+		Stats.FinishMS = MillisecondsSince(StageStart);
+	}
+
+	// 3-4. OBJ: 머티리얼 생성 + 메모리 캐시 등록 후 UStaticMesh (버텍스/인덱스 버퍼, Convex)
+	{
+		FTypeStats& Stats = GetStats(EPreloadAssetType::Obj);
+		Stats.NumFiles = ObjTasks.Num();
+		for (FObjTask& Task : ObjTasks)
+		{
+			WaitForTask(Task, LastReport.WaitMS);
+
+			const uint64 FinishStart = FWindowsPlatformTime::Cycles64();
+			if (Task.StaticMesh)
+			{
+				FObjManager::RegisterObjStaticMeshAsset(Task.Path, Task.StaticMesh, Task.MaterialInfos);
+				FObjManager::LoadObjStaticMesh(Task.Path);
+			}
+			else
+			{
+				UE_LOG("FAssetPreloader: Failed to prepare '%s'", Task.Path.c_str());
+			}
+			Stats.FinishMS += MillisecondsSince(FinishStart);
+			Stats.PrepareMS += Task.PrepareMS;
+		}
+	}
+	RESOURCE.SetStaticMeshs();
+
+	// 3-5. 사운드 등록
+	{
+		FTypeStats& Stats = GetStats(EPreloadAssetType::Sound);
+		Stats.NumFiles = SoundTasks.Num();
+		for (FSoundTask& Task : SoundTasks)
+		{
+			if (!Task.Sound)
+			{
+				continue;
+			}
+			WaitForTask(Task, LastReport.WaitMS);
+
+			const uint64 FinishStart = FWindowsPlatformTime::Cycles64();
+			UResourceManager::GetInstance().Add<USound>(Task.Path, Task.Sound);
+			Stats.FinishMS += MillisecondsSince(FinishStart);
+			Stats.PrepareMS += Task.PrepareMS;
+		}
+	}
+	RESOURCE.SetAudioFiles();
+
+	// ────────────────────────────────────────────────
+	// 4. 리포트
+	// ────────────────────────────────────────────────
+	LastReport.TotalMS = MillisecondsSince(PreloadStart);
+
+	UE_LOG("[AssetPreload] Cold start %.1f ms (scan %.1f ms, game thread wait %.1f ms, %u workers)",
+		LastReport.TotalMS, LastReport.ScanMS, LastReport.WaitMS, LastReport.NumWorkers);
+	for (int32 TypeIndex = 0; TypeIndex < static_cast<int32>(EPreloadAssetType::Count); ++TypeIndex)
+	{
+		const FTypeStats& Stats = LastReport.Types[TypeIndex];
+		UE_LOG("[AssetPreload]   %-16s %4d files | parse %8.1f ms (workers) | finish %8.1f ms (game thread)",
+			GetAssetTypeName(static_cast<EPreloadAssetType>(TypeIndex)), Stats.NumFiles, Stats.PrepareMS, Stats.FinishMS);
+	}
+}
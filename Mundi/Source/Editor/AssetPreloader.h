@@ -0,0 +1,67 @@
+﻿#pragma once
+
+#include "UEContainer.h"
+
+// ────────────────────────────────────────────────────────────────────────────
+// AssetPreloader.h
+// 시작 시 에셋 프리로드 파이프라인 (단일 디렉토리 스캔 + 잡 그래프)
+// ────────────────────────────────────────────────────────────────────────────
+
+/** 프리로드 리포트에서 구분하는 에셋 종류 */
+enum class EPreloadAssetType : uint8
+{
+	Texture,
+	Obj,
+	Fbx,
+	Sound,
+	PhysicalMaterial,
+	Count
+};
+
+/**
+ * FAssetPreloader
+ *
+ * 엔진 시작 시 Data 디렉토리의 에셋을 미리 로드합니다.
+ *
+ * 1. Data 디렉토리를 한 번만 재귀 스캔해 확장자별로 분류
+ * 2. 디바이스가 필요 없는 CPU 단계를 잡 시스템에 디스패치
+ *    - 텍스처: DDS 캐시 검사 및 변환
+ *    - OBJ: 캐시 로드 또는 파싱 + 캐시 저장
+ *    - WAV: 파일 읽기
+ * 3. 게임 스레드는 워커가 일하는 동안 의존 순서대로 직렬 단계를 처리
+ *    물리 재질 → 텍스처 GPU 생성 → FBX (SDK가 스레드 안전하지 않고 텍스처 캐시에 의존)
+ *    → OBJ 머티리얼 / GPU 버퍼 → 사운드 등록
+ * 4. 에셋 종류별 시간 리포트를 로그로 출력
+ */
+class FAssetPreloader
+{
+public:
+	/** 에셋 종류 하나의 시간 */
+	struct FTypeStats
+	{
+		int32 NumFiles = 0;
+		double PrepareMS = 0.0;	// 워커 잡 실행 시간 합 (병렬 실행이므로 벽시계 시간보다 클 수 있음)
+		double FinishMS = 0.0;	// 게임 스레드 직렬 단계 (GPU 리소스 생성, UObject 등록)
+	};
+
+	struct FReport
+	{
+		FTypeStats Types[static_cast<int32>(EPreloadAssetType::Count)];
+		double ScanMS = 0.0;
+		double WaitMS = 0.0;	// 게임 스레드가 CPU 단계 완료를 기다린 시간
+		double TotalMS = 0.0;
+		uint32 NumWorkers = 0;
+	};
+
+	/**
+	 * 전체 프리로드를 실행합니다.
+	 * FJobSystem, PhysX(Convex 생성), 렌더 디바이스 초기화 이후 게임 스레드에서 호출해야 합니다.
+	 */
+	static void PreloadAll();
+
+	/** 마지막 PreloadAll 리포트 */
+	static const FReport& GetLastReport() { return LastReport; }
+
+private:
+	static FReport LastReport;
+};
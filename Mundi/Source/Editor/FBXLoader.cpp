@@ -7,6 +7,7 @@
 #include "WindowsBinReader.h"
 #include "WindowsBinWriter.h"
 #include "PathUtils.h"
+#include "CookedMeshCache.h"
 #include "AnimSequence.h"
 #include "AnimDataModel.h"
 #include "ResourceManager.h"
@@ -104,99 +105,60 @@ UFbxLoader::UFbxLoader()
 
 }
 
-void UFbxLoader::PreLoad()
+void UFbxLoader::PreLoad(const TArray<FString>& MeshFbxFiles, const TArray<FString>& AnimationOnlyFbxFiles)
 {
 	UFbxLoader& FbxLoader = GetInstance();
 
-	const fs::path DataDir(UTF8ToWide(GDataDir));
-
-	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
-	{
-		UE_LOG("UFbxLoader::Preload: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
-		return;
-	}
-
 	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
-	TArray<FString> AnimationOnlyFbxFiles; // 메시 없는 애니메이션 전용 FBX 파일 리스트
 
 	// ===== 첫 번째 패스: 메시 있는 FBX 로드 (스켈레톤 확보) =====
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
+	for (const FString& PathStr : MeshFbxFiles)
 	{
-		if (!Entry.is_regular_file())
-			continue;
+		// 1. FBX 메시 로드
+		USkeletalMesh* SkeletalMesh = FbxLoader.LoadFbxMesh(PathStr);
 
-		const fs::path& Path = Entry.path();
-		FString Extension = WideToUTF8(Path.extension().wstring());
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".fbx")
+		// 2. 메시 로드 성공하고 스켈레톤이 있는 경우: 애니메이션도 로드
+		if (SkeletalMesh)
 		{
-			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
+			const FSkeleton* Skeleton = SkeletalMesh->GetSkeleton();
+			if (Skeleton && !Skeleton->Bones.IsEmpty())
 			{
-				ProcessedFiles.insert(PathStr);
+				// 3. FBX 파일에서 모든 애니메이션 스택 이름 가져오기
+				TArray<FString> AnimStackNames = FbxLoader.GetAnimationStackNames(PathStr);
 
-				// 0. 먼저 FBX에 메시가 있는지 확인 (ResourceManager에 빈 메시 등록 방지)
-				if (!FbxLoader.HasMeshInFbx(PathStr))
+				// 4. 각 애니메이션 스택 로드
+				for (const FString& AnimStackName : AnimStackNames)
 				{
-					// 메시 없음 → 애니메이션 전용 FBX일 수 있음
-					AnimationOnlyFbxFiles.Add(PathStr);
-					++LoadedCount;
-					continue;
-				}
-
-				// 1. FBX 메시 로드 (메시가 있는 경우에만)
-				USkeletalMesh* SkeletalMesh = FbxLoader.LoadFbxMesh(PathStr);
-
-				// 2. 메시 로드 성공하고 스켈레톤이 있는 경우: 애니메이션도 로드
-				if (SkeletalMesh)
-				{
-					const FSkeleton* Skeleton = SkeletalMesh->GetSkeleton();
-					if (Skeleton && !Skeleton->Bones.IsEmpty())
+					UAnimSequence* AnimSequence = FbxLoader.LoadFbxAnimation(PathStr, Skeleton, AnimStackName);
+					if (AnimSequence)
 					{
-						// 3. FBX 파일에서 모든 애니메이션 스택 이름 가져오기
-						TArray<FString> AnimStackNames = FbxLoader.GetAnimationStackNames(PathStr);
-
-						// 4. 각 애니메이션 스택 로드
-						for (const FString& AnimStackName : AnimStackNames)
-						{
-							UAnimSequence* AnimSequence = FbxLoader.LoadFbxAnimation(PathStr, Skeleton, AnimStackName);
-							if (AnimSequence)
-							{
-								UE_LOG("UFbxLoader::PreLoad: Loaded animation '%s' from '%s'",
-									AnimStackName.c_str(), PathStr.c_str());
-							}
-						}
-
-						if (!AnimStackNames.IsEmpty())
-						{
-							UE_LOG("UFbxLoader::PreLoad: Total %d animations loaded from '%s'",
-								AnimStackNames.Num(), PathStr.c_str());
-						}
-					}
-					else
-					{
-						// 메시는 있지만 스켈레톤이 없음 (스태틱 메시?)
-						UE_LOG("UFbxLoader::PreLoad: Mesh loaded but no skeleton in '%s'", PathStr.c_str());
+						UE_LOG("UFbxLoader::PreLoad: Loaded animation '%s' from '%s'",
+							AnimStackName.c_str(), PathStr.c_str());
 					}
 				}
 
-				++LoadedCount;
+				if (!AnimStackNames.IsEmpty())
+				{
+					UE_LOG("UFbxLoader::PreLoad: Total %d animations loaded from '%s'",
+						AnimStackNames.Num(), PathStr.c_str());
+				}
+			}
+			else
+			{
+				// 메시는 있지만 스켈레톤이 없음 (스태틱 메시?)
+				UE_LOG("UFbxLoader::PreLoad: Mesh loaded but no skeleton in '%s'", PathStr.c_str());
 			}
 		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(WideToUTF8(Path.wstring()));
-		}
+
+		++LoadedCount;
 	}
 
-	// ===== 두 번째 패스: 메시 없는 FBX에서 애니메이션만 로드 =====
+	// ===== 두 번째 패스: 메시 없는 FBX에서 애니메이션만 로드 (첫 번째 패스의 스켈레톤에 의존) =====
 	size_t AnimOnlyLoadedCount = 0;
 	for (const FString& PathStr : AnimationOnlyFbxFiles)
 	{
+		++LoadedCount;
+
 		// 1. 애니메이션 스택 확인
 		TArray<FString> AnimStackNames = FbxLoader.GetAnimationStackNames(PathStr);
 		if (AnimStackNames.IsEmpty())
@@ -240,8 +202,7 @@ void UFbxLoader::PreLoad()
 	RESOURCE.SetSkeletalMeshs();
 	RESOURCE.SetAnimations();
 
-	UE_LOG("UFbxLoader::Preload: Loaded %zu .fbx files (%zu animation-only) from %s",
-		LoadedCount, AnimOnlyLoadedCount, WideToUTF8(DataDir.wstring()).c_str());
+	UE_LOG("UFbxLoader::Preload: Loaded %zu .fbx files (%zu animation-only)", LoadedCount, AnimOnlyLoadedCount);
 }
 
 
@@ -300,96 +261,34 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 		std::filesystem::create_directories(CacheFileDirPath.parent_path());
 	}
 
-	bool bLoadedFromCache = false;
-	
-
-	// 2. 캐시 유효성 검사
-	bool bShouldRegenerate = true;
-	if (std::filesystem::exists(UTF8ToWide(BinPathFileName)))
-	{
-		try
-		{
-			auto binTime = std::filesystem::last_write_time(UTF8ToWide(BinPathFileName));
-			auto fbxTime = std::filesystem::last_write_time(UTF8ToWide(NormalizedPath));
+	// 2. 캐시 로드 시도 (헤더의 SourceHash가 FBX 파일 내용과 다르면 재생성)
+	const uint64 SourceHash = FCookedMeshCache::HashSourceFile(NormalizedPath);
 
-			// FBX 파일이 캐시보다 오래되었으면 캐시 사용
-			if (fbxTime <= binTime)
-			{
-				bShouldRegenerate = false;
-			}
-		}
-		catch (const std::filesystem::filesystem_error& e)
-		{
-			UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-			bShouldRegenerate = true;
-		}
-	}
-
-	// 3. 캐시에서 로드 시도
-	if (!bShouldRegenerate)
+	MeshData = new FSkeletalMeshData();
+	if (FCookedMeshCache::LoadSkeletalMesh(BinPathFileName, SourceHash, *MeshData, MaterialInfos))
 	{
-		UE_LOG("Attempting to load FBX '%s' from cache.", NormalizedPath.c_str());
-		try
+		// 3. 캐시에 포함된 머티리얼 등록
+		UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
+		for (const FMaterialInfo& MaterialInfo : MaterialInfos)
 		{
-			MeshData = new FSkeletalMeshData();
-			MeshData->PathFileName = NormalizedPath;
-
-			// FBX 파일의 이름을 스켈레톤 이름으로 사용
-			std::filesystem::path p(UTF8ToWide(NormalizedPath));
-			MeshData->Skeleton.Name = WideToUTF8(p.stem().wstring());
-
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
+			if (MaterialInfo.MaterialName.empty() || UResourceManager::GetInstance().Get<UMaterial>(MaterialInfo.MaterialName))
 			{
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *MeshData;
-			Reader.Close();
-
-			for (int Index = 0; Index < MeshData->GroupInfos.Num(); Index++)
-			{
-				if (MeshData->GroupInfos[Index].InitialMaterialName.empty())
-					continue;
-				const FString& MaterialName = MeshData->GroupInfos[Index].InitialMaterialName;
-				const FString& MaterialFilePath = ConvertDataPathToCachePath(MaterialName + ".mat.bin");
-				FWindowsBinReader MatReader(MaterialFilePath);
-				if (!MatReader.IsOpen())
-				{
-					throw std::runtime_error("Failed to open material bin file for reading.");
-				}
-				// for bin Load
-				FMaterialInfo MaterialInfo{};
-				Serialization::ReadAsset<FMaterialInfo>(MatReader, &MaterialInfo);
-
-				UMaterial* NewMaterial = NewObject<UMaterial>();
-
-				UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
-				NewMaterial->SetMaterialInfo(MaterialInfo);
-				NewMaterial->SetShader(Default->GetShader());
-				NewMaterial->SetShaderMacros(Default->GetShaderMacros());
-				UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
+				continue;
 			}
 
-			MeshData->CacheFilePath = BinPathFileName;
-			bLoadedFromCache = true;
-
-			UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
-			return MeshData;
+			UMaterial* NewMaterial = NewObject<UMaterial>();
+			NewMaterial->SetMaterialInfo(MaterialInfo);
+			NewMaterial->SetShader(Default->GetShader());
+			NewMaterial->SetShaderMacros(Default->GetShaderMacros());
+			UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
 		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading FBX from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPath.c_str());
 
-			std::filesystem::remove(UTF8ToWide(BinPathFileName));
-			if (MeshData)
-			{
-				delete MeshData;
-				MeshData = nullptr;
-			}
-			bLoadedFromCache = false;
-		}
+		UE_LOG("Successfully loaded FBX '%s' from cache.", NormalizedPath.c_str());
+		return MeshData;
 	}
+	delete MeshData;
+	MeshData = nullptr;
+	MaterialInfos.clear();
 
 	// 4. 캐시 로드 실패 시 FBX 파싱
 	UE_LOG("Regenerating cache for FBX '%s'...", NormalizedPath.c_str());
@@ -511,29 +410,15 @@ FSkeletalMeshData* UFbxLoader::LoadFbxMeshAsset(const FString& FilePath)
 	}
 
 #ifdef USE_OBJ_CACHE
-	// 5. 캐시 저장
-	try
+	// 5. 캐시 저장 (머티리얼도 같은 파일에 포함)
+	if (FCookedMeshCache::SaveSkeletalMesh(BinPathFileName, SourceHash, *MeshData, MaterialInfos))
 	{
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *MeshData;
-		Writer.Close();
-
-		for (FMaterialInfo& MaterialInfo : MaterialInfos)
-		{
-			
-			const FString MaterialFilePath = ConvertDataPathToCachePath(MaterialInfo.MaterialName + ".mat.bin");
-			FWindowsBinWriter MatWriter(MaterialFilePath);
-			Serialization::WriteAsset<FMaterialInfo>(MatWriter, &MaterialInfo);
-			MatWriter.Close();
-		}
-
 		MeshData->CacheFilePath = BinPathFileName;
-
 		UE_LOG("Cache regeneration complete for FBX '%s'.", NormalizedPath.c_str());
 	}
-	catch (const std::exception& e)
+	else
 	{
-		UE_LOG("Failed to save FBX cache: %s", e.what());
+		UE_LOG("Failed to save FBX cache: %s", BinPathFileName.c_str());
 	}
 #endif // USE_OBJ_CACHE
 
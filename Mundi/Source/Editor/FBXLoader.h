@@ -10,7 +10,12 @@ public:
 	static UFbxLoader& GetInstance();
 	UFbxLoader();
 
-	static void PreLoad();
+	/**
+	 * 시작 시 스캔된 FBX 파일들을 로드 (FBX SDK가 스레드 안전하지 않으므로 게임 스레드에서 순차 실행)
+	 * @param MeshFbxFiles 메시가 있는 FBX (스켈레탈 메시 + 포함된 애니메이션)
+	 * @param AnimationOnlyFbxFiles 메시 없는 애니메이션 전용 FBX (첫 번째 패스에서 확보한 스켈레톤에 매칭)
+	 */
+	static void PreLoad(const TArray<FString>& MeshFbxFiles, const TArray<FString>& AnimationOnlyFbxFiles);
 
 	USkeletalMesh* LoadFbxMesh(const FString& FilePath);
 
@@ -5,11 +5,10 @@
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
 #include "Enums.h"
-#include "WindowsBinReader.h"
-#include "WindowsBinWriter.h"
-#include "FBXLoader.h"
+#include "CookedMeshCache.h"
+#include "ObjParser.h"
+#include "WindowsMappedFile.h"
 #include <filesystem>
-#include <unordered_set>
 
 namespace fs = std::filesystem;
 
@@ -165,113 +164,20 @@ bool GetMtlDependencies(const FString& ObjPath, TArray<FString>& OutMtlFilePaths
 }
 
 /**
- * @brief 캐시 파일이 원본(.obj) 및 모든 의존성(.mtl) 파일보다 최신인지 검사합니다.
- * @param ObjPath 원본 .obj 파일의 경로입니다.
- * @param BinPath 메쉬 데이터 캐시(.obj.bin) 파일의 경로입니다.
- * @param MatBinPath 머티리얼 데이터 캐시(.mtl.bin) 파일의 경로입니다.
- * @return 캐시를 다시 생성해야 하면 true, 캐시가 유효하면 false를 반환합니다.
+ * @brief 원본 .obj와 의존하는 모든 .mtl 파일의 내용 해시를 계산합니다.
+ * 캐시 헤더의 SourceHash와 비교해 유효성을 판단합니다. (수정 시간은 복사/체크아웃 시 신뢰할 수 없음)
  */
-bool ShouldRegenerateCache(const FString& ObjPath, const FString& BinPath, const FString& MatBinPath)
+static uint64 ComputeObjSourceHash(const FString& ObjPath)
 {
-	// 캐시 파일 중 하나라도 존재하지 않으면 무조건 재생성해야 합니다.
-	if (!fs::exists(UTF8ToWide(BinPath)) || !fs::exists(UTF8ToWide(MatBinPath)))
-	{
-		return true;
-	}
-
-	try
-	{
-		auto BinTimestamp = fs::last_write_time(UTF8ToWide(BinPath));
-
-		// 1. 원본 .obj 파일의 수정 시간을 캐시 파일과 비교합니다.
-		if (fs::last_write_time(UTF8ToWide(ObjPath)) > BinTimestamp)
-		{
-			return true;
-		}
-
-		// 2. .obj 파일을 빠르게 스캔하여 의존하는 .mtl 파일 목록을 가져옵니다.
-		TArray<FString> MtlDependencies;
-		if (!GetMtlDependencies(ObjPath, MtlDependencies))
-		{
-			return true; // .obj 파일을 읽을 수 없으면 안전을 위해 캐시를 재생성합니다.
-		}
+	uint64 SourceHash = FCookedMeshCache::HashSourceFile(ObjPath);
 
-		// 3. 각 .mtl 파일의 수정 시간을 캐시 파일과 비교합니다.
-		for (const FString& MtlPath : MtlDependencies)
-		{
-			// .mtl 파일이 존재하지 않거나 캐시보다 최신 버전이면 재생성합니다.
-			if (!fs::exists(UTF8ToWide(MtlPath)) || fs::last_write_time(UTF8ToWide(MtlPath)) > BinTimestamp)
-			{
-				return true;
-			}
-		}
-	}
-	catch (const fs::filesystem_error& e)
+	TArray<FString> MtlDependencies;
+	GetMtlDependencies(ObjPath, MtlDependencies);
+	for (const FString& MtlPath : MtlDependencies)
 	{
-		// 파일 시스템 오류(예: 접근 권한 없음) 발생 시 안전하게 캐시를 재생성합니다.
-		UE_LOG("Filesystem error during cache validation: %s. Forcing regeneration.", e.what());
-		return true;
+		SourceHash = FCookedMeshCache::HashSourceFile(MtlPath, SourceHash);
 	}
-
-	// 모든 검사를 통과하면 캐시는 유효합니다.
-	return false;
-}
-
-void FObjManager::Preload()
-{
-	const fs::path DataDir(UTF8ToWide(GDataDir));
-
-	if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
-	{
-		UE_LOG("FObjManager::Preload: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
-		return;
-	}
-
-	size_t LoadedCount = 0;
-	std::unordered_set<FString> ProcessedFiles; // 중복 로딩 방지
-
-	for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
-	{
-		if (!Entry.is_regular_file())
-			continue;
-
-		const fs::path& Path = Entry.path();
-		FString Extension = WideToUTF8(Path.extension().wstring());
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-		if (Extension == ".obj"|| Extension == ".fbx")
-		{
-			FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
-
-			// 이미 처리된 파일인지 확인
-			if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-			{
-				ProcessedFiles.insert(PathStr);
-
-				// FBX 파일인 경우 메시가 있는지 먼저 확인 (애니메이션 전용 FBX 제외)
-				if (Extension == ".fbx")
-				{
-					if (!UFbxLoader::GetInstance().HasMeshInFbx(PathStr))
-					{
-						// 메시 없는 FBX는 StaticMesh로 로드하지 않음
-						continue;
-					}
-				}
-
-				LoadObjStaticMesh(PathStr);
-				++LoadedCount;
-			}
-		}
-		else if (Extension == ".dds" || Extension == ".jpg" || Extension == ".png")
-		{
-			UResourceManager::GetInstance().Load<UTexture>(WideToUTF8(Path.wstring())); // 데칼 텍스쳐를 ui에서 고를 수 있게 하기 위해 임시로 만듬.
-		}
-	}
-
-	// 4) 모든 StaticMeshs 가져오기
-	RESOURCE.SetStaticMeshs();
-
-	UE_LOG("FObjManager::Preload: Loaded %zu .obj files from %s", LoadedCount, WideToUTF8(DataDir.wstring()).c_str());
+	return SourceHash;
 }
 
 void FObjManager::Clear()
@@ -295,6 +201,27 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		return *It;
 	}
 
+	FString DefaultMaterialName;
+	if (UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial())
+	{
+		DefaultMaterialName = DefaultMaterial->GetMaterialInfo().MaterialName;
+	}
+
+	// 2~4. 캐시 로드 또는 파싱 (CPU 단계)
+	TArray<FMaterialInfo> MaterialInfos;
+	FStaticMesh* NewFStaticMesh = PrepareObjStaticMeshAsset(NormalizedPathStr, DefaultMaterialName, MaterialInfos);
+	if (!NewFStaticMesh)
+	{
+		return nullptr;
+	}
+
+	// 5. 머티리얼 생성 및 메모리 캐시 등록
+	return RegisterObjStaticMeshAsset(NormalizedPathStr, NewFStaticMesh, MaterialInfos);
+}
+
+// 전역 상태(ResourceManager, ObjStaticMeshMap)를 건드리지 않으므로 워커 스레드에서 호출해도 안전
+FStaticMesh* FObjManager::PrepareObjStaticMeshAsset(const FString& NormalizedPathStr, const FString& DefaultMaterialName, TArray<FMaterialInfo>& OutMaterialInfos)
+{
 	std::filesystem::path Path(UTF8ToWide(NormalizedPathStr));
 
 	// 2. 파일 경로 설정
@@ -313,7 +240,6 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	FString CachePathStr = ConvertDataPathToCachePath(NormalizedPathStr);
 
 	const FString BinPathFileName = CachePathStr + ".bin";
-	const FString MatBinPathFileName = CachePathStr + ".mat.bin";
 
 	// 캐시를 저장할 디렉토리가 없으면 생성
 	fs::path CacheFileDirPath(UTF8ToWide(BinPathFileName));
@@ -322,63 +248,19 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		fs::create_directories(CacheFileDirPath.parent_path());
 	}
 
-	// 3. 캐시 데이터 로드 시도 및 실패 시 재생성 로직
+	// 3. 캐시 데이터 로드 시도 (헤더의 SourceHash가 원본 내용과 다르면 재생성)
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
-	bool bLoadedSuccessfully = false;
+	TArray<FMaterialInfo>& MaterialInfos = OutMaterialInfos;
+	const uint64 SourceHash = ComputeObjSourceHash(NormalizedPathStr);
 
-	// 캐시가 오래되었는지 먼저 확인
-	bool bShouldRegenerate = ShouldRegenerateCache(NormalizedPathStr, BinPathFileName, MatBinPathFileName);
-
-	if (!bShouldRegenerate)
+	bool bLoadedSuccessfully = FCookedMeshCache::LoadStaticMesh(BinPathFileName, SourceHash, *NewFStaticMesh, MaterialInfos);
+	if (bLoadedSuccessfully)
 	{
-		UE_LOG("Attempting to load '%s' from cache.", NormalizedPathStr.c_str());
-		try
-		{
-			// 캐시에서 FStaticMesh 데이터 로드
-			FWindowsBinReader Reader(BinPathFileName);
-			if (!Reader.IsOpen())
-			{
-				// Reader 생성자에서 예외를 던지지 않는 경우를 대비한 명시적 실패 처리
-				throw std::runtime_error("Failed to open bin file for reading.");
-			}
-			Reader << *NewFStaticMesh;
-			Reader.Close();
-
-			// 캐시에서 Material 데이터 로드
-			FWindowsBinReader MatReader(MatBinPathFileName);
-			if (!MatReader.IsOpen())
-			{
-				throw std::runtime_error("Failed to open material bin file for reading.");
-			}
-			Serialization::ReadArray<FMaterialInfo>(MatReader, MaterialInfos);
-			MatReader.Close();
-
-			NewFStaticMesh->CacheFilePath = BinPathFileName;
-
-			// 모든 로드가 성공적으로 완료됨
-			bLoadedSuccessfully = true;
-			UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
-		}
-		catch (const std::exception& e)
-		{
-			UE_LOG("Error loading from cache: %s. Cache might be corrupt or incompatible.", e.what());
-			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPathStr.c_str());
-
-			// 실패 시 생성 중이던 객체 메모리 정리
-			delete NewFStaticMesh;
-			NewFStaticMesh = nullptr; // 포인터를 nullptr로 설정하여 이중 삭제 방지
-
-			// 손상된 캐시 파일 삭제
-			fs::remove(UTF8ToWide(BinPathFileName));
-			fs::remove(UTF8ToWide(MatBinPathFileName));
-
-			bLoadedSuccessfully = false;
-		}
+		UE_LOG("Successfully loaded '%s' from cache.", NormalizedPathStr.c_str());
 	}
 #else
 	FStaticMesh* NewFStaticMesh = new FStaticMesh();
-	TArray<FMaterialInfo> MaterialInfos;
+	TArray<FMaterialInfo>& MaterialInfos = OutMaterialInfos;
 	bool bLoadedSuccessfully = false;
 #endif // USE_OBJ_CACHE
 
@@ -390,8 +272,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 				UE_LOG("No materials found for '%s'. Assigning default 'uberlit' material.", NormalizedPathStr.c_str());
 
 				FMaterialInfo DefaultMaterialInfo;
-				UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
-				DefaultMaterialInfo.MaterialName = DefaultMaterial->GetMaterialInfo().MaterialName;
+				DefaultMaterialInfo.MaterialName = DefaultMaterialName;
 				Materials.Add(DefaultMaterialInfo);
 
 				TArray<FGroupInfo>& GroupInfos = Mesh->GroupInfos;
@@ -426,42 +307,13 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos);
 
 #ifdef USE_OBJ_CACHE
-		// 새로운 캐시 파일(.bin) 저장 (이제 올바른 데이터가 저장됨)
-		FWindowsBinWriter Writer(BinPathFileName);
-		Writer << *NewFStaticMesh;
-		Writer.Close();
-
-		FWindowsBinWriter MatWriter(MatBinPathFileName);
-		Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-		MatWriter.Close();
-
-		UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
-#endif // USE_OBJ_CACHE
-	}
-	else
-	{
-		// 캐시 로드에 성공한 경우(bLoadedSuccessfully == true)
-		// 구버전 캐시(기본 머티리얼이 없는)일 수 있으므로, 동일한 검사를 수행합니다.
-		if (EnsureDefaultMaterial(NewFStaticMesh, MaterialInfos))
+		// 새로운 캐시 파일(.bin) 저장 (머티리얼도 같은 파일에 포함)
+		if (FCookedMeshCache::SaveStaticMesh(BinPathFileName, SourceHash, *NewFStaticMesh, MaterialInfos))
 		{
-#ifdef USE_OBJ_CACHE
-			// 변경된 경우, 캐시를 갱신합니다.
-			UE_LOG("Updating outdated cache for '%s' with default material.", NormalizedPathStr.c_str());
-			try
-			{
-				FWindowsBinWriter Writer(BinPathFileName);
-				Writer << *NewFStaticMesh;
-				Writer.Close();
-				FWindowsBinWriter MatWriter(MatBinPathFileName);
-				Serialization::WriteArray<FMaterialInfo>(MatWriter, MaterialInfos);
-				MatWriter.Close();
-			}
-			catch (const std::exception& e)
-			{
-				UE_LOG("Failed to update cache for default material: %s", e.what());
-			}
-#endif // USE_OBJ_CACHE
+			NewFStaticMesh->CacheFilePath = BinPathFileName;
+			UE_LOG("Cache regeneration complete for '%s'.", NormalizedPathStr.c_str());
 		}
+#endif // USE_OBJ_CACHE
 	}
 
 	// 4. 머티리얼 및 텍스처 경로 처리 (공통 로직)
@@ -497,6 +349,19 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 			ResolveAssetRelativePath(MaterialInfo.EmissiveTextureFileName, ObjBaseDir);
 	}
 
+	return NewFStaticMesh;
+}
+
+// 게임 스레드 전용: UMaterial 생성과 메모리 캐시 등록
+FStaticMesh* FObjManager::RegisterObjStaticMeshAsset(const FString& NormalizedPathStr, FStaticMesh* InStaticMesh, const TArray<FMaterialInfo>& InMaterialInfos)
+{
+	// 준비 도중 같은 경로가 먼저 등록되었으면 기존 에셋을 사용
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(NormalizedPathStr))
+	{
+		delete InStaticMesh;
+		return *It;
+	}
+
 	// 루프가 시작되기 전에 기본 UberLit 셰이더 포인터를 한 번만 가져옵니다.
 	UShader* DefaultUberlitShader = nullptr;
 	UMaterial* DefaultMaterial = UResourceManager::GetInstance().GetDefaultMaterial();
@@ -510,7 +375,7 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 		UE_LOG("CRITICAL: Default Uberlit Shader not found. OBJ materials may fail.");
 	}
 
-	for (const FMaterialInfo& InMaterialInfo : MaterialInfos)
+	for (const FMaterialInfo& InMaterialInfo : InMaterialInfos)
 	{
 		if (!UResourceManager::GetInstance().Get<UMaterial>(InMaterialInfo.MaterialName))
 		{
@@ -529,8 +394,8 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 
 	// 5. 메모리 캐시에 등록하고 반환
-	ObjStaticMeshMap.Add(NormalizedPathStr, NewFStaticMesh);
-	return NewFStaticMesh;
+	ObjStaticMeshMap.Add(NormalizedPathStr, InStaticMesh);
+	return InStaticMesh;
 }
 
 void FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMesh* InStaticMesh)
@@ -578,162 +443,44 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
-	FString MtlFileName;
-
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
 	size_t pos = InFileName.find_last_of("/\\");
 	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
 
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	// 파일 전체를 매핑해 버퍼에서 바로 파싱합니다. (0바이트 파일은 매핑할 수 없으므로 빈 버퍼로 처리)
+	FWindowsMappedFile ObjFile;
+	if (!ObjFile.Open(InFileName))
 	{
-		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
-		return false;
-	}
-
-	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
-
-	FString line;
-	while (std::getline(FileIn, line))
-	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
+		const FWideString WidePath = UTF8ToWide(InFileName);
+		std::error_code ErrorCode;
+		if (!fs::exists(WidePath, ErrorCode))
 		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
+			UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
+			return false;
 		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
+
+		// 내용이 있는데 매핑하지 못했으면 (잠김 / 권한 없음) 빈 모델로 캐시 / 등록되지 않도록 실패 처리
+		const uintmax_t FileSize = fs::file_size(WidePath, ErrorCode);
+		if (ErrorCode || FileSize > 0)
 		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+			UE_LOG("Error: Failed to map '%s' (locked or access denied)", InFileName.c_str());
+			return false;
 		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
+	}
 
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
+	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
 
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
+	const char* ObjBegin = reinterpret_cast<const char*>(ObjFile.GetData());
+	FString MtlLibName;
+	FObjParser::ParseGeometry(ObjBegin, ObjBegin + ObjFile.GetSize(), bIsRightHanded, true, *OutObjInfo, MtlLibName);
+	ObjFile.Close();
 
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
-	}
+	FString MtlFileName = MtlLibName.empty() ? FString() : objDir + MtlLibName;
+	uint32 subsetCount = static_cast<uint32>(OutObjInfo->MaterialNames.size());
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo->PositionIndices.size());
+	const bool bHasTexcoord = !OutObjInfo->TexCoords.empty();
+	const bool bHasNormal = !OutObjInfo->Normals.empty();
 
 	if (subsetCount == 0)
 	{
@@ -757,8 +504,6 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
 	}
 
-	FileIn.close();
-
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
 
@@ -771,7 +516,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
+	std::ifstream FileIn(WMtlPath);
 
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
@@ -788,6 +533,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	TArray<FString> TempOptions;
 	FString TempTexturePath;
+	FString line;
 
 	while (std::getline(FileIn, line))
 	{
@@ -992,17 +738,3 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		// else: InitialMaterialName은 비어있게 됨 (정상)
 	}
 }
-
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
-{
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
-
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
-
-	return Result;
-}
@@ -48,11 +48,6 @@ public:
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
-
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
-
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
@@ -62,9 +57,20 @@ class FObjManager
 private:
 	static TMap<FString, FStaticMesh*> ObjStaticMeshMap;
 public:
-	static void Preload();
 	static void Clear();
 	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
+
+	/**
+	 * @brief .obj 캐시 로드(없거나 오래되면 파싱 후 캐시 저장)와 텍스처 경로 해석까지의 CPU 단계
+	 * 전역 상태를 건드리지 않으므로 워커 스레드에서 호출할 수 있다. 결과는 RegisterObjStaticMeshAsset으로 넘긴다.
+	 * @param DefaultMaterialName 머티리얼이 없는 메시에 넣을 기본 머티리얼 이름 (게임 스레드에서 미리 조회)
+	 * @return 생성된 FStaticMesh (실패 시 nullptr)
+	 */
+	static FStaticMesh* PrepareObjStaticMeshAsset(const FString& NormalizedPath, const FString& DefaultMaterialName, TArray<FMaterialInfo>& OutMaterialInfos);
+
+	/** @brief 준비된 에셋의 UMaterial을 만들고 메모리 캐시에 등록한다. (게임 스레드 전용) */
+	static FStaticMesh* RegisterObjStaticMeshAsset(const FString& NormalizedPath, FStaticMesh* InStaticMesh, const TArray<FMaterialInfo>& InMaterialInfos);
+
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 
 	// FBX 등 외부에서 생성된 FStaticMesh를 캐시에 등록
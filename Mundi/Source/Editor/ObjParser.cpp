@@ -0,0 +1,721 @@
+﻿#include "pch.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include "WindowsMappedFile.h"
+#include "PathUtils.h"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 청크 파싱
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	enum EObjStream : uint32
+	{
+		Stream_Position,
+		Stream_TexCoord,
+		Stream_Normal,
+		Stream_Count
+	};
+
+	enum class EObjLine : uint8
+	{
+		Empty,
+		Position,
+		TexCoord,
+		Normal,
+		Face,
+		Group,
+		UseMtl,
+		MtlLib,
+		Unknown
+	};
+
+	struct FObjMaterialMarker
+	{
+		uint32 LocalCorner;	// 청크 안에서의 코너 인덱스
+		FString Name;
+	};
+
+	/** 면 코너 하나 (bRelative면 Value는 청크 로컬 기준) */
+	struct FObjCornerRef
+	{
+		uint32 Value[Stream_Count];
+		bool bRelative[Stream_Count];
+	};
+
+	/** 줄 경계로 자른 버퍼 구간 하나의 파싱 결과 */
+	struct FObjChunk
+	{
+		const char* Begin = nullptr;
+		const char* End = nullptr;
+
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+		TArray<uint32> Indices[Stream_Count];
+		TArray<uint32> RelativeSlots[Stream_Count];	// 음수 인덱스로 기록된 코너 위치
+		TArray<FObjMaterialMarker> Materials;
+		FString MtlLibName;
+
+		uint32 NumUnknownLines = 0;
+		FString FirstUnknownLine;
+	};
+
+	inline bool IsBlank(char C)
+	{
+		return C == ' ' || C == '\t' || C == '\r';
+	}
+
+	inline const char* SkipBlanks(const char* P, const char* End)
+	{
+		while (P < End && IsBlank(*P))
+		{
+			++P;
+		}
+		return P;
+	}
+
+	inline const char* SkipToken(const char* P, const char* End)
+	{
+		while (P < End && !IsBlank(*P))
+		{
+			++P;
+		}
+		return P;
+	}
+
+	inline const char* FindLineEnd(const char* P, const char* End)
+	{
+		const void* NewLine = std::memchr(P, '\n', static_cast<size_t>(End - P));
+		return NewLine ? static_cast<const char*>(NewLine) : End;
+	}
+
+	inline const char* TrimLineEnd(const char* Begin, const char* End)
+	{
+		while (End > Begin && IsBlank(End[-1]))
+		{
+			--End;
+		}
+		return End;
+	}
+
+	EObjLine ClassifyLine(const char* Key, const char* KeyEnd)
+	{
+		const size_t Length = static_cast<size_t>(KeyEnd - Key);
+		if (Length == 0 || Key[0] == '#')
+		{
+			return EObjLine::Empty;
+		}
+
+		switch (Key[0])
+		{
+		case 'v':
+			if (Length == 1) return EObjLine::Position;
+			if (Length == 2 && Key[1] == 't') return EObjLine::TexCoord;
+			if (Length == 2 && Key[1] == 'n') return EObjLine::Normal;
+			break;
+		case 'f':
+			if (Length == 1) return EObjLine::Face;
+			break;
+		case 'g':
+			if (Length == 1) return EObjLine::Group;
+			break;
+		case 'u':
+			if (Length == 6 && std::memcmp(Key, "usemtl", 6) == 0) return EObjLine::UseMtl;
+			break;
+		case 'm':
+			if (Length == 6 && std::memcmp(Key, "mtllib", 6) == 0) return EObjLine::MtlLib;
+			break;
+		}
+		return EObjLine::Unknown;
+	}
+
+	inline const char* ParseFloat(const char* P, const char* End, float& Out)
+	{
+		P = SkipBlanks(P, End);
+		if (P < End && *P == '+')
+		{
+			++P;
+		}
+
+		const std::from_chars_result Result = std::from_chars(P, End, Out);
+		if (Result.ec != std::errc())
+		{
+			Out = 0.0f;
+			return SkipToken(P, End);
+		}
+		return Result.ptr;
+	}
+
+	/** 코너 성분 하나 ("//"처럼 비어 있으면 Out을 건드리지 않음) */
+	inline void ParseIndex(const char*& P, const char* End, int32& Out)
+	{
+		const std::from_chars_result Result = std::from_chars(P, End, Out);
+		if (Result.ec == std::errc())
+		{
+			P = Result.ptr;
+		}
+	}
+
+	/** OBJ 인덱스(1 기반, 음수는 상대)를 0 기반으로 바꾼다. 상대 인덱스는 청크 로컬 개수 기준으로 남긴다. */
+	inline void ResolveIndex(int32 Raw, int32 LocalCount, uint32& OutValue, bool& bOutRelative)
+	{
+		if (Raw < 0)
+		{
+			OutValue = static_cast<uint32>(LocalCount + Raw);
+			bOutRelative = true;
+		}
+		else
+		{
+			OutValue = Raw > 0 ? static_cast<uint32>(Raw - 1) : 0;
+			bOutRelative = false;
+		}
+	}
+
+	inline void EmitCorner(FObjChunk& Chunk, const FObjCornerRef& Corner)
+	{
+		for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+		{
+			if (Corner.bRelative[Stream])
+			{
+				Chunk.RelativeSlots[Stream].Add(static_cast<uint32>(Chunk.Indices[Stream].Num()));
+			}
+			Chunk.Indices[Stream].Add(Corner.Value[Stream]);
+		}
+	}
+
+	/** 1패스: 라인 종류별 개수와 삼각형 코너 수를 세어 청크 배열을 예약한다. */
+	void ReserveChunk(FObjChunk& Chunk)
+	{
+		uint32 NumPositions = 0;
+		uint32 NumTexCoords = 0;
+		uint32 NumNormals = 0;
+		uint32 NumCorners = 0;
+
+		const char* P = Chunk.Begin;
+		while (P < Chunk.End)
+		{
+			const char* LineEnd = FindLineEnd(P, Chunk.End);
+			const char* Key = SkipBlanks(P, LineEnd);
+			const char* KeyEnd = SkipToken(Key, LineEnd);
+
+			switch (ClassifyLine(Key, KeyEnd))
+			{
+			case EObjLine::Position: ++NumPositions; break;
+			case EObjLine::TexCoord: ++NumTexCoords; break;
+			case EObjLine::Normal: ++NumNormals; break;
+			case EObjLine::Face:
+			{
+				uint32 NumTokens = 0;
+				const char* Q = SkipBlanks(KeyEnd, LineEnd);
+				while (Q < LineEnd && *Q != '#')
+				{
+					++NumTokens;
+					Q = SkipBlanks(SkipToken(Q, LineEnd), LineEnd);
+				}
+				if (NumTokens >= 3)
+				{
+					NumCorners += (NumTokens - 2) * 3;
+				}
+				break;
+			}
+			default:
+				break;
+			}
+			P = LineEnd + 1;
+		}
+
+		Chunk.Positions.reserve(NumPositions);
+		Chunk.TexCoords.reserve(NumTexCoords);
+		Chunk.Normals.reserve(NumNormals);
+		for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+		{
+			Chunk.Indices[Stream].reserve(NumCorners);
+		}
+	}
+
+	/** 2패스: 청크의 라인을 파싱한다. (청크끼리 공유 상태가 없어 워커에서 병렬 실행) */
+	void ParseChunk(FObjChunk& Chunk, bool bIsRightHanded)
+	{
+		ReserveChunk(Chunk);
+
+		TArray<FObjCornerRef> FaceCorners;
+		const char* P = Chunk.Begin;
+		while (P < Chunk.End)
+		{
+			const char* LineEnd = FindLineEnd(P, Chunk.End);
+			const char* Key = SkipBlanks(P, LineEnd);
+			const char* KeyEnd = SkipToken(Key, LineEnd);
+			const char* Args = SkipBlanks(KeyEnd, LineEnd);
+
+			switch (ClassifyLine(Key, KeyEnd))
+			{
+			case EObjLine::Position: // 정점 좌표 (v x y z)
+			{
+				float X, Y, Z;
+				Args = ParseFloat(Args, LineEnd, X);
+				Args = ParseFloat(Args, LineEnd, Y);
+				ParseFloat(Args, LineEnd, Z);
+				Chunk.Positions.Add(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+				break;
+			}
+			case EObjLine::TexCoord: // 텍스처 좌표 (vt u v)
+			{
+				float U, V;
+				Args = ParseFloat(Args, LineEnd, U);
+				ParseFloat(Args, LineEnd, V);
+				// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+				Chunk.TexCoords.Add(FVector2D(U, 1.0f - V));
+				break;
+			}
+			case EObjLine::Normal: // 법선 (vn x y z)
+			{
+				float X, Y, Z;
+				Args = ParseFloat(Args, LineEnd, X);
+				Args = ParseFloat(Args, LineEnd, Y);
+				ParseFloat(Args, LineEnd, Z);
+				Chunk.Normals.Add(bIsRightHanded ? FVector(X, -Y, Z) : FVector(X, Y, Z));
+				break;
+			}
+			case EObjLine::Face: // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+			{
+				const int32 LocalCounts[Stream_Count] = { Chunk.Positions.Num(), Chunk.TexCoords.Num(), Chunk.Normals.Num() };
+
+				FaceCorners.clear();
+				const char* Q = Args;
+				while (Q < LineEnd && *Q != '#')
+				{
+					const char* TokenEnd = SkipToken(Q, LineEnd);
+
+					int32 Raw[Stream_Count] = { 0, 0, 0 };
+					const char* C = Q;
+					ParseIndex(C, TokenEnd, Raw[Stream_Position]);
+					for (uint32 Stream = Stream_TexCoord; Stream < Stream_Count && C < TokenEnd && *C == '/'; ++Stream)
+					{
+						++C;
+						ParseIndex(C, TokenEnd, Raw[Stream]);
+					}
+
+					FObjCornerRef Corner;
+					for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+					{
+						ResolveIndex(Raw[Stream], LocalCounts[Stream], Corner.Value[Stream], Corner.bRelative[Stream]);
+					}
+					FaceCorners.Add(Corner);
+
+					Q = SkipBlanks(TokenEnd, LineEnd);
+				}
+
+				// 4각형 이상의 폴리곤은 팬으로 분할
+				for (int32 i = 1; i + 1 < FaceCorners.Num(); ++i)
+				{
+					EmitCorner(Chunk, FaceCorners[0]);
+					if (bIsRightHanded)
+					{
+						EmitCorner(Chunk, FaceCorners[i + 1]);
+						EmitCorner(Chunk, FaceCorners[i]);
+					}
+					else
+					{
+						EmitCorner(Chunk, FaceCorners[i]);
+						EmitCorner(Chunk, FaceCorners[i + 1]);
+					}
+				}
+				break;
+			}
+			case EObjLine::Group:
+				// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+				break;
+			case EObjLine::UseMtl:
+			{
+				FObjMaterialMarker Marker;
+				Marker.LocalCorner = static_cast<uint32>(Chunk.Indices[Stream_Position].Num());
+				Marker.Name = FString(Args, TrimLineEnd(Args, LineEnd));
+				Chunk.Materials.Add(std::move(Marker));
+				break;
+			}
+			case EObjLine::MtlLib:
+				Chunk.MtlLibName = FString(Args, TrimLineEnd(Args, LineEnd));
+				break;
+			case EObjLine::Unknown:
+				if (Chunk.NumUnknownLines++ == 0)
+				{
+					Chunk.FirstUnknownLine = FString(Key, TrimLineEnd(Key, LineEnd));
+				}
+				break;
+			default:
+				break;
+			}
+			P = LineEnd + 1;
+		}
+	}
+
+	/** 버퍼를 NumChunks개의 줄 경계 구간으로 나눈다. */
+	void SplitChunks(const char* Begin, const char* End, int32 NumChunks, TArray<FObjChunk>& OutChunks)
+	{
+		const size_t Size = static_cast<size_t>(End - Begin);
+		OutChunks.resize(NumChunks);
+
+		const char* ChunkBegin = Begin;
+		for (int32 i = 0; i < NumChunks; ++i)
+		{
+			const char* ChunkEnd = End;
+			if (i + 1 < NumChunks)
+			{
+				const char* Target = std::max(ChunkBegin, Begin + Size * (i + 1) / NumChunks);
+				ChunkEnd = FindLineEnd(Target, End);
+				if (ChunkEnd < End)
+				{
+					++ChunkEnd;	// '\n'까지 포함
+				}
+			}
+			OutChunks[i].Begin = ChunkBegin;
+			OutChunks[i].End = ChunkEnd;
+			ChunkBegin = ChunkEnd;
+		}
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FObjParser
+// ────────────────────────────────────────────────────────────────────────────
+
+void FObjParser::ParseGeometry(const char* Begin, const char* End, bool bIsRightHanded, bool bAllowParallel,
+	FObjInfo& OutObjInfo, FString& OutMtlLibName)
+{
+	// UTF-8 BOM 건너뛰기
+	if (End - Begin >= 3 && std::memcmp(Begin, "\xEF\xBB\xBF", 3) == 0)
+	{
+		Begin += 3;
+	}
+
+	const size_t Size = static_cast<size_t>(End - Begin);
+	int32 NumChunks = 1;
+	if (bAllowParallel && Size >= MinParallelBytes && FJobSystem::GetNumWorkers() > 0)
+	{
+		const size_t MaxChunks = static_cast<size_t>(FJobSystem::GetNumWorkers()) + 1;
+		NumChunks = static_cast<int32>(std::max<size_t>(1, std::min(MaxChunks, Size / MinChunkBytes)));
+	}
+
+	// 1. 청크별 개수 세기 + 파싱 (청크가 하나면 호출 스레드에서 바로 실행)
+	TArray<FObjChunk> Chunks;
+	SplitChunks(Begin, End, NumChunks, Chunks);
+	FJobSystem::ParallelFor(NumChunks, 1, [&Chunks, bIsRightHanded](int32 Index)
+	{
+		ParseChunk(Chunks[Index], bIsRightHanded);
+	});
+
+	// 2. 앞 청크들의 개수를 누적해 각 청크의 최종 위치를 정한다.
+	TArray<uint32> StreamBase[Stream_Count];
+	TArray<uint32> CornerBase;
+	uint32 StreamTotal[Stream_Count] = { 0, 0, 0 };
+	uint32 CornerTotal = 0;
+	for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+	{
+		StreamBase[Stream].resize(NumChunks);
+	}
+	CornerBase.resize(NumChunks);
+
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		const FObjChunk& Chunk = Chunks[i];
+		const uint32 Counts[Stream_Count] =
+		{
+			static_cast<uint32>(Chunk.Positions.Num()),
+			static_cast<uint32>(Chunk.TexCoords.Num()),
+			static_cast<uint32>(Chunk.Normals.Num())
+		};
+		for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+		{
+			StreamBase[Stream][i] = StreamTotal[Stream];
+			StreamTotal[Stream] += Counts[Stream];
+		}
+		CornerBase[i] = CornerTotal;
+		CornerTotal += static_cast<uint32>(Chunk.Indices[Stream_Position].Num());
+	}
+
+	OutObjInfo.Positions.resize(StreamTotal[Stream_Position]);
+	OutObjInfo.TexCoords.resize(StreamTotal[Stream_TexCoord]);
+	OutObjInfo.Normals.resize(StreamTotal[Stream_Normal]);
+	OutObjInfo.PositionIndices.resize(CornerTotal);
+	OutObjInfo.TexCoordIndices.resize(CornerTotal);
+	OutObjInfo.NormalIndices.resize(CornerTotal);
+
+	// 3. 청크 결과를 자기 구간에 복사하고 상대 인덱스를 전역 인덱스로 바꾼다.
+	TArray<uint32>* OutIndices[Stream_Count] = { &OutObjInfo.PositionIndices, &OutObjInfo.TexCoordIndices, &OutObjInfo.NormalIndices };
+	FJobSystem::ParallelFor(NumChunks, 1, [&](int32 Index)
+	{
+		const FObjChunk& Chunk = Chunks[Index];
+		std::copy(Chunk.Positions.begin(), Chunk.Positions.end(), OutObjInfo.Positions.begin() + StreamBase[Stream_Position][Index]);
+		std::copy(Chunk.TexCoords.begin(), Chunk.TexCoords.end(), OutObjInfo.TexCoords.begin() + StreamBase[Stream_TexCoord][Index]);
+		std::copy(Chunk.Normals.begin(), Chunk.Normals.end(), OutObjInfo.Normals.begin() + StreamBase[Stream_Normal][Index]);
+
+		for (uint32 Stream = 0; Stream < Stream_Count; ++Stream)
+		{
+			uint32* Dest = OutIndices[Stream]->data() + CornerBase[Index];
+			std::copy(Chunk.Indices[Stream].begin(), Chunk.Indices[Stream].end(), Dest);
+
+			const int32 Base = static_cast<int32>(StreamBase[Stream][Index]);
+			for (uint32 Slot : Chunk.RelativeSlots[Stream])
+			{
+				Dest[Slot] = static_cast<uint32>(static_cast<int32>(Dest[Slot]) + Base);
+			}
+		}
+	});
+
+	// 4. 머티리얼 그룹 / mtllib / 알 수 없는 라인은 파일 순서대로 합친다.
+	uint32 NumUnknownLines = 0;
+	const FString* FirstUnknownLine = nullptr;
+	for (int32 i = 0; i < NumChunks; ++i)
+	{
+		const FObjChunk& Chunk = Chunks[i];
+		for (const FObjMaterialMarker& Marker : Chunk.Materials)
+		{
+			OutObjInfo.MaterialNames.Add(Marker.Name);
+			OutObjInfo.GroupIndexStartArray.Add(CornerBase[i] + Marker.LocalCorner);
+		}
+
+		if (!Chunk.MtlLibName.empty())
+		{
+			OutMtlLibName = Chunk.MtlLibName;
+		}
+
+		if (Chunk.NumUnknownLines > 0 && !FirstUnknownLine)
+		{
+			FirstUnknownLine = &Chunk.FirstUnknownLine;
+		}
+		NumUnknownLines += Chunk.NumUnknownLines;
+	}
+
+	if (NumUnknownLines > 0)
+	{
+		UE_LOG("While parsing the filename %s, %u lines with unknown symbols were skipped (first: \'%s\')",
+			OutObjInfo.ObjFileName.c_str(), NumUnknownLines, FirstUnknownLine->c_str());
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 벤치마크
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	/** 교체 전 LoadObjModel의 지오메트리 루프 (기준선, 오른손 좌표계) */
+	void ParseGeometryLegacy(std::istream& In, FObjInfo& Out)
+	{
+		struct FLegacyCorner { uint32 Position, TexCoord, Normal; };
+
+		auto ParseVertexDef = [](const FString& VertexDef)
+		{
+			FLegacyCorner Result{ 0, 0, 0 };
+			std::stringstream SS(VertexDef);
+			FString Part;
+			uint32 Value;
+			if (std::getline(SS, Part, '/')) { if (!Part.empty()) { std::stringstream Conv(Part); if (Conv >> Value) Result.Position = Value - 1; } }
+			if (std::getline(SS, Part, '/')) { if (!Part.empty()) { std::stringstream Conv(Part); if (Conv >> Value) Result.TexCoord = Value - 1; } }
+			if (std::getline(SS, Part, '/')) { if (!Part.empty()) { std::stringstream Conv(Part); if (Conv >> Value) Result.Normal = Value - 1; } }
+			return Result;
+		};
+
+		auto Emit = [&Out](const FLegacyCorner& Corner)
+		{
+			Out.PositionIndices.push_back(Corner.Position);
+			Out.TexCoordIndices.push_back(Corner.TexCoord);
+			Out.NormalIndices.push_back(Corner.Normal);
+		};
+
+		FString Line;
+		while (std::getline(In, Line))
+		{
+			if (Line.empty()) continue;
+			Line.erase(0, Line.find_first_not_of(" \t\n\r"));
+			if (Line.empty() || Line[0] == '#') continue;
+
+			if (Line.rfind("v ", 0) == 0)
+			{
+				std::stringstream SS(Line.substr(2));
+				float X, Y, Z;
+				SS >> X >> Y >> Z;
+				Out.Positions.push_back(FVector(X, -Y, Z));
+			}
+			else if (Line.rfind("vt ", 0) == 0)
+			{
+				std::stringstream SS(Line.substr(3));
+				float U, V;
+				SS >> U >> V;
+				Out.TexCoords.push_back(FVector2D(U, 1.0f - V));
+			}
+			else if (Line.rfind("vn ", 0) == 0)
+			{
+				std::stringstream SS(Line.substr(3));
+				float X, Y, Z;
+				SS >> X >> Y >> Z;
+				Out.Normals.push_back(FVector(X, -Y, Z));
+			}
+			else if (Line.rfind("f ", 0) == 0)
+			{
+				std::stringstream SS(Line.substr(2));
+				FString VertexDef;
+				TArray<FLegacyCorner> Corners;
+				while (SS >> VertexDef)
+				{
+					if (VertexDef[0] == '#') break;
+					Corners.push_back(ParseVertexDef(VertexDef));
+				}
+				for (size_t i = 1; i + 1 < Corners.size(); ++i)
+				{
+					Emit(Corners[0]);
+					Emit(Corners[i + 1]);
+					Emit(Corners[i]);
+				}
+			}
+		}
+	}
+
+	/** 사각형 면으로 이뤄진 높이맵 그리드 .obj 텍스트 */
+	std::string GenerateGridObj(int32 NumTriangles)
+	{
+		const int32 NumQuads = std::max(1, NumTriangles / 2);
+		const int32 Width = std::max(1, static_cast<int32>(std::sqrt(static_cast<double>(NumQuads))));
+		const int32 Height = (NumQuads + Width - 1) / Width;
+		const int32 Stride = Width + 1;
+
+		std::string Text;
+		Text.reserve(static_cast<size_t>(NumQuads) * 128);
+		Text += "# Mundi OBJ parser benchmark grid\nmtllib grid.mtl\n";
+
+		char Line[128];
+		for (int32 Y = 0; Y <= Height; ++Y)
+		{
+			for (int32 X = 0; X <= Width; ++X)
+			{
+				const float PX = X * 0.1f;
+				const float PZ = Y * 0.1f;
+				const float PY = std::sin(PX) * std::cos(PZ);
+				std::snprintf(Line, sizeof(Line), "v %.6f %.6f %.6f\n", PX, PY, PZ);
+				Text += Line;
+			}
+		}
+		for (int32 Y = 0; Y <= Height; ++Y)
+		{
+			for (int32 X = 0; X <= Width; ++X)
+			{
+				std::snprintf(Line, sizeof(Line), "vt %.6f %.6f\n", static_cast<float>(X) / Width, static_cast<float>(Y) / Height);
+				Text += Line;
+			}
+		}
+		for (int32 Y = 0; Y <= Height; ++Y)
+		{
+			for (int32 X = 0; X <= Width; ++X)
+			{
+				const FVector Normal = FVector(-std::cos(X * 0.1f), 1.0f, std::sin(Y * 0.1f)).GetSafeNormal();
+				std::snprintf(Line, sizeof(Line), "vn %.6f %.6f %.6f\n", Normal.X, Normal.Y, Normal.Z);
+				Text += Line;
+			}
+		}
+
+		Text += "usemtl GridA\n";
+		for (int32 Y = 0; Y < Height; ++Y)
+		{
+			if (Y == Height / 2)
+			{
+				Text += "usemtl GridB\n";
+			}
+			for (int32 X = 0; X < Width; ++X)
+			{
+				const int32 A = Y * Stride + X + 1;
+				const int32 B = A + 1;
+				const int32 C = A + Stride + 1;
+				const int32 D = A + Stride;
+				std::snprintf(Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", A, A, A, B, B, B, C, C, C, D, D, D);
+				Text += Line;
+			}
+		}
+		return Text;
+	}
+}
+
+void FObjParser::RunBenchmark(int32 NumTriangles, int32 Iterations)
+{
+	NumTriangles = std::max(2, NumTriangles);
+	Iterations = std::max(1, Iterations);
+
+	// 실제 임포트와 같은 조건(디스크 파일)에서 측정하기 위해 임시 파일로 기록
+	const std::filesystem::path TempPath = std::filesystem::temp_directory_path() / L"MundiObjParserBenchmark.obj";
+	size_t FileSize = 0;
+	{
+		const std::string Text = GenerateGridObj(NumTriangles);
+		std::ofstream OutFile(TempPath, std::ios::binary | std::ios::trunc);
+		OutFile.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+		if (!OutFile.good())
+		{
+			UE_LOG("OBJ Parser Benchmark: failed to write %s", WideToUTF8(TempPath.wstring()).c_str());
+			return;
+		}
+		FileSize = Text.size();
+	}
+	const FString TempPathUtf8 = WideToUTF8(TempPath.wstring());
+
+	auto Measure = [Iterations](auto&& Body)
+	{
+		const uint64 Start = FWindowsPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Body();
+		}
+		const uint64 End = FWindowsPlatformTime::Cycles64();
+		return FWindowsPlatformTime::ToMilliseconds(End - Start) / Iterations;
+	};
+
+	auto ParseMapped = [&TempPathUtf8](bool bAllowParallel, FObjInfo& OutInfo)
+	{
+		OutInfo = FObjInfo();
+		FWindowsMappedFile File(TempPathUtf8);
+		const char* Begin = reinterpret_cast<const char*>(File.GetData());
+		FString MtlLibName;
+		FObjParser::ParseGeometry(Begin, Begin + File.GetSize(), true, bAllowParallel, OutInfo, MtlLibName);
+	};
+
+	FObjInfo LegacyInfo;
+	FObjInfo SerialInfo;
+	FObjInfo ParallelInfo;
+
+	const double LegacyMS = Measure([&]()
+	{
+		LegacyInfo = FObjInfo();
+		std::ifstream InFile(TempPath);
+		ParseGeometryLegacy(InFile, LegacyInfo);
+	});
+
+	const double SerialMS = Measure([&]() { ParseMapped(false, SerialInfo); });
+	const double ParallelMS = Measure([&]() { ParseMapped(true, ParallelInfo); });
+
+	const bool bMatches =
+		LegacyInfo.Positions.Num() == ParallelInfo.Positions.Num() &&
+		LegacyInfo.TexCoords.Num() == ParallelInfo.TexCoords.Num() &&
+		LegacyInfo.Normals.Num() == ParallelInfo.Normals.Num() &&
+		LegacyInfo.PositionIndices == ParallelInfo.PositionIndices &&
+		LegacyInfo.TexCoordIndices == ParallelInfo.TexCoordIndices &&
+		LegacyInfo.NormalIndices == ParallelInfo.NormalIndices &&
+		SerialInfo.PositionIndices == ParallelInfo.PositionIndices &&
+		SerialInfo.GroupIndexStartArray == ParallelInfo.GroupIndexStartArray;
+
+	std::error_code ErrorCode;
+	std::filesystem::remove(TempPath, ErrorCode);
+
+	UE_LOG("OBJ Parser Benchmark: %d triangles, %.1f MB, %d iterations, %u workers",
+		static_cast<int32>(ParallelInfo.PositionIndices.Num() / 3), FileSize / (1024.0 * 1024.0), Iterations, FJobSystem::GetNumWorkers());
+	UE_LOG("  getline + stringstream : %.3f ms", LegacyMS);
+	UE_LOG("  Buffer                 : %.3f ms (x%.2f)", SerialMS, SerialMS > 0.0 ? LegacyMS / SerialMS : 0.0);
+	UE_LOG("  Buffer + MT            : %.3f ms (x%.2f)", ParallelMS, ParallelMS > 0.0 ? LegacyMS / ParallelMS : 0.0);
+	UE_LOG("  Results match          : %s", bMatches ? "yes" : "NO");
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FObjInfo;
+
+// ────────────────────────────────────────────────────────────────────────────
+// ObjParser.h
+// 메모리 버퍼 기반 .obj 지오메트리 파서
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @class FObjParser
+ * @brief 파일 전체를 담은 버퍼를 포인터로 훑으며 v / vt / vn / f / usemtl / mtllib 라인을 파싱한다.
+ *
+ * - 줄 단위 복사나 stringstream 없이 std::from_chars로 숫자를 읽는다.
+ * - 첫 패스에서 라인 종류별 개수와 면 코너 수를 세어 배열을 미리 예약한다.
+ * - 큰 파일은 줄 경계에 맞춰 청크로 나누고 청크마다 잡으로 파싱한 뒤 순서대로 합친다.
+ *   음수(상대) 인덱스는 청크 로컬로 기록해 두었다가 합칠 때 앞 청크 개수를 더해 해석한다.
+ */
+class FObjParser
+{
+public:
+	/** 이보다 작은 파일은 청크로 나누지 않는다. */
+	static constexpr size_t MinParallelBytes = 1u << 20;
+	/** 청크 하나의 최소 크기 */
+	static constexpr size_t MinChunkBytes = 256u << 10;
+
+	/**
+	 * @brief 버퍼의 지오메트리를 OutObjInfo에 채운다.
+	 * Positions / TexCoords / Normals / *Indices / MaterialNames / GroupIndexStartArray만 채우며,
+	 * vt / vn이 없을 때의 기본값 추가와 그룹 후처리는 호출자(FObjImporter)가 한다.
+	 * @param bIsRightHanded true면 Y축 반전 + 와인딩 반전
+	 * @param bAllowParallel false면 호출 스레드에서 한 청크로 파싱
+	 * @param OutMtlLibName 마지막 mtllib 인자 (obj 기준 상대 경로, 없으면 빈 문자열)
+	 */
+	static void ParseGeometry(const char* Begin, const char* End, bool bIsRightHanded, bool bAllowParallel,
+		FObjInfo& OutObjInfo, FString& OutMtlLibName);
+
+	/**
+	 * @brief 합성 그리드 .obj를 임시 파일로 만들어 기존 getline/stringstream 파싱과 비교한다.
+	 * @param NumTriangles 생성할 삼각형 수 (사각형 면으로 기록되어 팬 분할 경로도 측정)
+	 */
+	static void RunBenchmark(int32 NumTriangles = 2000000, int32 Iterations = 1);
+};
@@ -7,8 +7,8 @@ class FPhysicalMaterialLoader
 {
 public:
     /**
-     * 지정된 디렉토리 내의 모든 물리 재질 파일을 로드하여 리소스 매니저에 등록한다.
-     * @param RelativePath : 데이터 디렉토리 내 상대 경로 (기본값: "PhysicalMaterials")
+     * 시작 시 스캔된 물리 재질 파일(.phxmtl)을 로드하여 리소스 매니저에 등록한다.
+     * @param FilePaths : 정규화된 물리 재질 파일 경로 목록 (데이터 디렉토리의 PhysicalMaterials 하위)
      */
-    static void Preload(const FString& RelativePath = "PhysicalMaterials");
+    static void Preload(const TArray<FString>& FilePaths);
 };
\ No newline at end of file
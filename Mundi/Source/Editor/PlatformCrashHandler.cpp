@@ -62,27 +62,23 @@ void FPlatformCrashHandler::TickCrashMode()
     if (!bContinuousCrashMode)
         return;
 
-    if (GUObjectArray.empty())
+    if (GUObjectArray.IsEmpty())
         return;
 
     // 매 프레임마다 랜덤 객체를 삭제하여 빠르게 크래시
     static std::random_device rd;
     static std::mt19937 gen(rd());
-    // TMap에서 랜덤 객체 선택
-    std::uniform_int_distribution<size_t> dist(0, GUObjectArray.size() - 1);
-    size_t randomIndex = dist(gen);
+    // 슬롯 배열에서 랜덤 슬롯 선택 (0번은 예약)
+    const uint32 maxIndex = GUObjectArray.GetMaxIndex();
+    std::uniform_int_distribution<uint32> dist(1, maxIndex - 1);
+    uint32 startIndex = dist(gen);
 
-    // TMap 순회하여 랜덤 인덱스에 해당하는 객체 찾기
-    size_t currentIndex = 0;
+    // 빈 슬롯이면 다음 슬롯으로 진행 (끝에 닿으면 처음부터)
     UObject* targetObject = nullptr;
-    for (auto& pair : GUObjectArray)
+    for (uint32 offset = 0; offset < maxIndex - 1 && !targetObject; ++offset)
     {
-        if (currentIndex == randomIndex)
-        {
-            targetObject = pair.second;
-            break;
-        }
-        ++currentIndex;
+        const uint32 slot = 1 + (startIndex - 1 + offset) % (maxIndex - 1);
+        targetObject = GUObjectArray.IndexToObject(slot);
     }
 
     if (targetObject)
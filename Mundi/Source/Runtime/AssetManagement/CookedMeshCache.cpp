@@ -0,0 +1,442 @@
+﻿#include "pch.h"
+#include "CookedMeshCache.h"
+#include "Hash.h"
+#include "PathUtils.h"
+#include <fstream>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 쓰기 도우미
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	/** 파일 전체를 메모리에서 조립한 뒤 한 번에 기록한다. */
+	class FCookedMeshBuilder
+	{
+	public:
+		FCookedMeshBuilder(ECookedMeshType MeshType, uint64 SourceHash, uint32 Flags)
+		{
+			std::memset(&Header, 0, sizeof(Header));
+			Header.Magic = FCookedMeshCache::CookedMeshMagic;
+			Header.Version = FCookedMeshCache::CookedMeshVersion;
+			Header.MeshType = MeshType;
+			Header.Flags = Flags;
+			Header.SourceHash = SourceHash;
+		}
+
+		FCookedMeshHeader& GetHeader() { return Header; }
+
+		FCookedString AddString(const FString& String)
+		{
+			FCookedString Result;
+			Result.Offset = static_cast<uint32>(Strings.size());
+			Result.Length = static_cast<uint32>(String.size());
+			Strings.insert(Strings.end(), String.begin(), String.end());
+			return Result;
+		}
+
+		template<typename T>
+		void SetSection(ECookedMeshSection Section, const T* Data, size_t Count)
+		{
+			PendingSection& Pending = Sections[static_cast<uint32>(Section)];
+			Pending.Data = reinterpret_cast<const uint8*>(Data);
+			Pending.Count = static_cast<uint32>(Count);
+			Pending.Stride = sizeof(T);
+		}
+
+		bool WriteToFile(const FString& CachePath)
+		{
+			SetSection(ECookedMeshSection::Strings, Strings.data(), Strings.size());
+
+			// 헤더 뒤에 섹션을 정렬해서 배치
+			uint64 Cursor = AlignUp(sizeof(FCookedMeshHeader));
+			for (uint32 i = 0; i < static_cast<uint32>(ECookedMeshSection::Count); ++i)
+			{
+				FCookedSection& Info = Header.Sections[i];
+				Info.Offset = Cursor;
+				Info.Count = Sections[i].Count;
+				Info.Stride = Sections[i].Stride;
+				Cursor = AlignUp(Cursor + static_cast<uint64>(Info.Count) * Info.Stride);
+			}
+
+			TArray<uint8> Buffer(static_cast<size_t>(Cursor), 0);
+			std::memcpy(Buffer.data(), &Header, sizeof(Header));
+			for (uint32 i = 0; i < static_cast<uint32>(ECookedMeshSection::Count); ++i)
+			{
+				const FCookedSection& Info = Header.Sections[i];
+				if (Info.Count > 0)
+				{
+					std::memcpy(Buffer.data() + Info.Offset, Sections[i].Data, static_cast<size_t>(Info.Count) * Info.Stride);
+				}
+			}
+
+			std::ofstream OutFile(UTF8ToWide(CachePath), std::ios::binary | std::ios::trunc);
+			if (!OutFile.is_open())
+			{
+				UE_LOG("[CookedMeshCache] Failed to open for write: %s", CachePath.c_str());
+				return false;
+			}
+			OutFile.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+			return OutFile.good();
+		}
+
+	private:
+		struct PendingSection
+		{
+			const uint8* Data = nullptr;
+			uint32 Count = 0;
+			uint32 Stride = 0;
+		};
+
+		static uint64 AlignUp(uint64 Value)
+		{
+			const uint64 Alignment = FCookedMeshCache::CookedSectionAlignment;
+			return (Value + Alignment - 1) & ~(Alignment - 1);
+		}
+
+		FCookedMeshHeader Header;
+		PendingSection Sections[static_cast<uint32>(ECookedMeshSection::Count)];
+		TArray<char> Strings;
+	};
+
+	void CookGroups(FCookedMeshBuilder& Builder, const TArray<FGroupInfo>& GroupInfos, TArray<FCookedGroup>& OutGroups)
+	{
+		OutGroups.resize(GroupInfos.size());
+		for (size_t i = 0; i < GroupInfos.size(); ++i)
+		{
+			OutGroups[i].StartIndex = GroupInfos[i].StartIndex;
+			OutGroups[i].IndexCount = GroupInfos[i].IndexCount;
+			OutGroups[i].MaterialName = Builder.AddString(GroupInfos[i].InitialMaterialName);
+		}
+		Builder.SetSection(ECookedMeshSection::Groups, OutGroups.data(), OutGroups.size());
+	}
+
+	void CookMaterials(FCookedMeshBuilder& Builder, const TArray<FMaterialInfo>& MaterialInfos, TArray<FCookedMaterial>& OutMaterials)
+	{
+		OutMaterials.resize(MaterialInfos.size());
+		for (size_t i = 0; i < MaterialInfos.size(); ++i)
+		{
+			const FMaterialInfo& Info = MaterialInfos[i];
+			FCookedMaterial& Cooked = OutMaterials[i];
+			std::memset(&Cooked, 0, sizeof(Cooked));
+
+			Cooked.IlluminationModel = Info.IlluminationModel;
+			Cooked.DiffuseColor = Info.DiffuseColor;
+			Cooked.AmbientColor = Info.AmbientColor;
+			Cooked.SpecularColor = Info.SpecularColor;
+			Cooked.EmissiveColor = Info.EmissiveColor;
+			Cooked.TransmissionFilter = Info.TransmissionFilter;
+			Cooked.OpticalDensity = Info.OpticalDensity;
+			Cooked.Transparency = Info.Transparency;
+			Cooked.SpecularExponent = Info.SpecularExponent;
+			Cooked.BumpMultiplier = Info.BumpMultiplier;
+			Cooked.TileU = Info.TileU;
+			Cooked.TileV = Info.TileV;
+
+			Cooked.MaterialName = Builder.AddString(Info.MaterialName);
+			Cooked.DiffuseTextureFileName = Builder.AddString(Info.DiffuseTextureFileName);
+			Cooked.NormalTextureFileName = Builder.AddString(Info.NormalTextureFileName);
+			Cooked.AmbientTextureFileName = Builder.AddString(Info.AmbientTextureFileName);
+			Cooked.SpecularTextureFileName = Builder.AddString(Info.SpecularTextureFileName);
+			Cooked.EmissiveTextureFileName = Builder.AddString(Info.EmissiveTextureFileName);
+			Cooked.TransparencyTextureFileName = Builder.AddString(Info.TransparencyTextureFileName);
+			Cooked.SpecularExponentTextureFileName = Builder.AddString(Info.SpecularExponentTextureFileName);
+		}
+		Builder.SetSection(ECookedMeshSection::Materials, OutMaterials.data(), OutMaterials.size());
+	}
+
+	// ────────────────────────────────────────────────────────────────────────
+	// 읽기 도우미
+	// ────────────────────────────────────────────────────────────────────────
+
+	/**
+	 * 모든 인덱스가 정점 범위 안에 있고 모든 그룹 구간이 인덱스 범위 안에 있는지 확인한다.
+	 * 헤더와 해시가 맞아도 잘리거나 덮어쓴 파일이 GPU 드로우나 BVH 구축에서 범위 밖을 읽게 두지 않는다.
+	 */
+	bool ValidateTopology(const FCookedMeshReader& Reader, const FString& CachePath)
+	{
+		const uint32 NumVertices = Reader.GetHeader().Sections[static_cast<uint32>(ECookedMeshSection::Vertices)].Count;
+		TArrayView<uint32> Indices = Reader.GetSection<uint32>(ECookedMeshSection::Indices);
+
+		// 분기 없이 최댓값만 모아 한 번 비교 (큰 메시도 한 번 훑는 비용)
+		uint32 MaxIndex = 0;
+		for (uint32 Index : Indices)
+		{
+			MaxIndex = std::max(MaxIndex, Index);
+		}
+		if (!Indices.IsEmpty() && MaxIndex >= NumVertices)
+		{
+			UE_LOG("[CookedMeshCache] Index %u out of range (%u vertices) in %s", MaxIndex, NumVertices, CachePath.c_str());
+			return false;
+		}
+
+		TArrayView<FCookedGroup> Groups = Reader.GetSection<FCookedGroup>(ECookedMeshSection::Groups);
+		for (int32 i = 0; i < Groups.Num(); ++i)
+		{
+			if (static_cast<uint64>(Groups[i].StartIndex) + Groups[i].IndexCount > static_cast<uint64>(Indices.Num()))
+			{
+				UE_LOG("[CookedMeshCache] Group %d [%u, +%u) exceeds %d indices in %s",
+					i, Groups[i].StartIndex, Groups[i].IndexCount, Indices.Num(), CachePath.c_str());
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ReadGroups(const FCookedMeshReader& Reader, TArray<FGroupInfo>& OutGroupInfos)
+	{
+		TArrayView<FCookedGroup> Groups = Reader.GetSection<FCookedGroup>(ECookedMeshSection::Groups);
+		OutGroupInfos.resize(Groups.Num());
+		for (int32 i = 0; i < Groups.Num(); ++i)
+		{
+			OutGroupInfos[i].StartIndex = Groups[i].StartIndex;
+			OutGroupInfos[i].IndexCount = Groups[i].IndexCount;
+			OutGroupInfos[i].InitialMaterialName = Reader.GetString(Groups[i].MaterialName);
+		}
+	}
+
+	void ReadMaterials(const FCookedMeshReader& Reader, TArray<FMaterialInfo>& OutMaterialInfos)
+	{
+		TArrayView<FCookedMaterial> Materials = Reader.GetSection<FCookedMaterial>(ECookedMeshSection::Materials);
+		OutMaterialInfos.resize(Materials.Num());
+		for (int32 i = 0; i < Materials.Num(); ++i)
+		{
+			const FCookedMaterial& Cooked = Materials[i];
+			FMaterialInfo& Info = OutMaterialInfos[i];
+
+			Info.IlluminationModel = Cooked.IlluminationModel;
+			Info.DiffuseColor = Cooked.DiffuseColor;
+			Info.AmbientColor = Cooked.AmbientColor;
+			Info.SpecularColor = Cooked.SpecularColor;
+			Info.EmissiveColor = Cooked.EmissiveColor;
+			Info.TransmissionFilter = Cooked.TransmissionFilter;
+			Info.OpticalDensity = Cooked.OpticalDensity;
+			Info.Transparency = Cooked.Transparency;
+			Info.SpecularExponent = Cooked.SpecularExponent;
+			Info.BumpMultiplier = Cooked.BumpMultiplier;
+			Info.TileU = Cooked.TileU;
+			Info.TileV = Cooked.TileV;
+
+			Info.MaterialName = Reader.GetString(Cooked.MaterialName);
+			Info.DiffuseTextureFileName = Reader.GetString(Cooked.DiffuseTextureFileName);
+			Info.NormalTextureFileName = Reader.GetString(Cooked.NormalTextureFileName);
+			Info.AmbientTextureFileName = Reader.GetString(Cooked.AmbientTextureFileName);
+			Info.SpecularTextureFileName = Reader.GetString(Cooked.SpecularTextureFileName);
+			Info.EmissiveTextureFileName = Reader.GetString(Cooked.EmissiveTextureFileName);
+			Info.TransparencyTextureFileName = Reader.GetString(Cooked.TransparencyTextureFileName);
+			Info.SpecularExponentTextureFileName = Reader.GetString(Cooked.SpecularExponentTextureFileName);
+		}
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FCookedMeshReader
+// ────────────────────────────────────────────────────────────────────────────
+
+bool FCookedMeshReader::Open(const FString& CachePath, ECookedMeshType ExpectedType, uint64 ExpectedSourceHash)
+{
+	Header = nullptr;
+	bCorrupt = false;
+
+	if (!File.Open(CachePath) || File.GetSize() < sizeof(FCookedMeshHeader))
+	{
+		return false;
+	}
+
+	const FCookedMeshHeader* MappedHeader = reinterpret_cast<const FCookedMeshHeader*>(File.GetData());
+	if (MappedHeader->Magic != FCookedMeshCache::CookedMeshMagic ||
+		MappedHeader->Version != FCookedMeshCache::CookedMeshVersion ||
+		MappedHeader->MeshType != ExpectedType)
+	{
+		return false;
+	}
+
+	if (MappedHeader->SourceHash != ExpectedSourceHash)
+	{
+		return false;
+	}
+
+	// 섹션별 기대 요소 크기 (구조체 레이아웃이 바뀐 빌드의 캐시는 거부)
+	const uint32 VertexStride = (ExpectedType == ECookedMeshType::Static) ? sizeof(FNormalVertex) : sizeof(FSkinnedVertex);
+	const uint32 ExpectedStrides[static_cast<uint32>(ECookedMeshSection::Count)] =
+	{
+		VertexStride,
+		sizeof(uint32),
+		sizeof(FCookedGroup),
+		sizeof(FCookedBone),
+		sizeof(FCookedMaterial),
+		sizeof(char),
+	};
+
+	for (uint32 i = 0; i < static_cast<uint32>(ECookedMeshSection::Count); ++i)
+	{
+		const FCookedSection& Info = MappedHeader->Sections[i];
+		if (Info.Stride != ExpectedStrides[i] ||
+			Info.Count > static_cast<uint32>(INT32_MAX) ||
+			(Info.Offset % FCookedMeshCache::CookedSectionAlignment) != 0 ||
+			Info.Offset > File.GetSize() ||
+			static_cast<uint64>(Info.Count) * Info.Stride > File.GetSize() - Info.Offset)
+		{
+			UE_LOG("[CookedMeshCache] Corrupt section %u in %s", i, CachePath.c_str());
+			return false;
+		}
+	}
+
+	Header = MappedHeader;
+	return true;
+}
+
+FString FCookedMeshReader::GetString(const FCookedString& String) const
+{
+	const FCookedSection& Info = Header->Sections[static_cast<uint32>(ECookedMeshSection::Strings)];
+	if (static_cast<uint64>(String.Offset) + String.Length > Info.Count)
+	{
+		bCorrupt = true;
+		return FString();
+	}
+	const char* Base = reinterpret_cast<const char*>(File.GetData() + Info.Offset);
+	return FString(Base + String.Offset, String.Length);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FCookedMeshCache
+// ────────────────────────────────────────────────────────────────────────────
+
+uint64 FCookedMeshCache::HashSourceFile(const FString& SourcePath, uint64 Seed)
+{
+	FWindowsMappedFile File;
+	if (!File.Open(SourcePath))
+	{
+		// 없는 파일도 "없음" 상태로 해시에 반영해 의존 파일 삭제 시 캐시가 무효화되게 한다.
+		return HashCombine(Seed, 0);
+	}
+	return HashCombine(Seed, HashBytes(File.GetData(), static_cast<size_t>(File.GetSize()), File.GetSize()));
+}
+
+bool FCookedMeshCache::SaveStaticMesh(const FString& CachePath, uint64 SourceHash, const FStaticMesh& Mesh, const TArray<FMaterialInfo>& MaterialInfos)
+{
+	FCookedMeshBuilder Builder(ECookedMeshType::Static, SourceHash, Mesh.bHasMaterial ? CMF_HasMaterial : CMF_None);
+	Builder.GetHeader().SourcePath = Builder.AddString(Mesh.PathFileName);
+
+	TArray<FCookedGroup> Groups;
+	TArray<FCookedMaterial> Materials;
+	CookGroups(Builder, Mesh.GroupInfos, Groups);
+	CookMaterials(Builder, MaterialInfos, Materials);
+	Builder.SetSection(ECookedMeshSection::Vertices, Mesh.Vertices.data(), Mesh.Vertices.size());
+	Builder.SetSection(ECookedMeshSection::Indices, Mesh.Indices.data(), Mesh.Indices.size());
+	Builder.SetSection(ECookedMeshSection::Bones, static_cast<const FCookedBone*>(nullptr), 0);
+
+	return Builder.WriteToFile(CachePath);
+}
+
+bool FCookedMeshCache::LoadStaticMesh(const FString& CachePath, uint64 SourceHash, FStaticMesh& OutMesh, TArray<FMaterialInfo>& OutMaterialInfos)
+{
+	FCookedMeshReader Reader;
+	if (!Reader.Open(CachePath, ECookedMeshType::Static, SourceHash) || !ValidateTopology(Reader, CachePath))
+	{
+		return false;
+	}
+
+	// 문자열 참조까지 검증이 끝난 뒤에만 출력에 반영
+	FStaticMesh Mesh;
+	TArray<FMaterialInfo> MaterialInfos;
+	Mesh.PathFileName = Reader.GetString(Reader.GetHeader().SourcePath);
+	ReadGroups(Reader, Mesh.GroupInfos);
+	ReadMaterials(Reader, MaterialInfos);
+	if (Reader.IsCorrupt())
+	{
+		UE_LOG("[CookedMeshCache] Corrupt string table in %s", CachePath.c_str());
+		return false;
+	}
+
+	// 정점/인덱스는 매핑된 섹션에서 한 번에 복사
+	TArrayView<FNormalVertex> Vertices = Reader.GetSection<FNormalVertex>(ECookedMeshSection::Vertices);
+	TArrayView<uint32> Indices = Reader.GetSection<uint32>(ECookedMeshSection::Indices);
+	Mesh.Vertices.assign(Vertices.begin(), Vertices.end());
+	Mesh.Indices.assign(Indices.begin(), Indices.end());
+	Mesh.bHasMaterial = (Reader.GetHeader().Flags & CMF_HasMaterial) != 0;
+	Mesh.CacheFilePath = CachePath;
+
+	OutMesh = std::move(Mesh);
+	OutMaterialInfos = std::move(MaterialInfos);
+	return true;
+}
+
+bool FCookedMeshCache::SaveSkeletalMesh(const FString& CachePath, uint64 SourceHash, const FSkeletalMeshData& MeshData, const TArray<FMaterialInfo>& MaterialInfos)
+{
+	FCookedMeshBuilder Builder(ECookedMeshType::Skeletal, SourceHash, MeshData.bHasMaterial ? CMF_HasMaterial : CMF_None);
+	Builder.GetHeader().SourcePath = Builder.AddString(MeshData.PathFileName);
+	Builder.GetHeader().SkeletonName = Builder.AddString(MeshData.Skeleton.Name);
+
+	TArray<FCookedBone> Bones(MeshData.Skeleton.Bones.size());
+	for (size_t i = 0; i < Bones.size(); ++i)
+	{
+		const FBone& Bone = MeshData.Skeleton.Bones[i];
+		std::memset(&Bones[i], 0, sizeof(FCookedBone));
+		Bones[i].BindPose = Bone.BindPose;
+		Bones[i].InverseBindPose = Bone.InverseBindPose;
+		Bones[i].ParentIndex = Bone.ParentIndex;
+		Bones[i].Name = Builder.AddString(Bone.Name);
+	}
+
+	TArray<FCookedGroup> Groups;
+	TArray<FCookedMaterial> Materials;
+	CookGroups(Builder, MeshData.GroupInfos, Groups);
+	CookMaterials(Builder, MaterialInfos, Materials);
+	Builder.SetSection(ECookedMeshSection::Vertices, MeshData.Vertices.data(), MeshData.Vertices.size());
+	Builder.SetSection(ECookedMeshSection::Indices, MeshData.Indices.data(), MeshData.Indices.size());
+	Builder.SetSection(ECookedMeshSection::Bones, Bones.data(), Bones.size());
+
+	return Builder.WriteToFile(CachePath);
+}
+
+bool FCookedMeshCache::LoadSkeletalMesh(const FString& CachePath, uint64 SourceHash, FSkeletalMeshData& OutMeshData, TArray<FMaterialInfo>& OutMaterialInfos)
+{
+	FCookedMeshReader Reader;
+	if (!Reader.Open(CachePath, ECookedMeshType::Skeletal, SourceHash) || !ValidateTopology(Reader, CachePath))
+	{
+		return false;
+	}
+
+	FSkeletalMeshData MeshData;
+	TArray<FMaterialInfo> MaterialInfos;
+	MeshData.PathFileName = Reader.GetString(Reader.GetHeader().SourcePath);
+	MeshData.Skeleton.Name = Reader.GetString(Reader.GetHeader().SkeletonName);
+
+	TArrayView<FCookedBone> Bones = Reader.GetSection<FCookedBone>(ECookedMeshSection::Bones);
+	MeshData.Skeleton.Bones.resize(Bones.Num());
+	for (int32 i = 0; i < Bones.Num(); ++i)
+	{
+		FBone& Bone = MeshData.Skeleton.Bones[i];
+		Bone.Name = Reader.GetString(Bones[i].Name);
+		Bone.ParentIndex = Bones[i].ParentIndex;
+		Bone.BindPose = Bones[i].BindPose;
+		Bone.InverseBindPose = Bones[i].InverseBindPose;
+
+		if (Bone.ParentIndex < -1 || Bone.ParentIndex >= Bones.Num())
+		{
+			UE_LOG("[CookedMeshCache] Invalid parent index on bone %d in %s", i, CachePath.c_str());
+			return false;
+		}
+		MeshData.Skeleton.BoneNameToIndex[Bone.Name] = i;
+	}
+
+	ReadGroups(Reader, MeshData.GroupInfos);
+	ReadMaterials(Reader, MaterialInfos);
+	if (Reader.IsCorrupt())
+	{
+		UE_LOG("[CookedMeshCache] Corrupt string table in %s", CachePath.c_str());
+		return false;
+	}
+
+	TArrayView<FSkinnedVertex> Vertices = Reader.GetSection<FSkinnedVertex>(ECookedMeshSection::Vertices);
+	TArrayView<uint32> Indices = Reader.GetSection<uint32>(ECookedMeshSection::Indices);
+	MeshData.Vertices.assign(Vertices.begin(), Vertices.end());
+	MeshData.Indices.assign(Indices.begin(), Indices.end());
+	MeshData.bHasMaterial = (Reader.GetHeader().Flags & CMF_HasMaterial) != 0;
+	MeshData.CacheFilePath = CachePath;
+
+	OutMeshData = std::move(MeshData);
+	OutMaterialInfos = std::move(MaterialInfos);
+	return true;
+}
@@ -0,0 +1,160 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "VertexData.h"
+#include "ResourceData.h"
+#include "WindowsMappedFile.h"
+
+// ────────────────────────────────────────────────────────────────────────────
+// CookedMeshCache.h
+// 메모리 매핑으로 읽는 쿡드 메시 캐시 포맷 (DerivedDataCache/*.bin)
+//
+// [Header][Vertices][Indices][Groups][Bones][Materials][Strings]
+// - 각 섹션은 16바이트 정렬된 연속 배열이라 매핑 주소를 그대로 TArrayView로 쓴다.
+// - 문자열은 Strings 섹션 하나에 모아 두고 (Offset, Length)로 참조한다.
+// - 유효성은 원본 파일 내용 해시(SourceHash)로 판단한다. (last_write_time 비교 대신)
+// ────────────────────────────────────────────────────────────────────────────
+
+enum class ECookedMeshType : uint32
+{
+	Static = 0,		// FStaticMesh (FNormalVertex)
+	Skeletal = 1,	// FSkeletalMeshData (FSkinnedVertex + Bones)
+};
+
+enum class ECookedMeshSection : uint32
+{
+	Vertices,
+	Indices,
+	Groups,
+	Bones,
+	Materials,
+	Strings,
+	Count
+};
+
+enum ECookedMeshFlags : uint32
+{
+	CMF_None = 0,
+	CMF_HasMaterial = 1 << 0,	// bHasMaterial
+};
+
+/** Strings 섹션 안의 문자열 참조 */
+struct FCookedString
+{
+	uint32 Offset = 0;
+	uint32 Length = 0;
+};
+
+struct FCookedSection
+{
+	uint64 Offset = 0;	// 파일 시작 기준, CookedSectionAlignment 배수
+	uint32 Count = 0;
+	uint32 Stride = 0;	// 요소 크기 (빌드 간 구조체 크기가 바뀌면 캐시 무효)
+};
+
+struct FCookedGroup
+{
+	uint32 StartIndex;
+	uint32 IndexCount;
+	FCookedString MaterialName;
+};
+
+struct FCookedBone
+{
+	FMatrix BindPose;
+	FMatrix InverseBindPose;
+	int32 ParentIndex;
+	FCookedString Name;
+};
+
+struct FCookedMaterial
+{
+	int32 IlluminationModel;
+	FVector DiffuseColor;
+	FVector AmbientColor;
+	FVector SpecularColor;
+	FVector EmissiveColor;
+	FVector TransmissionFilter;
+	float OpticalDensity;
+	float Transparency;
+	float SpecularExponent;
+	float BumpMultiplier;
+	float TileU;
+	float TileV;
+
+	FCookedString MaterialName;
+	FCookedString DiffuseTextureFileName;
+	FCookedString NormalTextureFileName;
+	FCookedString AmbientTextureFileName;
+	FCookedString SpecularTextureFileName;
+	FCookedString EmissiveTextureFileName;
+	FCookedString TransparencyTextureFileName;
+	FCookedString SpecularExponentTextureFileName;
+};
+
+struct FCookedMeshHeader
+{
+	uint32 Magic;
+	uint32 Version;
+	ECookedMeshType MeshType;
+	uint32 Flags;			// ECookedMeshFlags
+	uint64 SourceHash;		// 원본(+의존 파일) 내용 해시
+	FCookedString SourcePath;
+	FCookedString SkeletonName;
+	FCookedSection Sections[static_cast<uint32>(ECookedMeshSection::Count)];
+};
+
+/**
+ * @class FCookedMeshReader
+ * @brief 쿡드 메시 캐시 파일 하나를 매핑하고 검증한 뒤 섹션을 복사 없이 노출한다.
+ * 뷰는 Reader가 살아 있는 동안만 유효하다.
+ */
+class FCookedMeshReader
+{
+public:
+	/**
+	 * @brief 파일을 매핑하고 헤더/섹션 범위/요소 크기/SourceHash를 검증한다.
+	 * @return 캐시를 그대로 쓸 수 있으면 true
+	 */
+	bool Open(const FString& CachePath, ECookedMeshType ExpectedType, uint64 ExpectedSourceHash);
+
+	const FCookedMeshHeader& GetHeader() const { return *Header; }
+
+	template<typename T>
+	TArrayView<T> GetSection(ECookedMeshSection Section) const
+	{
+		const FCookedSection& Info = Header->Sections[static_cast<uint32>(Section)];
+		return TArrayView<T>(reinterpret_cast<const T*>(File.GetData() + Info.Offset), static_cast<int32>(Info.Count));
+	}
+
+	/** Strings 섹션의 문자열 (범위를 벗어나면 빈 문자열을 돌려주고 IsCorrupt가 true가 됨) */
+	FString GetString(const FCookedString& String) const;
+
+	bool IsCorrupt() const { return bCorrupt; }
+
+private:
+	FWindowsMappedFile File;
+	const FCookedMeshHeader* Header = nullptr;
+	mutable bool bCorrupt = false;
+};
+
+/**
+ * @class FCookedMeshCache
+ * @brief FStaticMesh / FSkeletalMeshData를 쿡드 포맷으로 저장하고 매핑해서 읽는다.
+ * 파일 IO만 하므로 워커 스레드에서 호출해도 된다.
+ */
+class FCookedMeshCache
+{
+public:
+	static constexpr uint32 CookedMeshMagic = 0x4853454D;	// "MESH"
+	static constexpr uint32 CookedMeshVersion = 1;
+	static constexpr uint64 CookedSectionAlignment = 16;
+
+	/** 파일 내용 해시 (Seed에 이어서 누적, 파일이 없으면 Seed만 섞은 값) */
+	static uint64 HashSourceFile(const FString& SourcePath, uint64 Seed = 0);
+
+	static bool SaveStaticMesh(const FString& CachePath, uint64 SourceHash, const FStaticMesh& Mesh, const TArray<FMaterialInfo>& MaterialInfos);
+	static bool LoadStaticMesh(const FString& CachePath, uint64 SourceHash, FStaticMesh& OutMesh, TArray<FMaterialInfo>& OutMaterialInfos);
+
+	static bool SaveSkeletalMesh(const FString& CachePath, uint64 SourceHash, const FSkeletalMeshData& MeshData, const TArray<FMaterialInfo>& MaterialInfos);
+	static bool LoadSkeletalMesh(const FString& CachePath, uint64 SourceHash, FSkeletalMeshData& OutMeshData, TArray<FMaterialInfo>& OutMaterialInfos);
+};
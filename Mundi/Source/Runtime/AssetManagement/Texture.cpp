@@ -19,10 +19,8 @@ UTexture::~UTexture()
 	ReleaseResources();
 }
 
-void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
+FString UTexture::PrepareLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath)
 {
-	assert(InDevice);
-
 	// 실제로 로드할 파일 경로 결정
 	FString ActualLoadPath = InFilePath;
 
@@ -65,7 +63,7 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 
 			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
 			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+			OutCacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
 		}
 	}
 #else
@@ -73,6 +71,16 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
 #endif
 
+	return ActualLoadPath;
+}
+
+void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB)
+{
+	assert(InDevice);
+
+	// 실제로 로드할 파일 경로 결정 (필요 시 DDS 변환)
+	FString ActualLoadPath = PrepareLoadPath(InFilePath, bSRGB, CacheFilePath);
+
 	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
 	int needed = ::MultiByteToWideChar(CP_UTF8, 0, ActualLoadPath.c_str(), -1, nullptr, 0);
 	std::wstring WFilePath;
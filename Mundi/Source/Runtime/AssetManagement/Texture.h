@@ -14,6 +14,13 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
+	/**
+	 * @brief DDS 캐시를 검사하고 필요하면 변환까지 수행한 뒤 실제로 로드할 경로를 반환한다.
+	 * 디바이스를 쓰지 않으므로 워커 스레드에서 미리 호출해 변환 비용을 숨길 수 있다. (WIC 사용 시 호출 스레드의 COM 초기화 필요)
+	 * @param OutCacheFilePath DDS 캐시를 쓰는 경우에만 캐시 경로로 갱신된다.
+	 */
+	static FString PrepareLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath);
+
 	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
@@ -0,0 +1,405 @@
+#include "pch.h"
+#include "JobSystem.h"
+#include <thread>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 정적 멤버
+// ────────────────────────────────────────────────────────────────────────────
+
+struct FJobSystem::FWorker
+{
+	FWorkerQueue Queue;
+	std::thread Thread;
+};
+
+bool FJobSystem::bInitialized = false;
+std::vector<std::unique_ptr<FJobSystem::FWorker>> FJobSystem::Workers;
+std::atomic<uint32> FJobSystem::NextExternalQueue{ 0 };
+std::atomic<int32> FJobSystem::NumQueuedJobs{ 0 };
+std::atomic<bool> FJobSystem::bShutdownRequested{ false };
+std::mutex FJobSystem::WakeLock;
+std::condition_variable FJobSystem::WakeCondition;
+std::atomic<uint64> FJobSystem::ExecutedJobs{ 0 };
+std::atomic<uint64> FJobSystem::StolenJobs{ 0 };
+
+namespace
+{
+	/** 현재 스레드의 워커 인덱스 (워커가 아니면 -1) */
+	thread_local int32 GWorkerIndex = -1;
+
+	/** Steal 시작 위치를 흩뜨리기 위한 스레드별 시드 */
+	thread_local uint32 GStealSeed = 0x9E3779B9u;
+
+	inline uint32 NextStealSeed()
+	{
+		// xorshift32
+		uint32 X = GStealSeed;
+		X ^= X << 13;
+		X ^= X >> 17;
+		X ^= X << 5;
+		GStealSeed = X;
+		return X;
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FWorkerQueue
+// ────────────────────────────────────────────────────────────────────────────
+
+void FJobSystem::FWorkerQueue::Push(FJobHandle Job)
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	Jobs.push_back(std::move(Job));
+}
+
+FJobHandle FJobSystem::FWorkerQueue::Pop()
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	if (Jobs.empty())
+	{
+		return nullptr;
+	}
+	FJobHandle Job = std::move(Jobs.back());
+	Jobs.pop_back();
+	return Job;
+}
+
+FJobHandle FJobSystem::FWorkerQueue::Steal()
+{
+	std::lock_guard<std::mutex> Guard(Lock);
+	if (Jobs.empty())
+	{
+		return nullptr;
+	}
+	FJobHandle Job = std::move(Jobs.front());
+	Jobs.pop_front();
+	return Job;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 초기화 / 종료
+// ────────────────────────────────────────────────────────────────────────────
+
+void FJobSystem::Initialize(uint32 InNumWorkers)
+{
+	if (bInitialized)
+	{
+		return;
+	}
+
+	if (InNumWorkers == 0)
+	{
+		const uint32 HardwareThreads = std::thread::hardware_concurrency();
+		InNumWorkers = HardwareThreads > 1 ? HardwareThreads - 1 : 1;
+	}
+
+	bShutdownRequested = false;
+	NumQueuedJobs = 0;
+
+	// 큐를 모두 만든 뒤 스레드를 시작해야 Steal 시 Workers 배열이 바뀌지 않음
+	Workers.reserve(InNumWorkers);
+	for (uint32 i = 0; i < InNumWorkers; ++i)
+	{
+		Workers.emplace_back(std::make_unique<FWorker>());
+	}
+	for (uint32 i = 0; i < InNumWorkers; ++i)
+	{
+		Workers[i]->Thread = std::thread(&FJobSystem::WorkerMain, static_cast<int32>(i));
+	}
+
+	bInitialized = true;
+}
+
+void FJobSystem::Shutdown()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	// 남은 잡 처리
+	while (TryExecuteOneJob())
+	{
+	}
+
+	{
+		std::lock_guard<std::mutex> Guard(WakeLock);
+		bShutdownRequested = true;
+	}
+	WakeCondition.notify_all();
+
+	for (std::unique_ptr<FWorker>& Worker : Workers)
+	{
+		if (Worker->Thread.joinable())
+		{
+			Worker->Thread.join();
+		}
+	}
+
+	Workers.clear();
+	bInitialized = false;
+}
+
+int32 FJobSystem::GetCurrentWorkerIndex()
+{
+	return GWorkerIndex;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 잡 / 태스크 그래프
+// ────────────────────────────────────────────────────────────────────────────
+
+FJobHandle FJobSystem::Dispatch(FJobFunction Task, const std::vector<FJobHandle>& Prerequisites)
+{
+	FJobHandle Job = std::make_shared<FJob>();
+	Job->Task = std::move(Task);
+
+	for (const FJobHandle& Prerequisite : Prerequisites)
+	{
+		if (!Prerequisite)
+		{
+			continue;
+		}
+
+		// 완료 처리와 경쟁하지 않도록 선행 잡의 락 안에서 완료 여부 확인 후 등록
+		std::lock_guard<std::mutex> Guard(Prerequisite->DependentsLock);
+		if (!Prerequisite->IsCompleted())
+		{
+			Job->PendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+			Prerequisite->Dependents.push_back(Job);
+		}
+	}
+
+	// 등록 가드 해제. 선행 잡이 없거나 모두 끝났으면 바로 큐에 넣음
+	if (Job->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Enqueue(Job);
+	}
+
+	return Job;
+}
+
+void FJobSystem::Wait(const FJobHandle& Job)
+{
+	if (!Job)
+	{
+		return;
+	}
+
+	while (!Job->IsCompleted())
+	{
+		// 기다리는 동안 다른 잡을 대신 처리 (워커에서 Wait 해도 교착되지 않음)
+		if (!TryExecuteOneJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FJobSystem::WaitAll(const std::vector<FJobHandle>& Jobs)
+{
+	for (const FJobHandle& Job : Jobs)
+	{
+		Wait(Job);
+	}
+}
+
+void FJobSystem::Enqueue(FJobHandle Job)
+{
+	// 워커가 없으면 호출 스레드에서 즉시 실행
+	if (Workers.empty())
+	{
+		Execute(Job);
+		return;
+	}
+
+	// 워커 스레드는 자기 큐에, 그 외 스레드는 라운드로빈으로 분배
+	int32 QueueIndex = GWorkerIndex;
+	if (QueueIndex < 0)
+	{
+		QueueIndex = static_cast<int32>(NextExternalQueue.fetch_add(1, std::memory_order_relaxed) % Workers.size());
+	}
+
+	NumQueuedJobs.fetch_add(1, std::memory_order_release);
+	Workers[QueueIndex]->Queue.Push(std::move(Job));
+
+	// 빈 락을 한 번 잡아 대기 직전의 워커가 알림을 놓치지 않게 함
+	{
+		std::lock_guard<std::mutex> Guard(WakeLock);
+	}
+	WakeCondition.notify_one();
+}
+
+void FJobSystem::Execute(const FJobHandle& Job)
+{
+	if (Job->Task)
+	{
+		Job->Task();
+		Job->Task = nullptr; // 캡처한 리소스를 바로 해제
+	}
+
+	ExecutedJobs.fetch_add(1, std::memory_order_relaxed);
+
+	std::vector<FJobHandle> ReadyDependents;
+	{
+		std::lock_guard<std::mutex> Guard(Job->DependentsLock);
+		Job->bCompleted.store(true, std::memory_order_release);
+		ReadyDependents.swap(Job->Dependents);
+	}
+
+	for (FJobHandle& Dependent : ReadyDependents)
+	{
+		if (Dependent->PendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Enqueue(std::move(Dependent));
+		}
+	}
+}
+
+FJobHandle FJobSystem::FindJob(int32 WorkerIndex)
+{
+	const int32 NumWorkers = static_cast<int32>(Workers.size());
+	if (NumWorkers == 0 || NumQueuedJobs.load(std::memory_order_acquire) <= 0)
+	{
+		return nullptr;
+	}
+
+	// 1. 자기 큐 (LIFO, 캐시에 남아 있을 가능성이 높은 최근 잡)
+	if (WorkerIndex >= 0)
+	{
+		if (FJobHandle Job = Workers[WorkerIndex]->Queue.Pop())
+		{
+			NumQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+			return Job;
+		}
+	}
+
+	// 2. 다른 워커 큐에서 Steal (FIFO, 임의 위치부터 순회)
+	const int32 StartIndex = static_cast<int32>(NextStealSeed() % static_cast<uint32>(NumWorkers));
+	for (int32 Offset = 0; Offset < NumWorkers; ++Offset)
+	{
+		const int32 VictimIndex = (StartIndex + Offset) % NumWorkers;
+		if (VictimIndex == WorkerIndex)
+		{
+			continue;
+		}
+
+		if (FJobHandle Job = Workers[VictimIndex]->Queue.Steal())
+		{
+			NumQueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+			StolenJobs.fetch_add(1, std::memory_order_relaxed);
+			return Job;
+		}
+	}
+
+	return nullptr;
+}
+
+bool FJobSystem::TryExecuteOneJob()
+{
+	if (FJobHandle Job = FindJob(GWorkerIndex))
+	{
+		Execute(Job);
+		return true;
+	}
+	return false;
+}
+
+void FJobSystem::WorkerMain(int32 WorkerIndex)
+{
+	GWorkerIndex = WorkerIndex;
+	GStealSeed ^= static_cast<uint32>(WorkerIndex + 1) * 0x85EBCA6Bu;
+
+	while (true)
+	{
+		if (TryExecuteOneJob())
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> Guard(WakeLock);
+		WakeCondition.wait(Guard, []
+		{
+			return bShutdownRequested.load(std::memory_order_acquire)
+				|| NumQueuedJobs.load(std::memory_order_acquire) > 0;
+		});
+
+		if (bShutdownRequested.load(std::memory_order_acquire)
+			&& NumQueuedJobs.load(std::memory_order_acquire) <= 0)
+		{
+			break;
+		}
+	}
+
+	GWorkerIndex = -1;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// ParallelFor
+// ────────────────────────────────────────────────────────────────────────────
+
+void FJobSystem::ParallelForInternal(int32 NumBatches, const std::function<void(int32)>& BatchFn)
+{
+	// 헬퍼 잡이 호출자보다 오래 살아남을 수 있으므로 공유 상태는 shared_ptr로 유지.
+	// BatchFn은 배치를 하나라도 가져간 헬퍼만 호출하며, 그 동안 호출자는 반환하지 않음
+	struct FParallelForContext
+	{
+		const std::function<void(int32)>* BatchFn = nullptr;
+		int32 NumBatches = 0;
+		std::atomic<int32> NextBatch{ 0 };
+		std::atomic<int32> CompletedBatches{ 0 };
+
+		void Run()
+		{
+			while (true)
+			{
+				const int32 BatchIndex = NextBatch.fetch_add(1, std::memory_order_relaxed);
+				if (BatchIndex >= NumBatches)
+				{
+					return;
+				}
+				(*BatchFn)(BatchIndex);
+				CompletedBatches.fetch_add(1, std::memory_order_release);
+			}
+		}
+	};
+
+	std::shared_ptr<FParallelForContext> Context = std::make_shared<FParallelForContext>();
+	Context->BatchFn = &BatchFn;
+	Context->NumBatches = NumBatches;
+
+	// 호출 스레드도 배치를 처리하므로 헬퍼는 최대 NumBatches - 1개
+	const int32 NumHelpers = std::min(static_cast<int32>(Workers.size()), NumBatches - 1);
+	for (int32 i = 0; i < NumHelpers; ++i)
+	{
+		Dispatch([Context]() { Context->Run(); });
+	}
+
+	Context->Run();
+
+	while (Context->CompletedBatches.load(std::memory_order_acquire) < NumBatches)
+	{
+		if (!TryExecuteOneJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 통계
+// ────────────────────────────────────────────────────────────────────────────
+
+FJobSystem::FStats FJobSystem::GetStats()
+{
+	FStats Stats;
+	Stats.ExecutedJobs = ExecutedJobs.load(std::memory_order_relaxed);
+	Stats.StolenJobs = StolenJobs.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FJobSystem::ResetStats()
+{
+	ExecutedJobs = 0;
+	StolenJobs = 0;
+}
@@ -0,0 +1,230 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <vector>
+#include "CoreTypes.h"
+
+// ────────────────────────────────────────────────────────────────────────────
+// JobSystem.h
+// 엔진 공용 Work-Stealing 잡 스케줄러
+// ────────────────────────────────────────────────────────────────────────────
+
+struct FJob;
+
+/** 잡 핸들. 선행 조건(Prerequisite)이나 대기(Wait) 대상으로 사용합니다. */
+using FJobHandle = std::shared_ptr<FJob>;
+
+/** 잡이 실행할 작업 */
+using FJobFunction = std::function<void()>;
+
+/**
+ * FJob
+ *
+ * 스케줄러가 실행하는 단위 작업입니다.
+ * 선행 잡이 모두 끝나야 워커 큐에 들어가며, 완료되면 후행 잡들의 대기 카운트를 줄입니다.
+ */
+struct FJob
+{
+	/** 실행할 작업 */
+	FJobFunction Task;
+
+	/** 아직 끝나지 않은 선행 잡 수 (+1은 등록 중 가드) */
+	std::atomic<int32> PendingPrerequisites{ 1 };
+
+	/** 완료 여부 */
+	std::atomic<bool> bCompleted{ false };
+
+	/** 이 잡이 끝나길 기다리는 후행 잡들 (DependentsLock으로 보호) */
+	std::vector<FJobHandle> Dependents;
+	std::mutex DependentsLock;
+
+	bool IsCompleted() const { return bCompleted.load(std::memory_order_acquire); }
+};
+
+/**
+ * FJobSystem
+ *
+ * 코어 수만큼의 워커 스레드와 워커별 Deque를 가진 Work-Stealing 스케줄러입니다.
+ * - 워커는 자기 Deque의 뒤(LIFO)에서 꺼내고, 비면 다른 워커 Deque의 앞(FIFO)에서 훔쳐옵니다.
+ * - 게임 스레드는 워커가 아니지만 Wait/ParallelFor 중에는 큐의 잡을 같이 실행합니다.
+ * - Initialize 전이거나 워커가 0개면 모든 API가 호출 스레드에서 즉시 실행됩니다.
+ *
+ * 플랫폼 API 없이 표준 라이브러리(std::thread)만 사용합니다.
+ * 공개 헤더도 UEContainer.h 대신 std 컨테이너를 써서 엔진 없이 빌드됩니다. (Tests/JobSystemStress)
+ */
+class FJobSystem
+{
+public:
+	/**
+	 * 워커 스레드를 생성합니다.
+	 *
+	 * @param InNumWorkers - 워커 수 (0이면 하드웨어 스레드 수 - 1, 호출 스레드가 나머지 코어를 사용)
+	 */
+	static void Initialize(uint32 InNumWorkers = 0);
+
+	/**
+	 * 남은 잡을 모두 처리한 뒤 워커 스레드를 종료합니다.
+	 */
+	static void Shutdown();
+
+	static bool IsInitialized() { return bInitialized; }
+
+	/** 워커 스레드 수 (호출 스레드 제외) */
+	static uint32 GetNumWorkers() { return static_cast<uint32>(Workers.size()); }
+
+	/** 현재 스레드의 워커 인덱스 (워커가 아니면 -1) */
+	static int32 GetCurrentWorkerIndex();
+
+	// ────────────────────────────────────────────────
+	// 잡 / 태스크 그래프
+	// ────────────────────────────────────────────────
+
+	/**
+	 * 잡을 생성해 스케줄합니다.
+	 * 선행 잡이 모두 완료된 뒤에 실행됩니다.
+	 *
+	 * @param Task - 실행할 작업
+	 * @param Prerequisites - 선행 잡 목록 (nullptr 항목은 무시)
+	 * @return 생성된 잡 핸들
+	 */
+	static FJobHandle Dispatch(FJobFunction Task, const std::vector<FJobHandle>& Prerequisites = {});
+
+	/**
+	 * 잡이 완료될 때까지 기다립니다.
+	 * 기다리는 동안 호출 스레드도 큐에 있는 잡을 실행합니다.
+	 */
+	static void Wait(const FJobHandle& Job);
+
+	/**
+	 * 모든 잡이 완료될 때까지 기다립니다.
+	 */
+	static void WaitAll(const std::vector<FJobHandle>& Jobs);
+
+	// ────────────────────────────────────────────────
+	// ParallelFor
+	// ────────────────────────────────────────────────
+
+	/**
+	 * [0, Num) 범위를 BatchSize 단위로 나눠 병렬로 Fn(Index)을 호출합니다.
+	 * 호출 스레드도 배치를 처리하며, 모든 인덱스가 끝나야 반환합니다.
+	 *
+	 * @param Num - 전체 인덱스 수
+	 * @param BatchSize - 한 번에 가져가는 인덱스 수 (1 이상)
+	 * @param Fn - void(int32 Index)
+	 */
+	template<typename FuncType>
+	static void ParallelFor(int32 Num, int32 BatchSize, const FuncType& Fn)
+	{
+		ParallelForRange(Num, BatchSize, [&Fn](int32 Start, int32 End)
+		{
+			for (int32 Index = Start; Index < End; ++Index)
+			{
+				Fn(Index);
+			}
+		});
+	}
+
+	/**
+	 * ParallelFor의 구간 버전. 배치마다 Fn(Start, End)를 한 번 호출합니다.
+	 * 배치 내부 루프를 직접 작성할 수 있어 SIMD 커널 등에 적합합니다.
+	 *
+	 * @param Num - 전체 인덱스 수
+	 * @param BatchSize - 한 번에 가져가는 인덱스 수 (1 이상)
+	 * @param Fn - void(int32 Start, int32 End)
+	 */
+	template<typename FuncType>
+	static void ParallelForRange(int32 Num, int32 BatchSize, const FuncType& Fn)
+	{
+		if (Num <= 0)
+		{
+			return;
+		}
+
+		BatchSize = std::max(1, BatchSize);
+		const int32 NumBatches = (Num + BatchSize - 1) / BatchSize;
+
+		// 병렬화할 이유가 없으면 호출 스레드에서 바로 실행
+		if (NumBatches == 1 || Workers.empty())
+		{
+			Fn(0, Num);
+			return;
+		}
+
+		const std::function<void(int32)> BatchFn = [&Fn, Num, BatchSize](int32 BatchIndex)
+		{
+			const int32 Start = BatchIndex * BatchSize;
+			Fn(Start, std::min(Start + BatchSize, Num));
+		};
+		ParallelForInternal(NumBatches, BatchFn);
+	}
+
+	// ────────────────────────────────────────────────
+	// 통계
+	// ────────────────────────────────────────────────
+
+	struct FStats
+	{
+		/** 실행된 잡 수 */
+		uint64 ExecutedJobs = 0;
+
+		/** 다른 워커 큐에서 훔쳐 실행한 잡 수 */
+		uint64 StolenJobs = 0;
+	};
+
+	static FStats GetStats();
+	static void ResetStats();
+
+private:
+	/**
+	 * 워커별 잡 Deque.
+	 * 소유 워커는 뒤에서 Push/Pop, 다른 스레드는 앞에서 Steal 합니다.
+	 */
+	struct FWorkerQueue
+	{
+		std::mutex Lock;
+		std::deque<FJobHandle> Jobs;
+
+		void Push(FJobHandle Job);
+		FJobHandle Pop();
+		FJobHandle Steal();
+	};
+
+	struct FWorker;
+
+	static void ParallelForInternal(int32 NumBatches, const std::function<void(int32)>& BatchFn);
+
+	/** 선행 조건이 모두 풀린 잡을 큐에 넣습니다. */
+	static void Enqueue(FJobHandle Job);
+
+	/** 잡을 실행하고 후행 잡들을 깨웁니다. */
+	static void Execute(const FJobHandle& Job);
+
+	/** 자기 큐 → 다른 큐 순서로 실행 가능한 잡을 하나 찾습니다. */
+	static FJobHandle FindJob(int32 WorkerIndex);
+
+	/** 잡 하나를 찾아 실행합니다. 실행했으면 true */
+	static bool TryExecuteOneJob();
+
+	static void WorkerMain(int32 WorkerIndex);
+
+	static bool bInitialized;
+	static std::vector<std::unique_ptr<FWorker>> Workers;
+
+	/** 워커가 아닌 스레드가 넣은 잡을 나눠 넣을 라운드로빈 카운터 */
+	static std::atomic<uint32> NextExternalQueue;
+
+	/** 큐에 들어가 아직 꺼내지지 않은 잡 수 (워커 수면/기상 판단용) */
+	static std::atomic<int32> NumQueuedJobs;
+
+	static std::atomic<bool> bShutdownRequested;
+	static std::mutex WakeLock;
+	static std::condition_variable WakeCondition;
+
+	static std::atomic<uint64> ExecutedJobs;
+	static std::atomic<uint64> StolenJobs;
+};
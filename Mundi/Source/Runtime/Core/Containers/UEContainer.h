@@ -1,19 +1,6 @@
 ﻿#pragma once
 
-/** UE5 스타일 기본 타입 정의 */
-typedef int int32;
-typedef unsigned int uint32;
-typedef long long int64;
-typedef unsigned long long uint64;
-typedef char int8;
-typedef unsigned char uint8;
-typedef short int16;
-typedef unsigned short uint16;
-typedef float float32;
-typedef double float64;
-typedef bool UBOOL;
-typedef wchar_t WIDECHAR;
-//typedef size_t SIZE_T;    // Windows SDK 헤더인 basetsd.h 에 이미 선언되어 있음
+#include "CoreTypes.h"
 
 /** UE5 스타일 문자열 정의 */
 typedef std::string FString;
@@ -238,6 +225,35 @@ public:
     }
 };
 
+/**
+ * TArrayView - 연속 메모리에 대한 소유하지 않는 읽기 전용 뷰
+ * 메모리 매핑 파일처럼 TArray가 아닌 버퍼도 TArray와 같은 방식(Num, 인덱싱, 범위 for)으로 읽을 수 있다.
+ */
+template<typename T>
+class TArrayView
+{
+public:
+    TArrayView() = default;
+    TArrayView(const T* InData, int32 InNum) : Data(InData), Count(InNum) {}
+    TArrayView(const TArray<T>& InArray) : Data(InArray.GetData()), Count(InArray.Num()) {}
+
+    int32 Num() const { return Count; }
+    bool IsEmpty() const { return Count == 0; }
+    const T* GetData() const { return Data; }
+
+    const T& operator[](int32 Index) const { return Data[Index]; }
+
+    const T* begin() const { return Data; }
+    const T* end() const { return Data + Count; }
+
+    /** 소유 배열로 복사 (한 번의 연속 복사) */
+    TArray<T> ToArray() const { return TArray<T>(begin(), end()); }
+
+private:
+    const T* Data = nullptr;
+    int32 Count = 0;
+};
+
 /** TSet - 해시 기반 집합 */
 template<typename T>
 class TSet : public std::unordered_set<T>
@@ -3,28 +3,312 @@
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <mutex>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
+std::atomic<uint64> FMemoryManager::TotalAllocationBytes{ 0 };
+std::atomic<uint64> FMemoryManager::TotalAllocationCount{ 0 };
 
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// ──────────────────────────────────────────────────────
+	// 크기 클래스
+	// 16 ~ 256: 16 간격 (16개) / 320 ~ 1024: 64 간격 (12개) / 1280 ~ 4096: 256 간격 (12개)
+	// ──────────────────────────────────────────────────────
+	constexpr uint32 NumSizeClasses = 40;
+	constexpr SIZE_T MinAlignment = 16;
+
+	constexpr uint32 GetSizeClassSize(uint32 Index)
+	{
+		return Index < 16 ? (Index + 1) * 16
+			: Index < 28 ? 256 + (Index - 15) * 64
+			: 1024 + (Index - 27) * 256;
+	}
+	static_assert(GetSizeClassSize(15) == 256 && GetSizeClassSize(16) == 320, "크기 클래스 경계 불일치");
+	static_assert(GetSizeClassSize(27) == 1024 && GetSizeClassSize(28) == 1280, "크기 클래스 경계 불일치");
+	static_assert(GetSizeClassSize(NumSizeClasses - 1) == FMemoryManager::MaxSlabObjectSize, "마지막 크기 클래스는 MaxSlabObjectSize여야 합니다.");
+
+	/** Size(1 ~ MaxSlabObjectSize)가 들어가는 가장 작은 크기 클래스 */
+	uint32 SizeToClass(SIZE_T Size)
+	{
+		if (Size <= 256)
+			return static_cast<uint32>((Size + 15) / 16) - 1;
+		if (Size <= 1024)
+			return 15 + static_cast<uint32>((Size - 256 + 63) / 64);
+		return 27 + static_cast<uint32>((Size - 1024 + 255) / 256);
+	}
+
+	// ──────────────────────────────────────────────────────
+	// 슬랩 페이지
+	// 64KB 정렬 페이지의 앞 64바이트가 헤더, 나머지를 같은 크기의 슬롯으로 나눈다.
+	// 슬롯 크기는 16의 배수이고 헤더가 64바이트이므로 슬롯 주소는 크기 클래스가 나누는 정렬까지 맞는다.
+	// ──────────────────────────────────────────────────────
+	constexpr SIZE_T PageHeaderSize = 64;
+
+	struct FSlabPage
+	{
+		FSlabPage* Prev = nullptr;		// 빈 슬롯이 있는 페이지 리스트 (크기 클래스별) / 전역 빈 페이지 스택
+		FSlabPage* Next = nullptr;
+		void* FreeList = nullptr;		// 반환된 슬롯 (슬롯 앞 8바이트에 다음 슬롯 주소)
+		uint32 SizeClass = 0;
+		uint32 ObjectSize = 0;
+		uint32 NumUsed = 0;
+		uint32 NumBumped = 0;			// 한 번도 내주지 않은 슬롯은 이 번호부터 순서대로 잘라 쓴다.
+		uint32 Capacity = 0;
+	};
+	static_assert(sizeof(FSlabPage) <= PageHeaderSize, "슬랩 페이지 헤더가 64바이트를 넘습니다.");
+
+	struct FSizeClass
+	{
+		std::mutex Lock;
+		FSlabPage* PartialPages = nullptr;	// NumUsed < Capacity인 페이지만
+		std::atomic<uint32> LiveObjects{ 0 };
+		std::atomic<uint32> NumPages{ 0 };
+	};
+
+	void LinkPage(FSlabPage*& Head, FSlabPage* Page)
+	{
+		Page->Prev = nullptr;
+		Page->Next = Head;
+		if (Head)
+			Head->Prev = Page;
+		Head = Page;
+	}
+
+	void UnlinkPage(FSlabPage*& Head, FSlabPage* Page)
+	{
+		if (Page->Prev)
+			Page->Prev->Next = Page->Next;
+		else
+			Head = Page->Next;
+		if (Page->Next)
+			Page->Next->Prev = Page->Prev;
+		Page->Prev = Page->Next = nullptr;
+	}
+
+	struct FSlabAllocator
+	{
+		uint8* Base = nullptr;				// 예약 시작 (VirtualAlloc 예약 단위가 64KB이므로 페이지 정렬)
+		std::mutex PageLock;
+		SIZE_T NextPageOffset = 0;			// 아직 커밋하지 않은 첫 페이지
+		FSlabPage* FreePages = nullptr;		// 비어서 돌아온 페이지 (커밋 유지, 어떤 크기 클래스든 재사용)
+		std::atomic<uint64> CommittedBytes{ 0 };
+		FSizeClass Classes[NumSizeClasses];
+
+		// 예약에 실패하면 Base가 nullptr로 남고 모든 할당이 큰 블록 경로로 간다.
+		// (첫 UObject 생성 시점이라 콘솔 로그가 준비되지 않았을 수 있으므로 로그는 남기지 않음)
+		FSlabAllocator()
+		{
+			Base = static_cast<uint8*>(VirtualAlloc(nullptr, FMemoryManager::SlabReserveSize, MEM_RESERVE, PAGE_READWRITE));
+		}
+
+		bool Contains(const void* Ptr) const
+		{
+			return Base && reinterpret_cast<uintptr_t>(Ptr) - reinterpret_cast<uintptr_t>(Base) < FMemoryManager::SlabReserveSize;
+		}
+
+		/** 빈 페이지를 하나 꺼내 SizeClass용으로 초기화한다. 예약 범위를 다 쓰면 nullptr */
+		FSlabPage* AcquirePage(uint32 SizeClass)
+		{
+			void* Memory = nullptr;
+			{
+				std::lock_guard<std::mutex> Guard(PageLock);
+				if (FreePages)
+				{
+					Memory = FreePages;
+					FreePages = FreePages->Next;
+				}
+				else if (Base && NextPageOffset + FMemoryManager::SlabPageSize <= FMemoryManager::SlabReserveSize)
+				{
+					Memory = VirtualAlloc(Base + NextPageOffset, FMemoryManager::SlabPageSize, MEM_COMMIT, PAGE_READWRITE);
+					if (!Memory)
+						return nullptr;
+					NextPageOffset += FMemoryManager::SlabPageSize;
+					CommittedBytes.fetch_add(FMemoryManager::SlabPageSize, std::memory_order_relaxed);
+				}
+				else
+				{
+					return nullptr;
+				}
+			}
+
+			FSlabPage* Page = new (Memory) FSlabPage();
+			Page->SizeClass = SizeClass;
+			Page->ObjectSize = GetSizeClassSize(SizeClass);
+			Page->Capacity = static_cast<uint32>((FMemoryManager::SlabPageSize - PageHeaderSize) / Page->ObjectSize);
+			return Page;
+		}
+
+		void ReleasePage(FSlabPage* Page)
+		{
+			std::lock_guard<std::mutex> Guard(PageLock);
+			Page->Prev = nullptr;
+			Page->Next = FreePages;
+			FreePages = Page;
+		}
+
+		void* Allocate(uint32 SizeClass)
+		{
+			FSizeClass& Class = Classes[SizeClass];
+			std::lock_guard<std::mutex> Guard(Class.Lock);
+
+			FSlabPage* Page = Class.PartialPages;
+			if (!Page)
+			{
+				Page = AcquirePage(SizeClass);
+				if (!Page)
+					return nullptr;
+				LinkPage(Class.PartialPages, Page);
+				Class.NumPages.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			void* Slot;
+			if (Page->FreeList)
+			{
+				Slot = Page->FreeList;
+				Page->FreeList = *static_cast<void**>(Slot);
+			}
+			else
+			{
+				Slot = reinterpret_cast<uint8*>(Page) + PageHeaderSize + SIZE_T(Page->NumBumped) * Page->ObjectSize;
+				++Page->NumBumped;
+			}
+
+			if (++Page->NumUsed == Page->Capacity)
+				UnlinkPage(Class.PartialPages, Page);
+			Class.LiveObjects.fetch_add(1, std::memory_order_relaxed);
+			return Slot;
+		}
+
+		void Deallocate(void* Ptr)
+		{
+			// 살아있는 슬롯이 있는 페이지이므로 SizeClass는 락 밖에서 읽어도 바뀌지 않는다.
+			FSlabPage* Page = reinterpret_cast<FSlabPage*>(reinterpret_cast<uintptr_t>(Ptr) & ~uintptr_t(FMemoryManager::SlabPageSize - 1));
+			FSizeClass& Class = Classes[Page->SizeClass];
+
+			bool bReleasePage = false;
+			{
+				std::lock_guard<std::mutex> Guard(Class.Lock);
+				const bool bWasFull = Page->NumUsed == Page->Capacity;
+
+				*static_cast<void**>(Ptr) = Page->FreeList;
+				Page->FreeList = Ptr;
+				--Page->NumUsed;
+				Class.LiveObjects.fetch_sub(1, std::memory_order_relaxed);
+
+				if (bWasFull)
+					LinkPage(Class.PartialPages, Page);
+
+				// 비었으면 전역 풀로 돌려 다른 크기 클래스가 쓰게 한다.
+				// 단, 이 클래스의 유일한 페이지라면 생성/파괴가 반복될 때 매번 주고받지 않도록 남겨 둔다.
+				if (Page->NumUsed == 0 && (Page->Prev || Page->Next))
+				{
+					UnlinkPage(Class.PartialPages, Page);
+					Class.NumPages.fetch_sub(1, std::memory_order_relaxed);
+					bReleasePage = true;
+				}
+			}
+
+			if (bReleasePage)
+				ReleasePage(Page);
+		}
+	};
+
+	/**
+	 * 프로세스 종료까지 파괴하지 않는다.
+	 * 정적 소멸 단계에서 해제되는 UObject도 슬랩으로 돌아올 수 있어야 하기 때문 (메모리는 OS가 회수)
+	 */
+	FSlabAllocator& GetSlabAllocator()
+	{
+		static FSlabAllocator* Allocator = new FSlabAllocator();
+		return *Allocator;
+	}
+
+	// ──────────────────────────────────────────────────────
+	// 큰 블록 (슬랩 크기 / 정렬 초과)
+	// [Raw ... | Raw 주소 | Size][User]
+	// 헤더를 정렬 크기로 잡으므로 User는 요청한 정렬을 그대로 유지한다.
+	// ──────────────────────────────────────────────────────
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment)
+	{
+		const SIZE_T HeaderSize = Alignment;	// >= MinAlignment = 2 * sizeof(SIZE_T)
 
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		void* Raw = _aligned_malloc_dbg(Size + HeaderSize, Alignment, nullptr, 0);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		void* Raw = _aligned_malloc(Size + HeaderSize, Alignment);
 #endif
-	if (!Raw)
-		return nullptr;
+		if (!Raw)
+			return nullptr;
+
+		uint8* User = static_cast<uint8*>(Raw) + HeaderSize;
+		reinterpret_cast<void**>(User)[-2] = Raw;
+		reinterpret_cast<SIZE_T*>(User)[-1] = Size;
+		return User;
+	}
+
+	void DeallocateLarge(void* Ptr)
+	{
+		void* Raw = reinterpret_cast<void**>(Ptr)[-2];
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+		_aligned_free_dbg(Raw);
+#else
+		_aligned_free(Raw);
+#endif
+	}
+
+	// ──────────────────────────────────────────────────────
+	// 클래스별 통계 (UClass::ClassIndex로 인덱싱, 상수 초기화되므로 정적 초기화 순서와 무관)
+	// ──────────────────────────────────────────────────────
+	struct FClassAllocationStats
+	{
+		std::atomic<const UClass*> Class{ nullptr };
+		std::atomic<int32> LiveCount{ 0 };
+		std::atomic<int64> LiveBytes{ 0 };
+	};
+
+	FClassAllocationStats GClassAllocationStats[FMemoryManager::MaxTrackedClasses];
+
+	FClassAllocationStats* FindClassStats(const UClass* Class)
+	{
+		if (!Class || Class->ClassIndex >= FMemoryManager::MaxTrackedClasses)
+			return nullptr;
+		return &GClassAllocationStats[Class->ClassIndex];
+	}
+}
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	// MSVC x64의 alignof(std::max_align_t)는 8이지만 SIMD 멤버를 위해 최소 16바이트를 보장한다.
+	Alignment = std::max(Alignment, MinAlignment);
+	Size = std::max<SIZE_T>(Size, 1);
+
+	if (Size <= MaxSlabObjectSize && Alignment <= MaxSlabAlignment)
+	{
+		// 요청 정렬로 나누어떨어지는 첫 크기 클래스 (슬롯 주소 = 64바이트 정렬 헤더 뒤 + 크기의 배수)
+		for (uint32 Index = SizeToClass(Size); Index < NumSizeClasses; ++Index)
+		{
+			const uint32 ClassSize = GetSizeClassSize(Index);
+			if (ClassSize % Alignment != 0)
+				continue;
+
+			if (void* Ptr = GetSlabAllocator().Allocate(Index))
+			{
+				TotalAllocationBytes.fetch_add(ClassSize, std::memory_order_relaxed);
+				TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+				return Ptr;
+			}
+			break;	// 예약 범위 소진 → 일반 힙
+		}
+	}
+
+	void* Ptr = AllocateLarge(Size, Alignment);
+	if (!Ptr)
+		return nullptr;
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+	TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+	return Ptr;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +316,92 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	TotalAllocationBytes.fetch_sub(GetAllocationSize(Ptr), std::memory_order_relaxed);
+	TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	FSlabAllocator& Slab = GetSlabAllocator();
+	if (Slab.Contains(Ptr))
+		Slab.Deallocate(Ptr);
+	else
+		DeallocateLarge(Ptr);
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+SIZE_T FMemoryManager::GetAllocationSize(const void* Ptr)
+{
+	if (!Ptr)
+		return 0;
+
+	if (GetSlabAllocator().Contains(Ptr))
+	{
+		const FSlabPage* Page = reinterpret_cast<const FSlabPage*>(reinterpret_cast<uintptr_t>(Ptr) & ~uintptr_t(SlabPageSize - 1));
+		return Page->ObjectSize;
+	}
+	return reinterpret_cast<const SIZE_T*>(Ptr)[-1];
+}
+
+void FMemoryManager::TrackObjectAllocated(const UClass* Class, const void* Ptr)
+{
+	FClassAllocationStats* Stats = FindClassStats(Class);
+	if (!Stats)
+		return;
+
+	Stats->Class.store(Class, std::memory_order_relaxed);
+	Stats->LiveCount.fetch_add(1, std::memory_order_relaxed);
+	Stats->LiveBytes.fetch_add(static_cast<int64>(GetAllocationSize(Ptr)), std::memory_order_relaxed);
+}
+
+void FMemoryManager::TrackObjectFreed(const UClass* Class, const void* Ptr)
+{
+	FClassAllocationStats* Stats = FindClassStats(Class);
+	if (!Stats)
+		return;
+
+	Stats->LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	Stats->LiveBytes.fetch_sub(static_cast<int64>(GetAllocationSize(Ptr)), std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetSlabCommittedBytes()
+{
+	return GetSlabAllocator().CommittedBytes.load(std::memory_order_relaxed);
+}
+
+void FMemoryManager::GetSizeClassStats(TArray<FSizeClassStats>& OutStats)
+{
+	OutStats.Empty();
+
+	FSlabAllocator& Slab = GetSlabAllocator();
+	for (uint32 Index = 0; Index < NumSizeClasses; ++Index)
+	{
+		const FSizeClass& Class = Slab.Classes[Index];
+		FSizeClassStats Stats;
+		Stats.ObjectSize = GetSizeClassSize(Index);
+		Stats.LiveObjects = Class.LiveObjects.load(std::memory_order_relaxed);
+		Stats.NumPages = Class.NumPages.load(std::memory_order_relaxed);
+		if (Stats.LiveObjects > 0 || Stats.NumPages > 0)
+		{
+			OutStats.Add(Stats);
+		}
+	}
+}
+
+void FMemoryManager::GetClassStats(TArray<FClassStats>& OutStats)
+{
+	OutStats.Empty();
+
+	for (const FClassAllocationStats& Entry : GClassAllocationStats)
+	{
+		FClassStats Stats;
+		Stats.Class = Entry.Class.load(std::memory_order_relaxed);
+		Stats.LiveCount = Entry.LiveCount.load(std::memory_order_relaxed);
+		Stats.LiveBytes = Entry.LiveBytes.load(std::memory_order_relaxed);
+		if (Stats.Class && Stats.LiveCount > 0)
+		{
+			OutStats.Add(Stats);
+		}
+	}
+
+	std::sort(OutStats.begin(), OutStats.end(), [](const FClassStats& A, const FClassStats& B)
+	{
+		return A.LiveBytes > B.LiveBytes;
+	});
+}
@@ -1,15 +1,66 @@
 ﻿#pragma once
 #include <cstddef>
+#include <atomic>
 #include "UEContainer.h"
 
+struct UClass;
+
+/**
+ * @class FMemoryManager
+ * @brief UObject 전용 할당기
+ *
+ * - MaxSlabObjectSize 이하: 크기 클래스별 슬랩 (64KB 페이지, 예약해 둔 주소 범위에서 커밋)
+ *   같은 크기의 객체가 같은 페이지에 모이므로 대량 생성/파괴를 반복해도 일반 힙을 조각내지 않는다.
+ * - 그보다 크거나 정렬이 64바이트를 넘으면 정렬 크기만큼의 헤더를 앞에 둔 _aligned_malloc 블록
+ * 해제 시 주소가 슬랩 범위 안인지로 구분하므로 슬랩 객체에는 헤더가 없다.
+ * 모든 통계는 원자적으로 갱신한다. (워커 스레드 생성/파괴 허용)
+ */
 class FMemoryManager
 {
 public:
+	static constexpr SIZE_T SlabPageSize = 64 * 1024;
+	static constexpr SIZE_T MaxSlabObjectSize = 4096;
+	static constexpr SIZE_T MaxSlabAlignment = 64;
+	/** 슬랩용으로 예약하는 주소 공간 (실제 메모리는 페이지 단위로 필요할 때 커밋) */
+	static constexpr SIZE_T SlabReserveSize = SIZE_T(1) << 30;
+	/** 클래스별 통계를 추적하는 최대 클래스 수 (UClass::ClassIndex 기준) */
+	static constexpr uint32 MaxTrackedClasses = 1024;
+
 	// 인자 변수를 PascalCase로 변경
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	/** 블록이 실제로 차지하는 바이트 (슬랩은 크기 클래스 크기) */
+	static SIZE_T GetAllocationSize(const void* Ptr);
+
+	/** GUObjectArray에 등록/해제될 때 ObjectFactory / UObject가 호출 (클래스별 생존 개수 / 바이트) */
+	static void TrackObjectAllocated(const UClass* Class, const void* Ptr);
+	static void TrackObjectFreed(const UClass* Class, const void* Ptr);
+
+	static uint64 GetTotalAllocationBytes() { return TotalAllocationBytes.load(std::memory_order_relaxed); }
+	static uint64 GetTotalAllocationCount() { return TotalAllocationCount.load(std::memory_order_relaxed); }
+	/** 커밋된 슬랩 페이지 바이트 (빈 슬롯 포함) */
+	static uint64 GetSlabCommittedBytes();
+
+	struct FSizeClassStats
+	{
+		uint32 ObjectSize = 0;
+		uint32 LiveObjects = 0;
+		uint32 NumPages = 0;
+	};
+	/** 객체가 하나 이상 있었던 크기 클래스만 */
+	static void GetSizeClassStats(TArray<FSizeClassStats>& OutStats);
+
+	struct FClassStats
+	{
+		const UClass* Class = nullptr;
+		int32 LiveCount = 0;
+		int64 LiveBytes = 0;
+	};
+	/** 살아있는 객체가 있는 클래스를 바이트 내림차순으로 */
+	static void GetClassStats(TArray<FClassStats>& OutStats);
+
+private:
+	static std::atomic<uint64> TotalAllocationBytes;
+	static std::atomic<uint64> TotalAllocationCount;
+};
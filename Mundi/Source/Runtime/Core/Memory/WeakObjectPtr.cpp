@@ -4,15 +4,18 @@
 
 FWeakObjectPtr::FWeakObjectPtr()
     : InternalIndex(INDEX_NONE)
+    , SerialNumber(0)
 {
 }
 
 FWeakObjectPtr::FWeakObjectPtr(UObject* InObject)
     : InternalIndex(INDEX_NONE)
+    , SerialNumber(0)
 {
     if (InObject)
     {
         InternalIndex = InObject->InternalIndex;
+        SerialNumber = GUObjectArray.GetSerialNumber(InternalIndex);
     }
 }
 
@@ -23,13 +26,7 @@ UObject* FWeakObjectPtr::Get() const
         return nullptr;
     }
 
-    auto it = GUObjectArray.find(InternalIndex);
-    if (it != GUObjectArray.end())
-    {
-        return it->second;
-    }
-
-    return nullptr;
+    return GUObjectArray.IndexToObject(InternalIndex, SerialNumber);
 }
 
 bool FWeakObjectPtr::IsValid() const
@@ -12,10 +12,10 @@ constexpr uint32 INDEX_NONE = static_cast<uint32>(-1);
  * @class FWeakObjectPtr
  * @brief UObject의 소멸을 안전하게 감지하는 약한 포인터이다.
  *
- * 이 클래스는 UObject의 InternalIndex를 저장하여, GObjectArray를 통해
- * 해당 UObject가 여전히 유효한지(소멸되지 않았는지) 안전하게 검사한다.
- * @note 현재 구현은 UObject의 InternalIndex가 고유하며, GObjectArray의
- * 슬롯이 재사용되지 않음을 전제로 한다. (Stale Index 문제에 취약할 수 있음)
+ * 이 클래스는 UObject의 InternalIndex(슬롯 인덱스)와 슬롯 세대 번호를 저장하여,
+ * GUObjectArray를 통해 해당 UObject가 여전히 유효한지(소멸되지 않았는지) 안전하게 검사한다.
+ * @note 슬롯이 해제되면 세대 번호가 증가하므로, 같은 슬롯을 재사용한 새 객체는
+ * 이전 약한 포인터로 접근되지 않는다. 해석은 해시 조회 없이 슬롯 배열 접근만으로 끝난다.
  */
 class FWeakObjectPtr
 {
@@ -35,7 +35,7 @@ public:
     /**
      * @brief 이 약한 포인터가 가리키는 실제 UObject 포인터를 반환한다.
      *
-     * GObjectArray에서 InternalIndex를 조회하여 객체의 유효성을 검사한다.
+     * GUObjectArray에서 InternalIndex 슬롯을 조회하고 세대 번호가 같을 때만 객체를 반환한다.
      * 객체가 이미 소멸되었거나 유효하지 않은 인덱스인 경우 nullptr를 반환한다.
      *
      * @return 유효한 UObject 포인터이거나, 소멸된 경우 nullptr이다.
@@ -68,8 +68,11 @@ public:
     bool operator!=(const UObject* InObject) const;
 
 private:
-    /** @brief GObjectArray 내 UObject의 고유 인덱스이다. */
+    /** @brief GUObjectArray 내 UObject의 슬롯 인덱스이다. */
     uint32 InternalIndex;
+
+    /** @brief 생성 시점의 슬롯 세대 번호이다. (슬롯 재사용 감지) */
+    uint32 SerialNumber;
 };
 
 /*-----------------------------------------------------------------------------
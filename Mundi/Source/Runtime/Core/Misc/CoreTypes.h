@@ -0,0 +1,18 @@
+﻿#pragma once
+
+// 플랫폼 헤더 없이 쓸 수 있는 기본 타입만 둔다. (JobSystem처럼 엔진 밖에서도 빌드되는 코드용)
+
+/** UE5 스타일 기본 타입 정의 */
+typedef int int32;
+typedef unsigned int uint32;
+typedef long long int64;
+typedef unsigned long long uint64;
+typedef char int8;
+typedef unsigned char uint8;
+typedef short int16;
+typedef unsigned short uint16;
+typedef float float32;
+typedef double float64;
+typedef bool UBOOL;
+typedef wchar_t WIDECHAR;
+//typedef size_t SIZE_T;    // Windows SDK 헤더인 basetsd.h 에 이미 선언되어 있음
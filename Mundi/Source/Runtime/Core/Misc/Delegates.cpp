@@ -0,0 +1,106 @@
+﻿#include "pch.h"
+#include "Delegates.h"
+#include "PlatformTime.h"
+
+namespace
+{
+	/** 비교용: 이전 구현 (Broadcast마다 무효 핸들러 제거 + std::function 배열 복사) */
+	template<typename... Args>
+	class TLegacyDelegate
+	{
+	public:
+		using HandlerType = std::function<void(Args...)>;
+
+		template<typename TObj>
+		void AddDynamic(TObj* Instance, void(TObj::* Func)(Args...))
+		{
+			Handlers.push_back({ NextHandle++, [=](Args... args) { (Instance->*Func)(args...); }, [] { return true; } });
+		}
+
+		void Broadcast(Args... args)
+		{
+			Handlers.erase(std::remove_if(Handlers.begin(), Handlers.end(),
+				[](const Entry& Current) { return !Current.Validator(); }), Handlers.end());
+
+			std::vector<Entry> SafeHandlers = Handlers;
+			for (auto& Current : SafeHandlers)
+			{
+				if (Current.Handler)
+				{
+					Current.Handler(args...);
+				}
+			}
+		}
+
+	private:
+		struct Entry
+		{
+			FDelegateHandle Handle;
+			HandlerType Handler;
+			std::function<bool()> Validator;
+		};
+
+		std::vector<Entry> Handlers;
+		FDelegateHandle NextHandle = 1;
+	};
+
+	/** 충돌 콜백과 비슷한 크기의 인자를 받는 리스너 */
+	struct FBenchmarkListener
+	{
+		uint64 Sum = 0;
+
+		void OnEvent(int32 Value, const FVector& Normal)
+		{
+			Sum += static_cast<uint64>(Value) + static_cast<uint64>(Normal.X > 0.0f);
+		}
+	};
+}
+
+void FDelegateBenchmark::RunBenchmark(int32 Iterations)
+{
+	Iterations = std::max(1, Iterations);
+
+	UE_LOG("Delegate Broadcast Benchmark: %d broadcasts per case", Iterations);
+
+	const FVector Normal(1.0f, 0.0f, 0.0f);
+	for (const int32 NumListeners : { 1, 8, 64 })
+	{
+		TArray<FBenchmarkListener> LegacyListeners;
+		TArray<FBenchmarkListener> Listeners;
+		LegacyListeners.resize(NumListeners);
+		Listeners.resize(NumListeners);
+
+		TLegacyDelegate<int32, const FVector&> LegacyDelegate;
+		TDelegate<int32, const FVector&> Delegate;
+		for (int32 i = 0; i < NumListeners; ++i)
+		{
+			LegacyDelegate.AddDynamic(&LegacyListeners[i], &FBenchmarkListener::OnEvent);
+			Delegate.AddDynamic(&Listeners[i], &FBenchmarkListener::OnEvent);
+		}
+
+		auto Measure = [Iterations](auto&& Body)
+		{
+			const uint64 Start = FWindowsPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Body(Iteration);
+			}
+			const uint64 End = FWindowsPlatformTime::Cycles64();
+			return FWindowsPlatformTime::ToMilliseconds(End - Start) * 1.0e6 / Iterations;
+		};
+
+		const double LegacyNS = Measure([&](int32 Iteration) { LegacyDelegate.Broadcast(Iteration, Normal); });
+		const double NewNS = Measure([&](int32 Iteration) { Delegate.Broadcast(Iteration, Normal); });
+
+		uint64 LegacySum = 0;
+		uint64 NewSum = 0;
+		for (int32 i = 0; i < NumListeners; ++i)
+		{
+			LegacySum += LegacyListeners[i].Sum;
+			NewSum += Listeners[i].Sum;
+		}
+
+		UE_LOG("  %2d listeners : std::function copy %.1f ns, inline %.1f ns (x%.2f)%s",
+			NumListeners, LegacyNS, NewNS, NewNS > 0.0 ? LegacyNS / NewNS : 0.0, LegacySum == NewSum ? "" : " MISMATCH");
+	}
+}
@@ -4,105 +4,425 @@
 #include <functional>
 #include <algorithm>
 #include <memory>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <iterator>
 
 #include "WeakObjectPtr.h"
 
+/** 델리게이트 바인딩 핸들. 단조 증가하며 재사용하지 않으므로 이미 제거된 핸들로 새 바인딩을 지울 수 없다. */
 using FDelegateHandle = size_t;
 
+/**
+ * @class TDelegateFunction
+ * @brief 델리게이트 핸들러용 호출 객체 (std::function 대체)
+ *
+ * InlineSize 이하의 호출 객체(람다 캡처, 인스턴스 + 멤버 함수 포인터 등)는 내부 버퍼에 그대로 저장해 힙 할당이 없다.
+ * 더 큰 호출 객체만 바인딩 시점에 한 번 힙에 올린다. (Broadcast 중에는 할당하지 않음)
+ */
+template<typename... Args>
+class TDelegateFunction
+{
+public:
+    static constexpr size_t InlineSize = sizeof(void*) * 6;
+
+    TDelegateFunction() = default;
+
+    template<typename FuncType, typename = std::enable_if_t<!std::is_same_v<std::decay_t<FuncType>, TDelegateFunction>>>
+    TDelegateFunction(FuncType&& Func)
+    {
+        using FStored = std::decay_t<FuncType>;
+        if constexpr (bFitsInline<FStored>)
+        {
+            new (Storage) FStored(std::forward<FuncType>(Func));
+            Ops = &TInlineOps<FStored>::Table;
+        }
+        else
+        {
+            *reinterpret_cast<FStored**>(Storage) = new FStored(std::forward<FuncType>(Func));
+            Ops = &THeapOps<FStored>::Table;
+        }
+    }
+
+    TDelegateFunction(const TDelegateFunction& Other)
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->Copy(Storage, Other.Storage);
+            Ops = Other.Ops;
+        }
+    }
+
+    TDelegateFunction(TDelegateFunction&& Other) noexcept
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->Relocate(Storage, Other.Storage);
+            Ops = Other.Ops;
+            Other.Ops = nullptr;
+        }
+    }
+
+    TDelegateFunction& operator=(const TDelegateFunction& Other)
+    {
+        if (this != &Other)
+        {
+            TDelegateFunction Copy(Other);
+            *this = std::move(Copy);
+        }
+        return *this;
+    }
+
+    TDelegateFunction& operator=(TDelegateFunction&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            if (Other.Ops)
+            {
+                Other.Ops->Relocate(Storage, Other.Storage);
+                Ops = Other.Ops;
+                Other.Ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    ~TDelegateFunction()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
+    }
+
+    explicit operator bool() const { return Ops != nullptr; }
+
+    void operator()(Args... InArgs) const
+    {
+        Ops->Invoke(const_cast<unsigned char*>(Storage), std::forward<Args>(InArgs)...);
+    }
+
+private:
+    struct FOps
+    {
+        void (*Invoke)(void* Storage, Args&&... InArgs);
+        void (*Copy)(void* Dest, const void* Src);
+        void (*Relocate)(void* Dest, void* Src);  // Dest로 옮기고 Src는 소멸
+        void (*Destroy)(void* Storage);
+    };
+
+    template<typename F>
+    static constexpr bool bFitsInline = sizeof(F) <= InlineSize
+        && alignof(F) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible_v<F>;
+
+    template<typename F>
+    struct TInlineOps
+    {
+        static void Invoke(void* S, Args&&... InArgs) { (*static_cast<F*>(S))(std::forward<Args>(InArgs)...); }
+        static void Copy(void* D, const void* S) { new (D) F(*static_cast<const F*>(S)); }
+        static void Relocate(void* D, void* S) { new (D) F(std::move(*static_cast<F*>(S))); static_cast<F*>(S)->~F(); }
+        static void Destroy(void* S) { static_cast<F*>(S)->~F(); }
+        static constexpr FOps Table = { &Invoke, &Copy, &Relocate, &Destroy };
+    };
+
+    template<typename F>
+    struct THeapOps
+    {
+        static F*& Ptr(void* S) { return *static_cast<F**>(S); }
+        static void Invoke(void* S, Args&&... InArgs) { (*Ptr(S))(std::forward<Args>(InArgs)...); }
+        static void Copy(void* D, const void* S) { Ptr(D) = new F(**static_cast<F* const*>(S)); }
+        static void Relocate(void* D, void* S) { Ptr(D) = Ptr(S); Ptr(S) = nullptr; }
+        static void Destroy(void* S) { delete Ptr(S); }
+        static constexpr FOps Table = { &Invoke, &Copy, &Relocate, &Destroy };
+    };
+
+    alignas(std::max_align_t) unsigned char Storage[InlineSize];
+    const FOps* Ops = nullptr;
+};
+
+/**
+ * @class TDelegate
+ * @brief 멀티캐스트 델리게이트
+ *
+ * - Broadcast는 핸들러 배열을 복사하지 않고 인덱스로 순회한다. (핸들러 호출 외에는 할당 없음)
+ * - Broadcast 도중의 Remove / Clear는 항목에 제거 표시만 하고, 가장 바깥 Broadcast가 끝날 때 한꺼번에 정리한다.
+ * - Broadcast 도중의 Add는 대기 배열에 넣었다가 정리 시점에 합친다. (이번 Broadcast에서는 호출되지 않음)
+ * - 핸들러 안에서 델리게이트를 소유한 객체가 파괴되어도 남은 순회를 중단하고 안전하게 빠져나온다.
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
-    using HandlerType = std::function<void(Args...)>;
-    using ValidatorType = std::function<bool()>; 
+    using HandlerType = TDelegateFunction<Args...>;
+
+    TDelegate() = default;
+
+    TDelegate(const TDelegate& Other)
+    {
+        CopyLiveEntries(Other);
+    }
+
+    TDelegate& operator=(const TDelegate& Other)
+    {
+        if (this != &Other)
+        {
+            Clear();
+            CopyLiveEntries(Other);
+        }
+        return *this;
+    }
 
-    TDelegate() : NextHandle(1) {}
+    ~TDelegate()
+    {
+        // 핸들러 안에서 파괴됨: 진행 중인 Broadcast에 알림
+        if (DestroyedFlag)
+        {
+            *DestroyedFlag = true;
+        }
+    }
 
-    FDelegateHandle Add(const HandlerType& Handler)
+    template<typename FuncType>
+    FDelegateHandle Add(FuncType&& Handler)
     {
-       FDelegateHandle Handle = NextHandle++;
-       Handlers.push_back({ 
-           Handle, 
-           Handler, 
-           [] { return true; }
-       });
-       return Handle;
+        // 빈 std::function 등은 핸들만 발급하고 저장하지 않음
+        if constexpr (std::is_constructible_v<bool, const std::decay_t<FuncType>&>)
+        {
+            if (!static_cast<bool>(Handler))
+            {
+                return NextHandle++;
+            }
+        }
+        return AddEntry(HandlerType(std::forward<FuncType>(Handler)), FWeakObjectPtr(), false);
     }
 
     template<typename TObj, typename TClass>
     FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
     {
-        FDelegateHandle Handle = NextHandle++;
+        // 인스턴스 + 멤버 함수 포인터만 캡처하므로 인라인 버퍼에 들어감
+        HandlerType Handler([Instance, Func](Args... InArgs) { (Instance->*Func)(std::forward<Args>(InArgs)...); });
 
         if constexpr (std::is_base_of_v<UObject, TObj>)
         {
-            TWeakObjectPtr<TObj> WeakInstance(Instance);
-            Handlers.push_back({
-                Handle,
-                [WeakInstance, Func](Args... args) {
-                    if (auto Pinned = WeakInstance.Get()) (Pinned->*Func)(args...);
-                },
-                [WeakInstance] { return WeakInstance.IsValid(); }
-            });
+            // UObject는 약한 포인터로 생존을 확인하고, 소멸했으면 다음 Broadcast에서 제거
+            return AddEntry(std::move(Handler), FWeakObjectPtr(Instance), true);
         }
         else
         {
-            Handlers.push_back({
-                Handle,
-                [=](Args... args) { (Instance->*Func)(args...); },
-                [] { return true; }
-            });
+            return AddEntry(std::move(Handler), FWeakObjectPtr(), false);
         }
-        return Handle;
     }
 
-    void Broadcast(Args... args) 
+    void Broadcast(Args... args)
     {
-       auto NewEnd = std::remove_if(Handlers.begin(), Handlers.end(),
-           [](const Entry& Entry) {
-               if (!Entry.Validator()) 
-               {
-                   return true; 
-               }
-               return false;
-           });
+        // 이번 호출이 시작될 때의 핸들러까지만 호출 (Broadcast 중 추가된 것은 대기 배열에 있음)
+        const size_t NumHandlers = Handlers.size();
+        if (NumHandlers == 0)
+        {
+            return;
+        }
 
-       if (NewEnd != Handlers.end())
-       {
-           Handlers.erase(NewEnd, Handlers.end());
-       }
+        // 핸들러가 예외를 던져도 깊이 / 파괴 플래그를 되돌리도록 스코프 객체로 관리
+        FBroadcastScope Scope(*this);
 
-       std::vector<Entry> SafeHandlers = Handlers;
-       for (auto& Entry : SafeHandlers) {
-          if (Entry.Handler)
-          {
-             Entry.Handler(args...);
-          }
-       }
+        for (size_t Index = 0; Index < NumHandlers; ++Index)
+        {
+            Entry& Current = Handlers[Index];
+            if (Current.bRemoved)
+            {
+                continue;
+            }
+            if (Current.bWeakBound && !Current.BoundObject.IsValid())
+            {
+                Current.bRemoved = true;
+                bHasRemovedEntries = true;
+                continue;
+            }
+
+            Current.Handler(args...);
+
+            if (Scope.bDestroyed)
+            {
+                return;     // 핸들러 안에서 델리게이트가 파괴됨: 멤버를 더 건드리지 않음
+            }
+        }
     }
 
     void Remove(FDelegateHandle Handle)
     {
-       auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-       [&](const Entry& e) { return e.Handle == Handle; });
-       Handlers.erase(it, Handlers.end());
+        // 핸들은 추가 순서대로 증가하므로 두 배열 모두 정렬되어 있음
+        if (Entry* Found = FindEntry(PendingHandlers, Handle))
+        {
+            // 대기 중인 항목은 아직 호출된 적이 없으므로 바로 제거
+            PendingHandlers.erase(PendingHandlers.begin() + (Found - PendingHandlers.data()));
+            return;
+        }
+
+        Entry* Found = FindEntry(Handlers, Handle);
+        if (!Found || Found->bRemoved)
+        {
+            return;
+        }
+
+        if (BroadcastDepth > 0)
+        {
+            // 순회 중인 배열은 건드리지 않고 표시만 (자기 자신을 제거하는 핸들러도 안전)
+            Found->bRemoved = true;
+            bHasRemovedEntries = true;
+        }
+        else
+        {
+            Handlers.erase(Handlers.begin() + (Found - Handlers.data()));
+        }
     }
 
     void Clear()
     {
-       Handlers.clear();
+        PendingHandlers.clear();
+        if (BroadcastDepth > 0)
+        {
+            for (Entry& Current : Handlers)
+            {
+                Current.bRemoved = true;
+            }
+            bHasRemovedEntries = !Handlers.empty();
+        }
+        else
+        {
+            Handlers.clear();
+            bHasRemovedEntries = false;
+        }
+    }
+
+    bool IsBound() const
+    {
+        return !PendingHandlers.empty() || std::any_of(Handlers.begin(), Handlers.end(), [](const Entry& Current) { return !Current.bRemoved; });
     }
 
 private:
     struct Entry
     {
-       FDelegateHandle Handle;
-       HandlerType Handler;
-       ValidatorType Validator; 
+        FDelegateHandle Handle = 0;
+        HandlerType Handler;
+        FWeakObjectPtr BoundObject;
+        bool bWeakBound = false;  // BoundObject가 소멸하면 호출하지 않고 제거
+        bool bRemoved = false;    // 제거 대기 (Broadcast가 끝나면 정리)
     };
 
-    std::vector<Entry> Handlers;
-    FDelegateHandle NextHandle;
+    FDelegateHandle AddEntry(HandlerType&& Handler, const FWeakObjectPtr& BoundObject, bool bWeakBound)
+    {
+        const FDelegateHandle Handle = NextHandle++;
+        // Broadcast 중에는 순회 중인 배열이 재할당되지 않도록 대기 배열에 넣음
+        std::vector<Entry>& Target = BroadcastDepth > 0 ? PendingHandlers : Handlers;
+        Target.push_back({ Handle, std::move(Handler), BoundObject, bWeakBound, false });
+        return Handle;
+    }
+
+    static Entry* FindEntry(std::vector<Entry>& InEntries, FDelegateHandle Handle)
+    {
+        auto It = std::lower_bound(InEntries.begin(), InEntries.end(), Handle,
+            [](const Entry& Current, FDelegateHandle Value) { return Current.Handle < Value; });
+        return (It != InEntries.end() && It->Handle == Handle) ? &*It : nullptr;
+    }
+
+    /**
+     * Broadcast 한 번의 깊이 / 파괴 감지 플래그를 잡고, 정상 종료든 예외든 빠져나갈 때 되돌린다.
+     * 되돌리지 않으면 이후 Add / Remove가 영원히 지연되고, 소멸자가 사라진 스택 변수에 쓴다.
+     */
+    struct FBroadcastScope
+    {
+        explicit FBroadcastScope(TDelegate& InOwner)
+            : Owner(InOwner)
+            , OuterDestroyedFlag(InOwner.DestroyedFlag)
+        {
+            Owner.DestroyedFlag = &bDestroyed;
+            ++Owner.BroadcastDepth;
+        }
+
+        ~FBroadcastScope()
+        {
+            if (bDestroyed)
+            {
+                // 델리게이트가 이미 파괴됨: 바깥 Broadcast에도 알리고 Owner는 건드리지 않음
+                if (OuterDestroyedFlag)
+                {
+                    *OuterDestroyedFlag = true;
+                }
+                return;
+            }
+
+            Owner.DestroyedFlag = OuterDestroyedFlag;
+            if (--Owner.BroadcastDepth == 0)
+            {
+                Owner.FlushDeferred();
+            }
+        }
+
+        FBroadcastScope(const FBroadcastScope&) = delete;
+        FBroadcastScope& operator=(const FBroadcastScope&) = delete;
+
+        TDelegate& Owner;
+        bool* OuterDestroyedFlag;
+        bool bDestroyed = false;
+    };
+
+    /** 가장 바깥 Broadcast가 끝난 뒤: 제거 표시된 항목 정리, 대기 항목 합치기 */
+    void FlushDeferred()
+    {
+        if (bHasRemovedEntries)
+        {
+            Handlers.erase(std::remove_if(Handlers.begin(), Handlers.end(),
+                [](const Entry& Current) { return Current.bRemoved; }), Handlers.end());
+            bHasRemovedEntries = false;
+        }
+        if (!PendingHandlers.empty())
+        {
+            std::move(PendingHandlers.begin(), PendingHandlers.end(), std::back_inserter(Handlers));
+            PendingHandlers.clear();
+        }
+    }
+
+    void CopyLiveEntries(const TDelegate& Other)
+    {
+        for (const std::vector<Entry>* Source : { &Other.Handlers, &Other.PendingHandlers })
+        {
+            for (const Entry& Current : *Source)
+            {
+                if (!Current.bRemoved)
+                {
+                    Handlers.push_back(Current);
+                }
+            }
+        }
+        NextHandle = Other.NextHandle;
+    }
+
+    std::vector<Entry> Handlers;         // 핸들 오름차순
+    std::vector<Entry> PendingHandlers;  // Broadcast 중 추가된 항목 (핸들 오름차순)
+    FDelegateHandle NextHandle = 1;
+
+    int32 BroadcastDepth = 0;
+    bool bHasRemovedEntries = false;
+    bool* DestroyedFlag = nullptr;       // 진행 중인 가장 안쪽 Broadcast의 파괴 감지 플래그
+};
+
+/**
+ * @class FDelegateBenchmark
+ * @brief Broadcast 벤치마크 (리스너 1 / 8 / 64개, 이전 std::function 복사 방식과 비교)
+ */
+class FDelegateBenchmark
+{
+public:
+    static void RunBenchmark(int32 Iterations = 200000);
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
@@ -115,4 +435,4 @@ private:
 #define DECLARE_DELEGATE_TYPE(Name, ...)          using Name = TDelegate<__VA_ARGS__>;
 #define DECLARE_DELEGATE_TYPE_OneParam(Name, T1)  using Name = TDelegate<T1>;
 #define DECLARE_DELEGATE_TYPE_TwoParam(Name, T1, T2) using Name = TDelegate<T1, T2>;
-#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
\ No newline at end of file
+#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
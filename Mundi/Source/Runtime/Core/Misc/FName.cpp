@@ -1,62 +1,280 @@
 ﻿#include "pch.h"
 #include "Name.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace
 {
-    // NameMap을 안전하게 가져오는 getter
-    static TMap<FString, uint32>& GetNameMap()
+    // ── 설정 ──────────────────────────────
+    constexpr uint32 NumShardsBits = 6;
+    constexpr uint32 NumShards = 1u << NumShardsBits;       // 64 샤드
+    constexpr uint32 InitialShardCapacity = 256;            // 샤드 테이블 초기 슬롯 수 (2의 거듭제곱)
+    constexpr uint32 EntriesPerBlockBits = 12;
+    constexpr uint32 EntriesPerBlock = 1u << EntriesPerBlockBits;  // 블록당 4096 엔트리
+    constexpr uint32 MaxBlocks = 4096;                      // 최대 약 1600만 이름
+
+    inline char ToLowerAscii(char C)
     {
-        // 함수 내의 static 변수는 처음 호출될 때 스레드에 안전하게
-        // 단 한 번만 초기화됩니다.
-        static TMap<FString, uint32> GNameMap;
-        return GNameMap;
+        return (C >= 'A' && C <= 'Z') ? static_cast<char>(C + ('a' - 'A')) : C;
     }
 
-    // Entries를 안전하게 가져오는 getter
-    static TArray<FNameEntry>& GetEntries()
+    // Comparison(소문자)과 입력 문자열을 대소문자 무시로 비교 (임시 문자열 없음)
+    inline bool EqualsNoCase(const FString& Lower, const char* InStr, size_t InLen)
     {
-        static TArray<FNameEntry> GEntries;
-        return GEntries;
+        if (Lower.size() != InLen)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < InLen; ++i)
+        {
+            if (Lower[i] != ToLowerAscii(InStr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    // FString을 소문자로 변환하는 헬퍼 함수
-    static FString ToLower(const FString& InStr)
+    // ── 샤드 테이블 ──────────────────────────────
+    // 슬롯 = (Hash << 32) | (Index + 1), 0은 빈 슬롯
+    struct FNameTable
+    {
+        uint32 Capacity = 0;
+        std::atomic<uint64>* Slots = nullptr;
+
+        explicit FNameTable(uint32 InCapacity)
+            : Capacity(InCapacity)
+            , Slots(new std::atomic<uint64>[InCapacity])
+        {
+            for (uint32 i = 0; i < Capacity; ++i)
+            {
+                Slots[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    struct FNameShard
+    {
+        std::atomic<FNameTable*> Table{ nullptr };
+        std::mutex InsertMutex;
+        uint32 NumUsed = 0;
+    };
+
+    class FNamePoolImpl
+    {
+    public:
+        FNamePoolImpl()
+        {
+            for (FNameShard& Shard : Shards)
+            {
+                Shard.Table.store(new FNameTable(InitialShardCapacity), std::memory_order_relaxed);
+            }
+            for (std::atomic<FNameEntry*>& Block : Blocks)
+            {
+                Block.store(nullptr, std::memory_order_relaxed);
+            }
+
+            // 0번 = 빈 문자열 (FName::IsNone 판정용)
+            Add("", 0);
+        }
+
+        uint32 Add(const char* InStr, size_t InLen)
+        {
+            const uint32 Hash = FNamePool::HashNoCase(InStr, InLen);
+            FNameShard& Shard = Shards[Hash >> (32 - NumShardsBits)];
+
+            // 1. lock-free 조회 (대부분의 호출은 여기서 끝남)
+            uint32 Found = Find(Shard.Table.load(std::memory_order_acquire), Hash, InStr, InLen);
+            if (Found != UINT32_MAX)
+            {
+                return Found;
+            }
+
+            // 2. 삽입 (샤드 단위 직렬화, 다른 샤드와는 동시 진행)
+            std::lock_guard<std::mutex> Lock(Shard.InsertMutex);
+
+            FNameTable* Table = Shard.Table.load(std::memory_order_relaxed);
+            Found = Find(Table, Hash, InStr, InLen);
+            if (Found != UINT32_MAX)
+            {
+                return Found;  // 락 대기 중 다른 스레드가 먼저 등록
+            }
+
+            const uint32 NewIndex = AllocateEntry(Hash, InStr, InLen);
+
+            // 부하율 3/4 초과 시 테이블 2배 확장 후 교체
+            if ((Shard.NumUsed + 1) * 4 > Table->Capacity * 3)
+            {
+                Table = Grow(Shard, Table);
+            }
+
+            InsertSlot(Table, Hash, NewIndex);
+            ++Shard.NumUsed;
+            return NewIndex;
+        }
+
+        const FNameEntry* Get(uint32 Index) const
+        {
+            if (Index >= NumEntries.load(std::memory_order_acquire))
+            {
+                return nullptr;
+            }
+            const FNameEntry* Block = Blocks[Index >> EntriesPerBlockBits].load(std::memory_order_acquire);
+            return Block ? &Block[Index & (EntriesPerBlock - 1)] : nullptr;
+        }
+
+        uint32 Num() const
+        {
+            return NumEntries.load(std::memory_order_acquire);
+        }
+
+    private:
+        uint32 Find(const FNameTable* Table, uint32 Hash, const char* InStr, size_t InLen) const
+        {
+            const uint32 Mask = Table->Capacity - 1;
+            for (uint32 Pos = Hash & Mask; ; Pos = (Pos + 1) & Mask)
+            {
+                const uint64 Slot = Table->Slots[Pos].load(std::memory_order_acquire);
+                if (Slot == 0)
+                {
+                    return UINT32_MAX;
+                }
+                if (static_cast<uint32>(Slot >> 32) == Hash)
+                {
+                    const uint32 Index = static_cast<uint32>(Slot) - 1;
+                    const FNameEntry* Entry = Get(Index);
+                    if (Entry && EqualsNoCase(Entry->Comparison, InStr, InLen))
+                    {
+                        return Index;
+                    }
+                }
+            }
+        }
+
+        static void InsertSlot(FNameTable* Table, uint32 Hash, uint32 Index)
+        {
+            const uint32 Mask = Table->Capacity - 1;
+            uint32 Pos = Hash & Mask;
+            while (Table->Slots[Pos].load(std::memory_order_relaxed) != 0)
+            {
+                Pos = (Pos + 1) & Mask;
+            }
+            // release: 엔트리 내용이 슬롯보다 먼저 보이도록 보장
+            Table->Slots[Pos].store((static_cast<uint64>(Hash) << 32) | (Index + 1), std::memory_order_release);
+        }
+
+        // 이전 테이블은 lock-free 조회 중인 스레드가 있을 수 있으므로 해제하지 않음
+        // (확장마다 2배씩 커지므로 누적 크기는 현재 테이블의 2배 이하)
+        static FNameTable* Grow(FNameShard& Shard, FNameTable* OldTable)
+        {
+            FNameTable* NewTable = new FNameTable(OldTable->Capacity * 2);
+            for (uint32 i = 0; i < OldTable->Capacity; ++i)
+            {
+                const uint64 Slot = OldTable->Slots[i].load(std::memory_order_relaxed);
+                if (Slot != 0)
+                {
+                    InsertSlot(NewTable, static_cast<uint32>(Slot >> 32), static_cast<uint32>(Slot) - 1);
+                }
+            }
+            Shard.Table.store(NewTable, std::memory_order_release);
+            return NewTable;
+        }
+
+        uint32 AllocateEntry(uint32 Hash, const char* InStr, size_t InLen)
+        {
+            // 인덱스는 여러 샤드가 동시에 발급받으므로 원자적으로 증가
+            const uint32 Index = NextEntry.fetch_add(1, std::memory_order_relaxed);
+            const uint32 BlockIndex = Index >> EntriesPerBlockBits;
+            if (BlockIndex >= MaxBlocks)
+            {
+                UE_LOG("[error] FNamePool: name table is full (%u entries)", Index);
+                std::abort();
+            }
+
+            FNameEntry* Block = Blocks[BlockIndex].load(std::memory_order_acquire);
+            if (!Block)
+            {
+                FNameEntry* NewBlock = new FNameEntry[EntriesPerBlock];
+                if (Blocks[BlockIndex].compare_exchange_strong(Block, NewBlock, std::memory_order_acq_rel))
+                {
+                    Block = NewBlock;
+                }
+                else
+                {
+                    delete[] NewBlock;  // 다른 스레드가 먼저 할당 (Block에 그 포인터가 들어 있음)
+                }
+            }
+
+            FNameEntry& Entry = Block[Index & (EntriesPerBlock - 1)];
+            Entry.Display.assign(InStr, InLen);
+            Entry.Comparison.resize(InLen);
+            for (size_t i = 0; i < InLen; ++i)
+            {
+                Entry.Comparison[i] = ToLowerAscii(InStr[i]);
+            }
+            Entry.Hash = Hash;
+
+            // Get의 경계 검사용 카운트는 발급 순서대로만 증가 (앞 인덱스가 채워질 때까지 대기)
+            uint32 Expected = Index;
+            while (!NumEntries.compare_exchange_weak(Expected, Index + 1, std::memory_order_release, std::memory_order_relaxed))
+            {
+                Expected = Index;
+                std::this_thread::yield();
+            }
+            return Index;
+        }
+
+        FNameShard Shards[NumShards];
+        std::atomic<FNameEntry*> Blocks[MaxBlocks];
+        std::atomic<uint32> NextEntry{ 0 };
+        std::atomic<uint32> NumEntries{ 0 };
+    };
+
+    // 정적 소멸 순서와 무관하게 종료 시점까지 유효하도록 의도적으로 해제하지 않음
+    FNamePoolImpl& GetPool()
     {
-        FString Result = InStr;
-        std::transform(Result.begin(), Result.end(), Result.begin(),
-            [](unsigned char c) { return std::tolower(c); });
-        return Result;
+        static FNamePoolImpl* GPool = new FNamePoolImpl();
+        return *GPool;
     }
 }
 
-uint32 FNamePool::Add(const FString& InStr)
+uint32 FNamePool::HashNoCase(const char* InStr, size_t InLen)
 {
-    FString Lower = ToLower(InStr);
-
-    // 전역 변수 대신 getter를 통해 접근
-    TMap<FString, uint32>& NameMap = GetNameMap();
-    TArray<FNameEntry>& Entries = GetEntries();
-
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
-        return it->second;
+    // FNV-1a (소문자 기준) + 최종 믹싱 (상위 비트를 샤드 선택에 사용하므로)
+    uint32 Hash = 2166136261u;
+    for (size_t i = 0; i < InLen; ++i)
+    {
+        Hash ^= static_cast<uint8>(ToLowerAscii(InStr[i]));
+        Hash *= 16777619u;
+    }
+    Hash ^= Hash >> 16;
+    Hash *= 0x85ebca6bu;
+    Hash ^= Hash >> 13;
+    Hash *= 0xc2b2ae35u;
+    Hash ^= Hash >> 16;
+    return Hash;
+}
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
-    return NewIndex;
+uint32 FNamePool::Add(const char* InStr, size_t InLen)
+{
+    return GetPool().Add(InStr ? InStr : "", InStr ? InLen : 0);
 }
 
 const FNameEntry& FNamePool::Get(uint32 Index)
 {
-    // 전역 변수 대신 getter를 통해 접근
-    TArray<FNameEntry>& Entries = GetEntries();
+    const FNameEntry* Entry = GetPool().Get(Index);
 
-    // (안전성 강화) 경계 검사 추가
-    if (Index >= Entries.size())
+    // (안전성 강화) 경계 검사
+    if (!Entry)
     {
         static FNameEntry InvalidEntry = { "Invalid", "invalid" };
         return InvalidEntry;
     }
-    return Entries[Index];
-}
\ No newline at end of file
+    return *Entry;
+}
+
+uint32 FNamePool::Num()
+{
+    return GetPool().Num();
+}
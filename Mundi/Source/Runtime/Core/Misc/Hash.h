@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "UEContainer.h"
 #include "Name.h"
+#include <cstring>
 
 // FName에 대한 GetTypeHash 오버로드입니다.
 inline uint64 GetTypeHash(const FName& Name)
@@ -14,4 +15,38 @@ inline uint64 HashCombine(uint64 Seed, uint64 ValueToCombine)
     const uint64 GoldenRatio = 0x9e3779b97f4a7c15;
     Seed ^= ValueToCombine + GoldenRatio + (Seed << 6) + (Seed >> 2);
     return Seed;
-}
\ No newline at end of file
+}
+
+// 바이트 버퍼의 64비트 해시 (8바이트 단위 처리). 캐시 내용 비교용이며 암호학적 용도가 아닙니다.
+inline uint64 HashBytes(const void* Data, size_t Length, uint64 Seed = 0)
+{
+    const uint64 MulA = 0x87c37b91114253d5ULL;
+    const uint64 MulB = 0x4cf5ad432745937fULL;
+
+    const uint8* Bytes = static_cast<const uint8*>(Data);
+    uint64 Hash = Seed ^ (static_cast<uint64>(Length) * 0x9e3779b97f4a7c15ULL);
+
+    size_t Offset = 0;
+    for (; Offset + sizeof(uint64) <= Length; Offset += sizeof(uint64))
+    {
+        uint64 Word;
+        std::memcpy(&Word, Bytes + Offset, sizeof(uint64));
+        Hash ^= Word * MulA;
+        Hash = ((Hash << 31) | (Hash >> 33)) * MulB;
+    }
+
+    if (Offset < Length)
+    {
+        uint64 Tail = 0;
+        std::memcpy(&Tail, Bytes + Offset, Length - Offset);
+        Hash ^= Tail * MulA;
+    }
+
+    // 최종 섞기 (MurmurHash3 fmix64)
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+    Hash *= 0xc4ceb9fe1a85ec53ULL;
+    Hash ^= Hash >> 33;
+    return Hash;
+}
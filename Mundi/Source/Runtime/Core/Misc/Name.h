@@ -5,6 +5,7 @@
 #include <vector>
 #include <algorithm>
 #include <unordered_map>
+#include <cstring>
 #include"UEContainer.h"
 // ──────────────────────────────
 // FNameEntry & Pool
@@ -13,13 +14,31 @@ struct FNameEntry
 {
     FString Display;    // 원문
     FString Comparison; // lower-case
+    uint32 Hash = 0;    // 대소문자 무시 해시 (Add 시 1회 계산)
 };
 
+/**
+ * 전역 이름 테이블
+ * - 엔트리는 블록 단위로 할당되어 한 번 등록되면 주소가 바뀌지 않음 (Get 참조를 계속 보관해도 안전)
+ * - 조회는 해시 상위 비트로 고른 샤드의 개방 주소 테이블을 lock-free로 탐색
+ *   (삽입만 샤드 락을 잡고, 테이블 확장 시 새 테이블을 원자적으로 교체)
+ * - 대소문자 무시 해시/비교는 임시 문자열 없이 문자 단위로 수행
+ */
 class FNamePool
 {
 public:
-    static uint32 Add(const FString& InStr);
+    static uint32 Add(const FString& InStr) { return Add(InStr.data(), InStr.size()); }
+    static uint32 Add(const char* InStr, size_t InLen);
     static const FNameEntry& Get(uint32 Index);
+
+    /** 등록된 이름 수 */
+    static uint32 Num();
+
+    /** 대소문자 무시 해시 (ASCII) */
+    static uint32 HashNoCase(const char* InStr, size_t InLen);
+
+    /** 빈 문자열("")은 풀 생성 시 0번으로 등록됨 */
+    static constexpr uint32 EmptyIndex = 0;
 };
 
 // ──────────────────────────────
@@ -31,22 +50,28 @@ struct FName
     uint32 ComparisonIndex = -1;
 
     FName() = default;
-    FName(const char* InStr) { Init(FString(InStr)); }
-    FName(const FString& InStr) { Init(InStr); }
+    FName(const char* InStr) { Init(InStr, InStr ? strlen(InStr) : 0); }
+    FName(const FString& InStr) { Init(InStr.data(), InStr.size()); }
 
     void Init(const FString& InStr)
     {
-        int32_t Index = FNamePool::Add(InStr);
+        Init(InStr.data(), InStr.size());
+    }
+
+    void Init(const char* InStr, size_t InLen)
+    {
+        uint32 Index = FNamePool::Add(InStr, InLen);
         DisplayIndex = Index;
         ComparisonIndex = Index; // 필요시 다른 규칙 적용 가능
     }
 
     bool operator==(const FName& Other) const { return ComparisonIndex == Other.ComparisonIndex; }
     // C++20: operator!= is auto-generated from operator==
-    FString ToString() const { return FNamePool::Get(DisplayIndex).Display; }
+    // 엔트리 주소는 고정이므로 참조 반환 (복사 없음)
+    const FString& ToString() const { return FNamePool::Get(DisplayIndex).Display; }
 
     // Check if this FName is "None" (empty or default)
-    bool IsNone() const { return ToString().empty(); }
+    bool IsNone() const { return ComparisonIndex == FNamePool::EmptyIndex || ComparisonIndex == static_cast<uint32>(-1); }
 
     friend FName operator+(const FName& A, const FName& B)
     {
@@ -64,6 +89,11 @@ struct FName
     }
 };
 
+// 문자열 리터럴용 정적 FName 캐시
+// 호출 지점마다 최초 1회만 풀을 조회하고 이후에는 같은 FName을 재사용 (매 프레임 생성되는 매크로 이름 등)
+// 사용법: Macro.Name = STATIC_FNAME("GPU_SKINNING");
+#define STATIC_FNAME(Literal) ([]() -> const FName& { static const FName CachedName(Literal); return CachedName; }())
+
 // --- FName을 위한 std::hash 특수화 ---
 namespace std
 {
@@ -8,17 +8,17 @@ class TObjectIterator
 public:
 	TObjectIterator()
 	{
-		// TMap의 begin()으로 시작
-		MapIterator = GUObjectArray.begin();
+		// 0번 슬롯은 예약이므로 1번부터 순회
+		Index = 1;
 		AdvanceToNextValidObject();
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		if (MapIterator != GUObjectArray.end())
+		if (Index < GUObjectArray.GetMaxIndex())
 		{
-			++MapIterator;
+			++Index;
 			AdvanceToNextValidObject();
 		}
 		return *this;
@@ -27,11 +27,7 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		if (MapIterator != GUObjectArray.end())
-		{
-			return static_cast<TObject*>(MapIterator->second);
-		}
-		return nullptr;
+		return static_cast<TObject*>(GUObjectArray.IndexToObject(Index));
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -43,31 +39,33 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return MapIterator != Other.MapIterator;
+		return Index != Other.Index;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		return MapIterator != GUObjectArray.end();
+		return Index < GUObjectArray.GetMaxIndex();
 	}
 
 private:
 	// 현재 위치부터 다음 유효 객체를 찾는 헬퍼 함수
+	// 슬롯 배열을 선형으로 훑으므로 해시 버킷 순회보다 캐시 친화적
 	void AdvanceToNextValidObject()
 	{
-		while (MapIterator != GUObjectArray.end())
+		const uint32 MaxIndex = GUObjectArray.GetMaxIndex();
+		while (Index < MaxIndex)
 		{
-			UObject* Object = MapIterator->second;
+			UObject* Object = GUObjectArray.IndexToObject(Index);
 			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
 			if (Object && Object->IsA<TObject>())
 			{
 				break;
 			}
-			++MapIterator;
+			++Index;
 		}
 	}
 
 private:
-	typename TMap<uint32, UObject*>::iterator MapIterator;
-};
+	uint32 Index = 0;
+};
\ No newline at end of file
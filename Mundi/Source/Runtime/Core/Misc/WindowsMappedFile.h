@@ -0,0 +1,87 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "PathUtils.h"
+
+/**
+ * @class FWindowsMappedFile
+ * @brief 읽기 전용 메모리 매핑 파일 (RAII)
+ *
+ * 파일 전체를 주소 공간에 매핑하고 GetData()로 시작 주소를 돌려준다.
+ * 매핑 시작 주소는 페이지 정렬이므로 파일 안 오프셋을 정렬해 두면 그대로 구조체 포인터로 쓸 수 있다.
+ */
+class FWindowsMappedFile
+{
+public:
+    FWindowsMappedFile() = default;
+    explicit FWindowsMappedFile(const FString& Filename) { Open(Filename); }
+    ~FWindowsMappedFile() { Close(); }
+
+    FWindowsMappedFile(const FWindowsMappedFile&) = delete;
+    FWindowsMappedFile& operator=(const FWindowsMappedFile&) = delete;
+
+    bool Open(const FString& Filename)
+    {
+        Close();
+
+        FileHandle = ::CreateFileW(UTF8ToWide(Filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (FileHandle == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER FileSize{};
+        if (!::GetFileSizeEx(FileHandle, &FileSize) || FileSize.QuadPart == 0)
+        {
+            // 0바이트 파일은 매핑할 수 없으므로 열기 실패로 처리
+            Close();
+            return false;
+        }
+        Size = static_cast<uint64>(FileSize.QuadPart);
+
+        MappingHandle = ::CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!MappingHandle)
+        {
+            Close();
+            return false;
+        }
+
+        Data = static_cast<const uint8*>(::MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!Data)
+        {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close()
+    {
+        if (Data)
+        {
+            ::UnmapViewOfFile(Data);
+            Data = nullptr;
+        }
+        if (MappingHandle)
+        {
+            ::CloseHandle(MappingHandle);
+            MappingHandle = nullptr;
+        }
+        if (FileHandle != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(FileHandle);
+            FileHandle = INVALID_HANDLE_VALUE;
+        }
+        Size = 0;
+    }
+
+    bool IsOpen() const { return Data != nullptr; }
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
@@ -1,4 +1,5 @@
 ﻿#include "pch.h"
+#include "PlatformTime.h"
 
 FString UObject::GetName()
 {
@@ -10,6 +11,144 @@ FString UObject::GetComparisonName()
     return FString();
 }
 
+// ===== 클래스 트리 (IsChildOf 구간 검사용) =====
+
+void UClass::BuildClassTree()
+{
+    TArray<UClass*>& AllClasses = GetAllClasses();
+
+    // 부모 → 자식 목록 (등록되지 않은 부모를 가진 클래스는 루트로 취급)
+    TMap<const UClass*, TArray<UClass*>> Children;
+    TSet<const UClass*> Registered;
+    for (UClass* Class : AllClasses)
+    {
+        if (Class)
+        {
+            Registered.insert(Class);
+        }
+    }
+
+    TArray<UClass*> Roots;
+    for (UClass* Class : AllClasses)
+    {
+        if (!Class)
+        {
+            continue;
+        }
+        if (Class->Super && Registered.count(Class->Super))
+        {
+            Children[Class->Super].Add(Class);
+        }
+        else
+        {
+            Roots.Add(Class);
+        }
+    }
+
+    // 반복 DFS: 진입 시 번호 부여, 서브트리 종료 시 마지막 번호 기록
+    struct FStackEntry
+    {
+        UClass* Class;
+        int32 NextChild;
+    };
+
+    uint32 NextIndex = 0;
+    TArray<FStackEntry> Stack;
+    for (UClass* Root : Roots)
+    {
+        Root->ClassTreeIndex = NextIndex++;
+        Stack.Add({ Root, 0 });
+
+        while (!Stack.IsEmpty())
+        {
+            FStackEntry& Top = Stack.back();
+            auto It = Children.find(Top.Class);
+            if (It != Children.end() && Top.NextChild < It->second.Num())
+            {
+                UClass* Child = It->second[Top.NextChild++];
+                Child->ClassTreeIndex = NextIndex++;
+                Stack.Add({ Child, 0 });
+            }
+            else
+            {
+                Top.Class->ClassTreeLast = NextIndex - 1;
+                Stack.pop_back();
+            }
+        }
+    }
+}
+
+void UClass::RunIsABenchmark(int32 Iterations)
+{
+    TArray<UClass*> Classes;
+    for (UClass* Class : GetAllClasses())
+    {
+        if (Class)
+        {
+            Classes.Add(Class);
+        }
+    }
+
+    const int32 NumClasses = Classes.Num();
+    if (NumClasses == 0 || Iterations <= 0)
+    {
+        return;
+    }
+
+    // 1. 정합성 검사 (모든 쌍)
+    int32 NumMismatches = 0;
+    for (UClass* A : Classes)
+    {
+        for (UClass* B : Classes)
+        {
+            if (A->IsChildOf(B) != A->IsChildOfSlow(B))
+            {
+                ++NumMismatches;
+            }
+        }
+    }
+
+    // 2. 시간 측정 (결과를 누적해 최적화로 제거되지 않게 함)
+    volatile int32 Sink = 0;
+
+    uint64 Start = FWindowsPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        int32 Count = 0;
+        for (UClass* A : Classes)
+        {
+            for (UClass* B : Classes)
+            {
+                Count += A->IsChildOfSlow(B) ? 1 : 0;
+            }
+        }
+        Sink += Count;
+    }
+    const double SlowMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+
+    Start = FWindowsPlatformTime::Cycles64();
+    for (int32 Iter = 0; Iter < Iterations; ++Iter)
+    {
+        int32 Count = 0;
+        for (UClass* A : Classes)
+        {
+            for (UClass* B : Classes)
+            {
+                Count += A->IsChildOf(B) ? 1 : 0;
+            }
+        }
+        Sink += Count;
+    }
+    const double FastMS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+
+    const double NumChecks = static_cast<double>(NumClasses) * NumClasses * Iterations;
+    UE_LOG("[IsA Benchmark] %d classes, %d iterations (%.0f checks), mismatches: %d",
+        NumClasses, Iterations, NumChecks, NumMismatches);
+    UE_LOG("[IsA Benchmark] Super chain: %.3f ms (%.2f ns/check), Pre-order range: %.3f ms (%.2f ns/check), x%.2f",
+        SlowMS, SlowMS * 1.0e6 / NumChecks, FastMS, FastMS * 1.0e6 / NumChecks,
+        FastMS > 0.0 ? SlowMS / FastMS : 0.0);
+}
+
 // ===== 통합 프로퍼티 직렬화 함수 (재귀적) =====
 // Instance: 프로퍼티가 속한 객체/구조체의 포인터
 // Prop: 직렬화할 프로퍼티 메타데이터
@@ -29,12 +29,35 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 클래스 트리 pre-order 번호 (BuildClassTree에서 할당)
+    // 자손 클래스의 번호는 항상 [ClassTreeIndex, ClassTreeLast] 구간 안에 있음
+    static constexpr uint32 InvalidClassTreeIndex = UINT32_MAX;
+    uint32 ClassTreeIndex = InvalidClassTreeIndex;
+    uint32 ClassTreeLast = 0;
+
+    // GetAllClasses() 안의 등록 순번 (SignUpClass에서 할당, FMemoryManager 클래스별 통계의 인덱스)
+    uint32 ClassIndex = UINT32_MAX;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
     {
     }
     bool IsChildOf(const UClass* Base) const noexcept
+    {
+        if (!Base) return false;
+
+        // 두 클래스 모두 번호가 있으면 구간 검사 한 번으로 판정 (O(1))
+        if (ClassTreeIndex != InvalidClassTreeIndex && Base->ClassTreeIndex != InvalidClassTreeIndex)
+        {
+            return ClassTreeIndex - Base->ClassTreeIndex <= Base->ClassTreeLast - Base->ClassTreeIndex;
+        }
+
+        // BuildClassTree 이전 또는 이후에 등록된 클래스는 Super 체인 순회
+        return IsChildOfSlow(Base);
+    }
+
+    bool IsChildOfSlow(const UClass* Base) const noexcept
     {
         if (!Base) return false;
         for (auto c = this; c; c = c->Super)
@@ -42,6 +65,18 @@ struct UClass
         return false;
     }
 
+    /**
+     * 등록된 모든 클래스에 pre-order 번호를 매깁니다.
+     * 정적 초기화(클래스 등록)가 끝난 뒤, 워커 스레드가 Cast를 호출하기 전에 게임 스레드에서 호출해야 합니다.
+     */
+    static void BuildClassTree();
+
+    /**
+     * IsChildOf 마이크로벤치마크 (등록된 모든 클래스 쌍, Super 체인 순회 vs 구간 검사)
+     * @param Iterations 전체 쌍 반복 횟수
+     */
+    static void RunIsABenchmark(int32 Iterations = 100);
+
     static TArray<UClass*>& GetAllClasses()
     {
         static TArray<UClass*> AllClasses;
@@ -52,6 +87,7 @@ struct UClass
     {
         if (InClass)
         {
+            InClass->ClassIndex = static_cast<uint32>(GetAllClasses().Num());
             GetAllClasses().emplace_back(InClass);
         }
     }
@@ -260,7 +296,11 @@ public:
 protected:
     virtual ~UObject() = default;
     // Centralized deletion entry accessible to ObjectFactory only
-    void DestroyInternal() { delete this; }
+    void DestroyInternal()
+    {
+        FMemoryManager::TrackObjectFreed(GetClass(), this);
+        delete this;
+    }
     friend void ObjectFactory::DeleteObject(UObject* Obj);
     friend void ObjectFactory::DeleteObjectFast(UObject* Obj);
 
@@ -1,8 +1,5 @@
 ﻿#include "pch.h"
 #include "ObjectFactory.h"
-// 전역 오브젝트 맵 정의 (O(1) 삭제를 위해 TMap 사용)
-TMap<uint32, UObject*> GUObjectArray;
-uint32 GUObjectIndexCounter = 0;
 
 namespace ObjectFactory
 {
@@ -30,10 +27,9 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        // 고유 인덱스 할당
-        uint32 idx = ++GUObjectIndexCounter;
-        GUObjectArray[idx] = Obj;
-        Obj->InternalIndex = idx;
+        // 슬롯 할당 (프리 리스트 재사용, 세대 번호로 구분)
+        Obj->InternalIndex = GUObjectArray.AllocateIndex(Obj);
+        FMemoryManager::TrackObjectAllocated(Obj->GetClass(), Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -54,10 +50,9 @@ namespace ObjectFactory
     {
         if (!Obj) return nullptr;
 
-        // 고유 인덱스 할당
-        uint32 idx = ++GUObjectIndexCounter;
-        GUObjectArray[idx] = Obj;
-        Obj->InternalIndex = idx;
+        // 슬롯 할당 (프리 리스트 재사용, 세대 번호로 구분)
+        Obj->InternalIndex = GUObjectArray.AllocateIndex(Obj);
+        FMemoryManager::TrackObjectAllocated(Obj->GetClass(), Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -70,11 +65,12 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // 안전하게 전체 순회하여 포인터 비교로 찾기 (dangling pointer 대응)
-        for (auto it = GUObjectArray.begin(); it != GUObjectArray.end(); ++it)
+        const uint32 MaxIndex = GUObjectArray.GetMaxIndex();
+        for (uint32 idx = 1; idx < MaxIndex; ++idx)
         {
-            if (it->second == Obj)
+            if (GUObjectArray.IndexToObject(idx) == Obj)
             {
-                GUObjectArray.erase(it);  // 실제로 엔트리 제거 (sparse 유지)
+                GUObjectArray.FreeIndex(idx);  // 슬롯 반환 (세대 번호 증가)
                 Obj->DestroyInternal();
                 return;
             }
@@ -88,12 +84,11 @@ namespace ObjectFactory
 
         // InternalIndex로 O(1) 조회
         uint32 idx = Obj->InternalIndex;
-        auto it = GUObjectArray.find(idx);
 
-        // 안전 검증: 맵에 있고, 같은 객체인지 확인 (dangling pointer 대응)
-        if (it != GUObjectArray.end() && it->second == Obj)
+        // 안전 검증: 슬롯에 같은 객체가 있는지 확인 (dangling pointer 대응)
+        if (GUObjectArray.IndexToObject(idx) == Obj)
         {
-            GUObjectArray.erase(it);
+            GUObjectArray.FreeIndex(idx);
             Obj->DestroyInternal();
         }
         // else: Not managed or already deleted (dangling pointer case)
@@ -101,28 +96,23 @@ namespace ObjectFactory
 
     void DeleteAll(bool bCallBeginDestroy)
     {
-        // 복사본으로 순회 (삭제 중 맵 수정 방지)
-        TArray<UObject*> ObjectsToDelete;
-        for (auto& pair : GUObjectArray)
+        // 슬롯 순서대로 삭제 (슬롯에는 살아있는 객체만 있으므로 전체 재검색 불필요)
+        // 소멸 중 다른 객체가 먼저 삭제되면 해당 슬롯은 이미 비어 있어 건너뜀
+        const uint32 MaxIndex = GUObjectArray.GetMaxIndex();
+        for (uint32 idx = 1; idx < MaxIndex; ++idx)
         {
-            if (pair.second)
+            if (UObject* Obj = GUObjectArray.IndexToObject(idx))
             {
-                ObjectsToDelete.Add(pair.second);
+                DeleteObjectFast(Obj);
             }
         }
 
-        for (UObject* Obj : ObjectsToDelete)
-        {
-            DeleteObject(Obj);
-        }
-
-        GUObjectArray.clear();
-        GUObjectIndexCounter = 0;
+        GUObjectArray.Reset();
     }
 
-    // TMap 사용 시 CompactNullSlots는 더 이상 필요 없음
+    // 슬롯 배열은 프리 리스트로 재사용되므로 CompactNullSlots는 더 이상 필요 없음
     void CompactNullSlots()
     {
-        // TMap은 삭제 시 자동으로 엔트리가 제거되므로 별도 압축 불필요
+        // 해제된 슬롯은 FUObjectArray 프리 리스트가 관리하므로 별도 압축 불필요
     }
 }
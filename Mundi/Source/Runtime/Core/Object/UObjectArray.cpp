@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "UObjectArray.h"
+
+// 전역 오브젝트 슬롯 배열 정의
+FUObjectArray GUObjectArray;
+
+FUObjectArray::~FUObjectArray()
+{
+    Reset();
+}
+
+uint32 FUObjectArray::AllocateIndex(UObject* Object)
+{
+    uint32 Index = 0;
+    if (FreeIndices.Num() > static_cast<int32>(MinFreeSlotsBeforeReuse))
+    {
+        FreeIndices.Dequeue(Index);
+    }
+    else
+    {
+        Index = NumSlots++;
+        if ((Index >> NumItemsPerChunkShift) >= static_cast<uint32>(Chunks.Num()))
+        {
+            Chunks.Add(new FUObjectItem[NumItemsPerChunk]);
+        }
+    }
+
+    FUObjectItem& Item = Chunks[Index >> NumItemsPerChunkShift][Index & (NumItemsPerChunk - 1)];
+    Item.Object = Object;
+    ++NumObjects;
+    return Index;
+}
+
+void FUObjectArray::FreeIndex(uint32 Index)
+{
+    if (Index == 0 || Index >= NumSlots)
+    {
+        return;
+    }
+
+    FUObjectItem& Item = Chunks[Index >> NumItemsPerChunkShift][Index & (NumItemsPerChunk - 1)];
+    if (!Item.Object)
+    {
+        return;
+    }
+
+    Item.Object = nullptr;
+    ++Item.SerialNumber;  // 기존 약한 포인터 무효화
+    --NumObjects;
+    FreeIndices.Enqueue(Index);
+}
+
+void FUObjectArray::Reset()
+{
+    for (FUObjectItem* Chunk : Chunks)
+    {
+        delete[] Chunk;
+    }
+    Chunks.Empty();
+    FreeIndices.Empty();
+    NumSlots = 1;
+    NumObjects = 0;
+}
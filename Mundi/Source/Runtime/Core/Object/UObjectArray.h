@@ -0,0 +1,91 @@
+#pragma once
+#include "UEContainer.h"
+
+class UObject;
+
+// ── FUObjectItem ─────────────────────────────────────────────
+// 슬롯 하나. SerialNumber는 슬롯이 해제될 때마다 증가하여
+// 같은 인덱스를 재사용한 새 객체와 이전 객체를 구분한다.
+struct FUObjectItem
+{
+    UObject* Object = nullptr;
+    uint32 SerialNumber = 0;
+};
+
+/**
+ * @class FUObjectArray
+ * @brief 전역 UObject 슬롯 배열 (청크 단위 할당 + 세대 번호 + 프리 리스트)
+ *
+ * - UObject::InternalIndex는 슬롯 인덱스이며 피킹 ObjectID로도 쓰인다. (0번 슬롯은 "없음"으로 예약)
+ * - 청크는 재할당되지 않으므로 FUObjectItem 주소가 안정적이고, 인덱스 → 객체 조회는 배열 접근 두 번이다.
+ * - 해제된 슬롯은 FIFO 프리 리스트에 쌓였다가 MinFreeSlotsBeforeReuse개를 넘으면 오래된 것부터 재사용된다.
+ *   (방금 해제된 슬롯을 바로 재사용하지 않아 포인터 비교 기반 검증의 ABA 위험을 줄임)
+ */
+class FUObjectArray
+{
+public:
+    static constexpr uint32 NumItemsPerChunkShift = 16;
+    static constexpr uint32 NumItemsPerChunk = 1u << NumItemsPerChunkShift;
+    static constexpr uint32 MinFreeSlotsBeforeReuse = 1024;
+
+    FUObjectArray() = default;
+    ~FUObjectArray();
+
+    FUObjectArray(const FUObjectArray&) = delete;
+    FUObjectArray& operator=(const FUObjectArray&) = delete;
+
+    /** @brief 슬롯을 할당하고 Object를 등록한다. 반환값은 슬롯 인덱스이다. */
+    uint32 AllocateIndex(UObject* Object);
+
+    /** @brief 슬롯을 비우고 세대 번호를 올린 뒤 프리 리스트에 반환한다. */
+    void FreeIndex(uint32 Index);
+
+    /** @brief 인덱스의 슬롯 (범위 밖이면 nullptr) */
+    const FUObjectItem* IndexToItem(uint32 Index) const
+    {
+        if (Index >= NumSlots)
+        {
+            return nullptr;
+        }
+        return &Chunks[Index >> NumItemsPerChunkShift][Index & (NumItemsPerChunk - 1)];
+    }
+
+    /** @brief 인덱스의 객체 (빈 슬롯이거나 범위 밖이면 nullptr) */
+    UObject* IndexToObject(uint32 Index) const
+    {
+        const FUObjectItem* Item = IndexToItem(Index);
+        return Item ? Item->Object : nullptr;
+    }
+
+    /** @brief 세대 번호까지 일치할 때만 객체를 반환한다. (약한 포인터 해석용) */
+    UObject* IndexToObject(uint32 Index, uint32 SerialNumber) const
+    {
+        const FUObjectItem* Item = IndexToItem(Index);
+        return (Item && Item->SerialNumber == SerialNumber) ? Item->Object : nullptr;
+    }
+
+    /** @brief 인덱스의 현재 세대 번호 (범위 밖이면 0) */
+    uint32 GetSerialNumber(uint32 Index) const
+    {
+        const FUObjectItem* Item = IndexToItem(Index);
+        return Item ? Item->SerialNumber : 0;
+    }
+
+    /** @brief 지금까지 사용된 슬롯 수 (순회 상한, 0번 예약 슬롯 포함) */
+    uint32 GetMaxIndex() const { return NumSlots; }
+
+    /** @brief 등록된 객체 수 */
+    int32 Num() const { return NumObjects; }
+    bool IsEmpty() const { return NumObjects == 0; }
+
+    /** @brief 모든 슬롯과 청크를 해제한다. (객체 삭제는 호출자가 먼저 처리) */
+    void Reset();
+
+private:
+    TArray<FUObjectItem*> Chunks;
+    TQueue<uint32> FreeIndices;
+    uint32 NumSlots = 1;
+    int32 NumObjects = 0;
+};
+
+extern FUObjectArray GUObjectArray;
@@ -0,0 +1,350 @@
+#include "pch.h"
+#include "AnimCompression.h"
+#include "AnimDataModel.h"
+
+namespace
+{
+	/** 이 값 이하로만 변하는 채널은 Constant로 저장 */
+	constexpr float PositionTolerance = 1e-4f;
+	constexpr float ScaleTolerance = 1e-5f;
+	constexpr float RotationDotTolerance = 1e-6f;
+
+	constexpr float RadToDeg = 57.2957795f;
+
+	/** 짧은 채널은 마지막 키를 반복 (FindKeyframeIndices의 클램프와 같은 결과) */
+	template<typename T>
+	const T& GetPaddedKey(const TArray<T>& Keys, int32 Frame)
+	{
+		return Keys[std::min(Frame, Keys.Num() - 1)];
+	}
+
+	bool IsConstantVector(const TArray<FVector>& Keys, float Tolerance)
+	{
+		for (const FVector& Key : Keys)
+		{
+			if (std::fabs(Key.X - Keys[0].X) > Tolerance
+				|| std::fabs(Key.Y - Keys[0].Y) > Tolerance
+				|| std::fabs(Key.Z - Keys[0].Z) > Tolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool IsConstantRotation(const TArray<FQuat>& Keys)
+	{
+		for (const FQuat& Key : Keys)
+		{
+			if (1.0f - std::fabs(FQuat::Dot(Key, Keys[0])) > RotationDotTolerance)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	uint16 QuantizeUnit(float Value, float Min, float Range, float MaxValue)
+	{
+		if (Range <= 0.0f)
+		{
+			return 0;
+		}
+		const float Normalized = FMath::Clamp((Value - Min) / Range, 0.0f, 1.0f);
+		return static_cast<uint16>(Normalized * MaxValue + 0.5f);
+	}
+
+	void EncodeVector(const FVector& Value, const FVector& Min, const FVector& Max, uint16* OutPacked)
+	{
+		OutPacked[0] = QuantizeUnit(Value.X, Min.X, Max.X - Min.X, 65535.0f);
+		OutPacked[1] = QuantizeUnit(Value.Y, Min.Y, Max.Y - Min.Y, 65535.0f);
+		OutPacked[2] = QuantizeUnit(Value.Z, Min.Z, Max.Z - Min.Z, 65535.0f);
+	}
+
+	/** smallest-three: 절댓값이 가장 큰 성분을 빼고 나머지 셋을 15비트로 저장 */
+	void EncodeRotation(const FQuat& InRotation, uint16* OutPacked)
+	{
+		constexpr float Bias = 0.70710678f;
+
+		FQuat Rotation = InRotation;
+		Rotation.Normalize();
+
+		float Components[4] = { Rotation.X, Rotation.Y, Rotation.Z, Rotation.W };
+		int32 LargestIndex = 0;
+		for (int32 i = 1; i < 4; ++i)
+		{
+			if (std::fabs(Components[i]) > std::fabs(Components[LargestIndex]))
+			{
+				LargestIndex = i;
+			}
+		}
+
+		// q와 -q는 같은 회전이므로 가장 큰 성분이 양수가 되도록 맞추고 복원 시 sqrt로 구함
+		const float Sign = Components[LargestIndex] < 0.0f ? -1.0f : 1.0f;
+
+		uint16 Small[3];
+		int32 Slot = 0;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i != LargestIndex)
+			{
+				Small[Slot++] = QuantizeUnit(Components[i] * Sign, -Bias, 2.0f * Bias, 32767.0f);
+			}
+		}
+
+		OutPacked[0] = static_cast<uint16>(((LargestIndex >> 1) << 15) | Small[0]);
+		OutPacked[1] = static_cast<uint16>(((LargestIndex & 1) << 15) | Small[1]);
+		OutPacked[2] = Small[2];
+	}
+
+	void ComputeRange(const TArray<FVector>& Keys, FVector& OutMin, FVector& OutMax)
+	{
+		OutMin = Keys[0];
+		OutMax = Keys[0];
+		for (const FVector& Key : Keys)
+		{
+			OutMin = FVector(std::min(OutMin.X, Key.X), std::min(OutMin.Y, Key.Y), std::min(OutMin.Z, Key.Z));
+			OutMax = FVector(std::max(OutMax.X, Key.X), std::max(OutMax.Y, Key.Y), std::max(OutMax.Z, Key.Z));
+		}
+	}
+
+	FVector ComputeStep(const FVector& Min, const FVector& Max)
+	{
+		return (Max - Min) * (1.0f / 65535.0f);
+	}
+
+	/** 두 회전 사이의 각도. 1에 가까운 내적의 acos는 float 정밀도가 부족하므로 double로 계산 */
+	float RotationErrorDegrees(const FQuat& A, const FQuat& B)
+	{
+		const double LengthA = std::sqrt(static_cast<double>(A.X) * A.X + static_cast<double>(A.Y) * A.Y
+			+ static_cast<double>(A.Z) * A.Z + static_cast<double>(A.W) * A.W);
+		if (LengthA <= 0.0)
+		{
+			return 0.0f;
+		}
+		const double Dot = (static_cast<double>(A.X) * B.X + static_cast<double>(A.Y) * B.Y
+			+ static_cast<double>(A.Z) * B.Z + static_cast<double>(A.W) * B.W) / LengthA;
+		const double CosHalfAngle = std::min(1.0, std::fabs(Dot));
+		return static_cast<float>(2.0 * std::acos(CosHalfAngle) * RadToDeg);
+	}
+
+	float MaxComponentError(const FVector& A, const FVector& B)
+	{
+		return std::max(std::fabs(A.X - B.X), std::max(std::fabs(A.Y - B.Y), std::fabs(A.Z - B.Z)));
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 압축
+// ────────────────────────────────────────────────────────────────────────────
+
+void FAnimCompression::Compress(const UAnimDataModel& Model, FCompressedAnimData& OutData)
+{
+	OutData.Reset();
+
+	const TArray<FBoneAnimationTrack>& RawTracks = Model.GetBoneAnimationTracks();
+	if (RawTracks.IsEmpty())
+	{
+		return;
+	}
+
+	FAnimCompressionStats& Stats = OutData.Stats;
+
+	// 1. 채널 포맷 결정 및 프레임 레코드 레이아웃 배치
+	int32 NumFrames = 1;
+	int32 FrameStride = 0;
+	OutData.Tracks.Reserve(RawTracks.Num());
+
+	for (const FBoneAnimationTrack& RawTrack : RawTracks)
+	{
+		const FRawAnimSequenceTrack& Raw = RawTrack.InternalTrack;
+		FCompressedBoneTrack Track;
+		Track.BoneIndex = RawTrack.BoneIndex;
+
+		Stats.RawBytes += sizeof(FVector) * Raw.PositionKeys.Num()
+			+ sizeof(FQuat) * Raw.RotationKeys.Num()
+			+ sizeof(FVector) * Raw.ScaleKeys.Num();
+
+		NumFrames = std::max(NumFrames, Raw.PositionKeys.Num());
+		NumFrames = std::max(NumFrames, Raw.RotationKeys.Num());
+		NumFrames = std::max(NumFrames, Raw.ScaleKeys.Num());
+
+		// Position
+		if (!Raw.PositionKeys.IsEmpty())
+		{
+			if (IsConstantVector(Raw.PositionKeys, PositionTolerance))
+			{
+				Track.PositionFormat = EAnimTrackFormat::Constant;
+				Track.PositionMin = Raw.PositionKeys[0];
+			}
+			else
+			{
+				FVector Max;
+				ComputeRange(Raw.PositionKeys, Track.PositionMin, Max);
+				Track.PositionStep = ComputeStep(Track.PositionMin, Max);
+				Track.PositionFormat = EAnimTrackFormat::Animated;
+				Track.PositionOffset = static_cast<uint16>(FrameStride);
+				FrameStride += 3;
+			}
+		}
+
+		// Rotation
+		if (!Raw.RotationKeys.IsEmpty())
+		{
+			if (IsConstantRotation(Raw.RotationKeys))
+			{
+				Track.RotationFormat = EAnimTrackFormat::Constant;
+				Track.ConstantRotation = Raw.RotationKeys[0];
+			}
+			else
+			{
+				Track.RotationFormat = EAnimTrackFormat::Animated;
+				Track.RotationOffset = static_cast<uint16>(FrameStride);
+				FrameStride += 3;
+			}
+		}
+
+		// Scale
+		if (!Raw.ScaleKeys.IsEmpty())
+		{
+			if (IsConstantVector(Raw.ScaleKeys, ScaleTolerance))
+			{
+				Track.ScaleFormat = EAnimTrackFormat::Constant;
+				Track.ScaleMin = Raw.ScaleKeys[0];
+			}
+			else
+			{
+				FVector Max;
+				ComputeRange(Raw.ScaleKeys, Track.ScaleMin, Max);
+				Track.ScaleStep = ComputeStep(Track.ScaleMin, Max);
+				Track.ScaleFormat = EAnimTrackFormat::Animated;
+				Track.ScaleOffset = static_cast<uint16>(FrameStride);
+				FrameStride += 3;
+			}
+		}
+
+		for (EAnimTrackFormat Format : { Track.PositionFormat, Track.RotationFormat, Track.ScaleFormat })
+		{
+			switch (Format)
+			{
+			case EAnimTrackFormat::None:     ++Stats.NumNoneChannels; break;
+			case EAnimTrackFormat::Constant: ++Stats.NumConstantChannels; break;
+			case EAnimTrackFormat::Animated: ++Stats.NumAnimatedChannels; break;
+			}
+		}
+
+		OutData.Tracks.Add(Track);
+	}
+
+	if (FrameStride > 0xFFFF)
+	{
+		UE_LOG("[AnimCompression] 프레임 레코드가 너무 큽니다 (%d). 압축을 건너뜁니다.", FrameStride);
+		OutData.Reset();
+		return;
+	}
+
+	OutData.NumFrames = NumFrames;
+	OutData.FrameStride = FrameStride;
+
+	// 2. 프레임 우선 순서로 양자화 데이터 기록
+	OutData.FrameData.SetNum(static_cast<size_t>(NumFrames) * FrameStride);
+	for (int32 TrackIndex = 0; TrackIndex < RawTracks.Num(); ++TrackIndex)
+	{
+		const FRawAnimSequenceTrack& Raw = RawTracks[TrackIndex].InternalTrack;
+		const FCompressedBoneTrack& Track = OutData.Tracks[TrackIndex];
+
+		FVector PositionMax;
+		FVector ScaleMax;
+		if (Track.PositionFormat == EAnimTrackFormat::Animated)
+		{
+			FVector Unused;
+			ComputeRange(Raw.PositionKeys, Unused, PositionMax);
+		}
+		if (Track.ScaleFormat == EAnimTrackFormat::Animated)
+		{
+			FVector Unused;
+			ComputeRange(Raw.ScaleKeys, Unused, ScaleMax);
+		}
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			uint16* Record = OutData.FrameData.data() + static_cast<size_t>(Frame) * FrameStride;
+
+			if (Track.PositionFormat == EAnimTrackFormat::Animated)
+			{
+				EncodeVector(GetPaddedKey(Raw.PositionKeys, Frame), Track.PositionMin, PositionMax, Record + Track.PositionOffset);
+			}
+			if (Track.RotationFormat == EAnimTrackFormat::Animated)
+			{
+				EncodeRotation(GetPaddedKey(Raw.RotationKeys, Frame), Record + Track.RotationOffset);
+			}
+			if (Track.ScaleFormat == EAnimTrackFormat::Animated)
+			{
+				EncodeVector(GetPaddedKey(Raw.ScaleKeys, Frame), Track.ScaleMin, ScaleMax, Record + Track.ScaleOffset);
+			}
+		}
+	}
+
+	Stats.CompressedBytes = sizeof(FCompressedBoneTrack) * OutData.Tracks.Num()
+		+ sizeof(uint16) * OutData.FrameData.Num();
+
+	MeasureError(Model, OutData);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 왕복 오차 리포트
+// ────────────────────────────────────────────────────────────────────────────
+
+void FAnimCompression::MeasureError(const UAnimDataModel& Model, FCompressedAnimData& InOutData)
+{
+	FAnimCompressionStats& Stats = InOutData.Stats;
+	Stats.MaxPositionError = 0.0f;
+	Stats.MaxRotationErrorDegrees = 0.0f;
+	Stats.MaxScaleError = 0.0f;
+
+	const TArray<FBoneAnimationTrack>& RawTracks = Model.GetBoneAnimationTracks();
+	if (RawTracks.Num() != InOutData.Tracks.Num())
+	{
+		return;
+	}
+
+	for (int32 TrackIndex = 0; TrackIndex < RawTracks.Num(); ++TrackIndex)
+	{
+		const FRawAnimSequenceTrack& Raw = RawTracks[TrackIndex].InternalTrack;
+		const FCompressedBoneTrack& Track = InOutData.Tracks[TrackIndex];
+
+		for (int32 Frame = 0; Frame < InOutData.NumFrames; ++Frame)
+		{
+			FTransform Decoded;
+			InOutData.SampleTrack(Track, Frame, Frame, 0.0f, Decoded);
+
+			if (!Raw.PositionKeys.IsEmpty())
+			{
+				Stats.MaxPositionError = std::max(Stats.MaxPositionError,
+					MaxComponentError(GetPaddedKey(Raw.PositionKeys, Frame), Decoded.Translation));
+			}
+			if (!Raw.RotationKeys.IsEmpty())
+			{
+				Stats.MaxRotationErrorDegrees = std::max(Stats.MaxRotationErrorDegrees,
+					RotationErrorDegrees(GetPaddedKey(Raw.RotationKeys, Frame), Decoded.Rotation));
+			}
+			if (!Raw.ScaleKeys.IsEmpty())
+			{
+				Stats.MaxScaleError = std::max(Stats.MaxScaleError,
+					MaxComponentError(GetPaddedKey(Raw.ScaleKeys, Frame), Decoded.Scale3D));
+			}
+		}
+	}
+}
+
+void FAnimCompression::LogReport(const FString& Name, const FCompressedAnimData& Data)
+{
+	const FAnimCompressionStats& Stats = Data.Stats;
+	UE_LOG("[AnimCompression] %s: %d tracks, %d frames, %.1f KB -> %.1f KB (%.1f%%)",
+		Name.c_str(), Data.Tracks.Num(), Data.NumFrames,
+		Stats.RawBytes / 1024.0, Stats.CompressedBytes / 1024.0, Stats.GetCompressionRatio() * 100.0f);
+	UE_LOG("[AnimCompression]   channels: animated %d, constant %d, none %d",
+		Stats.NumAnimatedChannels, Stats.NumConstantChannels, Stats.NumNoneChannels);
+	UE_LOG("[AnimCompression]   max error: position %.5f, rotation %.4f deg, scale %.6f",
+		Stats.MaxPositionError, Stats.MaxRotationErrorDegrees, Stats.MaxScaleError);
+}
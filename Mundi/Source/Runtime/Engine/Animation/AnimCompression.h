@@ -0,0 +1,229 @@
+#pragma once
+#include "Vector.h"
+#include "UEContainer.h"
+
+class UAnimDataModel;
+
+// ────────────────────────────────────────────────────────────────────────────
+// AnimCompression.h
+// UAnimSequence 런타임 샘플링용 압축 트랙 포맷
+// ────────────────────────────────────────────────────────────────────────────
+
+/** 채널(Position/Rotation/Scale) 저장 방식 */
+enum class EAnimTrackFormat : uint8
+{
+	/** 키 없음 (샘플링 시 기존 값 유지) */
+	None,
+
+	/** 모든 키가 같은 값 (트랙 정보에 float로 한 번만 저장) */
+	Constant,
+
+	/** 프레임 버퍼에 16비트 x 3 으로 양자화해 저장 */
+	Animated,
+};
+
+/**
+ * 본 하나의 압축 트랙 정보
+ * Animated 채널은 프레임 레코드 내 오프셋과 역양자화 계수만 가집니다.
+ */
+struct FCompressedBoneTrack
+{
+	int32 BoneIndex = -1;
+
+	EAnimTrackFormat PositionFormat = EAnimTrackFormat::None;
+	EAnimTrackFormat RotationFormat = EAnimTrackFormat::None;
+	EAnimTrackFormat ScaleFormat = EAnimTrackFormat::None;
+
+	/** Animated 채널의 프레임 레코드 내 오프셋 (uint16 단위) */
+	uint16 PositionOffset = 0;
+	uint16 RotationOffset = 0;
+	uint16 ScaleOffset = 0;
+
+	/** Constant면 상수 값, Animated면 범위 최솟값 */
+	FVector PositionMin;
+	/** Animated 전용: (Max - Min) / 65535 */
+	FVector PositionStep;
+
+	/** Constant 회전 값 */
+	FQuat ConstantRotation;
+
+	/** Constant면 상수 값, Animated면 범위 최솟값 */
+	FVector ScaleMin = FVector(1.0f, 1.0f, 1.0f);
+	/** Animated 전용: (Max - Min) / 65535 */
+	FVector ScaleStep;
+};
+
+/**
+ * 압축 결과와 원본 트랙 대비 왕복 오차 리포트
+ */
+struct FAnimCompressionStats
+{
+	/** 원본 키 데이터 크기 (바이트) */
+	uint64 RawBytes = 0;
+
+	/** 압축 데이터 크기 (트랙 정보 + 프레임 버퍼, 바이트) */
+	uint64 CompressedBytes = 0;
+
+	int32 NumNoneChannels = 0;
+	int32 NumConstantChannels = 0;
+	int32 NumAnimatedChannels = 0;
+
+	/** 원본 키 대비 최대 오차 */
+	float MaxPositionError = 0.0f;
+	float MaxRotationErrorDegrees = 0.0f;
+	float MaxScaleError = 0.0f;
+
+	float GetCompressionRatio() const
+	{
+		return RawBytes > 0 ? static_cast<float>(CompressedBytes) / static_cast<float>(RawBytes) : 1.0f;
+	}
+};
+
+/**
+ * FCompressedAnimData
+ *
+ * 모든 본의 Animated 채널을 프레임 단위로 이어 붙인 프레임 우선(frame-major) 버퍼입니다.
+ * 한 프레임의 포즈는 FrameData[Frame * FrameStride] 부터 FrameStride 개의 uint16을
+ * 순서대로 읽으면 되며, 키 인덱스는 시간 * FrameRate로 상수 시간에 구합니다.
+ *
+ * - Constant 채널 제거: 모든 키가 같으면 프레임 버퍼에 넣지 않음
+ * - 회전: smallest-three 48비트 (2비트 인덱스 + 15비트 x 3)
+ * - 위치/스케일: 채널별 [Min, Max] 범위로 정규화한 16비트 x 3
+ */
+struct FCompressedAnimData
+{
+	TArray<FCompressedBoneTrack> Tracks;
+
+	/** 프레임 우선 양자화 데이터 (NumFrames * FrameStride) */
+	TArray<uint16> FrameData;
+
+	/** 모든 채널 중 가장 긴 키 개수. 짧은 채널은 마지막 키로 채움 */
+	int32 NumFrames = 0;
+
+	/** 한 프레임 레코드의 uint16 개수 */
+	int32 FrameStride = 0;
+
+	FAnimCompressionStats Stats;
+
+	bool IsValid() const { return Tracks.Num() > 0; }
+
+	void Reset()
+	{
+		Tracks.Empty();
+		FrameData.Empty();
+		NumFrames = 0;
+		FrameStride = 0;
+		Stats = FAnimCompressionStats();
+	}
+
+	const uint16* GetFrame(int32 Frame) const
+	{
+		return FrameStride > 0 ? FrameData.data() + static_cast<size_t>(Frame) * FrameStride : nullptr;
+	}
+
+	static FVector DecodeVector(const uint16* Packed, const FVector& Min, const FVector& Step)
+	{
+		return FVector(
+			Min.X + static_cast<float>(Packed[0]) * Step.X,
+			Min.Y + static_cast<float>(Packed[1]) * Step.Y,
+			Min.Z + static_cast<float>(Packed[2]) * Step.Z);
+	}
+
+	static FQuat DecodeRotation(const uint16* Packed)
+	{
+		// 1 / (32767 * sqrt(2)), sqrt(0.5)
+		constexpr float Scale = 2.0f / 32767.0f * 0.70710678f;
+		constexpr float Bias = 0.70710678f;
+
+		const int32 LargestIndex = ((Packed[0] >> 15) << 1) | (Packed[1] >> 15);
+		const float A = static_cast<float>(Packed[0] & 0x7FFF) * Scale - Bias;
+		const float B = static_cast<float>(Packed[1] & 0x7FFF) * Scale - Bias;
+		const float C = static_cast<float>(Packed[2] & 0x7FFF) * Scale - Bias;
+		const float Largest = std::sqrt(std::max(0.0f, 1.0f - A * A - B * B - C * C));
+
+		float Components[4];
+		int32 Slot = 0;
+		const float Small[3] = { A, B, C };
+		for (int32 i = 0; i < 4; ++i)
+		{
+			Components[i] = (i == LargestIndex) ? Largest : Small[Slot++];
+		}
+		return FQuat(Components[0], Components[1], Components[2], Components[3]);
+	}
+
+	/**
+	 * 트랙 하나를 두 프레임 사이에서 샘플링해 InOutTransform에 기록합니다.
+	 * None 채널은 InOutTransform의 기존 값을 그대로 둡니다.
+	 *
+	 * @param Track - 샘플링할 트랙
+	 * @param Frame0 - 이전 프레임
+	 * @param Frame1 - 다음 프레임 (Frame0과 같으면 보간하지 않음)
+	 * @param Alpha - 보간 알파 (0 ~ 1)
+	 * @param InOutTransform - 결과 트랜스폼
+	 */
+	void SampleTrack(const FCompressedBoneTrack& Track, int32 Frame0, int32 Frame1, float Alpha, FTransform& InOutTransform) const
+	{
+		const uint16* Key0 = GetFrame(Frame0);
+		const uint16* Key1 = GetFrame(Frame1);
+		const bool bLerp = Frame0 != Frame1 && Alpha > 0.0f;
+
+		if (Track.PositionFormat == EAnimTrackFormat::Constant)
+		{
+			InOutTransform.Translation = Track.PositionMin;
+		}
+		else if (Track.PositionFormat == EAnimTrackFormat::Animated)
+		{
+			const FVector P0 = DecodeVector(Key0 + Track.PositionOffset, Track.PositionMin, Track.PositionStep);
+			InOutTransform.Translation = bLerp
+				? FMath::Lerp(P0, DecodeVector(Key1 + Track.PositionOffset, Track.PositionMin, Track.PositionStep), Alpha)
+				: P0;
+		}
+
+		if (Track.RotationFormat == EAnimTrackFormat::Constant)
+		{
+			InOutTransform.Rotation = Track.ConstantRotation;
+		}
+		else if (Track.RotationFormat == EAnimTrackFormat::Animated)
+		{
+			const FQuat R0 = DecodeRotation(Key0 + Track.RotationOffset);
+			InOutTransform.Rotation = bLerp
+				? FQuat::Slerp(R0, DecodeRotation(Key1 + Track.RotationOffset), Alpha)
+				: R0;
+		}
+
+		if (Track.ScaleFormat == EAnimTrackFormat::Constant)
+		{
+			InOutTransform.Scale3D = Track.ScaleMin;
+		}
+		else if (Track.ScaleFormat == EAnimTrackFormat::Animated)
+		{
+			const FVector S0 = DecodeVector(Key0 + Track.ScaleOffset, Track.ScaleMin, Track.ScaleStep);
+			InOutTransform.Scale3D = bLerp
+				? FMath::Lerp(S0, DecodeVector(Key1 + Track.ScaleOffset, Track.ScaleMin, Track.ScaleStep), Alpha)
+				: S0;
+		}
+	}
+};
+
+/**
+ * 원본 트랙(FRawAnimSequenceTrack)을 FCompressedAnimData로 변환합니다.
+ */
+class FAnimCompression
+{
+public:
+	/**
+	 * 데이터 모델의 모든 본 트랙을 압축하고 왕복 오차를 측정합니다.
+	 *
+	 * @param Model - 원본 키프레임 데이터
+	 * @param OutData - 압축 결과 (기존 내용은 지워짐)
+	 */
+	static void Compress(const UAnimDataModel& Model, FCompressedAnimData& OutData);
+
+	/**
+	 * 압축 데이터를 원본 트랙의 모든 키와 비교해 OutData.Stats의 오차 항목을 채웁니다.
+	 */
+	static void MeasureError(const UAnimDataModel& Model, FCompressedAnimData& InOutData);
+
+	/** 압축 리포트를 로그로 출력합니다. */
+	static void LogReport(const FString& Name, const FCompressedAnimData& Data);
+};
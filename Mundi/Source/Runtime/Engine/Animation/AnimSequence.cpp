@@ -19,9 +19,17 @@ void UAnimSequence::Load(const FString& InFilePath, ID3D11Device* /*InDevice*/)
 void UAnimSequence::SetAnimDataModel(UAnimDataModel* InDataModel)
 {
 	AnimDataModel = InDataModel;
+	CompressedData.Reset();
 	if (AnimDataModel)
 	{
 		SetSequenceLength(AnimDataModel->SequenceLength);
+
+		// 런타임 샘플링용 압축 트랙 생성 (원본 트랙은 에디터/재압축용으로 유지)
+		FAnimCompression::Compress(*AnimDataModel, CompressedData);
+		if (CompressedData.IsValid())
+		{
+			FAnimCompression::LogReport(GetFilePath(), CompressedData);
+		}
 	}
 }
 
@@ -40,6 +48,12 @@ void UAnimSequence::GetBonePose(float Time, TArray<FTransform>& OutBonePose) con
 	// 시간을 [0, SequenceLength] 범위로 클램프
 	Time = FMath::Clamp(Time, 0.0f, SequenceLength);
 
+	if (IsUsingCompressedData())
+	{
+		SampleCompressedPose(Time, true, true, OutBonePose);
+		return;
+	}
+
 	// 각 본 트랙에 대해 포즈 계산
 	const TArray<FBoneAnimationTrack>& Tracks = AnimDataModel->GetBoneAnimationTracks();
 	for (const FBoneAnimationTrack& Track : Tracks)
@@ -113,6 +127,13 @@ void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool
         EvalTime = FMath::Clamp(EvalTime, 0.0f, Length);
     }
 
+    if (IsUsingCompressedData())
+    {
+        // Interpolated sampling resets missing channels to defaults, nearest sampling keeps the bind pose
+        SampleCompressedPose(EvalTime, bInterpolate, bInterpolate, OutLocalPose);
+        return;
+    }
+
     // Fill from tracks
     const TArray<FBoneAnimationTrack>& Tracks = AnimDataModel->GetBoneAnimationTracks();
     for (const FBoneAnimationTrack& Track : Tracks)
@@ -160,6 +181,34 @@ void UAnimSequence::ExtractBonePose(const FSkeleton& Skeleton, float Time, bool
     }
 }
 
+void UAnimSequence::SampleCompressedPose(float Time, bool bInterpolate, bool bResetMissingChannels, TArray<FTransform>& InOutPose) const
+{
+	int32 Frame0, Frame1;
+	float Alpha;
+	FindKeyframeIndices(Time, CompressedData.NumFrames, AnimDataModel->FrameRate, Frame0, Frame1, Alpha);
+	if (!bInterpolate)
+	{
+		Frame1 = Frame0;
+		Alpha = 0.0f;
+	}
+
+	const int32 NumBones = InOutPose.Num();
+	for (const FCompressedBoneTrack& Track : CompressedData.Tracks)
+	{
+		if (Track.BoneIndex < 0 || Track.BoneIndex >= NumBones)
+		{
+			continue;
+		}
+
+		FTransform& BonePose = InOutPose[Track.BoneIndex];
+		if (bResetMissingChannels)
+		{
+			BonePose = FTransform();
+		}
+		CompressedData.SampleTrack(Track, Frame0, Frame1, Alpha, BonePose);
+	}
+}
+
 void UAnimSequence::FindKeyframeIndices(float Time, int32 NumKeys, float FrameRate, int32& OutIndex0, int32& OutIndex1, float& OutAlpha) const
 {
 	if (NumKeys == 0)
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "AnimSequenceBase.h"
 #include "AnimDataModel.h"
+#include "AnimCompression.h"
 #include "Source/Runtime/Engine/Viewer/ViewerState.h"
 #include "UAnimSequence.generated.h"
 
@@ -45,6 +46,18 @@ public:
 	 */
 	void SetAnimDataModel(UAnimDataModel* InDataModel);
 
+	/**
+	 * 런타임 샘플링에 사용하는 압축 트랙 데이터
+	 * SetAnimDataModel 시점에 원본 트랙으로부터 생성됩니다.
+	 */
+	const FCompressedAnimData& GetCompressedData() const { return CompressedData; }
+
+	/**
+	 * 압축 트랙 사용 여부 (false면 원본 트랙으로 샘플링, 오차 비교용)
+	 */
+	void SetUseCompressedData(bool bInUseCompressedData) { bUseCompressedData = bInUseCompressedData; }
+	bool IsUsingCompressedData() const { return bUseCompressedData && CompressedData.IsValid(); }
+
 	/**
 	 * 애니메이션이 유효한지 확인
 	 * @return 유효하면 true
@@ -107,7 +120,22 @@ protected:
 	/** .anim.bin 캐시 파일 경로 (FBX 독립 로딩용) */
 	FString CachePath;
 
+	/** 원본 트랙을 압축한 런타임 샘플링용 데이터 */
+	FCompressedAnimData CompressedData;
+
+	bool bUseCompressedData = true;
+
 private:
+	/**
+	 * 압축 트랙에서 포즈 샘플링
+	 * 모든 본이 같은 프레임 레코드를 공유하므로 키 인덱스는 한 번만 계산
+	 * @param Time 평가 시간
+	 * @param bInterpolate false면 가장 가까운 이전 키 사용
+	 * @param bResetMissingChannels true면 키가 없는 채널을 기본값(0, Identity, 1)으로 설정
+	 * @param InOutPose 출력 본 트랜스폼 배열
+	 */
+	void SampleCompressedPose(float Time, bool bInterpolate, bool bResetMissingChannels, TArray<FTransform>& InOutPose) const;
+
 	/**
 	 * Position 키프레임 보간
 	 * @param PositionKeys 위치 키 배열
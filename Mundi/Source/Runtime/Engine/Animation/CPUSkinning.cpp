@@ -0,0 +1,250 @@
+#include "pch.h"
+#include "CPUSkinning.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+#include <random>
+
+namespace
+{
+	/** XYZ 성분만 정규화 (FVector::GetNormalized와 동일하게 길이가 KINDA_SMALL_NUMBER 이하면 0) */
+	inline __m128 Normalize3(__m128 V)
+	{
+		const __m128 Sq = _mm_mul_ps(V, V);
+		const __m128 LenSq = _mm_add_ss(_mm_add_ss(Sq, _mm_shuffle_ps(Sq, Sq, _MM_SHUFFLE(1, 1, 1, 1))),
+			_mm_shuffle_ps(Sq, Sq, _MM_SHUFFLE(2, 2, 2, 2)));
+		const __m128 Len = _mm_sqrt_ss(LenSq);
+		if (_mm_cvtss_f32(Len) <= KINDA_SMALL_NUMBER)
+		{
+			return _mm_setzero_ps();
+		}
+		return _mm_div_ps(V, _mm_shuffle_ps(Len, Len, _MM_SHUFFLE(0, 0, 0, 0)));
+	}
+
+	/** Row-vector 규약: X * R0 + Y * R1 + Z * R2 */
+	inline __m128 TransformVector3(float X, float Y, float Z, __m128 R0, __m128 R1, __m128 R2)
+	{
+		__m128 Result = _mm_mul_ps(_mm_set1_ps(X), R0);
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Y), R1));
+		Result = _mm_add_ps(Result, _mm_mul_ps(_mm_set1_ps(Z), R2));
+		return Result;
+	}
+
+	/** 두 결과 배열의 위치/노멀/탄젠트 최대 오차 */
+	float ComputeMaxError(const TArray<FNormalVertex>& A, const TArray<FNormalVertex>& B)
+	{
+		float MaxError = 0.0f;
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			MaxError = std::max(MaxError, (A[i].pos - B[i].pos).Size());
+			MaxError = std::max(MaxError, (A[i].normal - B[i].normal).Size());
+			const FVector TangentA(A[i].Tangent.X, A[i].Tangent.Y, A[i].Tangent.Z);
+			const FVector TangentB(B[i].Tangent.X, B[i].Tangent.Y, B[i].Tangent.Z);
+			MaxError = std::max(MaxError, (TangentA - TangentB).Size());
+		}
+		return MaxError;
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 스키닝 커널
+// ────────────────────────────────────────────────────────────────────────────
+
+void FCPUSkinning::SkinVertices(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 Start, int32 End,
+	const FMatrix* BoneMatrices, int32 NumBones)
+{
+	alignas(16) float Out[4];
+
+	for (int32 Idx = Start; Idx < End; ++Idx)
+	{
+		const FSkinnedVertex& SrcVert = Src[Idx];
+		FNormalVertex& DstVert = Dst[Idx];
+
+		// 1. 영향 본 행렬을 가중치로 블렌딩 (정점당 한 번)
+		__m128 R0 = _mm_setzero_ps();
+		__m128 R1 = _mm_setzero_ps();
+		__m128 R2 = _mm_setzero_ps();
+		__m128 R3 = _mm_setzero_ps();
+
+		for (int32 Influence = 0; Influence < 4; ++Influence)
+		{
+			const uint32 BoneIndex = SrcVert.BoneIndices[Influence];
+			const float Weight = SrcVert.BoneWeights[Influence];
+			if (Weight <= 0.f || BoneIndex >= static_cast<uint32>(NumBones))
+			{
+				continue;
+			}
+
+			const FMatrix& SkinMatrix = BoneMatrices[BoneIndex];
+			const __m128 W = _mm_set1_ps(Weight);
+			R0 = _mm_add_ps(R0, _mm_mul_ps(SkinMatrix.Rows[0], W));
+			R1 = _mm_add_ps(R1, _mm_mul_ps(SkinMatrix.Rows[1], W));
+			R2 = _mm_add_ps(R2, _mm_mul_ps(SkinMatrix.Rows[2], W));
+			R3 = _mm_add_ps(R3, _mm_mul_ps(SkinMatrix.Rows[3], W));
+		}
+
+		// 2. 블렌딩된 행렬로 위치/노멀/탄젠트를 한 번에 변환 (비균등 스케일 무시)
+		const FVector& Position = SrcVert.Position;
+		const __m128 SkinnedPosition = _mm_add_ps(TransformVector3(Position.X, Position.Y, Position.Z, R0, R1, R2), R3);
+
+		const FVector& Normal = SrcVert.Normal;
+		const __m128 SkinnedNormal = Normalize3(TransformVector3(Normal.X, Normal.Y, Normal.Z, R0, R1, R2));
+
+		const FVector4& Tangent = SrcVert.Tangent;
+		const __m128 SkinnedTangent = Normalize3(TransformVector3(Tangent.X, Tangent.Y, Tangent.Z, R0, R1, R2));
+
+		// FNormalVertex의 FVector 멤버는 16바이트 정렬이 아니므로 임시 버퍼를 거쳐 기록
+		_mm_store_ps(Out, SkinnedPosition);
+		DstVert.pos = FVector(Out[0], Out[1], Out[2]);
+
+		_mm_store_ps(Out, SkinnedNormal);
+		DstVert.normal = FVector(Out[0], Out[1], Out[2]);
+
+		_mm_store_ps(Out, SkinnedTangent);
+		DstVert.Tangent = FVector4(Out[0], Out[1], Out[2], Tangent.W);
+
+		DstVert.tex = SrcVert.UV;
+	}
+}
+
+void FCPUSkinning::SkinVerticesParallel(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 NumVertices,
+	const FMatrix* BoneMatrices, int32 NumBones)
+{
+	FJobSystem::ParallelForRange(NumVertices, VerticesPerBatch, [=](int32 Start, int32 End)
+	{
+		SkinVertices(Src, Dst, Start, End, BoneMatrices, NumBones);
+	});
+}
+
+void FCPUSkinning::SkinVerticesScalar(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 Start, int32 End,
+	const FMatrix* BoneMatrices, int32 NumBones)
+{
+	for (int32 Idx = Start; Idx < End; ++Idx)
+	{
+		const FSkinnedVertex& SrcVert = Src[Idx];
+		FNormalVertex& DstVert = Dst[Idx];
+
+		const FVector OriginalTangentDir(SrcVert.Tangent.X, SrcVert.Tangent.Y, SrcVert.Tangent.Z);
+
+		FVector BlendedPosition(0.f, 0.f, 0.f);
+		FVector BlendedNormal(0.f, 0.f, 0.f);
+		FVector BlendedTangentDir(0.f, 0.f, 0.f);
+
+		for (int32 Influence = 0; Influence < 4; ++Influence)
+		{
+			const uint32 BoneIndex = SrcVert.BoneIndices[Influence];
+			const float Weight = SrcVert.BoneWeights[Influence];
+			if (Weight <= 0.f || BoneIndex >= static_cast<uint32>(NumBones))
+			{
+				continue;
+			}
+
+			const FMatrix& SkinMatrix = BoneMatrices[BoneIndex];
+			BlendedPosition += SkinMatrix.TransformPosition(SrcVert.Position) * Weight;
+			BlendedNormal += SkinMatrix.TransformVector(SrcVert.Normal) * Weight;
+			BlendedTangentDir += SkinMatrix.TransformVector(OriginalTangentDir) * Weight;
+		}
+
+		const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
+
+		DstVert.pos = BlendedPosition;
+		DstVert.normal = BlendedNormal.GetSafeNormal();
+		DstVert.Tangent = FVector4(FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, SrcVert.Tangent.W);
+		DstVert.tex = SrcVert.UV;
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 벤치마크
+// ────────────────────────────────────────────────────────────────────────────
+
+void FCPUSkinning::RunBenchmark(int32 NumVertices, int32 NumBones, int32 Iterations)
+{
+	NumVertices = std::max(1, NumVertices);
+	NumBones = std::max(1, NumBones);
+	Iterations = std::max(1, Iterations);
+
+	// 고정 시드로 재현 가능한 입력 생성
+	std::mt19937 Random(12345);
+	std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+	std::uniform_int_distribution<uint32> BoneDist(0, static_cast<uint32>(NumBones - 1));
+
+	TArray<FMatrix> BoneMatrices;
+	BoneMatrices.SetNum(NumBones);
+	for (FMatrix& Bone : BoneMatrices)
+	{
+		Bone = FMatrix::Identity();
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			for (int32 Col = 0; Col < 3; ++Col)
+			{
+				Bone.M[Row][Col] += Unit(Random) * 0.25f;
+			}
+			Bone.M[3][Row] = Unit(Random) * 10.0f;
+		}
+	}
+
+	TArray<FSkinnedVertex> Vertices;
+	Vertices.SetNum(NumVertices);
+	for (FSkinnedVertex& Vertex : Vertices)
+	{
+		Vertex.Position = FVector(Unit(Random), Unit(Random), Unit(Random)) * 100.0f;
+		Vertex.Normal = FVector(Unit(Random), Unit(Random), Unit(Random)).GetSafeNormal();
+		Vertex.Tangent = FVector4(Unit(Random), Unit(Random), Unit(Random), Unit(Random) < 0.0f ? -1.0f : 1.0f);
+		Vertex.UV = FVector2D(Unit(Random), Unit(Random));
+
+		float WeightSum = 0.0f;
+		for (int32 Influence = 0; Influence < 4; ++Influence)
+		{
+			Vertex.BoneIndices[Influence] = BoneDist(Random);
+			Vertex.BoneWeights[Influence] = Unit(Random) * 0.5f + 0.5f;
+			WeightSum += Vertex.BoneWeights[Influence];
+		}
+		for (int32 Influence = 0; Influence < 4; ++Influence)
+		{
+			Vertex.BoneWeights[Influence] /= WeightSum;
+		}
+	}
+
+	TArray<FNormalVertex> ScalarResult;
+	TArray<FNormalVertex> SimdResult;
+	TArray<FNormalVertex> ParallelResult;
+	ScalarResult.SetNum(NumVertices);
+	SimdResult.SetNum(NumVertices);
+	ParallelResult.SetNum(NumVertices);
+
+	auto Measure = [Iterations](auto&& Body)
+	{
+		const uint64 Start = FWindowsPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			Body();
+		}
+		const uint64 End = FWindowsPlatformTime::Cycles64();
+		return FWindowsPlatformTime::ToMilliseconds(End - Start) / Iterations;
+	};
+
+	const double ScalarMS = Measure([&]()
+	{
+		SkinVerticesScalar(Vertices.data(), ScalarResult.data(), 0, NumVertices, BoneMatrices.data(), NumBones);
+	});
+
+	const double SimdMS = Measure([&]()
+	{
+		SkinVertices(Vertices.data(), SimdResult.data(), 0, NumVertices, BoneMatrices.data(), NumBones);
+	});
+
+	const double ParallelMS = Measure([&]()
+	{
+		SkinVerticesParallel(Vertices.data(), ParallelResult.data(), NumVertices, BoneMatrices.data(), NumBones);
+	});
+
+	FScopeCycleCounter::AddTimeProfile(TStatId("CPU_VertexSkinning"), ParallelMS);
+
+	UE_LOG("CPU Skinning Benchmark: %d vertices, %d bones, %d iterations, %u workers",
+		NumVertices, NumBones, Iterations, FJobSystem::GetNumWorkers());
+	UE_LOG("  Scalar      : %.3f ms", ScalarMS);
+	UE_LOG("  SIMD        : %.3f ms (x%.2f)", SimdMS, SimdMS > 0.0 ? ScalarMS / SimdMS : 0.0);
+	UE_LOG("  SIMD + MT   : %.3f ms (x%.2f)", ParallelMS, ParallelMS > 0.0 ? ScalarMS / ParallelMS : 0.0);
+	UE_LOG("  Max error   : SIMD %.6f, SIMD + MT %.6f",
+		ComputeMaxError(ScalarResult, SimdResult), ComputeMaxError(ScalarResult, ParallelResult));
+}
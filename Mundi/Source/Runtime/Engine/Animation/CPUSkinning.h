@@ -0,0 +1,62 @@
+#pragma once
+#include "Vector.h"
+#include "VertexData.h"
+
+// ────────────────────────────────────────────────────────────────────────────
+// CPUSkinning.h
+// CPU 버텍스 스키닝 커널 (SSE 배치 + 잡 시스템 병렬화)
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * FCPUSkinning
+ *
+ * USkinnedMeshComponent의 CPU 스키닝 경로에서 사용하는 커널 모음입니다.
+ * 정점마다 최대 4개 본 행렬을 가중치로 한 번만 블렌딩한 뒤
+ * 그 행렬로 위치/노멀/탄젠트를 한 번에 변환합니다.
+ *
+ * 컴포넌트 상태에 의존하지 않으므로 벤치마크에서 그대로 호출할 수 있습니다.
+ */
+struct FCPUSkinning
+{
+	/** ParallelFor 한 배치에서 처리할 정점 수 */
+	static constexpr int32 VerticesPerBatch = 1024;
+
+	/**
+	 * [Start, End) 구간의 정점을 SSE로 스키닝합니다.
+	 * 가중치가 0 이하이거나 본 인덱스가 범위를 벗어난 영향은 무시합니다.
+	 * Dst의 color는 건드리지 않습니다.
+	 *
+	 * @param Src - 원본 스킨드 정점 배열
+	 * @param Dst - 결과 정점 배열 (Src와 같은 인덱스로 기록)
+	 * @param Start - 시작 정점 인덱스
+	 * @param End - 끝 정점 인덱스 (미포함)
+	 * @param BoneMatrices - 최종 스키닝 행렬 배열
+	 * @param NumBones - 스키닝 행렬 수
+	 */
+	static void SkinVertices(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 Start, int32 End,
+		const FMatrix* BoneMatrices, int32 NumBones);
+
+	/**
+	 * 전체 정점을 정점 구간 단위로 나눠 워커 스레드에서 SkinVertices를 실행합니다.
+	 * 모든 정점이 끝나야 반환합니다.
+	 */
+	static void SkinVerticesParallel(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 NumVertices,
+		const FMatrix* BoneMatrices, int32 NumBones);
+
+	/**
+	 * 영향마다 FMatrix::TransformPosition/TransformVector를 호출하는 스칼라 기준 구현입니다.
+	 * 벤치마크의 비교 기준 및 결과 검증용입니다.
+	 */
+	static void SkinVerticesScalar(const FSkinnedVertex* Src, FNormalVertex* Dst, int32 Start, int32 End,
+		const FMatrix* BoneMatrices, int32 NumBones);
+
+	/**
+	 * 임의의 정점/본 데이터로 스칼라, SIMD, SIMD+멀티스레드 경로를 측정해 로그로 출력합니다.
+	 * SIMD+멀티스레드 결과는 CPU_VertexSkinning 스탯에도 기록됩니다.
+	 *
+	 * @param NumVertices - 정점 수
+	 * @param NumBones - 본 수
+	 * @param Iterations - 경로별 반복 횟수
+	 */
+	static void RunBenchmark(int32 NumVertices = 100000, int32 NumBones = 64, int32 Iterations = 20);
+};
@@ -34,6 +34,19 @@ namespace
 	{
 		return (ExpandBits(x) << 2) | (ExpandBits(y) << 1) | ExpandBits(z);
 	}
+
+	/**
+	 * AABB 표면적의 절반 (SAH 비용 비교용이므로 상수배는 무관)
+	 */
+	inline float HalfSurfaceArea(const FAABB& Box)
+	{
+		const FVector D = Box.Max - Box.Min;
+		return D.X * D.Y + D.Y * D.Z + D.Z * D.X;
+	}
+
+	/** SAH 비용 상수: 내부 노드 순회 비용 / 리프 컴포넌트 교차 비용 */
+	constexpr float SAHTraversalCost = 1.0f;
+	constexpr float SAHIntersectionCost = 1.0f;
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -63,8 +76,15 @@ void FCollisionBVH::Clear()
 	ShapeComponentBounds = TMap<UShapeComponent*, FAABB>();
 	ShapeComponentArray = TArray<UShapeComponent*>();
 	Nodes = TArray<FLBVHNode>();
+	ComponentLeafIndices = TMap<UShapeComponent*, int32>();
+	DirtyLeaves = TArray<int32>();
+	LeafDirtyFlags = TArray<uint8>();
 	Bounds = FAABB();
 	bPendingRebuild = false;
+	InternalAreaSum = 0.0f;
+	LeafAreaSum = 0.0f;
+	RebuildSAHCost = 0.0f;
+	LastRefitLeafCount = 0;
 }
 
 void FCollisionBVH::BulkUpdate(const TArray<UShapeComponent*>& Components)
@@ -90,8 +110,35 @@ void FCollisionBVH::Update(UShapeComponent* InComponent)
 		return;
 	}
 
-	ShapeComponentBounds[InComponent] = InComponent->GetWorldAABB();
-	bPendingRebuild = true;
+	const FAABB NewBounds = InComponent->GetWorldAABB();
+
+	// 신규 등록이거나 전체 재구축 모드면 구조 재구축 예약
+	FAABB* Cached = ShapeComponentBounds.Find(InComponent);
+	const int32* LeafIdx = ComponentLeafIndices.Find(InComponent);
+	if (!Cached || !LeafIdx || UpdateMode == EUpdateMode::Rebuild)
+	{
+		if (!Cached || Cached->Min != NewBounds.Min || Cached->Max != NewBounds.Max)
+		{
+			bPendingRebuild = true;
+		}
+		ShapeComponentBounds[InComponent] = NewBounds;
+		return;
+	}
+
+	// 움직이지 않은 컴포넌트는 트리에 영향 없음
+	if (Cached->Min == NewBounds.Min && Cached->Max == NewBounds.Max)
+	{
+		return;
+	}
+
+	*Cached = NewBounds;
+
+	// 소속 리프만 Refit 대상으로 기록
+	if (*LeafIdx >= 0 && *LeafIdx < LeafDirtyFlags.Num() && !LeafDirtyFlags[*LeafIdx])
+	{
+		LeafDirtyFlags[*LeafIdx] = 1;
+		DirtyLeaves.push_back(*LeafIdx);
+	}
 }
 
 void FCollisionBVH::Remove(UShapeComponent* InComponent)
@@ -104,16 +151,33 @@ void FCollisionBVH::Remove(UShapeComponent* InComponent)
 	if (ShapeComponentBounds.Find(InComponent))
 	{
 		ShapeComponentBounds.Remove(InComponent);
+		ComponentLeafIndices.Remove(InComponent);
 		bPendingRebuild = true;
 	}
 }
 
 void FCollisionBVH::FlushRebuild()
 {
+	LastRefitLeafCount = 0;
+
 	if (bPendingRebuild)
 	{
 		BuildLBVH();
 		bPendingRebuild = false;
+		return;
+	}
+
+	if (DirtyLeaves.empty())
+	{
+		return;
+	}
+
+	RefitDirtyLeaves();
+
+	// Refit으로 트리 품질이 일정 이상 나빠졌으면 전체 재구축
+	if (GetSAHCost() > RebuildSAHCost * (1.0f + RebuildCostThreshold))
+	{
+		BuildLBVH();
 	}
 }
 
@@ -288,6 +352,22 @@ void FCollisionBVH::DebugDump() const
 	UE_LOG("===== CollisionBVH (LBVH) DUMP END =====\r\n");
 }
 
+float FCollisionBVH::GetSAHCost() const
+{
+	if (Nodes.empty())
+	{
+		return 0.0f;
+	}
+
+	const float RootArea = HalfSurfaceArea(Nodes[0].Bounds);
+	if (RootArea <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return (SAHTraversalCost * InternalAreaSum + SAHIntersectionCost * LeafAreaSum) / RootArea;
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // LBVH 구축
 // ────────────────────────────────────────────────────────────────────────────
@@ -298,6 +378,13 @@ void FCollisionBVH::BuildLBVH()
 	ShapeComponentArray = ShapeComponentBounds.GetKeys();
 	const int N = ShapeComponentArray.Num();
 	Nodes = TArray<FLBVHNode>();
+	ComponentLeafIndices.clear();
+	DirtyLeaves.clear();
+	LeafDirtyFlags.clear();
+	InternalAreaSum = 0.0f;
+	LeafAreaSum = 0.0f;
+	RebuildSAHCost = 0.0f;
+	++RebuildCount;
 
 	if (N == 0)
 	{
@@ -383,7 +470,23 @@ void FCollisionBVH::BuildLBVH()
 	// 5. BVH 트리 구축
 	Nodes.reserve(std::max(1, 2 * N));
 	Nodes.clear();
+	ComponentLeafIndices.reserve(N);
 	BuildRange(0, N);
+
+	// 6. Refit용 보조 데이터 및 기준 SAH 비용 기록
+	LeafDirtyFlags.assign(Nodes.size(), 0);
+	for (const FLBVHNode& Node : Nodes)
+	{
+		if (Node.IsLeaf())
+		{
+			LeafAreaSum += GetNodeSAHTerm(Node);
+		}
+		else
+		{
+			InternalAreaSum += GetNodeSAHTerm(Node);
+		}
+	}
+	RebuildSAHCost = GetSAHCost();
 }
 
 int FCollisionBVH::BuildRange(int s, int e)
@@ -400,6 +503,14 @@ int FCollisionBVH::BuildRange(int s, int e)
 		node.First = s;
 		node.Count = count;
 
+		for (int i = s; i < e; ++i)
+		{
+			if (ShapeComponentArray[i])
+			{
+				ComponentLeafIndices[ShapeComponentArray[i]] = nodeIdx;
+			}
+		}
+
 		bool bInitialized = false;
 		FAABB Accumulated;
 
@@ -440,5 +551,91 @@ int FCollisionBVH::BuildRange(int s, int e)
 	node.Count = 0;
 	node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
 
+	Nodes[L].Parent = nodeIdx;
+	Nodes[R].Parent = nodeIdx;
+
 	return nodeIdx;
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// Refit
+// ────────────────────────────────────────────────────────────────────────────
+
+void FCollisionBVH::RefitDirtyLeaves()
+{
+	LastRefitLeafCount = DirtyLeaves.Num();
+
+	for (int32 LeafIdx : DirtyLeaves)
+	{
+		LeafDirtyFlags[LeafIdx] = 0;
+
+		SetNodeBounds(LeafIdx, ComputeLeafBounds(LeafIdx));
+
+		// 부모 방향으로 AABB 전파 (변화가 없으면 조기 종료)
+		int32 ParentIdx = Nodes[LeafIdx].Parent;
+		while (ParentIdx >= 0)
+		{
+			const FLBVHNode& ParentNode = Nodes[ParentIdx];
+			const FAABB Merged = FAABB::Union(Nodes[ParentNode.Left].Bounds, Nodes[ParentNode.Right].Bounds);
+			if (Merged.Min == ParentNode.Bounds.Min && Merged.Max == ParentNode.Bounds.Max)
+			{
+				break;
+			}
+
+			SetNodeBounds(ParentIdx, Merged);
+			ParentIdx = ParentNode.Parent;
+		}
+	}
+
+	DirtyLeaves.clear();
+
+	if (!Nodes.empty())
+	{
+		Bounds = Nodes[0].Bounds;
+	}
+}
+
+FAABB FCollisionBVH::ComputeLeafBounds(int32 NodeIdx) const
+{
+	const FLBVHNode& Node = Nodes[NodeIdx];
+
+	bool bInitialized = false;
+	FAABB Accumulated = Node.Bounds;
+
+	for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+	{
+		const FAABB* Bound = ShapeComponentBounds.Find(ShapeComponentArray[i]);
+		if (!Bound)
+		{
+			continue;
+		}
+
+		if (!bInitialized)
+		{
+			Accumulated = *Bound;
+			bInitialized = true;
+		}
+		else
+		{
+			Accumulated = FAABB::Union(Accumulated, *Bound);
+		}
+	}
+
+	return Accumulated;
+}
+
+void FCollisionBVH::SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds)
+{
+	FLBVHNode& Node = Nodes[NodeIdx];
+	float& AreaSum = Node.IsLeaf() ? LeafAreaSum : InternalAreaSum;
+
+	AreaSum -= GetNodeSAHTerm(Node);
+	Node.Bounds = NewBounds;
+	AreaSum += GetNodeSAHTerm(Node);
+}
+
+float FCollisionBVH::GetNodeSAHTerm(const FLBVHNode& Node) const
+{
+	const float Area = HalfSurfaceArea(Node.Bounds);
+	return Node.IsLeaf() ? Area * static_cast<float>(Node.Count) : Area;
+}
@@ -21,10 +21,28 @@ class URenderer;
  * - 특정 컴포넌트와 겹칠 가능성이 있는 컴포넌트 쿼리
  * - AABB 기반 공간 쿼리
  * - 디버그 렌더링
+ *
+ * 갱신 모드:
+ * - Rebuild: 변경이 있으면 매번 Morton 정렬부터 전체 재구축
+ * - Refit: 이동한 컴포넌트의 리프만 갱신 후 부모 방향으로 AABB를 다시 맞춤.
+ *          트리 품질(SAH 비용)이 마지막 재구축 대비 임계값 이상 나빠졌을 때만 재구축
+ * 컴포넌트 추가/제거는 트리 구조가 바뀌므로 두 모드 모두 전체 재구축을 수행합니다.
  */
 class FCollisionBVH
 {
 public:
+	/**
+	 * BVH 갱신 방식
+	 */
+	enum class EUpdateMode : uint8
+	{
+		/** 변경 시 항상 전체 재구축 */
+		Rebuild,
+
+		/** 이동한 리프만 갱신 후 Bottom-up Refit (품질 저하 시 재구축) */
+		Refit,
+	};
+
 	// ────────────────────────────────────────────────
 	// 생성자 / 소멸자
 	// ────────────────────────────────────────────────
@@ -73,11 +91,33 @@ public:
 	void Remove(UShapeComponent* InComponent);
 
 	/**
-	 * 보류 중인 BVH 재구축을 즉시 실행합니다.
+	 * 보류 중인 BVH 재구축(또는 Refit)을 즉시 실행합니다.
 	 * Update 호출 후 쿼리 전에 호출해야 합니다.
 	 */
 	void FlushRebuild();
 
+	/**
+	 * 갱신 방식을 설정합니다.
+	 *
+	 * @param InMode - Rebuild 또는 Refit
+	 */
+	void SetUpdateMode(EUpdateMode InMode) { UpdateMode = InMode; }
+
+	/**
+	 * 현재 갱신 방식을 반환합니다.
+	 *
+	 * @return 갱신 방식
+	 */
+	EUpdateMode GetUpdateMode() const { return UpdateMode; }
+
+	/**
+	 * Refit 모드에서 재구축을 유발하는 SAH 비용 증가율을 설정합니다.
+	 * 예) 0.5 이면 마지막 재구축 시점 대비 SAH 비용이 1.5배를 넘을 때 재구축합니다.
+	 *
+	 * @param InThreshold - 허용 증가율 (0 이상)
+	 */
+	void SetRebuildCostThreshold(float InThreshold) { RebuildCostThreshold = std::max(0.0f, InThreshold); }
+
 	// ────────────────────────────────────────────────
 	// 쿼리 API
 	// ────────────────────────────────────────────────
@@ -136,6 +176,34 @@ public:
 	 */
 	void DebugDump() const;
 
+	/**
+	 * 현재 트리의 SAH 비용을 반환합니다 (루트 표면적으로 정규화).
+	 *
+	 * @return SAH 비용
+	 */
+	float GetSAHCost() const;
+
+	/**
+	 * 마지막 전체 재구축 직후의 SAH 비용을 반환합니다.
+	 *
+	 * @return 기준 SAH 비용
+	 */
+	float GetRebuildSAHCost() const { return RebuildSAHCost; }
+
+	/**
+	 * 마지막 FlushRebuild에서 Refit된 리프 수를 반환합니다.
+	 *
+	 * @return Refit된 리프 수
+	 */
+	int GetLastRefitLeafCount() const { return LastRefitLeafCount; }
+
+	/**
+	 * 누적 전체 재구축 횟수를 반환합니다.
+	 *
+	 * @return 재구축 횟수
+	 */
+	int GetRebuildCount() const { return RebuildCount; }
+
 	/**
 	 * BVH 루트 노드의 경계를 반환합니다.
 	 *
@@ -169,6 +237,9 @@ private:
 		/** 리프 노드: 컴포넌트 개수 */
 		int32 Count = 0;
 
+		/** 부모 노드 인덱스 (루트는 -1, Refit용) */
+		int32 Parent = -1;
+
 		/**
 		 * 리프 노드 여부를 반환합니다.
 		 *
@@ -196,6 +267,34 @@ private:
 	 */
 	int BuildRange(int s, int e);
 
+	/**
+	 * Dirty 리프의 AABB를 다시 계산하고 부모 방향으로 전파합니다.
+	 * 트리 구조(컴포넌트 순서)는 유지됩니다.
+	 */
+	void RefitDirtyLeaves();
+
+	/**
+	 * 리프 노드의 AABB를 소속 컴포넌트들의 캐시 AABB로 다시 계산합니다.
+	 *
+	 * @param NodeIdx - 리프 노드 인덱스
+	 * @return 재계산된 AABB
+	 */
+	FAABB ComputeLeafBounds(int32 NodeIdx) const;
+
+	/**
+	 * 노드 AABB를 교체하면서 SAH 누적값을 갱신합니다.
+	 *
+	 * @param NodeIdx - 노드 인덱스
+	 * @param NewBounds - 새 AABB
+	 */
+	void SetNodeBounds(int32 NodeIdx, const FAABB& NewBounds);
+
+	/**
+	 * 노드 하나가 SAH 누적값에 기여하는 값을 반환합니다.
+	 * 내부 노드는 표면적, 리프는 표면적 * 컴포넌트 수입니다.
+	 */
+	float GetNodeSAHTerm(const FLBVHNode& Node) const;
+
 	// ────────────────────────────────────────────────
 	// 멤버 변수
 	// ────────────────────────────────────────────────
@@ -221,6 +320,36 @@ private:
 	/** LBVH 노드 배열 */
 	TArray<FLBVHNode> Nodes;
 
+	/** 컴포넌트 -> 소속 리프 노드 인덱스 (BuildLBVH에서 채워짐, Refit용) */
+	TMap<UShapeComponent*, int32> ComponentLeafIndices;
+
+	/** AABB가 바뀌어 Refit이 필요한 리프 노드 인덱스 */
+	TArray<int32> DirtyLeaves;
+
+	/** DirtyLeaves 중복 추가 방지 플래그 (Nodes와 같은 크기) */
+	TArray<uint8> LeafDirtyFlags;
+
 	/** 재구축 대기 플래그 */
 	bool bPendingRebuild = false;
+
+	/** 갱신 방식 */
+	EUpdateMode UpdateMode = EUpdateMode::Refit;
+
+	/** Refit 모드에서 재구축을 유발하는 SAH 비용 증가율 */
+	float RebuildCostThreshold = 0.5f;
+
+	/** 내부 노드 표면적 합 (SAH 비용 계산용, Refit 시 증분 갱신) */
+	float InternalAreaSum = 0.0f;
+
+	/** 리프 표면적 * 컴포넌트 수 합 (SAH 비용 계산용, Refit 시 증분 갱신) */
+	float LeafAreaSum = 0.0f;
+
+	/** 마지막 재구축 직후의 SAH 비용 */
+	float RebuildSAHCost = 0.0f;
+
+	/** 마지막 FlushRebuild에서 Refit된 리프 수 (통계용) */
+	int LastRefitLeafCount = 0;
+
+	/** 누적 전체 재구축 횟수 (통계용) */
+	int RebuildCount = 0;
 };
@@ -37,13 +37,14 @@ void UCollisionManager::RegisterComponent(UShapeComponent* Component)
 	}
 
 	// 이미 등록된 컴포넌트는 무시
-	if (RegisteredComponents.Contains(Component))
+	if (RegisteredComponentSet.Contains(Component))
 	{
 		return;
 	}
 
 	// 컴포넌트 등록
 	RegisteredComponents.push_back(Component);
+	RegisteredComponentSet.Add(Component);
 
 	// BVH에 추가
 	BVH->Update(Component);
@@ -60,7 +61,7 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 	}
 
 	// 등록되지 않은 컴포넌트는 무시
-	if (!RegisteredComponents.Contains(Component))
+	if (!RegisteredComponentSet.Contains(Component))
 	{
 		return;
 	}
@@ -70,15 +71,19 @@ void UCollisionManager::UnregisterComponent(UShapeComponent* Component)
 		std::remove(RegisteredComponents.begin(), RegisteredComponents.end(), Component),
 		RegisteredComponents.end()
 	);
+	RegisteredComponentSet.Remove(Component);
 
 	// BVH에서 제거
 	BVH->Remove(Component);
 
 	// Dirty 목록에서도 제거
-	DirtyComponents.erase(
-		std::remove(DirtyComponents.begin(), DirtyComponents.end(), Component),
-		DirtyComponents.end()
-	);
+	if (DirtyComponentSet.Remove(Component))
+	{
+		DirtyComponents.erase(
+			std::remove(DirtyComponents.begin(), DirtyComponents.end(), Component),
+			DirtyComponents.end()
+		);
+	}
 
 	bNeedsFullRebuild = true;
 }
@@ -91,18 +96,19 @@ void UCollisionManager::MarkComponentDirty(UShapeComponent* Component)
 	}
 
 	// 등록된 컴포넌트만 Dirty 마킹
-	if (!RegisteredComponents.Contains(Component))
+	if (!RegisteredComponentSet.Contains(Component))
 	{
 		return;
 	}
 
 	// 이미 Dirty 목록에 있으면 무시
-	if (DirtyComponents.Contains(Component))
+	if (DirtyComponentSet.Contains(Component))
 	{
 		return;
 	}
 
 	DirtyComponents.push_back(Component);
+	DirtyComponentSet.Add(Component);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -115,17 +121,11 @@ void UCollisionManager::UpdateCollisions(float DeltaTime)
 	CollisionPairsChecked = 0;
 	OverlapEventsTriggered = 0;
 
-	// 매 프레임 모든 등록된 컴포넌트의 현재 위치로 BVH 업데이트
-	// (WorldPartitionManager와 동일한 방식)
-	for (UShapeComponent* Comp : RegisteredComponents)
-	{
-		if (Comp && BVH)
-		{
-			BVH->Update(Comp);
-		}
-	}
+	// 이동한(Dirty) 컴포넌트만 BVH에 반영
+	// 트랜스폼 변경은 OnUpdateTransform이 자식까지 전파하며 MarkComponentDirty를 호출함
+	UpdateBVHIncremental();
 
-	// BVH 재구축 플러시
+	// BVH 재구축/Refit 플러시
 	if (BVH)
 	{
 		BVH->FlushRebuild();
@@ -201,6 +201,12 @@ void UCollisionManager::DebugDump() const
 	GetStats(TotalComponents, TotalNodes, MaxDepth);
 	UE_LOG("BVH - Components: %d, Nodes: %d, Max Depth: %d", TotalComponents, TotalNodes, MaxDepth);
 
+	if (BVH)
+	{
+		UE_LOG("BVH - SAH Cost: %.3f (Rebuild Baseline: %.3f), Refit Leaves (Last Frame): %d, Rebuilds: %d",
+			BVH->GetSAHCost(), BVH->GetRebuildSAHCost(), BVH->GetLastRefitLeafCount(), BVH->GetRebuildCount());
+	}
+
 	if (BVH)
 	{
 		BVH->DebugDump();
@@ -221,6 +227,7 @@ void UCollisionManager::UpdateBVHIncremental()
 	}
 
 	// Dirty 컴포넌트만 증분 업데이트
+	// (완전 재구축 여부는 BVH가 SAH 비용 증가율로 판단)
 	for (UShapeComponent* Comp : DirtyComponents)
 	{
 		if (Comp)
@@ -228,15 +235,10 @@ void UCollisionManager::UpdateBVHIncremental()
 			BVH->Update(Comp);
 		}
 	}
-
-	// 너무 많은 컴포넌트가 Dirty면 완전 재구축
-	if (DirtyComponents.Num() > RegisteredComponents.Num() / 2)
-	{
-		bNeedsFullRebuild = true;
-	}
 }
 
 void UCollisionManager::ClearDirtyFlags()
 {
 	DirtyComponents.clear();
+	DirtyComponentSet.clear();
 }
@@ -156,7 +156,7 @@ private:
 
 	/**
 	 * 증분 BVH 업데이트를 수행합니다.
-	 * DirtyComponents만 업데이트합니다.
+	 * DirtyComponents만 BVH에 전달하며, BVH는 Refit 모드에서 해당 리프만 갱신합니다.
 	 */
 	void UpdateBVHIncremental();
 
@@ -178,9 +178,15 @@ private:
 	/** 등록된 모든 컴포넌트 */
 	TArray<UShapeComponent*> RegisteredComponents;
 
+	/** RegisteredComponents 중복/포함 검사용 Set */
+	TSet<UShapeComponent*> RegisteredComponentSet;
+
 	/** 이동한 컴포넌트 (증분 업데이트용) */
 	TArray<UShapeComponent*> DirtyComponents;
 
+	/** 더티 목록 중복 추가를 막기 위한 Set */
+	TSet<UShapeComponent*> DirtyComponentSet;
+
 	/** 완전 재구축 필요 여부 */
 	bool bNeedsFullRebuild = false;
 
@@ -152,6 +152,51 @@ FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideA
     return Result;
 }
 
+// ------------------------------------------------------------
+// ViewProj 행렬에서 평면 추출
+//  - 행벡터 규약이므로 클립 좌표 성분 i는 행렬의 i번째 "열"과의 내적이다.
+//  - D3D 클립 공간: -w <= x,y <= w,  0 <= z <= w
+//  - 결합 결과 (a,b,c,d)에 대해 a*x+b*y+c*z+d >= 0 이 내부이므로
+//    우리 평면식 dot(N,X) - D >= 0 에 맞추어 N=(a,b,c)/len, D=-d/len
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipCombo(float A, float B, float C, float D)
+    {
+        const float Len = std::sqrt(A * A + B * B + C * C);
+        if (Len <= 0.0f)
+        {
+            return FPlane{ FVector4(0.0f, 0.0f, 0.0f, 0.0f), -1.0f }; // 항상 통과
+        }
+        const float InvLen = 1.0f / Len;
+        return FPlane{ FVector4(A * InvLen, B * InvLen, C * InvLen, 0.0f), -D * InvLen };
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection)
+{
+    const auto& M = ViewProjection.M;
+    auto Column = [&M](int32 Index, int32 Row) { return M[Row][Index]; };
+    auto Combo = [&](int32 Index, float Sign)
+        {
+            // Column3 + Sign * Column(Index)
+            return MakePlaneFromClipCombo(
+                Column(3, 0) + Sign * Column(Index, 0),
+                Column(3, 1) + Sign * Column(Index, 1),
+                Column(3, 2) + Sign * Column(Index, 2),
+                Column(3, 3) + Sign * Column(Index, 3));
+        };
+
+    FFrustum Result;
+    Result.LeftFace = Combo(0, 1.0f);
+    Result.RightFace = Combo(0, -1.0f);
+    Result.BottomFace = Combo(1, 1.0f);
+    Result.TopFace = Combo(1, -1.0f);
+    Result.NearFace = MakePlaneFromClipCombo(Column(2, 0), Column(2, 1), Column(2, 2), Column(2, 3)); // z >= 0
+    Result.FarFace = Combo(2, -1.0f);
+    return Result;
+}
+
 // ------------------------------------------------------------
 // AABB vs 프러스텀 판정
 //  - 각 평면에 대해: 중심의 부호 + 박스의 "프로젝션 반경"으로 배제 테스트
@@ -425,4 +470,57 @@ uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8])
     }
 
     return static_cast<uint8_t>(all_visible_mask);
-}
\ No newline at end of file
+}
+
+// SSE 4-wide 절두체 컬링 (BVH 노드/리프 박스 판정용)
+uint32 AreAABBsVisible_4_SSE(const FFrustum& Frustum, const FAABB* const Bounds[4], uint32& OutFullyInsideMask)
+{
+    // 1. AoS → SoA (박스가 흩어져 있으므로 레인별로 모음)
+    const __m128 MinX = _mm_setr_ps(Bounds[0]->Min.X, Bounds[1]->Min.X, Bounds[2]->Min.X, Bounds[3]->Min.X);
+    const __m128 MinY = _mm_setr_ps(Bounds[0]->Min.Y, Bounds[1]->Min.Y, Bounds[2]->Min.Y, Bounds[3]->Min.Y);
+    const __m128 MinZ = _mm_setr_ps(Bounds[0]->Min.Z, Bounds[1]->Min.Z, Bounds[2]->Min.Z, Bounds[3]->Min.Z);
+    const __m128 MaxX = _mm_setr_ps(Bounds[0]->Max.X, Bounds[1]->Max.X, Bounds[2]->Max.X, Bounds[3]->Max.X);
+    const __m128 MaxY = _mm_setr_ps(Bounds[0]->Max.Y, Bounds[1]->Max.Y, Bounds[2]->Max.Y, Bounds[3]->Max.Y);
+    const __m128 MaxZ = _mm_setr_ps(Bounds[0]->Max.Z, Bounds[1]->Max.Z, Bounds[2]->Max.Z, Bounds[3]->Max.Z);
+
+    // 2. 중심 / 반길이
+    const __m128 Half = _mm_set1_ps(0.5f);
+    const __m128 CenterX = _mm_mul_ps(_mm_add_ps(MaxX, MinX), Half);
+    const __m128 CenterY = _mm_mul_ps(_mm_add_ps(MaxY, MinY), Half);
+    const __m128 CenterZ = _mm_mul_ps(_mm_add_ps(MaxZ, MinZ), Half);
+    const __m128 ExtentX = _mm_mul_ps(_mm_sub_ps(MaxX, MinX), Half);
+    const __m128 ExtentY = _mm_mul_ps(_mm_sub_ps(MaxY, MinY), Half);
+    const __m128 ExtentZ = _mm_mul_ps(_mm_sub_ps(MaxZ, MinZ), Half);
+
+    // 3. 평면별 판정: Distance + Radius >= 0 이면 통과, Distance - Radius >= 0 이면 완전히 안쪽
+    const FPlane* Planes[6] = { &Frustum.LeftFace, &Frustum.RightFace, &Frustum.TopFace, &Frustum.BottomFace, &Frustum.NearFace, &Frustum.FarFace };
+    const __m128 Zero = _mm_setzero_ps();
+    uint32 VisibleMask = 0xF;
+    uint32 InsideMask = 0xF;
+
+    for (const FPlane* Plane : Planes)
+    {
+        const __m128 NX = _mm_set1_ps(Plane->Normal.X);
+        const __m128 NY = _mm_set1_ps(Plane->Normal.Y);
+        const __m128 NZ = _mm_set1_ps(Plane->Normal.Z);
+
+        const __m128 Distance = _mm_sub_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(CenterX, NX), _mm_mul_ps(CenterY, NY)), _mm_mul_ps(CenterZ, NZ)),
+            _mm_set1_ps(Plane->Distance));
+
+        const __m128 Radius = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(ExtentX, _mm_set1_ps(std::abs(Plane->Normal.X))), _mm_mul_ps(ExtentY, _mm_set1_ps(std::abs(Plane->Normal.Y)))),
+            _mm_mul_ps(ExtentZ, _mm_set1_ps(std::abs(Plane->Normal.Z))));
+
+        VisibleMask &= static_cast<uint32>(_mm_movemask_ps(_mm_cmpge_ps(_mm_add_ps(Distance, Radius), Zero)));
+        InsideMask &= static_cast<uint32>(_mm_movemask_ps(_mm_cmpge_ps(_mm_sub_ps(Distance, Radius), Zero)));
+
+        if (VisibleMask == 0)
+        {
+            break;
+        }
+    }
+
+    OutFullyInsideMask = InsideMask & VisibleMask;
+    return VisibleMask;
+}
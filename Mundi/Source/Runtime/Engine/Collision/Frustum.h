@@ -26,6 +26,9 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+
+// 행벡터 규약(p' = p * View * Proj)의 ViewProj 행렬에서 평면 추출 (D3D 깊이 0~1, 원근/직교 공용)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProjection);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
@@ -34,4 +37,9 @@ bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 // Returns an 8-bit mask: bit i is set if box i is visible.
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8]);
 
+// SSE로 AABB 4개를 6개 평면에 대해 동시에 판정 (BVH 순회용, 박스는 흩어진 포인터로 받음)
+// 반환: bit i가 1이면 박스 i가 보임
+// OutFullyInsideMask: bit i가 1이면 박스 i가 모든 평면 안쪽 (자식 판정 생략 가능)
+uint32 AreAABBsVisible_4_SSE(const FFrustum& Frustum, const FAABB* const Bounds[4], uint32& OutFullyInsideMask);
+
 bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents);
\ No newline at end of file
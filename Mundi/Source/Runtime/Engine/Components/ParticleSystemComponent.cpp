@@ -26,6 +26,7 @@
 #include "World.h"
 #include "ObjectFactory.h"
 #include "ParticleEventManager.h"
+#include "ParticleTickManager.h"
 
 // Quad 버텍스 구조체 (UV만 포함)
 struct FSpriteQuadVertex
@@ -553,6 +554,15 @@ void UParticleSystemComponent::CreateDebugRibbonParticleSystem()
 
 void UParticleSystemComponent::OnUnregister()
 {
+	// 이번 프레임 파티클 틱 단계에 등록되어 있으면 해제
+	if (UWorld* World = GetWorld())
+	{
+		if (FParticleTickManager* TickManager = World->GetParticleTickManager())
+		{
+			TickManager->Remove(this);
+		}
+	}
+
 	// 이미터 인스턴스 즉시 정리 (컴포넌트 해제 시에는 페이드 아웃 없이 즉시 클리어)
 	ClearEmitterInstances();
 	bDeactivating = false;
@@ -675,14 +685,58 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
 	// 이벤트 클리어 (매 프레임 시작 시)
 	ClearEvents();
 
+	// 월드 파티클 틱 단계에 등록 (액터 루프가 끝난 뒤 모든 컴포넌트의 이미터를 병렬 시뮬레이션)
+	UWorld* World = GetWorld();
+	if (World && World->GetParticleTickManager() && FParticleTickManager::IsParallelTickEnabled())
+	{
+		World->GetParticleTickManager()->Enqueue(this, DeltaTime);
+		return;
+	}
+
+	TickEmitters(DeltaTime);
+	FinishTick();
+}
+
+bool UParticleSystemComponent::CanTickEmittersInParallel() const
+{
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (!Instance || !Instance->CurrentLODLevel)
+		{
+			continue;
+		}
+
+		for (UParticleModule* Module : Instance->CurrentLODLevel->Modules)
+		{
+			if (Module && Module->bEnabled && !Module->CanTickInParallel())
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void UParticleSystemComponent::TickEmitters(float DeltaTime)
+{
 	// 모든 이미터 인스턴스 틱
 	// bDeactivating이면 새 파티클 스폰 억제 (기존 파티클은 자연 소멸)
-	int32 TotalActiveParticles = 0;
 	for (FParticleEmitterInstance* Instance : EmitterInstances)
 	{
 		if (Instance)
 		{
 			Instance->Tick(DeltaTime, bDeactivating);
+		}
+	}
+}
+
+void UParticleSystemComponent::FinishTick()
+{
+	int32 TotalActiveParticles = 0;
+	for (FParticleEmitterInstance* Instance : EmitterInstances)
+	{
+		if (Instance)
+		{
 			TotalActiveParticles += Instance->ActiveParticles;
 		}
 	}
@@ -729,18 +783,34 @@ void UParticleSystemComponent::ClearEvents()
 	DeathEvents.Empty();
 }
 
+// 병렬 틱 중에는 작업별 버퍼에 기록 (FParticleTickManager가 틱 후 순서대로 병합)
 void UParticleSystemComponent::AddCollisionEvent(const FParticleEventCollideData& Event)
 {
+	if (FParticleEventBuffer* Buffer = FParticleTickManager::GetActiveEventBuffer())
+	{
+		Buffer->CollisionEvents.Add(Event);
+		return;
+	}
 	CollisionEvents.Add(Event);
 }
 
 void UParticleSystemComponent::AddSpawnEvent(const FParticleEventData& Event)
 {
+	if (FParticleEventBuffer* Buffer = FParticleTickManager::GetActiveEventBuffer())
+	{
+		Buffer->SpawnEvents.Add(Event);
+		return;
+	}
 	SpawnEvents.Add(Event);
 }
 
 void UParticleSystemComponent::AddDeathEvent(const FParticleEventData& Event)
 {
+	if (FParticleEventBuffer* Buffer = FParticleTickManager::GetActiveEventBuffer())
+	{
+		Buffer->DeathEvents.Add(Event);
+		return;
+	}
 	DeathEvents.Add(Event);
 }
 
@@ -1224,6 +1294,9 @@ void UParticleSystemComponent::DuplicateSubObjects()
 
 	// 캐싱된 Material도 원본 소유이므로 비움 (delete 하지 않음)
 	CachedParticleMaterials.Empty();
+
+	// 정렬 캐시는 원본 파티클 슬롯 기준이므로 복사본에서 새로 구성
+	SpriteSortCaches.Empty();
 }
 
 void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshBatchElements, const FSceneView* View)
@@ -1242,6 +1315,10 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 
 	// 2. 스프라이트 파티클 수 계산 및 정렬
 	int32 TotalSpriteParticles = 0;
+	if (SpriteSortCaches.Num() != EmitterInstances.Num())
+	{
+		SpriteSortCaches.resize(EmitterInstances.Num());
+	}
 
 	for (FDynamicEmitterDataBase* EmitterData : EmitterRenderData)
 	{
@@ -1258,7 +1335,8 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
 			auto* SpriteData = static_cast<FDynamicSpriteEmitterDataBase*>(EmitterData);
 			FVector ViewOrigin = View ? View->ViewLocation : FVector(0.0f, 0.0f, 0.0f);
 			FVector ViewDirection = View ? View->ViewRotation.GetForwardVector() : FVector(1.0f, 0.0f, 0.0f);
-			SpriteData->SortSpriteParticles(Source.SortMode, ViewOrigin, ViewDirection);
+			FParticleSortCache* SortCache = EmitterData->EmitterIndex < SpriteSortCaches.Num() ? &SpriteSortCaches[EmitterData->EmitterIndex] : nullptr;
+			SpriteData->SortSpriteParticles(Source.SortMode, ViewOrigin, ViewDirection, SortCache);
 		}
 	}
 
@@ -46,6 +46,9 @@ public:
 	// 렌더 데이터 (렌더링 스레드용)
 	TArray<FDynamicEmitterDataBase*> EmitterRenderData;
 
+	// 스프라이트 정렬 캐시 (EmitterIndex별, 프레임 간 정렬 순서와 스크래치 버퍼 유지)
+	TArray<FParticleSortCache> SpriteSortCaches;
+
 	// 언리얼 엔진 호환: 인스턴스 파라미터 시스템
 	// 게임플레이에서 파티클 속성을 동적으로 제어 가능
 	struct FParticleParameter
@@ -113,6 +116,17 @@ public:
 	// 틱
 	virtual void TickComponent(float DeltaTime) override;
 
+	// 파티클 틱 단계 (FParticleTickManager가 호출, 월드가 없으면 TickComponent에서 바로 호출)
+	// TickEmitters: 모든 이미터 인스턴스 시뮬레이션
+	// FinishTick: 비활성화 정리, 렌더 데이터 갱신, 이벤트 디스패치/브로드캐스트
+	void TickEmitters(float DeltaTime);
+	void FinishTick();
+
+	// 이미터들을 서로 다른 스레드에서 Tick해도 되는지 (모든 모듈이 CanTickInParallel)
+	bool CanTickEmittersInParallel() const;
+
+	bool IsDeactivating() const { return bDeactivating; }
+
 	// 활성화/비활성화
 	void ActivateSystem();
 	void DeactivateSystem();
@@ -75,6 +75,9 @@ void UPrimitiveComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransfor
 {
     USceneComponent::OnUpdateTransform(UpdateTransformFlags, Teleport);
 
+    // 움직였으면 BVH가 다시 캐시할 때까지 컬링하지 않음
+    PartitionBoundsEpoch = 0;
+
     if (BodyInstance.IsValidBodyInstance() &&
         !((int32)UpdateTransformFlags & (int32)EUpdateTransformFlags::SkipPhysicsUpdate))
     {
@@ -167,6 +170,10 @@ void UPrimitiveComponent::OnDestroyPhysicsState()
 void UPrimitiveComponent::DuplicateSubObjects()
 {
     Super::DuplicateSubObjects();
+
+    // 복사본은 아직 어느 BVH에도 들어있지 않음
+    PartitionBoundsEpoch = 0;
+    FrustumVisibleStamp = 0;
 }
 
 void UPrimitiveComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -101,6 +101,22 @@ public:
     {
         return bIsCulled;
     }
+
+    // ───── 절두체 컬링 관련 ────────────────────────────
+    /** GetWorldAABB가 렌더링되는 모습을 모두 감싸는지 (false면 컬링하지 않고 항상 그림) */
+    virtual bool SupportsFrustumCulling() const { return false; }
+
+    /** 월드 파티션 BVH가 현재 바운드를 캐시했을 때의 FBVHierarchy::GetEpoch() (0이면 없음/오래됨) */
+    uint32 GetPartitionBoundsEpoch() const { return PartitionBoundsEpoch; }
+    void SetPartitionBoundsEpoch(uint32 InEpoch) { PartitionBoundsEpoch = InEpoch; }
+
+    /** 마지막으로 절두체 컬링을 통과한 쿼리 번호 (FSceneRenderer가 기록) */
+    uint32 GetFrustumVisibleStamp() const { return FrustumVisibleStamp; }
+    void SetFrustumVisibleStamp(uint32 InStamp) { FrustumVisibleStamp = InStamp; }
+
+    /** 마지막으로 오클루전 컬링에서 가려진 쿼리 번호 (FSceneRenderer가 절두체 쿼리 번호로 기록) */
+    uint32 GetOcclusionCulledStamp() const { return OcclusionCulledStamp; }
+    void SetOcclusionCulledStamp(uint32 InStamp) { OcclusionCulledStamp = InStamp; }
     
     // ───── 물리 관련 ────────────────────────────
     virtual void OnCreatePhysicsState();
@@ -141,6 +157,10 @@ public:
 protected:
     bool bIsCulled = false;
 
+    uint32 PartitionBoundsEpoch = 0;
+    uint32 FrustumVisibleStamp = 0;
+    uint32 OcclusionCulledStamp = 0;
+
     // ───── 충돌 관련 ────────────────────────────
     FBodyInstance BodyInstance;
 
@@ -9,6 +9,8 @@
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 // USceneComponent.cpp
 TMap<uint32, USceneComponent*> USceneComponent::SceneIdMap;
+TArray<USceneComponent*> USceneComponent::PendingTransformUpdates;
+uint32 USceneComponent::TransformUpdatePassCounter = 0;
 
 USceneComponent::USceneComponent()
     : RelativeLocation(0, 0, 0)
@@ -42,6 +44,13 @@ USceneComponent::~USceneComponent()
         ParentChildren.Remove(this);
         AttachParent = nullptr;
     }
+
+    // 일괄 갱신 큐에서 제거
+    if (bQueuedForTransformUpdate)
+    {
+        PendingTransformUpdates.Remove(this);
+        bQueuedForTransformUpdate = false;
+    }
 }
 
 // ──────────────────────────────
@@ -121,13 +130,11 @@ void USceneComponent::AddRelativeScale3D(const FVector& DeltaScale)
 // ──────────────────────────────
 FTransform USceneComponent::GetWorldTransform() const
 {
-    // Dangling pointer 방지를 위한 체크 
-    if (AttachParent && !AttachParent->IsPendingDestroy())
+    if (bIsTransformDirty)
     {
-        return AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+        UpdateComponentToWorld();
     }
-
-    return RelativeTransform;
+    return CachedComponentToWorld;
 }
 
 void USceneComponent::SetWorldTransform(const FTransform& W)
@@ -152,6 +159,7 @@ void USceneComponent::SetWorldTransform(const FTransform& W, EUpdateTransformFla
     RelativeRotationEuler = RelativeRotation.ToEulerZYXDeg(); 
     RelativeScale = RelativeTransform.Scale3D;
     
+    MarkTransformDirty();
     OnUpdateTransform(UpdateTransformFlags, Teleport);
 }
 
@@ -279,12 +287,123 @@ FMatrix USceneComponent::GetWorldMatrix() const
 {
     if (bIsTransformDirty)
     {
-        CachedWorldMatrix = GetWorldTransform().ToMatrix();
-        bIsTransformDirty = false;
+        UpdateComponentToWorld();
     }
     return CachedWorldMatrix;
 }
 
+// ──────────────────────────────
+// ComponentToWorld 캐시
+// ──────────────────────────────
+void USceneComponent::UpdateComponentToWorld() const
+{
+    // Dangling pointer 방지를 위한 체크
+    // 부모가 깨끗하면 부모 캐시를 그대로 쓰고, 더티면 부모 쪽이 먼저 재귀적으로 갱신됨
+    if (AttachParent && !AttachParent->IsPendingDestroy())
+    {
+        CachedComponentToWorld = AttachParent->GetWorldTransform().GetWorldTransform(RelativeTransform);
+    }
+    else
+    {
+        CachedComponentToWorld = RelativeTransform;
+    }
+
+    CachedWorldMatrix = CachedComponentToWorld.ToMatrix();
+    bIsTransformDirty = false;
+}
+
+void USceneComponent::MarkTransformDirty()
+{
+    // 서브트리의 루트만 큐에 등록 (자손은 UpdateDirtyTransforms의 너비 우선 순회가 처리)
+    if (!bQueuedForTransformUpdate)
+    {
+        bQueuedForTransformUpdate = true;
+        PendingTransformUpdates.Add(this);
+    }
+
+    bIsTransformDirty = true;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->PropagateTransformDirty();
+        }
+    }
+}
+
+void USceneComponent::PropagateTransformDirty()
+{
+    // 이미 더티면 자손도 모두 더티이므로 여기서 멈춤
+    if (bIsTransformDirty)
+    {
+        return;
+    }
+
+    bIsTransformDirty = true;
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->PropagateTransformDirty();
+        }
+    }
+}
+
+int32 USceneComponent::UpdateDirtyTransforms()
+{
+    if (PendingTransformUpdates.IsEmpty())
+    {
+        return 0;
+    }
+
+    // 갱신 중 새로 더티가 되는 컴포넌트는 다음 호출에서 처리
+    TArray<USceneComponent*> Roots;
+    Roots.swap(PendingTransformUpdates);
+    for (USceneComponent* Root : Roots)
+    {
+        Root->bQueuedForTransformUpdate = false;
+    }
+
+    // 이번 패스에서 이미 방문한 노드는 다른 루트의 서브트리로 처리된 것이므로 건너뜀
+    const uint32 Pass = ++TransformUpdatePassCounter;
+    int32 NumUpdated = 0;
+
+    TArray<USceneComponent*> Queue;
+    for (USceneComponent* Root : Roots)
+    {
+        if (Root->TransformUpdatePass == Pass)
+        {
+            continue;
+        }
+
+        // 너비 우선: 부모가 항상 자식보다 먼저 갱신되어 합성은 노드당 한 번
+        // (지연 평가로 이미 깨끗해진 노드 아래에도 더티 자손이 남아 있을 수 있으므로 서브트리 전체를 순회)
+        Queue.clear();
+        Queue.Add(Root);
+        Root->TransformUpdatePass = Pass;
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            USceneComponent* Node = Queue[Head];
+            if (Node->bIsTransformDirty)
+            {
+                Node->UpdateComponentToWorld();
+                ++NumUpdated;
+            }
+
+            for (USceneComponent* Child : Node->AttachChildren)
+            {
+                if (Child && Child->TransformUpdatePass != Pass)
+                {
+                    Child->TransformUpdatePass = Pass;
+                    Queue.Add(Child);
+                }
+            }
+        }
+    }
+
+    return NumUpdated;
+}
+
 // ──────────────────────────────
 // Attach / Detach
 // ──────────────────────────────
@@ -323,6 +442,9 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent, EAttachmentRule
     RelativeLocation = RelativeTransform.Translation;
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
+
+    // 부모가 바뀌었으므로 서브트리 캐시 무효화
+    MarkTransformDirty();
 }
 
 void USceneComponent::DetachFromParent(bool bKeepWorld)
@@ -343,6 +465,8 @@ void USceneComponent::DetachFromParent(bool bKeepWorld)
     RelativeRotation = RelativeTransform.Rotation;
     RelativeScale = RelativeTransform.Scale3D;
 
+    MarkTransformDirty();
+
     // Notify transform update so shapes can refresh overlaps
     OnUpdateTransform(EUpdateTransformFlags::None, ETeleportType::None);
 }
@@ -354,6 +478,11 @@ void USceneComponent::DuplicateSubObjects()
     AttachParent = nullptr; // 부모 컴포넌트가 이 객체의 SetupAttachment를 호출할 경우, 불필요한 로직(기존 부모에서 제거) 수행 방지
     SpriteComponent = nullptr;
     AttachChildren.clear(); // Actor에서 할당해줌
+
+    // 복사본은 원본의 큐 상태를 공유하지 않음
+    bQueuedForTransformUpdate = false;
+    TransformUpdatePass = 0;
+    MarkTransformDirty();
 }
 
 // ──────────────────────────────
@@ -362,6 +491,7 @@ void USceneComponent::DuplicateSubObjects()
 void USceneComponent::UpdateRelativeTransform()
 {
     RelativeTransform = FTransform(RelativeLocation, RelativeRotation, RelativeScale);
+    MarkTransformDirty();
 }
 
 void USceneComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -430,7 +560,7 @@ void USceneComponent::OnRegister(UWorld* InWorld)
 
 void USceneComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
 {
-    bIsTransformDirty = true;
+    // 캐시 무효화는 트랜스폼을 바꾼 쪽(MarkTransformDirty)에서 이미 처리됨. 여기서는 파생 클래스 알림만 전파
     for (USceneComponent* Child : GetAttachChildren())
     {
         Child->OnUpdateTransform(UpdateTransformFlags, Teleport);
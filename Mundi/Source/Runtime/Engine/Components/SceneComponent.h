@@ -91,6 +91,7 @@ public:
     // ──────────────────────────────
     // World Transform API
     // ──────────────────────────────
+    /** @brief 캐시된 ComponentToWorld. 자신이나 조상이 더티일 때만 부모 캐시로부터 다시 합성한다. */
     FTransform GetWorldTransform() const;
     /** @note 물리가 도입되기 전에 사용된 레거시 코드. EUpdateTransformFlags는 디폴트로 None 사용함. */
     void SetWorldTransform(const FTransform& W);
@@ -115,6 +116,24 @@ public:
     void SetLocalLocationAndRotation(const FVector& L, const FQuat& R);
 
     FMatrix GetWorldMatrix() const; // ToMatrixWithScale
+
+    // ──────────────────────────────
+    // ComponentToWorld 캐시
+    // ──────────────────────────────
+    /**
+     * @brief 자신과 서브트리의 월드 트랜스폼 캐시를 무효화하고 일괄 갱신 큐에 등록한다.
+     * @note 이미 더티인 자식에서는 전파를 멈춘다. (더티 노드의 자손은 항상 더티)
+     */
+    void MarkTransformDirty();
+    bool IsTransformDirty() const { return bIsTransformDirty; }
+
+    /**
+     * @brief 큐에 쌓인 더티 서브트리를 너비 우선으로 일괄 갱신한다.
+     * 부모가 항상 자식보다 먼저 갱신되므로 노드마다 합성은 한 번뿐이다.
+     * 호출 후에는 더티 컴포넌트가 남지 않으므로 워커 스레드에서 GetWorldTransform을 읽기 전용으로 쓸 수 있다.
+     * @return 다시 계산한 컴포넌트 수
+     */
+    static int32 UpdateDirtyTransforms();
       
     // ──────────────────────────────
     // Attach/Detach
@@ -136,6 +155,7 @@ public:
     void SetParent(USceneComponent* InParent)
     {
         AttachParent = InParent;
+        MarkTransformDirty();
     }
 
     // Serialize
@@ -190,6 +210,8 @@ protected:
     // UI 편집용 Euler Angle (Degrees)
     // RelativeRotation과 항상 동기화됨
 
+    // 월드 트랜스폼 캐시 (bIsTransformDirty 하나로 트랜스폼/행렬을 함께 관리)
+    mutable FTransform CachedComponentToWorld;
     mutable FMatrix CachedWorldMatrix = FMatrix::Identity();
     mutable bool bIsTransformDirty = true;
     
@@ -201,6 +223,16 @@ protected:
     FTransform RelativeTransform;
 
     void UpdateRelativeTransform();
+
+    /** @brief 부모 캐시(필요하면 부모부터 갱신)와 RelativeTransform으로 캐시를 다시 계산한다. */
+    void UpdateComponentToWorld() const;
+    void PropagateTransformDirty();
+
+    // UpdateDirtyTransforms 대기열
+    bool bQueuedForTransformUpdate = false;
+    uint32 TransformUpdatePass = 0;
+    static TArray<USceneComponent*> PendingTransformUpdates;
+    static uint32 TransformUpdatePassCounter;
     
     uint32 SceneId; // Scene파일에서 불러온 Id. 컴포넌트끼리 자식부모관계 연결하기 위해 저장. Scene에 저장할 때는 UUID를 저장
     uint32 ParentId;
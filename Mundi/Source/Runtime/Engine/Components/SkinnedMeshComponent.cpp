@@ -4,6 +4,7 @@
 #include "SceneView.h"
 #include "SkinningStats.h"
 #include "PlatformTime.h"
+#include "CPUSkinning.h"
 
 USkinnedMeshComponent::USkinnedMeshComponent() : SkeletalMesh(nullptr)
 {
@@ -207,8 +208,8 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        if (bUseGPU)
        {
           FShaderMacro GPUSkinningMacro;
-          GPUSkinningMacro.Name = FName("GPU_SKINNING");
-          GPUSkinningMacro.Definition = FName("1");
+          GPUSkinningMacro.Name = STATIC_FNAME("GPU_SKINNING");
+          GPUSkinningMacro.Definition = STATIC_FNAME("1");
           ShaderMacros.Add(GPUSkinningMacro);
        }
 
@@ -417,16 +418,9 @@ void USkinnedMeshComponent::PerformSkinning(bool bUseGPU)
       // CPU 버텍스 스키닝 계산 시간 측정
       uint64 VertexSkinningStart = FWindowsPlatformTime::Cycles64();
 
-      for (int32 Idx = 0; Idx < NumVertices; ++Idx)
-      {
-         const FSkinnedVertex& SrcVert = SrcVertices[Idx];
-         FNormalVertex& DstVert = SkinnedVertices[Idx];
-
-         DstVert.pos = SkinVertexPosition(SrcVert);
-         DstVert.normal = SkinVertexNormal(SrcVert);
-         DstVert.Tangent = SkinVertexTangent(SrcVert);
-         DstVert.tex = SrcVert.UV;
-      }
+      // 정점 구간을 워커 스레드에 나눠 SIMD 커널로 처리 (스탯 기록은 호출 스레드에서만)
+      FCPUSkinning::SkinVerticesParallel(SrcVertices.data(), SkinnedVertices.data(), NumVertices,
+         FinalSkinningMatrices.data(), NumBones);
 
       uint64 VertexSkinningEnd = FWindowsPlatformTime::Cycles64();
       double VertexSkinningTimeMS = FWindowsPlatformTime::ToMilliseconds(VertexSkinningEnd - VertexSkinningStart);
@@ -466,72 +460,6 @@ void USkinnedMeshComponent::UpdateSkinningMatrices(const TArray<FMatrix>& InSkin
    bSkinningMatricesDirty = true;
 }
 
-FVector USkinnedMeshComponent::SkinVertexPosition(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedPosition(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedPosition = SkinMatrix.TransformPosition(InVertex.Position);
-         BlendedPosition += TransformedPosition * Weight;
-      }
-   }
-
-   return BlendedPosition;
-}
-
-FVector USkinnedMeshComponent::SkinVertexNormal(const FSkinnedVertex& InVertex) const
-{
-   FVector BlendedNormal(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         // 노멀도 일반 스키닝 행렬로 변환 (비균등 스케일 무시)
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedNormal = SkinMatrix.TransformVector(InVertex.Normal);
-         BlendedNormal += TransformedNormal * Weight;
-      }
-   }
-
-   return BlendedNormal.GetSafeNormal();
-}
-
-FVector4 USkinnedMeshComponent::SkinVertexTangent(const FSkinnedVertex& InVertex) const
-{
-   const FVector OriginalTangentDir(InVertex.Tangent.X, InVertex.Tangent.Y, InVertex.Tangent.Z);
-   const float OriginalSignW = InVertex.Tangent.W;
-
-   FVector BlendedTangentDir(0.f, 0.f, 0.f);
-
-   for (int32 Idx = 0; Idx < 4; ++Idx)
-   {
-      const uint32 BoneIndex = InVertex.BoneIndices[Idx];
-      const float Weight = InVertex.BoneWeights[Idx];
-
-      if (Weight > 0.f)
-      {
-         // 탄젠트도 일반 스키닝 행렬로 변환 (비균등 스케일 무시)
-         const FMatrix& SkinMatrix = FinalSkinningMatrices[BoneIndex];
-         FVector TransformedTangentDir = SkinMatrix.TransformVector(OriginalTangentDir);
-         BlendedTangentDir += TransformedTangentDir * Weight;
-      }
-   }
-
-   const FVector FinalTangentDir = BlendedTangentDir.GetSafeNormal();
-   return { FinalTangentDir.X, FinalTangentDir.Y, FinalTangentDir.Z, OriginalSignW };
-}
-
 void USkinnedMeshComponent::UpdateBoneMatrixBuffer()
 {
    // 실제 본 개수 계산
@@ -7,6 +7,7 @@
 #include "JsonSerializer.h"
 #include "CameraComponent.h"
 #include "MeshBatchElement.h"
+#include "MeshInstancing.h"
 #include "Material.h"
 #include "SceneView.h"
 #include "LuaBindHelpers.h"
@@ -116,6 +117,18 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 			BatchElement.InputLayout = ShaderVariant->InputLayout;
 		}
 
+		// 자동 인스턴싱용 변형 (같은 메시를 그리는 다른 컴포넌트와 인스턴스 드로우로 병합될 수 있음)
+		if (ShaderVariant && FMeshAutoInstancing::IsEnabled() && ShaderToUse->SupportsInstancedWorld())
+		{
+			ShaderMacros.Add(FMeshAutoInstancing::GetInstancedWorldMacro());
+			if (FShaderVariant* InstancedVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros))
+			{
+				BatchElement.InstancedVertexShader = InstancedVariant->VertexShader;
+				BatchElement.InstancedPixelShader = InstancedVariant->PixelShader;
+				BatchElement.InstancedInputLayout = InstancedVariant->InputLayout;
+			}
+		}
+
 		// UMaterialInterface를 UMaterial로 캐스팅해야 할 수 있음. 렌더러가 UMaterial을 기대한다면.
 		// 지금은 Material.h 구조상 UMaterialInterface에 필요한 정보가 다 있음.
 		BatchElement.Material = MaterialToUse;
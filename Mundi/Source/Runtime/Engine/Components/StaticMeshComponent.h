@@ -40,6 +40,7 @@ public:
 	UStaticMesh* GetStaticMesh() const { return StaticMesh; }
 
 	FAABB GetWorldAABB() const override;
+	bool SupportsFrustumCulling() const override { return true; }
 
 	/** StaticMesh의 BodySetup을 반환합니다 */
 	virtual UBodySetup* GetBodySetup() override;
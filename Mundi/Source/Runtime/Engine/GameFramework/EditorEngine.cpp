@@ -8,12 +8,13 @@
 #include "GameUI/SGameHUD.h"
 #include <ObjManager.h>
 
-#include "PhysicalMaterialLoader.h"
+#include "AssetPreloader.h"
 #include "Source/Runtime/Engine/PhysicsEngine/PhysXSupport.h"
 #include "Source/Runtime/Engine/Cloth/ClothManager.h"
 #include "GameInstance.h"
 #include "LevelTransitionManager.h"
 #include "PathUtils.h"
+#include "JobSystem.h"
 
 float UEditorEngine::ClientWidth = 1024.0f;
 float UEditorEngine::ClientHeight = 1024.0f;
@@ -186,6 +187,12 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 클래스 등록(정적 초기화)이 끝났으므로 IsA/Cast용 클래스 트리 번호 부여
+    UClass::BuildClassTree();
+
+    // 잡 시스템 워커 스레드 생성 (에셋 로드 및 서브시스템 병렬 처리용)
+    FJobSystem::Initialize();
+
     if (!CreateMainWindow(hInstance))
         return false;
     
@@ -207,12 +214,8 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
     ClothManager = new UClothManager();
     ClothManager->InitClothManager(RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
 
-    FObjManager::Preload();
-    UFbxLoader::PreLoad();
-
-    FAudioDevice::Preload();
-
-    FPhysicalMaterialLoader::Preload();
+    // 텍스처 / OBJ / FBX / 사운드 / 물리 재질 프리로드 (CPU 단계는 잡 시스템에서 병렬)
+    FAssetPreloader::PreloadAll();
 
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Editor));
@@ -379,6 +382,9 @@ void UEditorEngine::MainLoop()
 
 void UEditorEngine::Shutdown()
 {
+    // 진행 중인 잡을 모두 끝내고 워커 종료 (잡이 참조하는 오브젝트 삭제 전)
+    FJobSystem::Shutdown();
+
     // 월드부터 삭제해야 DeleteAll 때 문제가 없음
     for (FWorldContext WorldContext : WorldContexts)
     {
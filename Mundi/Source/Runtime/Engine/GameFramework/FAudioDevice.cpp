@@ -463,43 +463,3 @@ void FAudioDevice::StopSound(IXAudio2SourceVoice* pSourceVoice)
     pSourceVoice->FlushSourceBuffers();
     pSourceVoice->DestroyVoice();
 }
-
-void FAudioDevice::Preload()
-{
-    const fs::path DataDir(UTF8ToWide(GDataDir + "/Audio"));
-    if (!fs::exists(DataDir) || !fs::is_directory(DataDir))
-    {
-        UE_LOG("FAudioDevice::Preload: Data directory not found: %s", WideToUTF8(DataDir.wstring()).c_str());
-        return;
-    }
-
-    size_t LoadedCount = 0;
-    std::unordered_set<FString> ProcessedFiles; //중복 로딩 방지
-
-    for (const auto& Entry : fs::recursive_directory_iterator(DataDir))
-    {
-        if (!Entry.is_regular_file())
-            continue;
-
-        const fs::path& Path = Entry.path();
-        FString Extension = WideToUTF8(Path.extension().wstring());
-        std::transform(Extension.begin(), Extension.end(), Extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-
-        if (Extension == ".wav")
-        {
-            FString PathStr = NormalizePath(WideToUTF8(Path.wstring()));
-
-            // 이미 처리된 파일인지 확인
-            if (ProcessedFiles.find(PathStr) == ProcessedFiles.end())
-            {
-                ProcessedFiles.insert(PathStr);
-                // Load wav file
-                ++LoadedCount;
-                UResourceManager::GetInstance().Load<USound>(WideToUTF8(Path.wstring()));
-            }
-        }
-    }
-    RESOURCE.SetAudioFiles();
-
-    UE_LOG("FAudioDevice::Preload: Loaded %zu .wav files from %s", LoadedCount, WideToUTF8(DataDir.wstring()).c_str());
-}
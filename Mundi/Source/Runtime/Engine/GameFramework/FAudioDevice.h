@@ -24,9 +24,6 @@ public:
     static void SetListenerPosition(const FVector& Position, const FVector& ForwardVec, const FVector& UpVec);
     static void UpdateSoundPosition(IXAudio2SourceVoice* pSourceVoice, const FVector& EmitterPosition);
 
-    // Loads .wav files under GDataDir/Audio into resource manager
-    static void Preload();
-
     // Check if audio device is valid (not shutdown)
     static bool IsValid() { return pXAudio2 != nullptr; }
 
@@ -10,10 +10,11 @@
 #include "PhysXSupport.h"
 #include "Source/Runtime/Engine/Cloth/ClothManager.h"
 #include "FbxLoader.h"
-#include "PhysicalMaterialLoader.h"
+#include "AssetPreloader.h"
 #include "GameInstance.h"
 #include "LevelTransitionManager.h"
 #include "PathUtils.h"
+#include "JobSystem.h"
 #include <sol/sol.hpp>
 
 float UGameEngine::ClientWidth = 1024.0f;
@@ -201,6 +202,12 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 {
     LoadIniFile();
 
+    // 클래스 등록(정적 초기화)이 끝났으므로 IsA/Cast용 클래스 트리 번호 부여
+    UClass::BuildClassTree();
+
+    // 잡 시스템 워커 스레드 생성 (에셋 로드 및 서브시스템 병렬 처리용)
+    FJobSystem::Initialize();
+
     if (!CreateMainWindow(hInstance))
         return false;
 
@@ -229,16 +236,8 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
     ClothManager = new UClothManager();
     ClothManager->InitClothManager(RHIDevice.GetDevice(), RHIDevice.GetDeviceContext());
 
-    FObjManager::Preload();
-
-    // FBX 파일에서 SkeletalMesh, Animation 로드
-    UFbxLoader::PreLoad();
-
-    // Preload audio assets
-    FAudioDevice::Preload();
-
-    // 물리 재질 로드
-    FPhysicalMaterialLoader::Preload();
+    // 텍스처 / OBJ / FBX / 사운드 / 물리 재질 프리로드 (CPU 단계는 잡 시스템에서 병렬)
+    FAssetPreloader::PreloadAll();
 
     ///////////////////////////////////
     WorldContexts.Add(FWorldContext(NewObject<UWorld>(), EWorldType::Game));
@@ -402,6 +401,9 @@ void UGameEngine::MainLoop()
 
 void UGameEngine::Shutdown()
 {
+    // 진행 중인 잡을 모두 끝내고 워커 종료 (잡이 참조하는 오브젝트 삭제 전)
+    FJobSystem::Shutdown();
+
     // GameInstance 삭제
     if (GameInstance)
     {
@@ -36,6 +36,7 @@
 #include "PlayerCameraManager.h"
 #include "Hash.h"
 #include "ParticleEventManager.h"
+#include "ParticleTickManager.h"
 #include "GameModeBase.h"
 #include "GameStateBase.h"
 #include "PlayerController.h"
@@ -52,6 +53,7 @@ UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based
 	LightManager = std::make_unique<FLightManager>();
 	LightManager->SetOwningWorld(this);  // Set owning world for optimization decisions
 	LuaManager = std::make_unique<FLuaManager>();
+	ParticleTickManager = std::make_unique<FParticleTickManager>();
 
 	UnscaledDelta = 0;
 	SlomoOnlyDelta = 0;
@@ -352,6 +354,16 @@ void UWorld::Tick(float DeltaSeconds)
 		LuaManager->Tick(GetDeltaTime(EDeltaTime::Game));
 	}
 
+	// 이번 프레임 이동한 컴포넌트의 월드 트랜스폼 캐시를 너비 우선으로 일괄 갱신
+	// (병렬 파티클 틱의 워커들이 GetWorldTransform을 읽기 전용으로 쓰도록 먼저 정리)
+	USceneComponent::UpdateDirtyTransforms();
+
+	// 파티클 틱 단계 (이번 프레임 등록된 모든 파티클 컴포넌트의 이미터를 병렬 시뮬레이션)
+	if (ParticleTickManager)
+	{
+		ParticleTickManager->Execute();
+	}
+
 	// 지연 삭제 처리
 	ProcessPendingKillActors();
 
@@ -30,6 +30,7 @@ class UStaticMesh;
 class FOcclusionCullingManagerCPU;
 class APlayerCameraManager;
 class AParticleEventManager;
+class FParticleTickManager;
 class UCollisionManager;
 class AGameModeBase;
 class ALevelTransitionManager;
@@ -181,6 +182,7 @@ public:
     AGridActor* GetGridActor() { return GridActor; }
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
     AParticleEventManager* GetParticleEventManager() { return ParticleEventManager; }
+    FParticleTickManager* GetParticleTickManager() { return ParticleTickManager.get(); }
     UCollisionManager* GetCollisionManager() { return CollisionManager.get(); }
     FPhysScene* GetPhysicsScene() { return PhysScene.get(); }
 
@@ -219,6 +221,9 @@ private:
     /** === 라이트 매니저 ===*/
     std::unique_ptr<FLightManager> LightManager;
 
+    /** === 파티클 틱 단계 (이미터 병렬 시뮬레이션) ===*/
+    std::unique_ptr<FParticleTickManager> ParticleTickManager;
+
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
     
@@ -119,6 +119,9 @@ void UWorldPartitionManager::MarkDirty(UPrimitiveComponent* Smc)
 {
 	if (!Smc) return;
 
+	// BVH에 캐시된 바운드가 더 이상 현재 상태가 아니므로 갱신될 때까지 컬링 대상에서 제외
+	Smc->SetPartitionBoundsEpoch(0);
+
 	AActor* Owner = Smc->GetOwner();
 	if (!Owner) return;
 
@@ -186,12 +189,25 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
 	}
 }
 
-void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
+void UWorldPartitionManager::RayQueryClosestBatch(const TArray<FRay>& InRays, float MaxDistance, OUT TArray<AActor*>& OutActors, OUT TArray<float>& OutHitT)
+{
+	if (BVH)
+	{
+		BVH->QueryRaysClosest(InRays, MaxDistance, OutActors, OutHitT);
+		return;
+	}
+	OutActors.assign(InRays.Num(), nullptr);
+	OutHitT.assign(InRays.Num(), MaxDistance);
+}
+
+bool UWorldPartitionManager::FrustumQuery(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const
 {
 	if (BVH)
 	{
-		BVH->QueryFrustum(InFrustum);
+		return BVH->QueryFrustum(InFrustum, OutComponents);
 	}
+	OutComponents.clear();
+	return false;
 }
 
 void UWorldPartitionManager::ClearSceneOctree()
@@ -48,6 +48,20 @@ public:
 		// 파생 클래스에서 오버라이드
 	}
 
+	// SoA 레이아웃 업데이트 지원 여부
+	// 이미터의 모든 업데이트 모듈이 true여야 SoA 경로가 사용됨
+	virtual bool SupportsSoAUpdate() const
+	{
+		return false;
+	}
+
+	// SoA 레이아웃에서 매 프레임 호출 (Update 대신)
+	// 기본 속성은 Context.SoAData 스트림에 기록해야 함 (AoS 반영은 이미터가 처리)
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context)
+	{
+		// 파생 클래스에서 오버라이드
+	}
+
 	// 언리얼 엔진 호환: 페이로드 시스템
 	// 이 모듈이 파티클별로 필요로 하는 추가 데이터 크기를 반환
 	virtual uint32 RequiredBytes(FParticleEmitterInstance* Owner = nullptr)
@@ -71,4 +85,8 @@ public:
 	// LOD 스케일링: 하위 LOD 생성 시 값들을 Multiplier로 스케일
 	// 파생 클래스에서 오버라이드하여 SpawnRate, BurstCount 등을 조정
 	virtual void ScaleForLOD(float Multiplier) {}
+
+	// 월드 파티클 틱 단계에서 다른 이미터와 동시에 Tick해도 되는지
+	// 다른 이미터 인스턴스를 읽거나 모듈 자체 상태(템플릿 공유)를 갱신하면 false
+	virtual bool CanTickInParallel() const { return true; }
 };
@@ -27,57 +27,120 @@ void UParticleModuleAcceleration::Spawn(FParticleEmitterInstance* Owner, int32 O
 	Payload.GravityZ = bApplyGravity ? (-9.8f * GravityScale) : 0.0f;
 }
 
-void UParticleModuleAcceleration::Update(FModuleUpdateContext& Context)
+FVector UParticleModuleAcceleration::EvalAcceleration(float RelativeTime, const FParticleAccelerationPayload& Payload) const
 {
-	// Distribution 타입 확인
-	const EDistributionType DistType = AccelerationOverLife.Type;
+	FVector CurrentAcceleration;
 
-	// 언리얼 엔진 방식: 모든 파티클 업데이트 (Context 사용)
-	BEGIN_UPDATE_LOOP;
-		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
-		PARTICLE_ELEMENT(FParticleAccelerationPayload, Payload);
+	switch (AccelerationOverLife.Type)
+	{
+	case EDistributionType::ConstantCurve:
+		CurrentAcceleration = AccelerationOverLife.ConstantCurve.Eval(RelativeTime);
+		break;
 
-		FVector CurrentAcceleration;
+	case EDistributionType::UniformCurve:
+		{
+			FVector MinAtTime = AccelerationOverLife.MinCurve.Eval(RelativeTime);
+			FVector MaxAtTime = AccelerationOverLife.MaxCurve.Eval(RelativeTime);
+			CurrentAcceleration.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, Payload.RandomFactor.X);
+			CurrentAcceleration.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, Payload.RandomFactor.Y);
+			CurrentAcceleration.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, Payload.RandomFactor.Z);
+		}
+		break;
 
-		switch (DistType)
+	case EDistributionType::Uniform:
 		{
-		case EDistributionType::ConstantCurve:
-			CurrentAcceleration = AccelerationOverLife.ConstantCurve.Eval(Particle.RelativeTime);
-			break;
-
-		case EDistributionType::UniformCurve:
-			{
-				FVector MinAtTime = AccelerationOverLife.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxAtTime = AccelerationOverLife.MaxCurve.Eval(Particle.RelativeTime);
-				CurrentAcceleration.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, Payload.RandomFactor.X);
-				CurrentAcceleration.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, Payload.RandomFactor.Y);
-				CurrentAcceleration.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, Payload.RandomFactor.Z);
-			}
-			break;
-
-		case EDistributionType::Uniform:
-			{
-				// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
-				CurrentAcceleration.X = FMath::Lerp(AccelerationOverLife.MinValue.X, AccelerationOverLife.MaxValue.X, Payload.RandomFactor.X);
-				CurrentAcceleration.Y = FMath::Lerp(AccelerationOverLife.MinValue.Y, AccelerationOverLife.MaxValue.Y, Payload.RandomFactor.Y);
-				CurrentAcceleration.Z = FMath::Lerp(AccelerationOverLife.MinValue.Z, AccelerationOverLife.MaxValue.Z, Payload.RandomFactor.Z);
-			}
-			break;
-
-		default:
-			// Constant: 고정값 사용
-			CurrentAcceleration = AccelerationOverLife.ConstantValue;
-			break;
+			// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
+			CurrentAcceleration.X = FMath::Lerp(AccelerationOverLife.MinValue.X, AccelerationOverLife.MaxValue.X, Payload.RandomFactor.X);
+			CurrentAcceleration.Y = FMath::Lerp(AccelerationOverLife.MinValue.Y, AccelerationOverLife.MaxValue.Y, Payload.RandomFactor.Y);
+			CurrentAcceleration.Z = FMath::Lerp(AccelerationOverLife.MinValue.Z, AccelerationOverLife.MaxValue.Z, Payload.RandomFactor.Z);
 		}
+		break;
 
-		// 중력 추가
-		CurrentAcceleration.Z += Payload.GravityZ;
+	default:
+		// Constant: 고정값 사용
+		CurrentAcceleration = AccelerationOverLife.ConstantValue;
+		break;
+	}
+
+	// 중력 추가
+	CurrentAcceleration.Z += Payload.GravityZ;
+	return CurrentAcceleration;
+}
+
+void UParticleModuleAcceleration::Update(FModuleUpdateContext& Context)
+{
+	// 언리얼 엔진 방식: 모든 파티클 업데이트 (Context 사용)
+	BEGIN_UPDATE_LOOP;
+		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
+		PARTICLE_ELEMENT(FParticleAccelerationPayload, Payload);
 
 		// 속도에 가속도 적용
-		Particle.Velocity += CurrentAcceleration * DeltaTime;
+		Particle.Velocity += EvalAcceleration(Particle.RelativeTime, Payload) * DeltaTime;
 	END_UPDATE_LOOP;
 }
 
+void UParticleModuleAcceleration::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	float* VelocityX = Context.SoAData.Get(EParticleStream::VelocityX);
+	float* VelocityY = Context.SoAData.Get(EParticleStream::VelocityY);
+	float* VelocityZ = Context.SoAData.Get(EParticleStream::VelocityZ);
+
+	// 커브/랜덤 분포는 파티클마다 평가가 필요하므로 스칼라 루프
+	if (AccelerationOverLife.Type != EDistributionType::Constant)
+	{
+		BEGIN_SOA_UPDATE_LOOP;
+			PARTICLE_ELEMENT(FParticleAccelerationPayload, Payload);
+
+			const FVector DeltaVelocity = EvalAcceleration(Context.SoAData.Get(EParticleStream::RelativeTime)[i], Payload) * DeltaTime;
+			VelocityX[i] += DeltaVelocity.X;
+			VelocityY[i] += DeltaVelocity.Y;
+			VelocityZ[i] += DeltaVelocity.Z;
+		END_SOA_UPDATE_LOOP;
+		return;
+	}
+
+	// Constant: 4개씩 Velocity += (Acc + GravityZ) * DeltaTime (GravityZ만 페이로드에서 모음)
+	const int32 NumParticles = Context.Owner.ActiveParticles;
+	const int32* Flags = Context.SoAData.Flags.data();
+	const uint8* ParticleData = Context.Owner.ParticleData;
+	const uint16* ParticleIndices = Context.Owner.ParticleIndices;
+	const uint32 ParticleStride = Context.Owner.ParticleStride;
+	const uint32 GravityOffset = Context.Offset + offsetof(FParticleAccelerationPayload, GravityZ);
+
+	auto GravityAt = [&](int32 Index)
+	{
+		return *reinterpret_cast<const float*>(ParticleData + ParticleIndices[Index] * ParticleStride + GravityOffset);
+	};
+
+	const FVector& Acceleration = AccelerationOverLife.ConstantValue;
+	const __m128 DT = _mm_set1_ps(Context.DeltaTime);
+	const __m128 DeltaX = _mm_set1_ps(Acceleration.X * Context.DeltaTime);
+	const __m128 DeltaY = _mm_set1_ps(Acceleration.Y * Context.DeltaTime);
+	const __m128 AccZ = _mm_set1_ps(Acceleration.Z);
+
+	int32 i = 0;
+	for (; i + 4 <= NumParticles; i += 4)
+	{
+		const __m128 Active = FParticleSoAData::LoadActiveMask(Flags + i);
+		const __m128 Gravity = _mm_setr_ps(GravityAt(i), GravityAt(i + 1), GravityAt(i + 2), GravityAt(i + 3));
+		const __m128 DeltaZ = _mm_mul_ps(_mm_add_ps(AccZ, Gravity), DT);
+
+		_mm_storeu_ps(VelocityX + i, _mm_add_ps(_mm_loadu_ps(VelocityX + i), _mm_and_ps(Active, DeltaX)));
+		_mm_storeu_ps(VelocityY + i, _mm_add_ps(_mm_loadu_ps(VelocityY + i), _mm_and_ps(Active, DeltaY)));
+		_mm_storeu_ps(VelocityZ + i, _mm_add_ps(_mm_loadu_ps(VelocityZ + i), _mm_and_ps(Active, DeltaZ)));
+	}
+
+	for (; i < NumParticles; ++i)
+	{
+		if ((Flags[i] & STATE_Particle_Freeze) == 0)
+		{
+			VelocityX[i] += Acceleration.X * Context.DeltaTime;
+			VelocityY[i] += Acceleration.Y * Context.DeltaTime;
+			VelocityZ[i] += (Acceleration.Z + GravityAt(i)) * Context.DeltaTime;
+		}
+	}
+}
+
 void UParticleModuleAcceleration::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
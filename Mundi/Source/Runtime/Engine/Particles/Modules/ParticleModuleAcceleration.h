@@ -47,5 +47,11 @@ public:
 
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FModuleUpdateContext& Context) override;
+	virtual bool SupportsSoAUpdate() const override { return true; }
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context) override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+private:
+	// 파티클 하나의 현재 가속도 (중력 포함)
+	FVector EvalAcceleration(float RelativeTime, const FParticleAccelerationPayload& Payload) const;
 };
@@ -36,89 +36,147 @@ void UParticleModuleColor::Spawn(FParticleEmitterInstance* Owner, int32 Offset,
 }
 
 // 언리얼 엔진 호환: Context를 사용한 업데이트 (페이로드 시스템)
-void UParticleModuleColor::Update(FModuleUpdateContext& Context)
+FLinearColor UParticleModuleColor::EvalColor(float RelativeTime, const FParticleColorPayload& ColorPayload) const
 {
-	// Distribution 타입 확인 (RGB와 Alpha 각각)
-	const EDistributionType RGBDistType = ColorOverLife.RGB.Type;
-	const EDistributionType AlphaDistType = ColorOverLife.Alpha.Type;
-
-	BEGIN_UPDATE_LOOP
-		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
-		PARTICLE_ELEMENT(FParticleColorPayload, ColorPayload);
+	FLinearColor CurrentColor;
 
-		FLinearColor CurrentColor;
+	// RGB 처리
+	switch (ColorOverLife.RGB.Type)
+	{
+	case EDistributionType::ConstantCurve:
+		{
+			FVector RGB = ColorOverLife.RGB.ConstantCurve.Eval(RelativeTime);
+			CurrentColor.R = RGB.X;
+			CurrentColor.G = RGB.Y;
+			CurrentColor.B = RGB.Z;
+		}
+		break;
 
-		// RGB 처리
-		switch (RGBDistType)
+	case EDistributionType::UniformCurve:
 		{
-		case EDistributionType::ConstantCurve:
-			{
-				FVector RGB = ColorOverLife.RGB.ConstantCurve.Eval(Particle.RelativeTime);
-				CurrentColor.R = RGB.X;
-				CurrentColor.G = RGB.Y;
-				CurrentColor.B = RGB.Z;
-			}
-			break;
-
-		case EDistributionType::UniformCurve:
-			{
-				FVector MinRGB = ColorOverLife.RGB.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxRGB = ColorOverLife.RGB.MaxCurve.Eval(Particle.RelativeTime);
-				CurrentColor.R = FMath::Lerp(MinRGB.X, MaxRGB.X, ColorPayload.RGBRandomFactor.X);
-				CurrentColor.G = FMath::Lerp(MinRGB.Y, MaxRGB.Y, ColorPayload.RGBRandomFactor.Y);
-				CurrentColor.B = FMath::Lerp(MinRGB.Z, MaxRGB.Z, ColorPayload.RGBRandomFactor.Z);
-			}
-			break;
-
-		case EDistributionType::Uniform:
-			{
-				// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
-				CurrentColor.R = FMath::Lerp(ColorOverLife.RGB.MinValue.X, ColorOverLife.RGB.MaxValue.X, ColorPayload.RGBRandomFactor.X);
-				CurrentColor.G = FMath::Lerp(ColorOverLife.RGB.MinValue.Y, ColorOverLife.RGB.MaxValue.Y, ColorPayload.RGBRandomFactor.Y);
-				CurrentColor.B = FMath::Lerp(ColorOverLife.RGB.MinValue.Z, ColorOverLife.RGB.MaxValue.Z, ColorPayload.RGBRandomFactor.Z);
-			}
-			break;
-
-		default:
-			// Constant 타입: 고정값 사용
-			{
-				CurrentColor.R = ColorOverLife.RGB.ConstantValue.X;
-				CurrentColor.G = ColorOverLife.RGB.ConstantValue.Y;
-				CurrentColor.B = ColorOverLife.RGB.ConstantValue.Z;
-			}
-			break;
+			FVector MinRGB = ColorOverLife.RGB.MinCurve.Eval(RelativeTime);
+			FVector MaxRGB = ColorOverLife.RGB.MaxCurve.Eval(RelativeTime);
+			CurrentColor.R = FMath::Lerp(MinRGB.X, MaxRGB.X, ColorPayload.RGBRandomFactor.X);
+			CurrentColor.G = FMath::Lerp(MinRGB.Y, MaxRGB.Y, ColorPayload.RGBRandomFactor.Y);
+			CurrentColor.B = FMath::Lerp(MinRGB.Z, MaxRGB.Z, ColorPayload.RGBRandomFactor.Z);
 		}
+		break;
 
-		// Alpha 처리
-		switch (AlphaDistType)
+	case EDistributionType::Uniform:
 		{
-		case EDistributionType::ConstantCurve:
-			CurrentColor.A = ColorOverLife.Alpha.ConstantCurve.Eval(Particle.RelativeTime);
-			break;
-
-		case EDistributionType::UniformCurve:
-			{
-				float MinA = ColorOverLife.Alpha.MinCurve.Eval(Particle.RelativeTime);
-				float MaxA = ColorOverLife.Alpha.MaxCurve.Eval(Particle.RelativeTime);
-				CurrentColor.A = FMath::Lerp(MinA, MaxA, ColorPayload.AlphaRandomFactor);
-			}
-			break;
-
-		case EDistributionType::Uniform:
 			// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
-			CurrentColor.A = FMath::Lerp(ColorOverLife.Alpha.MinValue, ColorOverLife.Alpha.MaxValue, ColorPayload.AlphaRandomFactor);
-			break;
+			CurrentColor.R = FMath::Lerp(ColorOverLife.RGB.MinValue.X, ColorOverLife.RGB.MaxValue.X, ColorPayload.RGBRandomFactor.X);
+			CurrentColor.G = FMath::Lerp(ColorOverLife.RGB.MinValue.Y, ColorOverLife.RGB.MaxValue.Y, ColorPayload.RGBRandomFactor.Y);
+			CurrentColor.B = FMath::Lerp(ColorOverLife.RGB.MinValue.Z, ColorOverLife.RGB.MaxValue.Z, ColorPayload.RGBRandomFactor.Z);
+		}
+		break;
 
-		default:
-			// Constant 타입: 고정값 사용
-			CurrentColor.A = ColorOverLife.Alpha.ConstantValue;
-			break;
+	default:
+		// Constant 타입: 고정값 사용
+		{
+			CurrentColor.R = ColorOverLife.RGB.ConstantValue.X;
+			CurrentColor.G = ColorOverLife.RGB.ConstantValue.Y;
+			CurrentColor.B = ColorOverLife.RGB.ConstantValue.Z;
 		}
+		break;
+	}
+
+	// Alpha 처리
+	switch (ColorOverLife.Alpha.Type)
+	{
+	case EDistributionType::ConstantCurve:
+		CurrentColor.A = ColorOverLife.Alpha.ConstantCurve.Eval(RelativeTime);
+		break;
+
+	case EDistributionType::UniformCurve:
+		{
+			float MinA = ColorOverLife.Alpha.MinCurve.Eval(RelativeTime);
+			float MaxA = ColorOverLife.Alpha.MaxCurve.Eval(RelativeTime);
+			CurrentColor.A = FMath::Lerp(MinA, MaxA, ColorPayload.AlphaRandomFactor);
+		}
+		break;
+
+	case EDistributionType::Uniform:
+		// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
+		CurrentColor.A = FMath::Lerp(ColorOverLife.Alpha.MinValue, ColorOverLife.Alpha.MaxValue, ColorPayload.AlphaRandomFactor);
+		break;
+
+	default:
+		// Constant 타입: 고정값 사용
+		CurrentColor.A = ColorOverLife.Alpha.ConstantValue;
+		break;
+	}
+
+	return CurrentColor;
+}
+
+void UParticleModuleColor::Update(FModuleUpdateContext& Context)
+{
+	BEGIN_UPDATE_LOOP
+		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
+		PARTICLE_ELEMENT(FParticleColorPayload, ColorPayload);
 
-		Particle.Color = CurrentColor;
+		Particle.Color = EvalColor(Particle.RelativeTime, ColorPayload);
 	END_UPDATE_LOOP
 }
 
+void UParticleModuleColor::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	float* ColorR = Context.SoAData.Get(EParticleStream::ColorR);
+	float* ColorG = Context.SoAData.Get(EParticleStream::ColorG);
+	float* ColorB = Context.SoAData.Get(EParticleStream::ColorB);
+	float* ColorA = Context.SoAData.Get(EParticleStream::ColorA);
+
+	// 커브/랜덤 분포는 파티클마다 평가가 필요하므로 스칼라 루프
+	if (ColorOverLife.RGB.Type != EDistributionType::Constant || ColorOverLife.Alpha.Type != EDistributionType::Constant)
+	{
+		const float* RelativeTime = Context.SoAData.Get(EParticleStream::RelativeTime);
+
+		BEGIN_SOA_UPDATE_LOOP
+			PARTICLE_ELEMENT(FParticleColorPayload, ColorPayload);
+
+			const FLinearColor CurrentColor = EvalColor(RelativeTime[i], ColorPayload);
+			ColorR[i] = CurrentColor.R;
+			ColorG[i] = CurrentColor.G;
+			ColorB[i] = CurrentColor.B;
+			ColorA[i] = CurrentColor.A;
+		END_SOA_UPDATE_LOOP
+		return;
+	}
+
+	// Constant: Freeze가 아닌 파티클에 4개씩 같은 색상 기록
+	const int32 NumParticles = Context.Owner.ActiveParticles;
+	const int32* Flags = Context.SoAData.Flags.data();
+	const FVector& RGB = ColorOverLife.RGB.ConstantValue;
+	const float Alpha = ColorOverLife.Alpha.ConstantValue;
+
+	const __m128 R = _mm_set1_ps(RGB.X);
+	const __m128 G = _mm_set1_ps(RGB.Y);
+	const __m128 B = _mm_set1_ps(RGB.Z);
+	const __m128 A = _mm_set1_ps(Alpha);
+
+	int32 i = 0;
+	for (; i + 4 <= NumParticles; i += 4)
+	{
+		const __m128 Active = FParticleSoAData::LoadActiveMask(Flags + i);
+		FParticleSoAData::StoreMasked(ColorR + i, R, Active);
+		FParticleSoAData::StoreMasked(ColorG + i, G, Active);
+		FParticleSoAData::StoreMasked(ColorB + i, B, Active);
+		FParticleSoAData::StoreMasked(ColorA + i, A, Active);
+	}
+
+	for (; i < NumParticles; ++i)
+	{
+		if ((Flags[i] & STATE_Particle_Freeze) == 0)
+		{
+			ColorR[i] = RGB.X;
+			ColorG[i] = RGB.Y;
+			ColorB[i] = RGB.Z;
+			ColorA[i] = Alpha;
+		}
+	}
+}
+
 void UParticleModuleColor::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
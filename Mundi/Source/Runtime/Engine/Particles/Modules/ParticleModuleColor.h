@@ -39,5 +39,11 @@ public:
 
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FModuleUpdateContext& Context) override;
+	virtual bool SupportsSoAUpdate() const override { return true; }
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context) override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+private:
+	// 파티클 하나의 현재 색상
+	FLinearColor EvalColor(float RelativeTime, const FParticleColorPayload& ColorPayload) const;
 };
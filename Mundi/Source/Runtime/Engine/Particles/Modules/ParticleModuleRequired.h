@@ -66,6 +66,11 @@ public:
 	UPROPERTY(EditAnywhere, Category="Delay")
 	bool bDelayFirstLoopOnly = false;
 
+	// 파티클 기본 속성을 SoA 스트림으로 유지하고 SIMD로 업데이트
+	// 모든 업데이트 모듈이 UpdateSoA를 지원할 때만 실제로 적용됨 (아니면 AoS 경로)
+	UPROPERTY(EditAnywhere, Category="Emitter")
+	bool bUseSoALayout = false;
+
 	// ────────────────────────────────────────────
 	// Sub-UV (스프라이트 시트 애니메이션)
 	// ────────────────────────────────────────────
@@ -25,46 +25,86 @@ void UParticleModuleRotationRate::Spawn(FParticleEmitterInstance* Owner, int32 O
 	ParticleBase->BaseRotationRate = InitialRate;
 }
 
-void UParticleModuleRotationRate::Update(FModuleUpdateContext& Context)
+float UParticleModuleRotationRate::EvalRotationRate(float RelativeTime, const FParticleRotationRatePayload& Payload) const
 {
-	// Distribution 타입 확인
-	const EDistributionType DistType = RotationRateOverLife.Type;
+	float CurrentRotationRate;
+
+	switch (RotationRateOverLife.Type)
+	{
+	case EDistributionType::ConstantCurve:
+		CurrentRotationRate = RotationRateOverLife.ConstantCurve.Eval(RelativeTime);
+		break;
+
+	case EDistributionType::UniformCurve:
+		{
+			float MinAtTime = RotationRateOverLife.MinCurve.Eval(RelativeTime);
+			float MaxAtTime = RotationRateOverLife.MaxCurve.Eval(RelativeTime);
+			CurrentRotationRate = FMath::Lerp(MinAtTime, MaxAtTime, Payload.RandomFactor);
+		}
+		break;
+
+	case EDistributionType::Uniform:
+		// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
+		CurrentRotationRate = FMath::Lerp(RotationRateOverLife.MinValue, RotationRateOverLife.MaxValue, Payload.RandomFactor);
+		break;
+
+	default:
+		// Constant: 고정값 사용
+		CurrentRotationRate = RotationRateOverLife.ConstantValue;
+		break;
+	}
 
+	return CurrentRotationRate;
+}
+
+void UParticleModuleRotationRate::Update(FModuleUpdateContext& Context)
+{
 	// 언리얼 엔진 방식: 모든 파티클 업데이트
 	BEGIN_UPDATE_LOOP;
 		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
 		PARTICLE_ELEMENT(FParticleRotationRatePayload, Payload);
 
-		float CurrentRotationRate;
+		// 회전 속도 업데이트
+		Particle.RotationRate = EvalRotationRate(Particle.RelativeTime, Payload);
+	END_UPDATE_LOOP;
+}
 
-		switch (DistType)
+void UParticleModuleRotationRate::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	float* RotationRate = Context.SoAData.Get(EParticleStream::RotationRate);
+
+	// 커브/랜덤 분포는 파티클마다 평가가 필요하므로 스칼라 루프
+	if (RotationRateOverLife.Type != EDistributionType::Constant)
+	{
+		const float* RelativeTime = Context.SoAData.Get(EParticleStream::RelativeTime);
+
+		BEGIN_SOA_UPDATE_LOOP;
+			PARTICLE_ELEMENT(FParticleRotationRatePayload, Payload);
+
+			RotationRate[i] = EvalRotationRate(RelativeTime[i], Payload);
+		END_SOA_UPDATE_LOOP;
+		return;
+	}
+
+	// Constant: Freeze가 아닌 파티클에 4개씩 같은 값 기록
+	const int32 NumParticles = Context.Owner.ActiveParticles;
+	const int32* Flags = Context.SoAData.Flags.data();
+	const float ConstantRate = RotationRateOverLife.ConstantValue;
+	const __m128 Rate = _mm_set1_ps(ConstantRate);
+
+	int32 i = 0;
+	for (; i + 4 <= NumParticles; i += 4)
+	{
+		FParticleSoAData::StoreMasked(RotationRate + i, Rate, FParticleSoAData::LoadActiveMask(Flags + i));
+	}
+
+	for (; i < NumParticles; ++i)
+	{
+		if ((Flags[i] & STATE_Particle_Freeze) == 0)
 		{
-		case EDistributionType::ConstantCurve:
-			CurrentRotationRate = RotationRateOverLife.ConstantCurve.Eval(Particle.RelativeTime);
-			break;
-
-		case EDistributionType::UniformCurve:
-			{
-				float MinAtTime = RotationRateOverLife.MinCurve.Eval(Particle.RelativeTime);
-				float MaxAtTime = RotationRateOverLife.MaxCurve.Eval(Particle.RelativeTime);
-				CurrentRotationRate = FMath::Lerp(MinAtTime, MaxAtTime, Payload.RandomFactor);
-			}
-			break;
-
-		case EDistributionType::Uniform:
-			// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관)
-			CurrentRotationRate = FMath::Lerp(RotationRateOverLife.MinValue, RotationRateOverLife.MaxValue, Payload.RandomFactor);
-			break;
-
-		default:
-			// Constant: 고정값 사용
-			CurrentRotationRate = RotationRateOverLife.ConstantValue;
-			break;
+			RotationRate[i] = ConstantRate;
 		}
-
-		// 회전 속도 업데이트
-		Particle.RotationRate = CurrentRotationRate;
-	END_UPDATE_LOOP;
+	}
 }
 
 void UParticleModuleRotationRate::Serialize(const bool bInIsLoading, JSON& InOutHandle)
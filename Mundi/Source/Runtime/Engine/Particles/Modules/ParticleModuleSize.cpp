@@ -45,53 +45,63 @@ void UParticleModuleSize::Spawn(FParticleEmitterInstance* Owner, int32 Offset, f
 }
 
 // 언리얼 엔진 호환: Context를 사용한 업데이트 (페이로드 시스템)
-void UParticleModuleSize::Update(FModuleUpdateContext& Context)
+float UParticleModuleSize::GetComponentScaleX(const FParticleEmitterInstance& Owner)
 {
-	// Distribution 타입 확인
-	const EDistributionType DistType = SizeOverLife.Type;
-	const float ComponentScaleX = Context.Owner.Component->GetWorldScale().X;
+	return Owner.Component ? Owner.Component->GetWorldScale().X : 1.0f;
+}
 
-	BEGIN_UPDATE_LOOP
-		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
-		PARTICLE_ELEMENT(FParticleSizePayload, SizePayload);
+FVector UParticleModuleSize::EvalSize(float RelativeTime, const FParticleSizePayload& SizePayload, float ComponentScaleX) const
+{
+	FVector CurrentSizeVec;
 
-		FVector CurrentSizeVec;
+	switch (SizeOverLife.Type)
+	{
+	case EDistributionType::ConstantCurve:
+		// ConstantCurve: RelativeTime에 따라 커브 평가
+		CurrentSizeVec = SizeOverLife.ConstantCurve.Eval(RelativeTime);
+		CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
+		break;
+
+	case EDistributionType::UniformCurve:
+		{
+			// UniformCurve: Min/Max 커브 평가 후 저장된 랜덤 비율로 보간
+			FVector MinAtTime = SizeOverLife.MinCurve.Eval(RelativeTime);
+			FVector MaxAtTime = SizeOverLife.MaxCurve.Eval(RelativeTime);
+			CurrentSizeVec.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, SizePayload.RandomFactor.X);
+			CurrentSizeVec.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, SizePayload.RandomFactor.Y);
+			CurrentSizeVec.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, SizePayload.RandomFactor.Z);
+			CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
+		}
+		break;
 
-		switch (DistType)
+	case EDistributionType::Uniform:
 		{
-		case EDistributionType::ConstantCurve:
-			// ConstantCurve: RelativeTime에 따라 커브 평가
-			CurrentSizeVec = SizeOverLife.ConstantCurve.Eval(Particle.RelativeTime);
+			// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관, 고정값)
+			CurrentSizeVec.X = FMath::Lerp(SizeOverLife.MinValue.X, SizeOverLife.MaxValue.X, SizePayload.RandomFactor.X);
+			CurrentSizeVec.Y = FMath::Lerp(SizeOverLife.MinValue.Y, SizeOverLife.MaxValue.Y, SizePayload.RandomFactor.Y);
+			CurrentSizeVec.Z = FMath::Lerp(SizeOverLife.MinValue.Z, SizeOverLife.MaxValue.Z, SizePayload.RandomFactor.Z);
 			CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
-			break;
-
-		case EDistributionType::UniformCurve:
-			{
-				// UniformCurve: Min/Max 커브 평가 후 저장된 랜덤 비율로 보간
-				FVector MinAtTime = SizeOverLife.MinCurve.Eval(Particle.RelativeTime);
-				FVector MaxAtTime = SizeOverLife.MaxCurve.Eval(Particle.RelativeTime);
-				CurrentSizeVec.X = FMath::Lerp(MinAtTime.X, MaxAtTime.X, SizePayload.RandomFactor.X);
-				CurrentSizeVec.Y = FMath::Lerp(MinAtTime.Y, MaxAtTime.Y, SizePayload.RandomFactor.Y);
-				CurrentSizeVec.Z = FMath::Lerp(MinAtTime.Z, MaxAtTime.Z, SizePayload.RandomFactor.Z);
-				CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
-			}
-			break;
-
-		case EDistributionType::Uniform:
-			{
-				// Uniform: Spawn 시 결정된 랜덤 비율로 Min/Max 보간 (시간 무관, 고정값)
-				CurrentSizeVec.X = FMath::Lerp(SizeOverLife.MinValue.X, SizeOverLife.MaxValue.X, SizePayload.RandomFactor.X);
-				CurrentSizeVec.Y = FMath::Lerp(SizeOverLife.MinValue.Y, SizeOverLife.MaxValue.Y, SizePayload.RandomFactor.Y);
-				CurrentSizeVec.Z = FMath::Lerp(SizeOverLife.MinValue.Z, SizeOverLife.MaxValue.Z, SizePayload.RandomFactor.Z);
-				CurrentSizeVec = CurrentSizeVec * ComponentScaleX;
-			}
-			break;
-
-		default:
-			// Constant: 고정값 사용
-			CurrentSizeVec = SizeOverLife.ConstantValue * ComponentScaleX;
-			break;
 		}
+		break;
+
+	default:
+		// Constant: 고정값 사용
+		CurrentSizeVec = SizeOverLife.ConstantValue * ComponentScaleX;
+		break;
+	}
+
+	return CurrentSizeVec;
+}
+
+void UParticleModuleSize::Update(FModuleUpdateContext& Context)
+{
+	const float ComponentScaleX = GetComponentScaleX(Context.Owner);
+
+	BEGIN_UPDATE_LOOP
+		// 언리얼 엔진 호환: PARTICLE_ELEMENT 매크로 (CurrentOffset 자동 증가)
+		PARTICLE_ELEMENT(FParticleSizePayload, SizePayload);
+
+		const FVector CurrentSizeVec = EvalSize(Particle.RelativeTime, SizePayload, ComponentScaleX);
 
 		// 음수 크기 방지
 		Particle.Size.X = FMath::Max(CurrentSizeVec.X, 0.01f);
@@ -100,6 +110,61 @@ void UParticleModuleSize::Update(FModuleUpdateContext& Context)
 	END_UPDATE_LOOP
 }
 
+void UParticleModuleSize::UpdateSoA(FModuleSoAUpdateContext& Context)
+{
+	const float ComponentScaleX = GetComponentScaleX(Context.Owner);
+	float* SizeX = Context.SoAData.Get(EParticleStream::SizeX);
+	float* SizeY = Context.SoAData.Get(EParticleStream::SizeY);
+	float* SizeZ = Context.SoAData.Get(EParticleStream::SizeZ);
+
+	// 커브/랜덤 분포는 파티클마다 평가가 필요하므로 스칼라 루프
+	if (SizeOverLife.Type != EDistributionType::Constant)
+	{
+		const float* RelativeTime = Context.SoAData.Get(EParticleStream::RelativeTime);
+
+		BEGIN_SOA_UPDATE_LOOP
+			PARTICLE_ELEMENT(FParticleSizePayload, SizePayload);
+
+			const FVector CurrentSizeVec = EvalSize(RelativeTime[i], SizePayload, ComponentScaleX);
+			SizeX[i] = FMath::Max(CurrentSizeVec.X, 0.01f);
+			SizeY[i] = FMath::Max(CurrentSizeVec.Y, 0.01f);
+			SizeZ[i] = FMath::Max(CurrentSizeVec.Z, 0.01f);
+		END_SOA_UPDATE_LOOP
+		return;
+	}
+
+	// Constant: 모든 파티클이 같은 크기이므로 한 번만 계산해 4개씩 기록
+	const FVector ConstantSize = SizeOverLife.ConstantValue * ComponentScaleX;
+	const float ClampedX = FMath::Max(ConstantSize.X, 0.01f);
+	const float ClampedY = FMath::Max(ConstantSize.Y, 0.01f);
+	const float ClampedZ = FMath::Max(ConstantSize.Z, 0.01f);
+
+	const int32 NumParticles = Context.Owner.ActiveParticles;
+	const int32* Flags = Context.SoAData.Flags.data();
+	const __m128 X = _mm_set1_ps(ClampedX);
+	const __m128 Y = _mm_set1_ps(ClampedY);
+	const __m128 Z = _mm_set1_ps(ClampedZ);
+
+	int32 i = 0;
+	for (; i + 4 <= NumParticles; i += 4)
+	{
+		const __m128 Active = FParticleSoAData::LoadActiveMask(Flags + i);
+		FParticleSoAData::StoreMasked(SizeX + i, X, Active);
+		FParticleSoAData::StoreMasked(SizeY + i, Y, Active);
+		FParticleSoAData::StoreMasked(SizeZ + i, Z, Active);
+	}
+
+	for (; i < NumParticles; ++i)
+	{
+		if ((Flags[i] & STATE_Particle_Freeze) == 0)
+		{
+			SizeX[i] = ClampedX;
+			SizeY[i] = ClampedY;
+			SizeZ[i] = ClampedZ;
+		}
+	}
+}
+
 void UParticleModuleSize::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	UParticleModule::Serialize(bInIsLoading, InOutHandle);
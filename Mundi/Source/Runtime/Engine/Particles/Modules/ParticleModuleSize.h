@@ -36,5 +36,14 @@ public:
 
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FModuleUpdateContext& Context) override;
+	virtual bool SupportsSoAUpdate() const override { return true; }
+	virtual void UpdateSoA(FModuleSoAUpdateContext& Context) override;
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
+
+private:
+	// 파티클 하나의 현재 크기 (컴포넌트 스케일 적용, 최소값 클램프 전)
+	FVector EvalSize(float RelativeTime, const FParticleSizePayload& SizePayload, float ComponentScaleX) const;
+
+	// 소유 컴포넌트의 X 스케일 (컴포넌트가 없으면 1)
+	static float GetComponentScaleX(const FParticleEmitterInstance& Owner);
 };
@@ -46,6 +46,9 @@ public:
 	// 매 프레임 호출: 소스 파티클 추적 및 Trail 파티클 생성
 	virtual void Update(FModuleUpdateContext& Context) override;
 
+	// 소스 이미터 파티클을 읽고 LastSpawnPositions를 갱신하므로 게임 스레드에서 순차 Tick
+	virtual bool CanTickInParallel() const override { return false; }
+
 	// 직렬화
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
@@ -77,3 +77,241 @@ void FParticleDataContainer::Free()
 	ParticleDataNumBytes = 0;
 	ParticleIndicesNumShorts = 0;
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// 스프라이트 파티클 정렬 (라딕스 + 시간 일관성 보정)
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	// float → 오름차순 비교 가능한 uint32 (음수는 전체 반전, 양수는 부호 비트만 세움)
+	inline uint32 FloatToSortKey(float Value)
+	{
+		uint32 Bits;
+		memcpy(&Bits, &Value, sizeof(Bits));
+		return (Bits & 0x80000000u) ? ~Bits : (Bits | 0x80000000u);
+	}
+
+	// 큰 값이 먼저 오도록 반전 (Age: 오래된 것부터, Depth: 먼 것부터)
+	inline uint32 MakeDescendingSortKey(float Value)
+	{
+		return ~FloatToSortKey(Value);
+	}
+
+	// LSD 라딕스 정렬 (8비트 × 4패스, 안정 정렬)
+	// 히스토그램은 한 번의 순회로 모두 만들고, 모든 키의 자릿값이 같은 패스는 건너뜀
+	void RadixSortKeyValue(uint32* Keys, uint16* Values, uint32* KeysTemp, uint16* ValuesTemp, int32 Num)
+	{
+		uint32 Histograms[4][256] = {};
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const uint32 Key = Keys[i];
+			++Histograms[0][Key & 0xFF];
+			++Histograms[1][(Key >> 8) & 0xFF];
+			++Histograms[2][(Key >> 16) & 0xFF];
+			++Histograms[3][Key >> 24];
+		}
+
+		uint32* SrcKeys = Keys;
+		uint16* SrcValues = Values;
+		uint32* DstKeys = KeysTemp;
+		uint16* DstValues = ValuesTemp;
+
+		for (int32 Pass = 0; Pass < 4; ++Pass)
+		{
+			uint32* Histogram = Histograms[Pass];
+			const uint32 Shift = Pass * 8;
+
+			if (Histogram[(SrcKeys[0] >> Shift) & 0xFF] == static_cast<uint32>(Num))
+			{
+				continue;
+			}
+
+			// 누적합 → 버킷 시작 위치
+			uint32 Offset = 0;
+			for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const uint32 Count = Histogram[Bucket];
+				Histogram[Bucket] = Offset;
+				Offset += Count;
+			}
+
+			for (int32 i = 0; i < Num; ++i)
+			{
+				const uint32 Dest = Histogram[(SrcKeys[i] >> Shift) & 0xFF]++;
+				DstKeys[Dest] = SrcKeys[i];
+				DstValues[Dest] = SrcValues[i];
+			}
+
+			std::swap(SrcKeys, DstKeys);
+			std::swap(SrcValues, DstValues);
+		}
+
+		if (SrcKeys != Keys)
+		{
+			memcpy(Keys, SrcKeys, Num * sizeof(uint32));
+			memcpy(Values, SrcValues, Num * sizeof(uint16));
+		}
+	}
+
+	// 거의 정렬된 배열의 삽입 정렬 보정
+	// 이동 횟수가 MaxShifts를 넘으면 중단하고 false (배열은 순열 상태 유지)
+	bool InsertionSortKeyValue(uint32* Keys, uint16* Values, int32 Num, int32 MaxShifts)
+	{
+		int32 NumShifts = 0;
+		for (int32 i = 1; i < Num; ++i)
+		{
+			const uint32 Key = Keys[i];
+			const uint16 Value = Values[i];
+
+			int32 j = i - 1;
+			while (j >= 0 && Keys[j] > Key)
+			{
+				Keys[j + 1] = Keys[j];
+				Values[j + 1] = Values[j];
+				--j;
+				++NumShifts;
+			}
+			Keys[j + 1] = Key;
+			Values[j + 1] = Value;
+
+			if (NumShifts > MaxShifts)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+void FDynamicSpriteEmitterDataBase::SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection, FParticleSortCache* SortCache)
+{
+	const FDynamicEmitterReplayDataBase& SourceData = GetSource();
+	const int32 Num = SourceData.ActiveParticleCount;
+
+	if ((SortMode != 1 && SortMode != 2) || Num <= 1)
+	{
+		if (SortCache)
+		{
+			SortCache->Invalidate();
+		}
+		return;  // 정렬 불필요
+	}
+
+	uint16* Indices = SourceData.DataContainer.ParticleIndices;
+	const uint8* ParticleData = SourceData.DataContainer.ParticleData;
+	const int32 ParticleStride = SourceData.ParticleStride;
+
+	if (!Indices || !ParticleData)
+	{
+		return;
+	}
+
+	// 캐시가 없으면 호출 스레드의 스크래치만 재사용 (시간 일관성 경로 없음)
+	thread_local FParticleSortCache LocalScratch;
+	FParticleSortCache& Cache = SortCache ? *SortCache : LocalScratch;
+
+	if (Cache.Keys.Num() < Num)
+	{
+		Cache.Keys.resize(Num);
+		Cache.KeysTemp.resize(Num);
+		Cache.Values.resize(Num);
+		Cache.ValuesTemp.resize(Num);
+	}
+	uint32* Keys = Cache.Keys.data();
+	uint16* Values = Cache.Values.data();
+
+	// 1. 시간 일관성 판정 (같은 정렬 모드, 깊이 정렬이면 카메라 변화가 작을 때만)
+	const uint16* Slots = SourceData.ParticleSlots.Num() == Num ? SourceData.ParticleSlots.data() : nullptr;
+	bool bCoherent = SortCache && Slots && Cache.bValid && Cache.LastSortMode == SortMode;
+	if (bCoherent && SortMode == 2)
+	{
+		bCoherent = (ViewOrigin - Cache.LastViewOrigin).SizeSquared() <= FParticleSortCache::MaxCoherentViewMoveSq
+			&& FVector::Dot(ViewDirection, Cache.LastViewDirection) >= FParticleSortCache::MinCoherentViewDot;
+	}
+
+	// 2. 초기 순서 구성
+	if (bCoherent)
+	{
+		// 지난 프레임 순서 중 살아남은 파티클 → 새 파티클 순으로 배치
+		TArray<int32>& SlotToCompact = Cache.SlotToCompact;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (Slots[i] >= SlotToCompact.Num())
+			{
+				SlotToCompact.resize(Slots[i] + 1, -1);
+			}
+			SlotToCompact[Slots[i]] = i;
+		}
+
+		int32 Count = 0;
+		for (uint16 Slot : Cache.SortedSlots)
+		{
+			if (Slot < SlotToCompact.Num() && SlotToCompact[Slot] >= 0)
+			{
+				Values[Count++] = static_cast<uint16>(SlotToCompact[Slot]);
+				SlotToCompact[Slot] = -1;
+			}
+		}
+		for (int32 i = 0; i < Num; ++i)
+		{
+			if (SlotToCompact[Slots[i]] >= 0)
+			{
+				Values[Count++] = static_cast<uint16>(i);
+				SlotToCompact[Slots[i]] = -1;
+			}
+		}
+	}
+	else
+	{
+		memcpy(Values, Indices, Num * sizeof(uint16));
+	}
+
+	// 3. 정렬 키 계산
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FBaseParticle* Particle = (const FBaseParticle*)(ParticleData + Values[i] * ParticleStride);
+		if (SortMode == 1)  // Age 정렬 (오래된 것부터)
+		{
+			Keys[i] = MakeDescendingSortKey(Particle->RelativeTime);
+		}
+		else  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
+		{
+			// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확)
+			Keys[i] = MakeDescendingSortKey(FVector::Dot(Particle->Location - ViewOrigin, ViewDirection));
+		}
+	}
+
+	// 4. 정렬 (보정 예산 초과 시 라딕스로 폴백)
+	const bool bFixedUp = bCoherent
+		&& InsertionSortKeyValue(Keys, Values, Num, Num * FParticleSortCache::MaxFixupShiftsPerParticle);
+	if (bFixedUp)
+	{
+		++Cache.NumCoherentSorts;
+	}
+	else
+	{
+		RadixSortKeyValue(Keys, Values, Cache.KeysTemp.data(), Cache.ValuesTemp.data(), Num);
+		++Cache.NumFullSorts;
+	}
+
+	memcpy(Indices, Values, Num * sizeof(uint16));
+
+	// 5. 다음 프레임용 순서 저장 (원본 슬롯 기준)
+	if (SortCache && Slots)
+	{
+		Cache.SortedSlots.resize(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Cache.SortedSlots[i] = Slots[Values[i]];
+		}
+		Cache.LastViewOrigin = ViewOrigin;
+		Cache.LastViewDirection = ViewDirection;
+		Cache.LastSortMode = SortMode;
+		Cache.bValid = true;
+	}
+	else if (SortCache)
+	{
+		SortCache->Invalidate();
+	}
+}
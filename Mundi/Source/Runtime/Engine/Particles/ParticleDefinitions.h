@@ -259,6 +259,10 @@ struct FDynamicEmitterReplayDataBase
 	FVector Scale;
 	int32 SortMode;
 
+	// 컴팩트 인덱스 → 원본 이미터 데이터 슬롯 (파티클 수명 동안 유지되는 ID)
+	// 정렬 캐시가 프레임 간 같은 파티클을 찾는 데 사용. 비어 있으면 시간 일관성 정렬 생략
+	TArray<uint16> ParticleSlots;
+
 	FDynamicEmitterReplayDataBase()
 		: eEmitterType(EDynamicEmitterType::Unknown)
 		, ActiveParticleCount(0)
@@ -350,6 +354,44 @@ struct FDynamicRibbonEmitterReplayDataBase : public FDynamicEmitterReplayDataBas
 	}
 };
 
+// 스프라이트 정렬 캐시 (컴포넌트가 이미터별로 소유, 프레임 간 유지)
+// 1. 키: 뷰 깊이 / Age를 부호 처리한 32비트 float 키로 변환해 라딕스 정렬 (4패스 × 8비트)
+// 2. 카메라가 거의 움직이지 않았으면 지난 프레임 순서에서 시작해 삽입 정렬로 보정
+//    (보정 이동 횟수가 예산을 넘으면 라딕스 정렬로 폴백)
+struct FParticleSortCache
+{
+	// 시간 일관성 경로를 허용하는 카메라 변화량
+	static constexpr float MaxCoherentViewMoveSq = 0.25f;
+	static constexpr float MinCoherentViewDot = 0.999f;
+
+	// 삽입 정렬 보정 예산 (파티클당 이동 횟수)
+	static constexpr int32 MaxFixupShiftsPerParticle = 4;
+
+	// 지난 프레임 정렬 결과 (원본 이미터 데이터 슬롯 순서)
+	TArray<uint16> SortedSlots;
+	FVector LastViewOrigin = FVector(0.0f, 0.0f, 0.0f);
+	FVector LastViewDirection = FVector(1.0f, 0.0f, 0.0f);
+	int32 LastSortMode = 0;
+	bool bValid = false;
+
+	// 재사용 스크래치 버퍼 (프레임마다 재할당하지 않음)
+	TArray<uint32> Keys;
+	TArray<uint32> KeysTemp;
+	TArray<uint16> Values;
+	TArray<uint16> ValuesTemp;
+	TArray<int32> SlotToCompact;  // 원본 슬롯 → 컴팩트 인덱스 (사용 후 항상 -1로 복구)
+
+	// 통계
+	int32 NumFullSorts = 0;
+	int32 NumCoherentSorts = 0;
+
+	void Invalidate()
+	{
+		SortedSlots.Empty();
+		bValid = false;
+	}
+};
+
 // 동적 이미터 데이터 베이스 (렌더링용)
 struct FDynamicEmitterDataBase
 {
@@ -373,46 +415,8 @@ struct FDynamicSpriteEmitterDataBase : public FDynamicEmitterDataBase
 	// 언리얼 엔진 호환: 파티클 정렬 (투명 렌더링을 위해 필수)
 	// SortMode: 0 = 정렬 없음, 1 = Age (오래된 것부터), 2 = Distance (먼 것부터)
 	// ViewDirection: 카메라가 바라보는 방향 (forward vector)
-	virtual void SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection)
-	{
-		const FDynamicEmitterReplayDataBase& SourceData = GetSource();
-
-		if (SortMode == 0 || SourceData.ActiveParticleCount <= 1)
-		{
-			return;  // 정렬 불필요
-		}
-
-		uint16* Indices = SourceData.DataContainer.ParticleIndices;
-		const uint8* ParticleData = SourceData.DataContainer.ParticleData;
-		const int32 ParticleStride = SourceData.ParticleStride;
-
-		if (!Indices || !ParticleData)
-		{
-			return;
-		}
-
-		// std::sort 사용 (O(N log N) - 버블 정렬보다 훨씬 빠름)
-		std::sort(Indices, Indices + SourceData.ActiveParticleCount,
-			[&](uint16 IndexA, uint16 IndexB) -> bool
-			{
-				const FBaseParticle* PA = (const FBaseParticle*)(ParticleData + IndexA * ParticleStride);
-				const FBaseParticle* PB = (const FBaseParticle*)(ParticleData + IndexB * ParticleStride);
-
-				if (SortMode == 1)  // Age 정렬 (오래된 것부터)
-				{
-					return PA->RelativeTime > PB->RelativeTime;
-				}
-				else if (SortMode == 2)  // Depth 정렬 (먼 것부터 - 투명도 렌더링)
-				{
-					// 뷰 방향에 대한 내적으로 깊이 계산 (유클리드 거리보다 정확)
-					float DepthA = FVector::Dot(PA->Location - ViewOrigin, ViewDirection);
-					float DepthB = FVector::Dot(PB->Location - ViewOrigin, ViewDirection);
-					return DepthA > DepthB;  // 먼 것(깊이가 큰 것)을 먼저 렌더링
-				}
-
-				return false;
-			});
-	}
+	// SortCache: 이미터별 프레임 간 캐시 (nullptr이면 매번 전체 라딕스 정렬)
+	virtual void SortSpriteParticles(int32 SortMode, const FVector& ViewOrigin, const FVector& ViewDirection, FParticleSortCache* SortCache = nullptr);
 
 	virtual int32 GetDynamicVertexStride() const = 0;
 };
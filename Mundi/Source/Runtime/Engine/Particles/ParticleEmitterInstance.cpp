@@ -27,6 +27,7 @@ FParticleEmitterInstance::FParticleEmitterInstance()
 	, FrameSpawnedCount(0)
 	, FrameKilledCount(0)
 	, MaxActiveParticles(0)
+	, bUseSoALayout(false)
 	, SpawnFraction(0.0f)
 	// BurstFired는 TArray이므로 기본 초기화됨
 	, EmitterTime(0.0f)
@@ -278,6 +279,55 @@ void FParticleEmitterInstance::SetupEmitter()
 			BurstFired[i] = false;
 		}
 	}
+
+	// SoA 레이아웃 결정 (LOD 전환으로 모듈 구성이 바뀔 수 있으므로 매번 다시 판단)
+	bUseSoALayout = CanUseSoALayout();
+	if (bUseSoALayout)
+	{
+		SoAData.Resize(MaxActiveParticles);
+		RebuildSoAData();
+	}
+	else
+	{
+		SoAData.Empty();
+	}
+}
+
+bool FParticleEmitterInstance::CanUseSoALayout() const
+{
+	if (!CurrentLODLevel || !CurrentLODLevel->RequiredModule || !CurrentLODLevel->RequiredModule->bUseSoALayout)
+	{
+		return false;
+	}
+
+	// 스프라이트 이외의 TypeData는 자체 업데이트 규칙이 있으므로 AoS 유지
+	UParticleModuleTypeDataBase* TypeData = CurrentLODLevel->TypeDataModule;
+	if (TypeData && TypeData->bEnabled && !Cast<UParticleModuleTypeDataSprite>(TypeData))
+	{
+		return false;
+	}
+
+	for (UParticleModule* Module : CurrentLODLevel->UpdateModules)
+	{
+		if (Module && Module->bEnabled && Module->bUpdateModule && !Module->SupportsSoAUpdate())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FParticleEmitterInstance::RebuildSoAData()
+{
+	if (!bUseSoALayout || !ParticleData || !ParticleIndices)
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		SoAData.LoadParticle(i, *GetParticleAtIndex(i));
+	}
 }
 
 void FParticleEmitterInstance::Resize(int32 NewMaxActiveParticles)
@@ -372,6 +422,12 @@ void FParticleEmitterInstance::Resize(int32 NewMaxActiveParticles)
 		ActiveParticles = 0;
 	}
 
+	// SoA 스트림도 같은 용량으로 (활성 인덱스 기준이므로 앞쪽 ActiveParticles개가 보존됨)
+	if (bUseSoALayout)
+	{
+		SoAData.Resize(MaxActiveParticles);
+	}
+
 	// OldContainer는 스코프 종료 시 자동 해제됨
 }
 
@@ -565,6 +621,12 @@ void FParticleEmitterInstance::SpawnParticles(int32 Count, float StartTime, floa
 		// 생성 후
 		PostSpawn(Particle, static_cast<float>(i) / Count, SpawnTime);
 
+		// 새 파티클은 항상 활성 인덱스의 마지막
+		if (bUseSoALayout)
+		{
+			SoAData.LoadParticle(ActiveParticles - 1, *Particle);
+		}
+
 		ParticleCounter++;
 		FrameSpawnedCount++;
 	}
@@ -627,6 +689,12 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 		return;
 	}
 
+	if (bUseSoALayout)
+	{
+		UpdateParticlesSoA(DeltaTime);
+		return;
+	}
+
 	// PHASE 1: 모든 파티클의 기본 속성 업데이트 (수명, 위치, 회전)
 	// 이 단계에서는 파티클을 죽이지 않음 - 모듈들이 먼저 처리할 수 있도록
 	for (int32 i = ActiveParticles - 1; i >= 0; i--)
@@ -697,6 +765,38 @@ void FParticleEmitterInstance::UpdateParticles(float DeltaTime)
 	}
 }
 
+void FParticleEmitterInstance::UpdateParticlesSoA(float DeltaTime)
+{
+	// PHASE 1: 수명/위치/회전 (4개씩 SSE)
+	SoAData.Integrate(ActiveParticles, DeltaTime);
+
+	// PHASE 2: 업데이트 모듈 (CanUseSoALayout에서 모두 UpdateSoA 지원이 보장됨)
+	for (UParticleModule* Module : CurrentLODLevel->UpdateModules)
+	{
+		if (Module && Module->bEnabled && Module->bUpdateModule)
+		{
+			FModuleSoAUpdateContext Context = { *this, SoAData, PayloadOffset + Module->ModuleOffsetInParticle, DeltaTime };
+			Module->UpdateSoA(Context);
+		}
+	}
+
+	// PHASE 3: 수명이 다한 파티클 제거 (역방향 순회, KillParticle이 스트림도 함께 swap)
+	const float* RelativeTime = SoAData.Get(EParticleStream::RelativeTime);
+	for (int32 i = ActiveParticles - 1; i >= 0; i--)
+	{
+		if (RelativeTime[i] >= 1.0f)
+		{
+			KillParticle(i);
+		}
+	}
+
+	// PHASE 4: 렌더링/이벤트/에디터가 읽는 AoS 버퍼에 결과 반영
+	for (int32 i = 0; i < ActiveParticles; i++)
+	{
+		SoAData.StoreParticle(i, *GetParticleAtIndex(i));
+	}
+}
+
 void FParticleEmitterInstance::KillParticle(int32 Index)
 {
 	if (Index < 0 || Index >= ActiveParticles)
@@ -713,6 +813,11 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
 		uint16 Temp = ParticleIndices[Index];
 		ParticleIndices[Index] = ParticleIndices[ActiveParticles - 1];
 		ParticleIndices[ActiveParticles - 1] = Temp;
+
+		if (bUseSoALayout)
+		{
+			SoAData.CopyParticle(Index, ActiveParticles - 1);
+		}
 	}
 
 	ActiveParticles--;
@@ -843,6 +948,7 @@ bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData*
 
 	// 컴팩트 복사: 활성 파티클만 연속으로 복사 (sparse array → dense array)
 	uint8* DstData = Data->Source.DataContainer.ParticleData;
+	Data->Source.ParticleSlots.resize(ActiveParticles);
 	for (int32 i = 0; i < ActiveParticles; i++)
 	{
 		int32 SrcIndex = ParticleIndices[i];
@@ -851,6 +957,9 @@ bool FParticleEmitterInstance::BuildSpriteDynamicData(FDynamicSpriteEmitterData*
 
 		// 인덱스는 컴팩트 복사 후 순차적으로 재매핑
 		Data->Source.DataContainer.ParticleIndices[i] = static_cast<uint16>(i);
+
+		// 원본 슬롯은 파티클 수명 동안 유지되므로 정렬 캐시의 ID로 사용
+		Data->Source.ParticleSlots[i] = static_cast<uint16>(SrcIndex);
 	}
 
 	// 언리얼 엔진 호환: Required 모듈과 Material 설정 (렌더링 시 필요)
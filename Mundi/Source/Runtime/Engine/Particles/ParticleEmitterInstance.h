@@ -2,6 +2,7 @@
 
 #include "ParticleDefinitions.h"
 #include "ParticleHelper.h"
+#include "ParticleSoA.h"
 #include "ParticleEmitter.h"
 #include "ParticleRandomStream.h"
 
@@ -51,6 +52,11 @@ struct FParticleEmitterInstance
 	/** 파티클 데이터배열에 저장할 수 있는 최대 파티클 활성 수 */
 	int32 MaxActiveParticles;
 
+	/** SoA 업데이트 경로 사용 여부 (SetupEmitter에서 결정) */
+	bool bUseSoALayout;
+	/** 활성 파티클 기본 속성의 SoA 스트림 (bUseSoALayout일 때만 유지) */
+	FParticleSoAData SoAData;
+
 	// 스폰 분수 (부드러운 스폰을 위함)
 	float SpawnFraction;
 
@@ -114,6 +120,15 @@ struct FParticleEmitterInstance
 	// 파티클 업데이트
 	void UpdateParticles(float DeltaTime);
 
+	// SoA 레이아웃 파티클 업데이트 (UpdateParticles에서 분기)
+	void UpdateParticlesSoA(float DeltaTime);
+
+	// 현재 LOD가 SoA 업데이트 경로를 쓸 수 있는지 (모든 업데이트 모듈이 UpdateSoA 지원)
+	bool CanUseSoALayout() const;
+
+	// 활성 파티클 전체를 AoS 버퍼에서 SoA 스트림으로 다시 읽어 옴
+	void RebuildSoAData();
+
 	// 인덱스의 파티클 가져오기
 	FBaseParticle* GetParticleAtIndex(int32 Index);
 
@@ -4,6 +4,7 @@
 
 // 전방 선언
 struct FParticleEmitterInstance;
+struct FParticleSoAData;
 
 // 언리얼 엔진 호환: 모듈 업데이트 컨텍스트 구조체
 // 매개변수 전달을 간소화하고 확장성을 높임
@@ -14,6 +15,16 @@ struct FModuleUpdateContext
 	float                     DeltaTime;  // 델타 타임
 };
 
+// SoA 레이아웃 모듈 업데이트 컨텍스트
+// 기본 속성은 SoAData 스트림(활성 인덱스 기준)에서, 페이로드는 기존 AoS 버퍼에서 읽음
+struct FModuleSoAUpdateContext
+{
+	FParticleEmitterInstance& Owner;      // 이미터 인스턴스 참조
+	FParticleSoAData&         SoAData;    // 기본 속성 스트림
+	int32                     Offset;     // 파티클 데이터 오프셋
+	float                     DeltaTime;  // 델타 타임
+};
+
 // 파티클 데이터에서 파티클 포인터를 선언하는 헬퍼 매크로 (언리얼 엔진 호환)
 // SpawnParticles 내부에서 사용 (ParticleBase를 Particle로 캐스팅)
 // 사용법: DECLARE_PARTICLE_PTR(Particle, ParticleBase);
@@ -56,6 +67,32 @@ struct FModuleUpdateContext
 		} \
 	}
 
+// SoA 업데이트(UpdateSoA)의 파티클별 스칼라 루프 (FModuleSoAUpdateContext 사용)
+// i는 활성 인덱스 = 스트림 인덱스, ParticleBase는 페이로드 접근용 AoS 주소
+// Freeze 상태는 SoA Flags 스트림으로 판단
+#define BEGIN_SOA_UPDATE_LOOP \
+	{ \
+		const int32       ActiveParticles  = Context.Owner.ActiveParticles; \
+		int32             Offset           = Context.Offset; \
+		uint32            CurrentOffset    = Offset; \
+		float             DeltaTime        = Context.DeltaTime; \
+		const uint8*      ParticleData     = Context.Owner.ParticleData; \
+		const uint32      ParticleStride   = Context.Owner.ParticleStride; \
+		const uint16*     ParticleIndices  = Context.Owner.ParticleIndices; \
+		const int32*      ParticleFlags    = Context.SoAData.Flags.data(); \
+		for(int32 i=ActiveParticles-1; i>=0; i--) \
+		{ \
+			const uint8*   ParticleBase = ParticleData + ParticleIndices[i] * ParticleStride; \
+			if ((ParticleFlags[i] & STATE_Particle_Freeze) == 0) \
+			{
+
+// SoA 파티클 루프를 종료하는 헬퍼 매크로
+#define END_SOA_UPDATE_LOOP \
+			} \
+			CurrentOffset = Offset; \
+		} \
+	}
+
 // 파티클 기본 크기를 가져오는 헬퍼 함수
 inline FVector GetParticleBaseSize(const FBaseParticle& Particle)
 {
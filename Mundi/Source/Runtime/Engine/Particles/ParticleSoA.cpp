@@ -0,0 +1,349 @@
+#include "pch.h"
+#include "ParticleSoA.h"
+#include "ParticleEmitterInstance.h"
+#include "Modules/ParticleModuleAcceleration.h"
+#include "Modules/ParticleModuleColor.h"
+#include "Modules/ParticleModuleLifetime.h"
+#include "Modules/ParticleModuleRotationRate.h"
+#include "Modules/ParticleModuleSize.h"
+#include "PlatformTime.h"
+#include <random>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 스트림 관리
+// ────────────────────────────────────────────────────────────────────────────
+
+void FParticleSoAData::Resize(int32 NewCapacity)
+{
+	NewCapacity = (std::max(NewCapacity, 0) + 3) & ~3;
+	if (NewCapacity == Capacity)
+	{
+		return;
+	}
+
+	const int32 NumStreams = static_cast<int32>(EParticleStream::Count);
+	const int32 NumPreserved = std::min(Capacity, NewCapacity);
+
+	TArray<float> NewStreams;
+	NewStreams.SetNum(static_cast<size_t>(NumStreams) * NewCapacity);
+	for (int32 Stream = 0; Stream < NumStreams && NumPreserved > 0; ++Stream)
+	{
+		memcpy(NewStreams.data() + static_cast<size_t>(Stream) * NewCapacity,
+			Streams.data() + static_cast<size_t>(Stream) * Capacity,
+			NumPreserved * sizeof(float));
+	}
+
+	Streams.swap(NewStreams);
+	Flags.resize(NewCapacity, 0);
+	Capacity = NewCapacity;
+}
+
+void FParticleSoAData::LoadParticle(int32 Index, const FBaseParticle& Particle)
+{
+	Get(EParticleStream::LocationX)[Index] = Particle.Location.X;
+	Get(EParticleStream::LocationY)[Index] = Particle.Location.Y;
+	Get(EParticleStream::LocationZ)[Index] = Particle.Location.Z;
+	Get(EParticleStream::OldLocationX)[Index] = Particle.OldLocation.X;
+	Get(EParticleStream::OldLocationY)[Index] = Particle.OldLocation.Y;
+	Get(EParticleStream::OldLocationZ)[Index] = Particle.OldLocation.Z;
+	Get(EParticleStream::VelocityX)[Index] = Particle.Velocity.X;
+	Get(EParticleStream::VelocityY)[Index] = Particle.Velocity.Y;
+	Get(EParticleStream::VelocityZ)[Index] = Particle.Velocity.Z;
+	Get(EParticleStream::Rotation)[Index] = Particle.Rotation;
+	Get(EParticleStream::RotationRate)[Index] = Particle.RotationRate;
+	Get(EParticleStream::SizeX)[Index] = Particle.Size.X;
+	Get(EParticleStream::SizeY)[Index] = Particle.Size.Y;
+	Get(EParticleStream::SizeZ)[Index] = Particle.Size.Z;
+	Get(EParticleStream::ColorR)[Index] = Particle.Color.R;
+	Get(EParticleStream::ColorG)[Index] = Particle.Color.G;
+	Get(EParticleStream::ColorB)[Index] = Particle.Color.B;
+	Get(EParticleStream::ColorA)[Index] = Particle.Color.A;
+	Get(EParticleStream::RelativeTime)[Index] = Particle.RelativeTime;
+	Get(EParticleStream::OneOverMaxLifetime)[Index] = Particle.OneOverMaxLifetime;
+	Flags[Index] = Particle.Flags;
+}
+
+void FParticleSoAData::StoreParticle(int32 Index, FBaseParticle& Particle) const
+{
+	Particle.Location = FVector(Get(EParticleStream::LocationX)[Index], Get(EParticleStream::LocationY)[Index], Get(EParticleStream::LocationZ)[Index]);
+	Particle.OldLocation = FVector(Get(EParticleStream::OldLocationX)[Index], Get(EParticleStream::OldLocationY)[Index], Get(EParticleStream::OldLocationZ)[Index]);
+	Particle.Velocity = FVector(Get(EParticleStream::VelocityX)[Index], Get(EParticleStream::VelocityY)[Index], Get(EParticleStream::VelocityZ)[Index]);
+	Particle.Rotation = Get(EParticleStream::Rotation)[Index];
+	Particle.RotationRate = Get(EParticleStream::RotationRate)[Index];
+	Particle.Size = FVector(Get(EParticleStream::SizeX)[Index], Get(EParticleStream::SizeY)[Index], Get(EParticleStream::SizeZ)[Index]);
+	Particle.Color = FLinearColor(Get(EParticleStream::ColorR)[Index], Get(EParticleStream::ColorG)[Index], Get(EParticleStream::ColorB)[Index], Get(EParticleStream::ColorA)[Index]);
+	Particle.RelativeTime = Get(EParticleStream::RelativeTime)[Index];
+	Particle.OneOverMaxLifetime = Get(EParticleStream::OneOverMaxLifetime)[Index];
+	Particle.Flags = Flags[Index];
+}
+
+void FParticleSoAData::CopyParticle(int32 DstIndex, int32 SrcIndex)
+{
+	for (int32 Stream = 0; Stream < static_cast<int32>(EParticleStream::Count); ++Stream)
+	{
+		float* Data = Get(static_cast<EParticleStream>(Stream));
+		Data[DstIndex] = Data[SrcIndex];
+	}
+	Flags[DstIndex] = Flags[SrcIndex];
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 업데이트 커널
+// ────────────────────────────────────────────────────────────────────────────
+
+void FParticleSoAData::Integrate(int32 NumParticles, float DeltaTime)
+{
+	float* LocationX = Get(EParticleStream::LocationX);
+	float* LocationY = Get(EParticleStream::LocationY);
+	float* LocationZ = Get(EParticleStream::LocationZ);
+	float* OldLocationX = Get(EParticleStream::OldLocationX);
+	float* OldLocationY = Get(EParticleStream::OldLocationY);
+	float* OldLocationZ = Get(EParticleStream::OldLocationZ);
+	const float* VelocityX = Get(EParticleStream::VelocityX);
+	const float* VelocityY = Get(EParticleStream::VelocityY);
+	const float* VelocityZ = Get(EParticleStream::VelocityZ);
+	float* Rotation = Get(EParticleStream::Rotation);
+	const float* RotationRate = Get(EParticleStream::RotationRate);
+	float* RelativeTime = Get(EParticleStream::RelativeTime);
+	const float* OneOverMaxLifetime = Get(EParticleStream::OneOverMaxLifetime);
+	int32* ParticleFlags = Flags.data();
+
+	const __m128 DT = _mm_set1_ps(DeltaTime);
+	const __m128i Zero = _mm_setzero_si128();
+	const __m128i FreezeBit = _mm_set1_epi32(STATE_Particle_Freeze);
+	const __m128i FreezeTranslationBit = _mm_set1_epi32(STATE_Particle_FreezeTranslation);
+	const __m128i FreezeRotationBit = _mm_set1_epi32(STATE_Particle_FreezeRotation);
+	const __m128i JustSpawnedBit = _mm_set1_epi32(STATE_Particle_JustSpawned);
+
+	int32 i = 0;
+	for (; i + 4 <= NumParticles; i += 4)
+	{
+		// 수명 (Freeze 여부와 관계없이 증가)
+		_mm_storeu_ps(RelativeTime + i, _mm_add_ps(_mm_loadu_ps(RelativeTime + i),
+			_mm_mul_ps(DT, _mm_loadu_ps(OneOverMaxLifetime + i))));
+
+		const __m128i F = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ParticleFlags + i));
+		const __m128i ActiveI = _mm_cmpeq_epi32(_mm_and_si128(F, FreezeBit), Zero);
+		const __m128 Active = _mm_castsi128_ps(ActiveI);
+		const __m128 Move = _mm_and_ps(Active, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(F, FreezeTranslationBit), Zero)));
+		const __m128 Rotate = _mm_and_ps(Active, _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(F, FreezeRotationBit), Zero)));
+
+		// 이전 위치 저장 후 위치 적분
+		const __m128 LX = _mm_loadu_ps(LocationX + i);
+		const __m128 LY = _mm_loadu_ps(LocationY + i);
+		const __m128 LZ = _mm_loadu_ps(LocationZ + i);
+		StoreMasked(OldLocationX + i, LX, Active);
+		StoreMasked(OldLocationY + i, LY, Active);
+		StoreMasked(OldLocationZ + i, LZ, Active);
+		_mm_storeu_ps(LocationX + i, _mm_add_ps(LX, _mm_and_ps(Move, _mm_mul_ps(_mm_loadu_ps(VelocityX + i), DT))));
+		_mm_storeu_ps(LocationY + i, _mm_add_ps(LY, _mm_and_ps(Move, _mm_mul_ps(_mm_loadu_ps(VelocityY + i), DT))));
+		_mm_storeu_ps(LocationZ + i, _mm_add_ps(LZ, _mm_and_ps(Move, _mm_mul_ps(_mm_loadu_ps(VelocityZ + i), DT))));
+
+		// 회전 적분
+		_mm_storeu_ps(Rotation + i, _mm_add_ps(_mm_loadu_ps(Rotation + i),
+			_mm_and_ps(Rotate, _mm_mul_ps(_mm_loadu_ps(RotationRate + i), DT))));
+
+		// Freeze가 아닌 파티클만 JustSpawned 제거
+		const __m128i ClearBits = _mm_and_si128(ActiveI, JustSpawnedBit);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(ParticleFlags + i), _mm_andnot_si128(ClearBits, F));
+	}
+
+	// 나머지 (4개 미만)
+	for (; i < NumParticles; ++i)
+	{
+		RelativeTime[i] += DeltaTime * OneOverMaxLifetime[i];
+
+		const int32 F = ParticleFlags[i];
+		if (F & STATE_Particle_Freeze)
+		{
+			continue;
+		}
+
+		OldLocationX[i] = LocationX[i];
+		OldLocationY[i] = LocationY[i];
+		OldLocationZ[i] = LocationZ[i];
+
+		if ((F & STATE_Particle_FreezeTranslation) == 0)
+		{
+			LocationX[i] += VelocityX[i] * DeltaTime;
+			LocationY[i] += VelocityY[i] * DeltaTime;
+			LocationZ[i] += VelocityZ[i] * DeltaTime;
+		}
+
+		if ((F & STATE_Particle_FreezeRotation) == 0)
+		{
+			Rotation[i] += RotationRate[i] * DeltaTime;
+		}
+
+		ParticleFlags[i] = F & ~STATE_Particle_JustSpawned;
+	}
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 벤치마크
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	/** 벤치마크용 이미터: Acceleration(중력) / Color / Size / RotationRate 업데이트 + Lifetime */
+	UParticleEmitter* CreateBenchmarkEmitter()
+	{
+		UParticleLODLevel* LODLevel = ObjectFactory::NewObject<UParticleLODLevel>();
+
+		UParticleModuleLifetime* Lifetime = ObjectFactory::NewObject<UParticleModuleLifetime>();
+		UParticleModuleAcceleration* Acceleration = ObjectFactory::NewObject<UParticleModuleAcceleration>();
+		Acceleration->AccelerationOverLife = FDistributionVector(FVector(1.0f, 0.5f, 0.0f));
+		Acceleration->bApplyGravity = true;
+		UParticleModuleColor* Color = ObjectFactory::NewObject<UParticleModuleColor>();
+		Color->ColorOverLife = FDistributionColor(FLinearColor(1.0f, 0.5f, 0.25f, 0.8f));
+		UParticleModuleSize* Size = ObjectFactory::NewObject<UParticleModuleSize>();
+		Size->SizeOverLife = FDistributionVector(FVector(2.0f, 2.0f, 2.0f));
+		UParticleModuleRotationRate* RotationRate = ObjectFactory::NewObject<UParticleModuleRotationRate>();
+		RotationRate->RotationRateOverLife = FDistributionFloat(1.5f);
+
+		LODLevel->Modules.Add(Lifetime);
+		LODLevel->Modules.Add(Acceleration);
+		LODLevel->Modules.Add(Color);
+		LODLevel->Modules.Add(Size);
+		LODLevel->Modules.Add(RotationRate);
+
+		UParticleEmitter* Emitter = ObjectFactory::NewObject<UParticleEmitter>();
+		Emitter->LODLevels.Add(LODLevel);
+		Emitter->CacheEmitterModuleInfo();
+		return Emitter;
+	}
+
+	/**
+	 * 이미터 인스턴스를 만들고 Count개 파티클을 직접 채웁니다.
+	 * 컴포넌트 없이 동작해야 하므로 SpawnParticles 대신 PreSpawn + Spawn 모듈을 호출합니다.
+	 */
+	FParticleEmitterInstance* CreateBenchmarkInstance(UParticleEmitter* Emitter, int32 Count, uint32 Seed)
+	{
+		FParticleEmitterInstance* Instance = new FParticleEmitterInstance();
+		Instance->Init(nullptr, Emitter);
+		Instance->Resize(Count);
+
+		std::mt19937 Random(Seed);
+		std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+		for (int32 i = 0; i < Count && Instance->ActiveParticles < Instance->MaxActiveParticles; ++i)
+		{
+			const int32 Slot = Instance->ParticleIndices[Instance->ActiveParticles++];
+			uint8* ParticleBase = Instance->ParticleData + Slot * Instance->ParticleStride;
+			memset(ParticleBase, 0, Instance->ParticleStride);
+			DECLARE_PARTICLE_PTR(Particle, ParticleBase);
+
+			const FVector Location(Unit(Random) * 100.0f, Unit(Random) * 100.0f, Unit(Random) * 100.0f);
+			const FVector Velocity(Unit(Random) * 10.0f, Unit(Random) * 10.0f, Unit(Random) * 10.0f);
+			Instance->PreSpawn(Particle, Location, Velocity);
+
+			for (UParticleModule* Module : Instance->CurrentLODLevel->SpawnModules)
+			{
+				const int32 Offset = Instance->PayloadOffset + Module->ModuleOffsetInParticle;
+				Module->Spawn(Instance, Offset, 0.0f, Particle);
+
+				// 컴포넌트가 없으면 Acceleration::Spawn이 페이로드를 채우지 않으므로 중력만 직접 기록
+				if (UParticleModuleAcceleration* Acceleration = Cast<UParticleModuleAcceleration>(Module))
+				{
+					reinterpret_cast<FParticleAccelerationPayload*>(ParticleBase + Offset)->GravityZ = -9.8f * Acceleration->GravityScale;
+				}
+			}
+
+			// 측정 도중 죽지 않도록 수명을 충분히 길게, 일부는 Freeze 경로도 거치도록
+			Particle->OneOverMaxLifetime = 1.0e-4f;
+			Particle->RelativeTime = 0.0f;
+			if ((i % 16) == 0)
+			{
+				Particle->Flags |= STATE_Particle_FreezeTranslation;
+			}
+			Particle->Flags |= STATE_Particle_JustSpawned;
+		}
+
+		Instance->RebuildSoAData();
+		return Instance;
+	}
+}
+
+void FParticleSoAData::RunBenchmark(int32 NumParticles, int32 Iterations)
+{
+	NumParticles = std::max(1, NumParticles);
+	Iterations = std::max(1, Iterations);
+
+	// 이미터 인스턴스당 하드 리밋이 1000개이므로 여러 인스턴스로 나눔
+	constexpr int32 ParticlesPerEmitter = 1000;
+	const int32 NumEmitters = (NumParticles + ParticlesPerEmitter - 1) / ParticlesPerEmitter;
+
+	UParticleEmitter* Emitter = CreateBenchmarkEmitter();
+	UParticleModuleRequired* Required = Emitter->GetLODLevel(0)->RequiredModule;
+
+	TArray<FParticleEmitterInstance*> AoSInstances;
+	TArray<FParticleEmitterInstance*> SoAInstances;
+	for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; ++EmitterIndex)
+	{
+		const int32 Count = std::min(ParticlesPerEmitter, NumParticles - EmitterIndex * ParticlesPerEmitter);
+		const uint32 Seed = 777u + static_cast<uint32>(EmitterIndex);
+
+		Required->bUseSoALayout = false;
+		AoSInstances.Add(CreateBenchmarkInstance(Emitter, Count, Seed));
+
+		Required->bUseSoALayout = true;
+		SoAInstances.Add(CreateBenchmarkInstance(Emitter, Count, Seed));
+	}
+
+	const float DeltaTime = 1.0f / 60.0f;
+	auto Measure = [Iterations, DeltaTime](TArray<FParticleEmitterInstance*>& Instances)
+	{
+		const uint64 Start = FWindowsPlatformTime::Cycles64();
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			for (FParticleEmitterInstance* Instance : Instances)
+			{
+				Instance->UpdateParticles(DeltaTime);
+			}
+		}
+		const uint64 End = FWindowsPlatformTime::Cycles64();
+		return FWindowsPlatformTime::ToMilliseconds(End - Start) / Iterations;
+	};
+
+	const double AoSMS = Measure(AoSInstances);
+	const double SoAMS = Measure(SoAInstances);
+
+	// 두 레이아웃의 최종 AoS 결과 비교 (같은 입력, 같은 업데이트 횟수)
+	float MaxError = 0.0f;
+	int32 NumSoAEmitters = 0;
+	for (int32 EmitterIndex = 0; EmitterIndex < NumEmitters; ++EmitterIndex)
+	{
+		FParticleEmitterInstance* AoS = AoSInstances[EmitterIndex];
+		FParticleEmitterInstance* SoA = SoAInstances[EmitterIndex];
+		NumSoAEmitters += SoA->bUseSoALayout ? 1 : 0;
+
+		for (int32 i = 0; i < std::min(AoS->ActiveParticles, SoA->ActiveParticles); ++i)
+		{
+			const FBaseParticle* A = AoS->GetParticleAtIndex(i);
+			const FBaseParticle* B = SoA->GetParticleAtIndex(i);
+			MaxError = std::max(MaxError, (A->Location - B->Location).Size());
+			MaxError = std::max(MaxError, (A->Velocity - B->Velocity).Size());
+			MaxError = std::max(MaxError, (A->Size - B->Size).Size());
+			MaxError = std::max(MaxError, std::abs(A->Rotation - B->Rotation));
+			MaxError = std::max(MaxError, std::abs(A->Color.A - B->Color.A));
+		}
+	}
+
+	for (FParticleEmitterInstance* Instance : AoSInstances)
+	{
+		delete Instance;
+	}
+	for (FParticleEmitterInstance* Instance : SoAInstances)
+	{
+		delete Instance;
+	}
+	ObjectFactory::DeleteObject(Emitter);
+
+	FScopeCycleCounter::AddTimeProfile(TStatId("Particle_UpdateSoA"), SoAMS);
+
+	UE_LOG("Particle Layout Benchmark: %d particles, %d emitters, %d iterations", NumParticles, NumEmitters, Iterations);
+	UE_LOG("  AoS         : %.3f ms", AoSMS);
+	UE_LOG("  SoA + SSE   : %.3f ms (x%.2f, %d/%d emitters on SoA path)",
+		SoAMS, SoAMS > 0.0 ? AoSMS / SoAMS : 0.0, NumSoAEmitters, NumEmitters);
+	UE_LOG("  Max error   : %.6f", MaxError);
+}
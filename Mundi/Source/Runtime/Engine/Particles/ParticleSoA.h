@@ -0,0 +1,114 @@
+#pragma once
+
+#include "ParticleDefinitions.h"
+#include <emmintrin.h>
+
+// ────────────────────────────────────────────────────────────────────────────
+// ParticleSoA.h
+// 파티클 기본 속성의 SoA(Structure of Arrays) 저장소와 SSE 업데이트 커널
+// ────────────────────────────────────────────────────────────────────────────
+
+/** FParticleSoAData의 float 스트림 종류 */
+enum class EParticleStream : int32
+{
+	LocationX, LocationY, LocationZ,
+	OldLocationX, OldLocationY, OldLocationZ,
+	VelocityX, VelocityY, VelocityZ,
+	Rotation,
+	RotationRate,
+	SizeX, SizeY, SizeZ,
+	ColorR, ColorG, ColorB, ColorA,
+	RelativeTime,
+	OneOverMaxLifetime,
+
+	Count
+};
+
+/**
+ * FParticleSoAData
+ *
+ * 활성 파티클의 기본 속성을 속성별 연속 float 배열로 보관합니다.
+ * 스트림의 i번째 원소는 ParticleIndices[i]가 가리키는 파티클과 같으며
+ * (활성 인덱스 기준으로 촘촘하게 유지), KillParticle의 swap도 똑같이 따라갑니다.
+ *
+ * 모듈 페이로드와 렌더링은 계속 AoS(FBaseParticle) 버퍼를 사용하므로
+ * FParticleEmitterInstance는 업데이트가 끝난 뒤 스트림을 AoS로 되돌려 씁니다.
+ */
+struct FParticleSoAData
+{
+	/** 스트림 용량 (SIMD 폭의 배수) */
+	int32 Capacity = 0;
+
+	/** float 스트림 전체 (Stream * Capacity + Index) */
+	TArray<float> Streams;
+
+	/** 파티클 상태 플래그 (STATE_Particle_*) */
+	TArray<int32> Flags;
+
+	float* Get(EParticleStream Stream)
+	{
+		return Streams.data() + static_cast<size_t>(Stream) * Capacity;
+	}
+
+	const float* Get(EParticleStream Stream) const
+	{
+		return Streams.data() + static_cast<size_t>(Stream) * Capacity;
+	}
+
+	/**
+	 * 용량을 조정합니다. 기존 원소는 작은 쪽 용량만큼 보존됩니다.
+	 *
+	 * @param NewCapacity - 새 최대 파티클 수 (내부적으로 4의 배수로 올림)
+	 */
+	void Resize(int32 NewCapacity);
+
+	void Empty()
+	{
+		Capacity = 0;
+		Streams.Empty();
+		Flags.Empty();
+	}
+
+	/** AoS 파티클 하나를 스트림의 Index 위치로 읽어 옵니다. */
+	void LoadParticle(int32 Index, const FBaseParticle& Particle);
+
+	/** 스트림의 Index 위치를 AoS 파티클에 되돌려 씁니다. (Base* 속성은 건드리지 않음) */
+	void StoreParticle(int32 Index, FBaseParticle& Particle) const;
+
+	/** SrcIndex 원소를 DstIndex로 복사합니다. (KillParticle의 swap 대응) */
+	void CopyParticle(int32 DstIndex, int32 SrcIndex);
+
+	/**
+	 * [0, NumParticles) 파티클의 수명/위치/회전을 4개씩 갱신합니다.
+	 * FParticleEmitterInstance::UpdateParticles의 PHASE 1과 같은 규칙을 따릅니다.
+	 * - 수명은 Freeze 여부와 관계없이 증가
+	 * - Freeze가 아니면 OldLocation 저장, JustSpawned 플래그 제거
+	 * - FreezeTranslation / FreezeRotation이면 해당 속성 유지
+	 */
+	void Integrate(int32 NumParticles, float DeltaTime);
+
+	/** Flags[Index..Index+3] 중 Freeze가 아닌 레인은 모든 비트가 1인 마스크 */
+	static __m128 LoadActiveMask(const int32* InFlags)
+	{
+		const __m128i F = _mm_loadu_si128(reinterpret_cast<const __m128i*>(InFlags));
+		const __m128i Frozen = _mm_and_si128(F, _mm_set1_epi32(STATE_Particle_Freeze));
+		return _mm_castsi128_ps(_mm_cmpeq_epi32(Frozen, _mm_setzero_si128()));
+	}
+
+	/** Mask 레인만 Value로 덮어씁니다. */
+	static void StoreMasked(float* Dst, __m128 Value, __m128 Mask)
+	{
+		const __m128 Old = _mm_loadu_ps(Dst);
+		_mm_storeu_ps(Dst, _mm_or_ps(_mm_and_ps(Mask, Value), _mm_andnot_ps(Mask, Old)));
+	}
+
+	/**
+	 * 같은 파티클 수를 AoS / SoA 레이아웃으로 각각 업데이트해 시간과 결과 차이를 로그로 출력합니다.
+	 * 이미터당 하드 리밋(1000개)이 있으므로 이미터 여러 개로 나눠 구성합니다.
+	 * SoA 결과는 Particle_UpdateSoA 스탯에도 기록됩니다.
+	 *
+	 * @param NumParticles - 전체 파티클 수
+	 * @param Iterations - 레이아웃별 업데이트 반복 횟수
+	 */
+	static void RunBenchmark(int32 NumParticles = 100000, int32 Iterations = 20);
+};
@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "ParticleTickManager.h"
+#include "ParticleSystemComponent.h"
+#include "JobSystem.h"
+#include "PlatformTime.h"
+
+bool FParticleTickManager::bParallelTickEnabled = true;
+
+namespace
+{
+	/** 현재 스레드가 시뮬레이션 중인 작업의 이벤트 버퍼 */
+	thread_local FParticleEventBuffer* GActiveEventBuffer = nullptr;
+}
+
+FParticleEventBuffer* FParticleTickManager::GetActiveEventBuffer()
+{
+	return GActiveEventBuffer;
+}
+
+void FParticleTickManager::Enqueue(UParticleSystemComponent* Component, float DeltaTime)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	FPendingComponent Pending;
+	Pending.Component = Component;
+	Pending.DeltaTime = DeltaTime;
+	PendingComponents.Add(Pending);
+}
+
+void FParticleTickManager::Remove(UParticleSystemComponent* Component)
+{
+	for (FPendingComponent& Pending : PendingComponents)
+	{
+		if (Pending.Component == Component)
+		{
+			Pending.Component = nullptr;
+		}
+	}
+}
+
+void FParticleTickManager::Execute()
+{
+	LastStats = FStats();
+	if (PendingComponents.IsEmpty())
+	{
+		return;
+	}
+
+	const uint64 SimulateStart = FWindowsPlatformTime::Cycles64();
+
+	// 1. 작업 수집 (컴포넌트 등록 순서 → 이미터 순서)
+	int32 NumTasks = 0;
+	TArray<int32> SerialComponents;
+	for (int32 PendingIndex = 0; PendingIndex < PendingComponents.Num(); ++PendingIndex)
+	{
+		UParticleSystemComponent* Component = PendingComponents[PendingIndex].Component;
+		if (!Component || Component->IsPendingDestroy())
+		{
+			continue;
+		}
+
+		if (!Component->CanTickEmittersInParallel())
+		{
+			SerialComponents.Add(PendingIndex);
+			continue;
+		}
+
+		for (FParticleEmitterInstance* Instance : Component->EmitterInstances)
+		{
+			if (!Instance)
+			{
+				continue;
+			}
+
+			if (NumTasks >= EmitterTasks.Num())
+			{
+				EmitterTasks.Emplace();
+			}
+			FEmitterTask& Task = EmitterTasks[NumTasks++];
+			Task.PendingIndex = PendingIndex;
+			Task.Instance = Instance;
+			Task.Events.Reset();
+		}
+	}
+
+	// 2. 이미터 병렬 시뮬레이션 (이벤트는 작업별 버퍼로)
+	FJobSystem::ParallelFor(NumTasks, 1, [this](int32 TaskIndex)
+	{
+		FEmitterTask& Task = EmitterTasks[TaskIndex];
+		const FPendingComponent& Pending = PendingComponents[Task.PendingIndex];
+
+		GActiveEventBuffer = &Task.Events;
+		Task.Instance->Tick(Pending.DeltaTime, Pending.Component->IsDeactivating());
+		GActiveEventBuffer = nullptr;
+	});
+
+	// 모듈 상태를 공유하는 컴포넌트는 게임 스레드에서 순차 틱 (이벤트는 컴포넌트로 직접)
+	for (int32 PendingIndex : SerialComponents)
+	{
+		const FPendingComponent& Pending = PendingComponents[PendingIndex];
+		Pending.Component->TickEmitters(Pending.DeltaTime);
+	}
+
+	// 3. 이벤트 병합 (작업 순서 = 직렬 틱 순서)
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+	{
+		FEmitterTask& Task = EmitterTasks[TaskIndex];
+		UParticleSystemComponent* Component = PendingComponents[Task.PendingIndex].Component;
+
+		Component->CollisionEvents.insert(Component->CollisionEvents.end(), Task.Events.CollisionEvents.begin(), Task.Events.CollisionEvents.end());
+		Component->SpawnEvents.insert(Component->SpawnEvents.end(), Task.Events.SpawnEvents.begin(), Task.Events.SpawnEvents.end());
+		Component->DeathEvents.insert(Component->DeathEvents.end(), Task.Events.DeathEvents.begin(), Task.Events.DeathEvents.end());
+		Task.Instance = nullptr;
+	}
+
+	const uint64 FinishStart = FWindowsPlatformTime::Cycles64();
+
+	// 4. 렌더 데이터 / 이벤트 디스패치 / 브로드캐스트 (등록 순서대로)
+	// FinishTick 안에서 다른 컴포넌트가 등록될 수 있으므로 큐를 먼저 분리
+	TArray<FPendingComponent> Finished;
+	Finished.swap(PendingComponents);
+
+	for (const FPendingComponent& Pending : Finished)
+	{
+		if (Pending.Component && !Pending.Component->IsPendingDestroy())
+		{
+			Pending.Component->FinishTick();
+			++LastStats.NumComponents;
+		}
+	}
+
+	const uint64 FinishEnd = FWindowsPlatformTime::Cycles64();
+
+	LastStats.NumParallelEmitters = NumTasks;
+	LastStats.NumSerialComponents = SerialComponents.Num();
+	LastStats.SimulateMS = FWindowsPlatformTime::ToMilliseconds(FinishStart - SimulateStart);
+	LastStats.FinishMS = FWindowsPlatformTime::ToMilliseconds(FinishEnd - FinishStart);
+
+	FScopeCycleCounter::AddTimeProfile(TStatId("Particle_Simulate"), LastStats.SimulateMS);
+}
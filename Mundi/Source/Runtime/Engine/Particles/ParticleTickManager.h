@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ParticleEventTypes.h"
+
+class UParticleSystemComponent;
+struct FParticleEmitterInstance;
+
+// ────────────────────────────────────────────────────────────────────────────
+// ParticleTickManager.h
+// 월드 단위 파티클 틱 단계 (이미터 인스턴스 병렬 시뮬레이션)
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * 작업 하나가 시뮬레이션 중 생성한 파티클 이벤트
+ * 워커 스레드는 컴포넌트 이벤트 배열 대신 여기에 기록하고, 병합은 게임 스레드에서 합니다.
+ */
+struct FParticleEventBuffer
+{
+	TArray<FParticleEventCollideData> CollisionEvents;
+	TArray<FParticleEventData> SpawnEvents;
+	TArray<FParticleEventData> DeathEvents;
+
+	void Reset()
+	{
+		CollisionEvents.Empty();
+		SpawnEvents.Empty();
+		DeathEvents.Empty();
+	}
+};
+
+/**
+ * FParticleTickManager
+ *
+ * UParticleSystemComponent::TickComponent는 틱 준비만 하고 컴포넌트를 여기에 등록합니다.
+ * UWorld::Tick이 액터 루프 뒤에 Execute를 호출하면 다음 순서로 진행됩니다.
+ *
+ * 1. 등록된 모든 컴포넌트의 이미터 인스턴스를 모아 잡 시스템으로 병렬 Tick
+ *    (병렬 안전하지 않은 모듈이 있는 컴포넌트는 게임 스레드에서 순차 Tick)
+ * 2. 작업별 이벤트 버퍼를 컴포넌트 → 이미터 등록 순서대로 병합
+ *    (직렬 틱과 같은 순서이므로 결과가 스레드 스케줄에 의존하지 않음)
+ * 3. 컴포넌트 등록 순서대로 FinishTick (렌더 데이터, 이벤트 디스패치, 브로드캐스트)
+ */
+class FParticleTickManager
+{
+public:
+	/** 이번 프레임 파티클 틱 단계에 컴포넌트를 등록합니다. */
+	void Enqueue(UParticleSystemComponent* Component, float DeltaTime);
+
+	/** 등록 해제 (Execute 전에 컴포넌트가 사라지는 경우) */
+	void Remove(UParticleSystemComponent* Component);
+
+	/** 등록된 컴포넌트를 모두 시뮬레이션하고 큐를 비웁니다. */
+	void Execute();
+
+	/**
+	 * 현재 스레드에서 시뮬레이션 중인 작업의 이벤트 버퍼
+	 * 병렬 틱 밖(게임 스레드 직렬 경로)에서는 nullptr
+	 */
+	static FParticleEventBuffer* GetActiveEventBuffer();
+
+	/** 병렬 틱 사용 여부 (false면 TickComponent에서 바로 직렬 틱) */
+	static bool IsParallelTickEnabled() { return bParallelTickEnabled; }
+	static void SetParallelTickEnabled(bool bEnabled) { bParallelTickEnabled = bEnabled; }
+
+	/** 마지막 Execute 통계 */
+	struct FStats
+	{
+		int32 NumComponents = 0;
+		int32 NumParallelEmitters = 0;
+		int32 NumSerialComponents = 0;
+		double SimulateMS = 0.0;
+		double FinishMS = 0.0;
+	};
+	const FStats& GetLastStats() const { return LastStats; }
+
+private:
+	struct FPendingComponent
+	{
+		UParticleSystemComponent* Component = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	/** 병렬로 Tick할 이미터 하나 */
+	struct FEmitterTask
+	{
+		int32 PendingIndex = -1;
+		FParticleEmitterInstance* Instance = nullptr;
+		FParticleEventBuffer Events;
+	};
+
+	TArray<FPendingComponent> PendingComponents;
+
+	/** 프레임마다 재사용 (이벤트 버퍼 용량 유지) */
+	TArray<FEmitterTask> EmitterTasks;
+
+	FStats LastStats;
+
+	static bool bParallelTickEnabled;
+};
@@ -31,22 +31,17 @@ inline bool IsValidUObject(UObject* Ptr)
 {
     if (!Ptr) return false;
 
-    // Step 1: Check InternalIndex in TMap
+    // Step 1: Look up the InternalIndex slot in GUObjectArray
     uint32_t idx = Ptr->InternalIndex;
-    auto it = GUObjectArray.find(idx);
-    if (it == GUObjectArray.end())
-        return false;
+    UObject* RegisteredObj = GUObjectArray.IndexToObject(idx);
 
     // Step 2: Verify GUObjectArray slot points to the same object
-    UObject* RegisteredObj = it->second;
     if (RegisteredObj != Ptr)
         return false;  // Deleted or different object
 
-    // Step 3: UUID validation (commented for now)
-    // TODO(SlotReuse): If ObjectFactory enables null slot reuse, uncomment below
-    // to prevent ABA problem (same address, different object):
-    // if (RegisteredObj->UUID != Ptr->UUID)
-    //     return false;
+    // Note: slots are reused, but only after FUObjectArray::MinFreeSlotsBeforeReuse
+    // other slots were freed, which keeps the same-address ABA window small.
+    // Holders that need a strict guarantee should keep a TWeakObjectPtr (slot serial check).
 
     return true;
 }
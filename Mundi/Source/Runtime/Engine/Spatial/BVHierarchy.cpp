@@ -4,6 +4,8 @@
 #include <cmath>
 #include <functional>
 #include <queue>
+#include <random>
+#include <emmintrin.h>
 #include "BVHierarchy.h"
 #include "Actor.h"
 #include "Collision.h"
@@ -11,6 +13,7 @@
 #include "OBB.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
+#include "PlatformTime.h"
 
 #include "StaticMeshComponent.h"
 
@@ -45,13 +48,110 @@ namespace {
         outTMax = tmax;
         return true;
     }
+
+    // 노드 확장 허용 오차 (이 거리만큼 현재 최선보다 먼 박스까지는 방문)
+    constexpr float RayPruneEpsilon = 1e-3f;
+
+    /** 레이 4개의 SoA 표현 (레이 하나를 검사할 때는 네 레인이 같은 값) */
+    struct FRaySIMD
+    {
+        __m128 OriginX, OriginY, OriginZ;
+        __m128 InvDirX, InvDirY, InvDirZ;
+    };
+
+    // 0 방향 성분은 큰 유한값으로 바꿔 (0 * inf = NaN) 없이 슬랩 경계를 처리
+    inline float SafeInverse(float Value)
+    {
+        return std::abs(Value) > 1e-12f ? 1.0f / Value : std::copysign(1e30f, Value);
+    }
+
+    inline FRaySIMD MakeRaySIMD(const FRay& Ray)
+    {
+        FRaySIMD Out;
+        Out.OriginX = _mm_set1_ps(Ray.Origin.X);
+        Out.OriginY = _mm_set1_ps(Ray.Origin.Y);
+        Out.OriginZ = _mm_set1_ps(Ray.Origin.Z);
+        Out.InvDirX = _mm_set1_ps(SafeInverse(Ray.Direction.X));
+        Out.InvDirY = _mm_set1_ps(SafeInverse(Ray.Direction.Y));
+        Out.InvDirZ = _mm_set1_ps(SafeInverse(Ray.Direction.Z));
+        return Out;
+    }
+
+    // 빈 레인은 마지막 레이로 채움 (호출자가 MaxT를 음수로 두어 무시)
+    inline FRaySIMD MakeRayPacket(const FRay* Rays, int32 NumRays)
+    {
+        const FRay& R0 = Rays[0];
+        const FRay& R1 = Rays[std::min(1, NumRays - 1)];
+        const FRay& R2 = Rays[std::min(2, NumRays - 1)];
+        const FRay& R3 = Rays[std::min(3, NumRays - 1)];
+
+        FRaySIMD Out;
+        Out.OriginX = _mm_setr_ps(R0.Origin.X, R1.Origin.X, R2.Origin.X, R3.Origin.X);
+        Out.OriginY = _mm_setr_ps(R0.Origin.Y, R1.Origin.Y, R2.Origin.Y, R3.Origin.Y);
+        Out.OriginZ = _mm_setr_ps(R0.Origin.Z, R1.Origin.Z, R2.Origin.Z, R3.Origin.Z);
+        Out.InvDirX = _mm_setr_ps(SafeInverse(R0.Direction.X), SafeInverse(R1.Direction.X), SafeInverse(R2.Direction.X), SafeInverse(R3.Direction.X));
+        Out.InvDirY = _mm_setr_ps(SafeInverse(R0.Direction.Y), SafeInverse(R1.Direction.Y), SafeInverse(R2.Direction.Y), SafeInverse(R3.Direction.Y));
+        Out.InvDirZ = _mm_setr_ps(SafeInverse(R0.Direction.Z), SafeInverse(R1.Direction.Z), SafeInverse(R2.Direction.Z), SafeInverse(R3.Direction.Z));
+        return Out;
+    }
+
+    /**
+     * 레인별 슬랩 테스트: [0, MaxT] 구간에서 박스에 들어가면 레인 비트가 켜짐
+     * @param OutEntry 레인별 진입 거리 (레이 원점이 박스 안이면 0)
+     */
+    inline uint32 IntersectRaySlabs_4(const FRaySIMD& Ray,
+        __m128 MinX, __m128 MinY, __m128 MinZ, __m128 MaxX, __m128 MaxY, __m128 MaxZ,
+        __m128 MaxT, __m128& OutEntry)
+    {
+        const __m128 TX0 = _mm_mul_ps(_mm_sub_ps(MinX, Ray.OriginX), Ray.InvDirX);
+        const __m128 TX1 = _mm_mul_ps(_mm_sub_ps(MaxX, Ray.OriginX), Ray.InvDirX);
+        const __m128 TY0 = _mm_mul_ps(_mm_sub_ps(MinY, Ray.OriginY), Ray.InvDirY);
+        const __m128 TY1 = _mm_mul_ps(_mm_sub_ps(MaxY, Ray.OriginY), Ray.InvDirY);
+        const __m128 TZ0 = _mm_mul_ps(_mm_sub_ps(MinZ, Ray.OriginZ), Ray.InvDirZ);
+        const __m128 TZ1 = _mm_mul_ps(_mm_sub_ps(MaxZ, Ray.OriginZ), Ray.InvDirZ);
+
+        const __m128 Entry = _mm_max_ps(
+            _mm_max_ps(_mm_min_ps(TX0, TX1), _mm_min_ps(TY0, TY1)),
+            _mm_max_ps(_mm_min_ps(TZ0, TZ1), _mm_setzero_ps()));
+        const __m128 Exit = _mm_min_ps(
+            _mm_min_ps(_mm_max_ps(TX0, TX1), _mm_max_ps(TY0, TY1)),
+            _mm_min_ps(_mm_max_ps(TZ0, TZ1), MaxT));
+
+        OutEntry = Entry;
+        return static_cast<uint32>(_mm_movemask_ps(_mm_cmple_ps(Entry, Exit)));
+    }
+
+    /** 레이 하나 vs 박스 4개 (AoS → SoA) */
+    inline uint32 IntersectRayAABBs_4(const FRaySIMD& Ray, const FAABB* const Boxes[4], __m128 MaxT, __m128& OutEntry)
+    {
+        return IntersectRaySlabs_4(Ray,
+            _mm_setr_ps(Boxes[0]->Min.X, Boxes[1]->Min.X, Boxes[2]->Min.X, Boxes[3]->Min.X),
+            _mm_setr_ps(Boxes[0]->Min.Y, Boxes[1]->Min.Y, Boxes[2]->Min.Y, Boxes[3]->Min.Y),
+            _mm_setr_ps(Boxes[0]->Min.Z, Boxes[1]->Min.Z, Boxes[2]->Min.Z, Boxes[3]->Min.Z),
+            _mm_setr_ps(Boxes[0]->Max.X, Boxes[1]->Max.X, Boxes[2]->Max.X, Boxes[3]->Max.X),
+            _mm_setr_ps(Boxes[0]->Max.Y, Boxes[1]->Max.Y, Boxes[2]->Max.Y, Boxes[3]->Max.Y),
+            _mm_setr_ps(Boxes[0]->Max.Z, Boxes[1]->Max.Z, Boxes[2]->Max.Z, Boxes[3]->Max.Z),
+            MaxT, OutEntry);
+    }
+
+    /** 레이 패킷(4개) vs 박스 하나 */
+    inline uint32 IntersectRayPacketAABB(const FRaySIMD& Packet, const FAABB& Box, __m128 MaxT, __m128& OutEntry)
+    {
+        return IntersectRaySlabs_4(Packet,
+            _mm_set1_ps(Box.Min.X), _mm_set1_ps(Box.Min.Y), _mm_set1_ps(Box.Min.Z),
+            _mm_set1_ps(Box.Max.X), _mm_set1_ps(Box.Max.Y), _mm_set1_ps(Box.Max.Z),
+            MaxT, OutEntry);
+    }
 }
 
+uint32 FBVHierarchy::NextEpoch = 1;
+
 FBVHierarchy::FBVHierarchy(const FAABB& InBounds, int InDepth, int InMaxDepth, int InMaxObjects)
     : Depth(InDepth)
     , MaxDepth(InMaxDepth)
     , MaxObjects(InMaxObjects)
     , Bounds(InBounds)
+    , Epoch(NextEpoch++)
 {
 }
 
@@ -65,9 +165,13 @@ void FBVHierarchy::Clear()
     // NOTE: TMap, TArray를 clear로 비우면 capacity가 그대로이기 때문에 새 객체로 초기화
     StaticMeshComponentBounds = TMap<UPrimitiveComponent*, FAABB>();
     StaticMeshComponentArray = TArray<UPrimitiveComponent*>();
+    StaticMeshComponentBoundsArray = TArray<FAABB>();
     Nodes = TArray<FLBVHNode>();
     Bounds = FAABB();
     bPendingRebuild = false;
+
+    // 이전에 캐시된 컴포넌트들의 Epoch를 한꺼번에 무효화 (이미 파괴된 컴포넌트일 수 있으므로 건드리지 않음)
+    Epoch = NextEpoch++;
 }
 
 void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
@@ -77,6 +181,7 @@ void FBVHierarchy::BulkUpdate(const TArray<UPrimitiveComponent*>& Components)
         if (SMC)
         {
             StaticMeshComponentBounds.Add(SMC, SMC->GetWorldAABB());
+            SMC->SetPartitionBoundsEpoch(SMC->SupportsFrustumCulling() ? Epoch : 0);
         }
     }
 
@@ -102,6 +207,7 @@ void FBVHierarchy::Update(UPrimitiveComponent* InComponent)
     const FAABB WorldBounds = InComponent->GetWorldAABB();
 
     StaticMeshComponentBounds.Add(InComponent, WorldBounds);
+    InComponent->SetPartitionBoundsEpoch(InComponent->SupportsFrustumCulling() ? Epoch : 0);
     bPendingRebuild = true;
 }
 
@@ -112,6 +218,8 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
         return;
     }
 
+    InComponent->SetPartitionBoundsEpoch(0);
+
     if (StaticMeshComponentBounds.Find(InComponent))
     {
         StaticMeshComponentBounds.Remove(InComponent);
@@ -119,59 +227,117 @@ void FBVHierarchy::Remove(UPrimitiveComponent* InComponent)
     }
 }
 
-void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
+bool FBVHierarchy::QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const
 {
-    if (Nodes.empty()) return;
-    //프러스텀 외부에 바운드 존재
-    if (!IsAABBVisible(InFrustum, Nodes[0].Bounds)) return;
-    //프러스텀 내부에 바운드 존재 (교차 X)
-    if (!IsAABBIntersects(InFrustum, Nodes[0].Bounds))
+    OutComponents.clear();
+
+    // 맵과 노드가 어긋나 있으면(제거/갱신 후 리빌드 전) 노드 바운드를 믿을 수 없음
+    if (bPendingRebuild)
     {
-        for (UPrimitiveComponent* Component : StaticMeshComponentArray)
+        return false;
+    }
+    if (Nodes.empty())
+    {
+        return true;
+    }
+
+    // 리빌드 직후이므로 배열의 모든 컴포넌트는 맵에 존재 (개별 Find 불필요)
+    auto AppendRange = [this, &OutComponents](int32 First, int32 Span)
         {
-            if (!Component) continue;
-            if (StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
-                continue;
-            if (AActor* Owner = Component->GetOwner())
+            for (int32 i = First; i < First + Span; ++i)
             {
-                Owner->SetCulled(false);
+                if (UPrimitiveComponent* Component = StaticMeshComponentArray[i])
+                {
+                    OutComponents.Add(Component);
+                }
             }
-        }
-        return;
-    }
-    //프러스텀과 바운드가 교차
-    TArray<int32> IdxStack;
-    IdxStack.push_back({ 0 });
+        };
 
-    while (!IdxStack.empty())
+    // 리프 컴포넌트 박스는 4개가 모일 때마다 한 번에 판정
+    int32 PendingIndices[4];
+    int32 NumPending = 0;
+    auto FlushPending = [&]()
+        {
+            if (NumPending == 0)
+            {
+                return;
+            }
+            const FAABB* Boxes[4];
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                // 빈 레인은 마지막 박스로 채움 (결과는 무시)
+                Boxes[Lane] = &StaticMeshComponentBoundsArray[PendingIndices[Lane < NumPending ? Lane : NumPending - 1]];
+            }
+            uint32 InsideMask = 0;
+            const uint32 VisibleMask = AreAABBsVisible_4_SSE(InFrustum, Boxes, InsideMask);
+            for (int32 Lane = 0; Lane < NumPending; ++Lane)
+            {
+                if (VisibleMask & (1u << Lane))
+                {
+                    AppendRange(PendingIndices[Lane], 1);
+                }
+            }
+            NumPending = 0;
+        };
+
+    // 너비 우선으로 한 레벨의 노드들을 4개씩 판정
+    TArray<int32> Frontier;
+    TArray<int32> NextFrontier;
+    Frontier.push_back(0);
+
+    while (!Frontier.empty())
     {
-        int32 Idx = IdxStack.back();
-        IdxStack.pop_back();
-        const FLBVHNode& node = Nodes[Idx];
-        if (node.IsLeaf())
+        NextFrontier.clear();
+
+        for (int32 Base = 0; Base < Frontier.Num(); Base += 4)
         {
-            for (int32 i = 0; i < node.Count; ++i)
+            const int32 NumLanes = std::min(4, Frontier.Num() - Base);
+            const FAABB* Boxes[4];
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                Boxes[Lane] = &Nodes[Frontier[Base + (Lane < NumLanes ? Lane : NumLanes - 1)]].Bounds;
+            }
+
+            uint32 InsideMask = 0;
+            const uint32 VisibleMask = AreAABBsVisible_4_SSE(InFrustum, Boxes, InsideMask);
+
+            for (int32 Lane = 0; Lane < NumLanes; ++Lane)
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                if (!(VisibleMask & (1u << Lane)))
+                {
                     continue;
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                }
+
+                const FLBVHNode& Node = Nodes[Frontier[Base + Lane]];
+                if (InsideMask & (1u << Lane))
+                {
+                    // 완전히 안쪽: 서브트리 전체가 보임
+                    AppendRange(Node.First, Node.Span);
+                }
+                else if (Node.IsLeaf())
                 {
-                    if (AActor* Owner = Component->GetOwner())
+                    for (int32 i = 0; i < Node.Count; ++i)
                     {
-                        Owner->SetCulled(false);
+                        PendingIndices[NumPending++] = Node.First + i;
+                        if (NumPending == 4)
+                        {
+                            FlushPending();
+                        }
                     }
                 }
+                else
+                {
+                    if (Node.Left >= 0) NextFrontier.push_back(Node.Left);
+                    if (Node.Right >= 0) NextFrontier.push_back(Node.Right);
+                }
             }
-            continue;
         }
-        if (node.Left >= 0 && IsAABBVisible(InFrustum, Nodes[node.Left].Bounds))
-            IdxStack.push_back({ node.Left });
-        if (node.Right >= 0 && IsAABBVisible(InFrustum, Nodes[node.Right].Bounds))
-            IdxStack.push_back({ node.Right });
+
+        Frontier.swap(NextFrontier);
     }
+
+    FlushPending();
+    return true;
 }
 
 void FBVHierarchy::DebugDraw(URenderer* Renderer) const
@@ -273,6 +439,20 @@ void FBVHierarchy::BuildLBVH()
 {
     StaticMeshComponentArray = StaticMeshComponentBounds.GetKeys();
     const int N = StaticMeshComponentArray.Num();
+
+    StaticMeshComponentBoundsArray.resize(N);
+    for (int i = 0; i < N; ++i)
+    {
+        const FAABB* Bound = StaticMeshComponentBounds.Find(StaticMeshComponentArray[i]);
+        StaticMeshComponentBoundsArray[i] = Bound ? *Bound : StaticMeshComponentArray[i]->GetWorldAABB();
+    }
+
+    BuildNodesFromArrays();
+}
+
+void FBVHierarchy::BuildNodesFromArrays()
+{
+    const int N = StaticMeshComponentArray.Num();
     Nodes = TArray<FLBVHNode>();
 
     if (N == 0)
@@ -281,37 +461,20 @@ void FBVHierarchy::BuildLBVH()
         return;
     }
 
-    bool bHasBounds = false;
-    for (const auto& Pair : StaticMeshComponentBounds)
+    Bounds = StaticMeshComponentBoundsArray[0];
+    for (int i = 1; i < N; ++i)
     {
-        const FAABB& Bound = Pair.second;
-        if (!bHasBounds)
-        {
-            Bounds = Bound;
-            bHasBounds = true;
-        }
-        else
-        {
-            Bounds = FAABB::Union(Bounds, Bound);
-        }
-    }
-
-    if (!bHasBounds)
-    {
-        Bounds = FAABB();
-        return;
+        Bounds = FAABB::Union(Bounds, StaticMeshComponentBoundsArray[i]);
     }
 
-    TArray<uint32> Codes;
-    Codes.resize(N);
     const FVector Min = Bounds.Min;
     const FVector Extent = Bounds.GetHalfExtent();
 
+    TArray<std::pair<uint32, int32>> CodeIndexPairs;
+    CodeIndexPairs.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-        const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-        const FVector Center = Bound ? Bound->GetCenter() : Component->GetWorldAABB().GetCenter();
+        const FVector Center = StaticMeshComponentBoundsArray[i].GetCenter();
 
         const auto Normalize = [](float Value, float MinValue, float ExtHalf)
             {
@@ -330,26 +493,27 @@ void FBVHierarchy::BuildLBVH()
         const uint32 Iy = static_cast<uint32>(Ny * 1023.0f);
         const uint32 Iz = static_cast<uint32>(Nz * 1023.0f);
 
-        Codes[i] = Morton3D(Ix, Iy, Iz);
+        CodeIndexPairs[i] = { Morton3D(Ix, Iy, Iz), i };
     }
 
-    TArray<std::pair<UPrimitiveComponent*, uint32>> ComponentCodePairs;
-    ComponentCodePairs.resize(N);
-    for (int i = 0; i < N; ++i)
-    {
-        ComponentCodePairs[i] = { StaticMeshComponentArray[i], Codes[i] };
-    }
-
-    std::sort(ComponentCodePairs.begin(), ComponentCodePairs.end(),
+    std::sort(CodeIndexPairs.begin(), CodeIndexPairs.end(),
         [](const auto& LHS, const auto& RHS)
         {
-            return LHS.second < RHS.second;
+            return LHS.first < RHS.first;
         });
 
+    // 컴포넌트와 바운드를 같은 모튼 순서로 재배치
+    TArray<UPrimitiveComponent*> SortedComponents;
+    TArray<FAABB> SortedBounds;
+    SortedComponents.resize(N);
+    SortedBounds.resize(N);
     for (int i = 0; i < N; ++i)
     {
-        StaticMeshComponentArray[i] = ComponentCodePairs[i].first;
+        SortedComponents[i] = StaticMeshComponentArray[CodeIndexPairs[i].second];
+        SortedBounds[i] = StaticMeshComponentBoundsArray[CodeIndexPairs[i].second];
     }
+    StaticMeshComponentArray = std::move(SortedComponents);
+    StaticMeshComponentBoundsArray = std::move(SortedBounds);
 
     Nodes.reserve(std::max(1, 2 * N));
     Nodes.clear();
@@ -363,42 +527,270 @@ int FBVHierarchy::BuildRange(int s, int e)
     FLBVHNode& node = Nodes[nodeIdx];
 
     int count = e - s;
+    node.First = s;
+    node.Span = count;
     if (count <= MaxObjects)
     {
-        node.First = s;
         node.Count = count;
-        bool bInitialized = false;
-        FAABB Accumulated;
-        for (int i = s; i < e; ++i)
+        FAABB Accumulated = StaticMeshComponentBoundsArray[s];
+        for (int i = s + 1; i < e; ++i)
         {
-            UPrimitiveComponent* Component = StaticMeshComponentArray[i];
-            if (!Component)
+            Accumulated = FAABB::Union(Accumulated, StaticMeshComponentBoundsArray[i]);
+        }
+        node.Bounds = Accumulated;
+        return nodeIdx;
+    }
+
+    int mid = (s + e) / 2;
+    int L = BuildRange(s, mid);
+    int R = BuildRange(mid, e);
+    node.Left = L; node.Right = R; node.Count = 0;
+    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
+    return nodeIdx;
+}
+
+AActor* FBVHierarchy::GetPickableOwner(int32 ComponentIndex) const
+{
+    UPrimitiveComponent* Component = StaticMeshComponentArray[ComponentIndex];
+    if (!Component)
+    {
+        return nullptr;
+    }
+    // 리빌드 전에는 배열에 이미 제거(파괴)된 컴포넌트가 남아 있을 수 있음
+    if (bPendingRebuild && !StaticMeshComponentBounds.Find(Component))
+    {
+        return nullptr;
+    }
+    AActor* Owner = Component->GetOwner();
+    if (!Owner || Owner->GetActorHiddenInEditor())
+    {
+        return nullptr;
+    }
+    return Owner;
+}
+
+template<typename LeafHitFunc>
+int32 FBVHierarchy::TraverseRayClosest(const FRay& Ray, float& InOutBestT, LeafHitFunc&& LeafHit) const
+{
+    if (Nodes.empty())
+    {
+        return -1;
+    }
+
+    const FRaySIMD RaySIMD = MakeRaySIMD(Ray);
+    alignas(16) float EntryT[4];
+    __m128 Entry;
+
+    const FAABB* RootBoxes[4] = { &Nodes[0].Bounds, &Nodes[0].Bounds, &Nodes[0].Bounds, &Nodes[0].Bounds };
+    if (!(IntersectRayAABBs_4(RaySIMD, RootBoxes, _mm_set1_ps(InOutBestT + RayPruneEpsilon), Entry) & 1u))
+    {
+        return -1;
+    }
+
+    struct FStackEntry
+    {
+        int32 NodeIndex;
+        float EntryT;
+    };
+    FStackEntry Stack[MaxRayStackDepth];
+    int32 StackSize = 0;
+
+    int32 BestIndex = -1;
+    int32 NodeIndex = 0;
+    while (true)
+    {
+        const FLBVHNode& Node = Nodes[NodeIndex];
+        if (Node.IsLeaf())
+        {
+            // 리프 컴포넌트 박스는 4개씩 판정
+            for (int32 Base = 0; Base < Node.Count; Base += 4)
             {
-                continue;
+                const int32 NumLanes = std::min(4, Node.Count - Base);
+                const FAABB* Boxes[4];
+                for (int32 Lane = 0; Lane < 4; ++Lane)
+                {
+                    Boxes[Lane] = &StaticMeshComponentBoundsArray[Node.First + Base + (Lane < NumLanes ? Lane : NumLanes - 1)];
+                }
+
+                uint32 HitMask = IntersectRayAABBs_4(RaySIMD, Boxes, _mm_set1_ps(InOutBestT + RayPruneEpsilon), Entry);
+                HitMask &= (1u << NumLanes) - 1u;
+                _mm_store_ps(EntryT, Entry);
+
+                for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+                {
+                    // 같은 묶음 안에서 앞 레인이 최선을 갱신했을 수 있으므로 다시 비교
+                    if (!(HitMask & (1u << Lane)) || EntryT[Lane] > InOutBestT + RayPruneEpsilon)
+                    {
+                        continue;
+                    }
+
+                    const int32 ComponentIndex = Node.First + Base + Lane;
+                    float HitT;
+                    if (LeafHit(ComponentIndex, Ray, EntryT[Lane], HitT) && HitT < InOutBestT)
+                    {
+                        InOutBestT = HitT;
+                        BestIndex = ComponentIndex;
+                    }
+                }
             }
+        }
+        else
+        {
+            // 두 자식 박스를 한 번에 판정 (레인 0 = 왼쪽, 1 = 오른쪽)
+            const FAABB* Boxes[4] = { &Nodes[Node.Left].Bounds, &Nodes[Node.Right].Bounds, &Nodes[Node.Left].Bounds, &Nodes[Node.Right].Bounds };
+            const uint32 HitMask = IntersectRayAABBs_4(RaySIMD, Boxes, _mm_set1_ps(InOutBestT + RayPruneEpsilon), Entry) & 3u;
+            _mm_store_ps(EntryT, Entry);
 
-            const FAABB* Bound = StaticMeshComponentBounds.Find(Component);
-            const FAABB LocalBound = Bound ? *Bound : Component->GetWorldAABB();
-            if (!bInitialized)
+            if (HitMask == 3u)
             {
-                Accumulated = LocalBound;
-                bInitialized = true;
+                // 가까운 자식부터 내려가고 먼 자식은 진입 거리와 함께 보관
+                const bool bLeftFirst = EntryT[0] <= EntryT[1];
+                Stack[StackSize++] = bLeftFirst ? FStackEntry{ Node.Right, EntryT[1] } : FStackEntry{ Node.Left, EntryT[0] };
+                NodeIndex = bLeftFirst ? Node.Left : Node.Right;
+                continue;
             }
-            else
+            if (HitMask != 0)
             {
-                Accumulated = FAABB::Union(Accumulated, LocalBound);
+                NodeIndex = (HitMask & 1u) ? Node.Left : Node.Right;
+                continue;
             }
         }
-        node.Bounds = bInitialized ? Accumulated : Bounds;
-        return nodeIdx;
+
+        // 보관한 노드 중 아직 현재 최선보다 가까울 수 있는 것만 꺼냄
+        bool bFound = false;
+        while (StackSize > 0)
+        {
+            const FStackEntry& Top = Stack[--StackSize];
+            if (Top.EntryT <= InOutBestT + RayPruneEpsilon)
+            {
+                NodeIndex = Top.NodeIndex;
+                bFound = true;
+                break;
+            }
+        }
+        if (!bFound)
+        {
+            break;
+        }
     }
 
-    int mid = (s + e) / 2;
-    int L = BuildRange(s, mid);
-    int R = BuildRange(mid, e);
-    node.Left = L; node.Right = R; node.First = -1; node.Count = 0;
-    node.Bounds = FAABB::Union(Nodes[L].Bounds, Nodes[R].Bounds);
-    return nodeIdx;
+    return BestIndex;
+}
+
+template<typename LeafHitFunc>
+void FBVHierarchy::TraverseRayPacket(const FRay* Rays, int32 NumRays, float InOutBestT[4], int32 OutIndices[4], LeafHitFunc&& LeafHit) const
+{
+    for (int32 Lane = 0; Lane < 4; ++Lane)
+    {
+        OutIndices[Lane] = -1;
+    }
+    if (Nodes.empty() || NumRays <= 0)
+    {
+        return;
+    }
+
+    const FRaySIMD Packet = MakeRayPacket(Rays, NumRays);
+
+    // 레인별 탐색 상한 (빈 레인은 음수라 어떤 박스와도 겹치지 않음)
+    alignas(16) float LaneMaxT[4];
+    for (int32 Lane = 0; Lane < 4; ++Lane)
+    {
+        LaneMaxT[Lane] = Lane < NumRays ? InOutBestT[Lane] + RayPruneEpsilon : -1.0f;
+    }
+    __m128 MaxT = _mm_load_ps(LaneMaxT);
+
+    alignas(16) float EntryT[4];
+    __m128 Entry;
+
+    if (IntersectRayPacketAABB(Packet, Nodes[0].Bounds, MaxT, Entry) == 0)
+    {
+        return;
+    }
+
+    // 먼 자식은 꺼낼 때 (레인별 최선이 줄었을 수 있으므로) 다시 판정
+    int32 Stack[MaxRayStackDepth];
+    int32 StackSize = 0;
+
+    // 패킷 안에서 박스에 가장 먼저 들어가는 레이의 진입 거리
+    const auto NearestEntry = [&EntryT](uint32 HitMask)
+        {
+            float Nearest = FLT_MAX;
+            for (int32 Lane = 0; Lane < 4; ++Lane)
+            {
+                if (HitMask & (1u << Lane))
+                {
+                    Nearest = std::min(Nearest, EntryT[Lane]);
+                }
+            }
+            return Nearest;
+        };
+
+    int32 NodeIndex = 0;
+    while (true)
+    {
+        const FLBVHNode& Node = Nodes[NodeIndex];
+        if (Node.IsLeaf())
+        {
+            for (int32 i = 0; i < Node.Count; ++i)
+            {
+                const int32 ComponentIndex = Node.First + i;
+                const uint32 HitMask = IntersectRayPacketAABB(Packet, StaticMeshComponentBoundsArray[ComponentIndex], MaxT, Entry);
+                if (HitMask == 0)
+                {
+                    continue;
+                }
+                _mm_store_ps(EntryT, Entry);
+
+                for (int32 Lane = 0; Lane < NumRays; ++Lane)
+                {
+                    float HitT;
+                    if ((HitMask & (1u << Lane)) && LeafHit(ComponentIndex, Rays[Lane], EntryT[Lane], HitT) && HitT < InOutBestT[Lane])
+                    {
+                        InOutBestT[Lane] = HitT;
+                        OutIndices[Lane] = ComponentIndex;
+                        LaneMaxT[Lane] = HitT + RayPruneEpsilon;
+                        MaxT = _mm_load_ps(LaneMaxT);
+                    }
+                }
+            }
+        }
+        else
+        {
+            const uint32 LeftMask = IntersectRayPacketAABB(Packet, Nodes[Node.Left].Bounds, MaxT, Entry);
+            const float LeftEntry = LeftMask ? (_mm_store_ps(EntryT, Entry), NearestEntry(LeftMask)) : FLT_MAX;
+            const uint32 RightMask = IntersectRayPacketAABB(Packet, Nodes[Node.Right].Bounds, MaxT, Entry);
+            const float RightEntry = RightMask ? (_mm_store_ps(EntryT, Entry), NearestEntry(RightMask)) : FLT_MAX;
+
+            if (LeftMask && RightMask)
+            {
+                const bool bLeftFirst = LeftEntry <= RightEntry;
+                Stack[StackSize++] = bLeftFirst ? Node.Right : Node.Left;
+                NodeIndex = bLeftFirst ? Node.Left : Node.Right;
+                continue;
+            }
+            if (LeftMask || RightMask)
+            {
+                NodeIndex = LeftMask ? Node.Left : Node.Right;
+                continue;
+            }
+        }
+
+        bool bFound = false;
+        while (StackSize > 0)
+        {
+            const int32 Candidate = Stack[--StackSize];
+            if (IntersectRayPacketAABB(Packet, Nodes[Candidate].Bounds, MaxT, Entry) != 0)
+            {
+                NodeIndex = Candidate;
+                bFound = true;
+                break;
+            }
+        }
+        if (!bFound)
+        {
+            break;
+        }
+    }
 }
 
 void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
@@ -410,87 +802,249 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
         OutBestT = std::numeric_limits<float>::infinity();
     }
 
-    if (Nodes.empty()) return;
+    const int32 HitIndex = TraverseRayClosest(Ray, OutBestT,
+        [this](int32 ComponentIndex, const FRay& InRay, float, float& OutT)
+        {
+            AActor* Owner = GetPickableOwner(ComponentIndex);
+            return Owner && CPickingSystem::CheckActorPicking(Owner, InRay, OutT);
+        });
 
-    float tminRoot, tmaxRoot;
-    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+    if (HitIndex >= 0)
+    {
+        OutActor = StaticMeshComponentArray[HitIndex]->GetOwner();
+    }
+}
 
-    struct HeapItem
+void FBVHierarchy::QueryRaysClosest(const TArray<FRay>& Rays, float MaxDistance, TArray<AActor*>& OutActors, TArray<float>& OutHitT) const
+{
+    if (!(std::isfinite(MaxDistance) && MaxDistance > 0.0f))
     {
-        int Idx;
-        float TMin;
-        bool operator<(const HeapItem& other) const { return TMin > other.TMin; } // min-heap behavior
-    };
+        MaxDistance = std::numeric_limits<float>::infinity();
+    }
+
+    const int32 NumRays = Rays.Num();
+    OutActors.assign(NumRays, nullptr);
+    OutHitT.assign(NumRays, MaxDistance);
 
-    std::priority_queue<HeapItem> heap;
-    heap.push({ 0, tminRoot });
+    const auto LeafHit = [this](int32 ComponentIndex, const FRay& InRay, float, float& OutT)
+        {
+            AActor* Owner = GetPickableOwner(ComponentIndex);
+            return Owner && CPickingSystem::CheckActorPicking(Owner, InRay, OutT);
+        };
 
-    const float Epsilon = 1e-3f;
-    bool isPick = false;
-    while (!heap.empty())
+    for (int32 Base = 0; Base < NumRays; Base += 4)
     {
-        HeapItem entry = heap.top();
-        heap.pop();
+        const int32 NumLanes = std::min(4, NumRays - Base);
+        float BestT[4] = { MaxDistance, MaxDistance, MaxDistance, MaxDistance };
+        int32 HitIndices[4];
+        TraverseRayPacket(&Rays[Base], NumLanes, BestT, HitIndices, LeafHit);
 
-        if (OutActor && entry.TMin > OutBestT + Epsilon)
-            break;
+        for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            if (HitIndices[Lane] >= 0)
+            {
+                OutActors[Base + Lane] = StaticMeshComponentArray[HitIndices[Lane]]->GetOwner();
+                OutHitT[Base + Lane] = BestT[Lane];
+            }
+        }
+    }
+}
+
+void FBVHierarchy::RunRayBenchmark(int32 NumObjects, int32 NumRays)
+{
+    NumObjects = std::max(1, NumObjects);
+    NumRays = std::max(4, NumRays & ~3);
+
+    // 고정 시드로 재현 가능한 장면: 한 변 1000인 공간에 크기 0.5 ~ 8 인 박스를 흩뿌림
+    std::mt19937 Random(12345);
+    std::uniform_real_distribution<float> Position(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> Size(0.25f, 4.0f);
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+
+    FBVHierarchy Tree(FAABB(), 0, 12, 8);
+    Tree.StaticMeshComponentArray.assign(NumObjects, nullptr);
+    Tree.StaticMeshComponentBoundsArray.resize(NumObjects);
+    for (FAABB& Box : Tree.StaticMeshComponentBoundsArray)
+    {
+        const FVector Center(Position(Random), Position(Random), Position(Random));
+        const FVector HalfSize(Size(Random), Size(Random), Size(Random));
+        Box = FAABB(Center - HalfSize, Center + HalfSize);
+    }
+    Tree.BuildNodesFromArrays();
+
+    // 무작위 레이 (서로 관련 없는 방향) / 부채꼴 레이 (한 점에서 인접한 방향, 시야 검사 형태)
+    TArray<FRay> RandomRays;
+    TArray<FRay> FanRays;
+    RandomRays.resize(NumRays);
+    FanRays.resize(NumRays);
+    for (FRay& Ray : RandomRays)
+    {
+        Ray.Origin = FVector(Position(Random), Position(Random), Position(Random));
+        Ray.Direction = FVector(Unit(Random), Unit(Random), Unit(Random)).GetSafeNormal();
+        if (Ray.Direction.SizeSquared() == 0.0f)
+        {
+            Ray.Direction = FVector(1.0f, 0.0f, 0.0f);
+        }
+    }
+    const int32 FanWidth = static_cast<int32>(std::sqrt(static_cast<float>(NumRays)));
+    for (int32 i = 0; i < NumRays; ++i)
+    {
+        const float Yaw = (static_cast<float>(i % FanWidth) / FanWidth - 0.5f) * 1.5f;
+        const float Pitch = (static_cast<float>(i / FanWidth) / (NumRays / FanWidth + 1) - 0.5f) * 1.0f;
+        FanRays[i].Origin = FVector(-600.0f, 0.0f, 0.0f);
+        FanRays[i].Direction = FVector(std::cos(Pitch) * std::cos(Yaw), std::cos(Pitch) * std::sin(Yaw), std::sin(Pitch)).GetSafeNormal();
+    }
 
-        const FLBVHNode& node = Nodes[entry.Idx];
-        if (node.IsLeaf())
+    // 좁은 단계 대신 박스 진입 거리를 히트로 사용 (순회 비용만 비교)
+    const auto BoxLeafHit = [](int32, const FRay&, float EntryT, float& OutT)
         {
-            for (int i = 0; i < node.Count; ++i)
+            OutT = EntryT;
+            return true;
+        };
+
+    // 이전 방식: 쿼리마다 priority_queue를 만들고 자식 박스를 하나씩 판정
+    const auto LegacyQuery = [&Tree](const FRay& Ray, float& OutBestT)
+        {
+            struct FHeapItem
+            {
+                int32 Index;
+                float TMin;
+                bool operator<(const FHeapItem& Other) const { return TMin > Other.TMin; }
+            };
+
+            int32 BestIndex = -1;
+            float TMin, TMax;
+            if (!RayAABB_IntersectT(Ray, Tree.Nodes[0].Bounds, TMin, TMax))
             {
-                UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component) continue;
-                AActor* Owner = Component->GetOwner();
-                if (!Owner) continue;
-                if (Owner->GetActorHiddenInEditor()) continue;
+                return BestIndex;
+            }
 
-                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
+            std::priority_queue<FHeapItem> Heap;
+            Heap.push({ 0, TMin });
+            while (!Heap.empty())
+            {
+                const FHeapItem Item = Heap.top();
+                Heap.pop();
+                if (BestIndex >= 0 && Item.TMin > OutBestT + RayPruneEpsilon)
+                {
+                    break;
+                }
 
-                float tmin, tmax;
-                if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
-                    continue;
-                if (OutActor && tmin > OutBestT + Epsilon)
+                const FLBVHNode& Node = Tree.Nodes[Item.Index];
+                if (Node.IsLeaf())
+                {
+                    for (int32 i = Node.First; i < Node.First + Node.Count; ++i)
+                    {
+                        if (RayAABB_IntersectT(Ray, Tree.StaticMeshComponentBoundsArray[i], TMin, TMax) && TMax >= 0.0f && TMin < OutBestT)
+                        {
+                            OutBestT = TMin;
+                            BestIndex = i;
+                        }
+                    }
                     continue;
+                }
 
-                float hitDistance;
-                if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
+                for (const int32 Child : { Node.Left, Node.Right })
                 {
-                    if (hitDistance < OutBestT)
+                    if (RayAABB_IntersectT(Ray, Tree.Nodes[Child].Bounds, TMin, TMax) && (BestIndex < 0 || TMin <= OutBestT + RayPruneEpsilon))
                     {
-                        OutBestT = hitDistance;
-                        OutActor = Owner;
-                        isPick = true;
+                        Heap.push({ Child, TMin });
                     }
                 }
             }
-            continue;
-        }
-        if (isPick == true)
+            return BestIndex;
+        };
+
+    struct FResult
+    {
+        double MS = 0.0;
+        int32 Hits = 0;
+        TArray<float> HitT;
+    };
+
+    const auto RunLegacy = [&](const TArray<FRay>& Rays)
         {
-            break;
-        }
-        // Internal node: push children if intersected and promising
-        if (node.Left >= 0)
+            FResult Result;
+            Result.HitT.resize(Rays.Num());
+            const uint64 Start = FWindowsPlatformTime::Cycles64();
+            for (int32 i = 0; i < Rays.Num(); ++i)
+            {
+                float BestT = std::numeric_limits<float>::infinity();
+                Result.Hits += LegacyQuery(Rays[i], BestT) >= 0 ? 1 : 0;
+                Result.HitT[i] = BestT;
+            }
+            Result.MS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+            return Result;
+        };
+
+    const auto RunStack = [&](const TArray<FRay>& Rays)
         {
-            float tminL, tmaxL;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL))
+            FResult Result;
+            Result.HitT.resize(Rays.Num());
+            const uint64 Start = FWindowsPlatformTime::Cycles64();
+            for (int32 i = 0; i < Rays.Num(); ++i)
             {
-                if (!OutActor || tminL <= OutBestT + Epsilon)
-                    heap.push({ node.Left, tminL });
+                float BestT = std::numeric_limits<float>::infinity();
+                Result.Hits += Tree.TraverseRayClosest(Rays[i], BestT, BoxLeafHit) >= 0 ? 1 : 0;
+                Result.HitT[i] = BestT;
             }
-        }
-        if (node.Right >= 0)
+            Result.MS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+            return Result;
+        };
+
+    const auto RunPacket = [&](const TArray<FRay>& Rays)
         {
-            float tminR, tmaxR;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR))
+            FResult Result;
+            Result.HitT.resize(Rays.Num());
+            const uint64 Start = FWindowsPlatformTime::Cycles64();
+            for (int32 Base = 0; Base < Rays.Num(); Base += 4)
             {
-                if (!OutActor || tminR <= OutBestT + Epsilon)
-                    heap.push({ node.Right, tminR });
+                float BestT[4];
+                int32 HitIndices[4];
+                std::fill(BestT, BestT + 4, std::numeric_limits<float>::infinity());
+                Tree.TraverseRayPacket(&Rays[Base], 4, BestT, HitIndices, BoxLeafHit);
+                for (int32 Lane = 0; Lane < 4; ++Lane)
+                {
+                    Result.Hits += HitIndices[Lane] >= 0 ? 1 : 0;
+                    Result.HitT[Base + Lane] = BestT[Lane];
+                }
             }
-        }
+            Result.MS = FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - Start);
+            return Result;
+        };
+
+    const auto CountMismatches = [](const FResult& A, const FResult& B)
+        {
+            int32 Mismatches = 0;
+            for (int32 i = 0; i < A.HitT.Num(); ++i)
+            {
+                const bool bBothMiss = std::isinf(A.HitT[i]) && std::isinf(B.HitT[i]);
+                if (!bBothMiss && std::abs(A.HitT[i] - B.HitT[i]) > 1e-3f)
+                {
+                    ++Mismatches;
+                }
+            }
+            return Mismatches;
+        };
+
+    const auto MRaysPerSecond = [NumRays](double MS)
+        {
+            return MS > 0.0 ? NumRays / (MS * 1000.0) : 0.0;
+        };
+
+    UE_LOG("BVH Ray Benchmark: %d objects, %d nodes, %d rays", NumObjects, Tree.TotalNodeCount(), NumRays);
+    const struct { const char* Name; const TArray<FRay>* Rays; } Scenes[] = { { "Random", &RandomRays }, { "Fan", &FanRays } };
+    for (const auto& Scene : Scenes)
+    {
+        const FResult Legacy = RunLegacy(*Scene.Rays);
+        const FResult Stack = RunStack(*Scene.Rays);
+        const FResult Packet = RunPacket(*Scene.Rays);
+
+        UE_LOG("  [%s] hits %d", Scene.Name, Legacy.Hits);
+        UE_LOG("    priority_queue : %.3f ms (%.2f Mrays/s)", Legacy.MS, MRaysPerSecond(Legacy.MS));
+        UE_LOG("    Stack + SSE    : %.3f ms (%.2f Mrays/s, x%.2f)", Stack.MS, MRaysPerSecond(Stack.MS), Stack.MS > 0.0 ? Legacy.MS / Stack.MS : 0.0);
+        UE_LOG("    Packet x4      : %.3f ms (%.2f Mrays/s, x%.2f)", Packet.MS, MRaysPerSecond(Packet.MS), Packet.MS > 0.0 ? Legacy.MS / Packet.MS : 0.0);
+        UE_LOG("    Mismatches     : stack %d, packet %d", CountMismatches(Legacy, Stack), CountMismatches(Legacy, Packet));
     }
 }
 
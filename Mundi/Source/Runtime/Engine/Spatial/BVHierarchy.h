@@ -32,8 +32,26 @@ public:
 
     void FlushRebuild();
 
+    /**
+     * @brief 레이와 가장 가까운 액터를 찾습니다. (힙 할당 없이 고정 크기 스택으로 가까운 자식부터 순회)
+     * @param OutBestT 입력이 양의 유한값이면 탐색 거리 상한, 출력은 히트 거리 (레이 방향은 정규화되어 있어야 함)
+     */
     void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
-    void QueryFrustum(const FFrustum& InFrustum);
+    /**
+     * @brief 여러 레이를 4개씩 묶어(패킷) 트리 순회를 공유하며 각각 가장 가까운 액터를 찾습니다.
+     * 한 점에서 부채꼴로 쏘는 시야 검사처럼 인접한 레이끼리 방향이 비슷할수록 빠릅니다.
+     * @param MaxDistance 모든 레이의 탐색 거리 상한
+     * @param OutActors 레이별 히트 액터 (없으면 nullptr)
+     * @param OutHitT 레이별 히트 거리 (히트가 없으면 MaxDistance)
+     */
+    void QueryRaysClosest(const TArray<FRay>& Rays, float MaxDistance, TArray<AActor*>& OutActors, TArray<float>& OutHitT) const;
+    /**
+     * @brief 절두체와 겹치는 컴포넌트를 수집합니다. (노드/리프 박스를 SSE로 4개씩 판정)
+     * @param InFrustum 판정할 절두체
+     * @param OutComponents 보이는 컴포넌트 (완전히 안쪽인 서브트리는 개별 판정 없이 통째로 추가)
+     * @return 리빌드 대기 중이라 노드 바운드를 믿을 수 없으면 false (호출자는 컬링을 생략해야 함)
+     */
+    bool QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
@@ -47,6 +65,18 @@ public:
     void DebugDump() const;
     const FAABB& GetBounds() const { return Bounds; }
 
+    /**
+     * @brief 캐시된 바운드의 세대 번호 (BVH 인스턴스와 Clear마다 고유)
+     * 컴포넌트의 GetPartitionBoundsEpoch()가 이 값과 같으면 BVH가 그 컴포넌트의 현재 바운드를 갖고 있음
+     */
+    uint32 GetEpoch() const { return Epoch; }
+
+    /**
+     * 레이 쿼리 벤치마크 (합성 박스 장면, priority_queue 순회 / 스택 순회 / 4-레이 패킷)
+     * 좁은 단계(CheckActorPicking) 대신 박스 진입 거리를 히트로 써서 순회 비용만 잽니다.
+     */
+    static void RunRayBenchmark(int32 NumObjects = 100000, int32 NumRays = 50000);
+
     // 프러스텀 기준으로 오클루더(내부노드 AABB) / 오클루디(리프의 액터들) 수집
     // VP는 행벡터 기준(네 컨벤션): p' = p * VP
 
@@ -59,9 +89,29 @@ private:
         int32 Right = -1;
         int32 First = -1;
         int32 Count = 0;
+        int32 Span = 0;   // 서브트리가 덮는 컴포넌트 배열 구간 [First, First + Span)
         bool IsLeaf() const { return Count > 0; }
     };
     void BuildLBVH();
+    /** StaticMeshComponentArray / StaticMeshComponentBoundsArray를 모튼 순서로 정렬하고 노드를 만듦 */
+    void BuildNodesFromArrays();
+
+    // BuildRange는 절반씩 나누므로 깊이가 log2(N)을 넘지 않음 (32비트 개수에서 64칸이면 충분)
+    static constexpr int32 MaxRayStackDepth = 64;
+
+    /**
+     * @brief 레이 하나의 가장 가까운 히트를 찾는 순회 (LeafHit: 박스를 통과한 컴포넌트의 좁은 단계 판정)
+     * @return 히트한 컴포넌트의 배열 인덱스 (없으면 -1)
+     */
+    template<typename LeafHitFunc>
+    int32 TraverseRayClosest(const FRay& Ray, float& InOutBestT, LeafHitFunc&& LeafHit) const;
+
+    /** 레이 최대 4개를 한 번에 순회 (레인마다 InOutBestT / OutIndices 갱신) */
+    template<typename LeafHitFunc>
+    void TraverseRayPacket(const FRay* Rays, int32 NumRays, float InOutBestT[4], int32 OutIndices[4], LeafHitFunc&& LeafHit) const;
+
+    /** 레이 쿼리에서 좁은 단계를 시도할 컴포넌트인지 (숨김 / 제거 대기 제외) */
+    AActor* GetPickableOwner(int32 ComponentIndex) const;
 
 private:
     template<typename BoundType, typename NodeIntersectFunc, typename ComponentIntersectFunc>
@@ -78,9 +128,13 @@ private:
 
     TMap<UPrimitiveComponent*, FAABB> StaticMeshComponentBounds;
     TArray<UPrimitiveComponent*> StaticMeshComponentArray;
+    TArray<FAABB> StaticMeshComponentBoundsArray; // StaticMeshComponentArray와 같은 순서의 바운드 (쿼리 시 맵 조회 생략)
 
     // LBVH nodes
     TArray<FLBVHNode> Nodes;
 
     bool bPendingRebuild = false;
+
+    uint32 Epoch = 0;
+    static uint32 NextEpoch;
 };
@@ -1,333 +1,409 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include "JobSystem.h"
+
+namespace
+{
+	// 이 깊이를 넘으면 SAH 대신 개수 절반 분할 (순회 스택 64칸 안에 들어가도록 깊이를 제한)
+	constexpr uint32 MaxSAHDepth = 32;
+	constexpr int32 MaxTraversalStack = 64;
+
+	// SAH 비용: 삼각형 교차 1회 대비 노드 순회 비용
+	constexpr float TraversalCost = 1.0f;
+
+	inline float HalfSurfaceArea(const FVector& Min, const FVector& Max)
+	{
+		const float DX = Max.X - Min.X;
+		const float DY = Max.Y - Min.Y;
+		const float DZ = Max.Z - Min.Z;
+		return DX * DY + DY * DZ + DZ * DX;
+	}
+
+	inline void GrowBounds(FVector& Min, FVector& Max, const FVector& InMin, const FVector& InMax)
+	{
+		Min.X = std::min(Min.X, InMin.X); Min.Y = std::min(Min.Y, InMin.Y); Min.Z = std::min(Min.Z, InMin.Z);
+		Max.X = std::max(Max.X, InMax.X); Max.Y = std::max(Max.Y, InMax.Y); Max.Z = std::max(Max.Z, InMax.Z);
+	}
+
+	// 슬랩 테스트: [0, MaxT] 구간에서 노드 박스에 들어가는 거리
+	inline bool IntersectNode(const FMeshBVHNode& Node, const FVector& Origin, const FVector& InvDir, float MaxT, float& OutEntry)
+	{
+		const float TX0 = (Node.BoundsMin.X - Origin.X) * InvDir.X;
+		const float TX1 = (Node.BoundsMax.X - Origin.X) * InvDir.X;
+		const float TY0 = (Node.BoundsMin.Y - Origin.Y) * InvDir.Y;
+		const float TY1 = (Node.BoundsMax.Y - Origin.Y) * InvDir.Y;
+		const float TZ0 = (Node.BoundsMin.Z - Origin.Z) * InvDir.Z;
+		const float TZ1 = (Node.BoundsMax.Z - Origin.Z) * InvDir.Z;
+
+		const float Entry = std::max(std::max(std::min(TX0, TX1), std::min(TY0, TY1)), std::max(std::min(TZ0, TZ1), 0.0f));
+		const float Exit = std::min(std::min(std::max(TX0, TX1), std::max(TY0, TY1)), std::min(std::max(TZ0, TZ1), MaxT));
+		OutEntry = Entry;
+		return Entry <= Exit;
+	}
+
+	// Möller–Trumbore (IntersectRayTriangleMT와 같은 허용 오차, 변은 미리 계산됨)
+	inline bool IntersectTriangle(const FRay& Ray, const FMeshBVHTriangle& Tri, float& OutT)
+	{
+		const float Epsilon = KINDA_SMALL_NUMBER;
+
+		const FVector Perpendicular = FVector::Cross(Ray.Direction, Tri.Edge2);
+		const float Determinant = FVector::Dot(Tri.Edge1, Perpendicular);
+		if (Determinant > -Epsilon && Determinant < Epsilon)
+		{
+			return false;
+		}
+
+		const float InvDeterminant = 1.0f / Determinant;
+		const FVector OriginToV0 = Ray.Origin - Tri.V0;
+		const float U = InvDeterminant * FVector::Dot(OriginToV0, Perpendicular);
+		if (U < -Epsilon || U > 1.0f + Epsilon)
+		{
+			return false;
+		}
+
+		const FVector CrossQ = FVector::Cross(OriginToV0, Tri.Edge1);
+		const float V = InvDeterminant * FVector::Dot(Ray.Direction, CrossQ);
+		if (V < -Epsilon || (U + V) > 1.0f + Epsilon)
+		{
+			return false;
+		}
+
+		OutT = InvDeterminant * FVector::Dot(Tri.Edge2, CrossQ);
+		return OutT > Epsilon;
+	}
+}
 
 void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
 {
-	TriIndices.Empty();
 	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
-	if (TriCount == 0) return;
+	Triangles.Empty();
 
-	TriIndices.Reserve(TriCount);
-	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	const int32 TriCount = Indices.Num() / 3;
+	if (TriCount == 0)
+	{
+		return;
+	}
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
+	// 삼각형별 바운드 / 중심 (SAH 비닝에서 반복해서 읽으므로 한 번만 계산)
+	BuildTriangles.resize(TriCount);
+	BuildOrder.resize(TriCount);
+	FJobSystem::ParallelFor(TriCount, 4096, [&](int32 Tri)
+	{
+		const FVector& A = Vertices[Indices[Tri * 3 + 0]].pos;
+		const FVector& B = Vertices[Indices[Tri * 3 + 1]].pos;
+		const FVector& C = Vertices[Indices[Tri * 3 + 2]].pos;
+
+		FBuildTriangle& Build = BuildTriangles[Tri];
+		Build.BoundsMin = FVector(std::min({ A.X, B.X, C.X }), std::min({ A.Y, B.Y, C.Y }), std::min({ A.Z, B.Z, C.Z }));
+		Build.BoundsMax = FVector(std::max({ A.X, B.X, C.X }), std::max({ A.Y, B.Y, C.Y }), std::max({ A.Z, B.Z, C.Z }));
+		Build.Centroid = (A + B + C) / 3.0f;
+		BuildOrder[Tri] = static_cast<uint32>(Tri);
+	});
+
+	Nodes.reserve(static_cast<size_t>(TriCount / MinLeafSize) * 2 + 1);
+	BuildSubtree(0, static_cast<uint32>(TriCount), 0, Nodes);
+
+	// 리프 순서로 삼각형 재배치 (리프 안의 삼각형이 메모리상 연속)
+	Triangles.resize(TriCount);
+	FJobSystem::ParallelFor(TriCount, 4096, [&](int32 Index)
+	{
+		const uint32 Tri = BuildOrder[Index];
+		const FVector& A = Vertices[Indices[Tri * 3 + 0]].pos;
+		const FVector& B = Vertices[Indices[Tri * 3 + 1]].pos;
+		const FVector& C = Vertices[Indices[Tri * 3 + 2]].pos;
+
+		FMeshBVHTriangle& Out = Triangles[Index];
+		Out.V0 = A;
+		Out.Edge1 = B - A;
+		Out.Edge2 = C - A;
+	});
+
+	Nodes.shrink_to_fit();
+	BuildTriangles.Empty();
+	BuildTriangles.shrink_to_fit();
+	BuildOrder.Empty();
+	BuildOrder.shrink_to_fit();
 }
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다. 
-// Möller–Trumbore로 교차 체크 ! 
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
+void FMeshBVH::BuildSubtree(uint32 Start, uint32 Count, uint32 Depth, TArray<FMeshBVHNode>& OutNodes)
 {
-	if (Nodes.Num() == 0)
+	FMeshBVHNode Node;
+	Node.BoundsMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+	Node.BoundsMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (uint32 i = Start; i < Start + Count; ++i)
 	{
-		return false;
+		const FBuildTriangle& Tri = BuildTriangles[BuildOrder[i]];
+		GrowBounds(Node.BoundsMin, Node.BoundsMax, Tri.BoundsMin, Tri.BoundsMax);
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	const int32 NodeIndex = OutNodes.Num();
+	OutNodes.Add(Node);
+
+	uint32 LeftCount = 0;
+	if (Count <= MinLeafSize || !SplitRange(Start, Count, Depth, Node.BoundsMin, Node.BoundsMax, LeftCount))
 	{
-		return false;
+		OutNodes[NodeIndex].Offset = Start;
+		OutNodes[NodeIndex].Count = Count;
+		return;
 	}
 
-	struct FHeapItem
+	const uint32 RightStart = Start + LeftCount;
+	const uint32 RightCount = Count - LeftCount;
+
+	if (Count >= ParallelBuildThreshold && FJobSystem::GetNumWorkers() > 0)
 	{
-		int NodeIndex;
-		float EntryDistance;
+		// 두 서브트리는 BuildOrder의 겹치지 않는 구간만 건드리므로 따로 만든 뒤 순서대로 이어 붙임
+		TArray<FMeshBVHNode> LeftNodes;
+		TArray<FMeshBVHNode> RightNodes;
+		FJobHandle LeftJob = FJobSystem::Dispatch([this, Start, LeftCount, Depth, &LeftNodes]()
+		{
+			BuildSubtree(Start, LeftCount, Depth + 1, LeftNodes);
+		});
+		BuildSubtree(RightStart, RightCount, Depth + 1, RightNodes);
+		FJobSystem::Wait(LeftJob);
 
-		bool operator>(const FHeapItem& Other) const
+		auto AppendSubtree = [&OutNodes](const TArray<FMeshBVHNode>& Subtree)
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
+			const uint32 Base = static_cast<uint32>(OutNodes.Num());
+			for (FMeshBVHNode SubNode : Subtree)
+			{
+				if (!SubNode.IsLeaf())
+				{
+					SubNode.Offset += Base;
+				}
+				OutNodes.Add(SubNode);
+			}
+		};
+		AppendSubtree(LeftNodes);
+		OutNodes[NodeIndex].Offset = static_cast<uint32>(OutNodes.Num());
+		AppendSubtree(RightNodes);
+	}
+	else
+	{
+		// 깊이 우선: 왼쪽 자식은 NodeIndex + 1
+		BuildSubtree(Start, LeftCount, Depth + 1, OutNodes);
+		OutNodes[NodeIndex].Offset = static_cast<uint32>(OutNodes.Num());
+		BuildSubtree(RightStart, RightCount, Depth + 1, OutNodes);
+	}
+}
+
+bool FMeshBVH::SplitRange(uint32 Start, uint32 Count, uint32 Depth, const FVector& BoundsMin, const FVector& BoundsMax, uint32& OutLeftCount)
+{
+	const auto SplitAtMiddle = [&]()
+	{
+		if (Count <= MaxLeafSize)
+		{
+			return false;
 		}
+		OutLeftCount = Count / 2;
+		return true;
 	};
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
+	// 너무 깊어지면 개수 절반 분할로 남은 깊이를 log2(Count) 이하로 제한
+	if (Depth >= MaxSAHDepth)
+	{
+		return SplitAtMiddle();
+	}
 
-	while (!Heap.empty())
+	// 중심점 바운드 (비닝 범위)
+	FVector CentroidMin(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector CentroidMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (uint32 i = Start; i < Start + Count; ++i)
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+		const FVector& C = BuildTriangles[BuildOrder[i]].Centroid;
+		GrowBounds(CentroidMin, CentroidMax, C, C);
+	}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+	struct FBin
+	{
+		FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		uint32 Count = 0;
+	};
+
+	float BestCost = FLT_MAX;
+	int32 BestAxis = -1;
+	uint32 BestBin = 0;
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float AxisMin = CentroidMin[Axis];
+		const float Extent = CentroidMax[Axis] - AxisMin;
+		if (Extent <= 1e-8f)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
-			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+			continue;
+		}
+		const float Scale = static_cast<float>(NumBins) / Extent;
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+		FBin Bins[NumBins];
+		for (uint32 i = Start; i < Start + Count; ++i)
+		{
+			const FBuildTriangle& Tri = BuildTriangles[BuildOrder[i]];
+			const uint32 BinIndex = std::min(NumBins - 1, static_cast<uint32>((Tri.Centroid[Axis] - AxisMin) * Scale));
+			GrowBounds(Bins[BinIndex].Min, Bins[BinIndex].Max, Tri.BoundsMin, Tri.BoundsMax);
+			++Bins[BinIndex].Count;
+		}
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
-				{
-					OutHitDistance = HitT;
-					return true; // 🚀 첫 번째 히트 → 바로 종료
-				}
-			}
+		// 오른쪽부터 누적: RightArea[i] / RightCount[i] = 구간 (i, NumBins) 의 바운드 면적 / 개수
+		float RightArea[NumBins - 1];
+		uint32 RightCount[NumBins - 1];
+		FVector AccumMin(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector AccumMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		uint32 AccumCount = 0;
+		for (uint32 i = NumBins - 1; i > 0; --i)
+		{
+			GrowBounds(AccumMin, AccumMax, Bins[i].Min, Bins[i].Max);
+			AccumCount += Bins[i].Count;
+			RightArea[i - 1] = AccumCount > 0 ? HalfSurfaceArea(AccumMin, AccumMax) : 0.0f;
+			RightCount[i - 1] = AccumCount;
 		}
-		else
+
+		// 왼쪽부터 누적하면서 분할 비용 계산 (분할 위치 i: 왼쪽 = 구간 [0, i])
+		AccumMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+		AccumMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		AccumCount = 0;
+		for (uint32 i = 0; i < NumBins - 1; ++i)
 		{
-			if (Node.Left >= 0)
+			GrowBounds(AccumMin, AccumMax, Bins[i].Min, Bins[i].Max);
+			AccumCount += Bins[i].Count;
+			if (AccumCount == 0 || RightCount[i] == 0)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Left, ChildEntry });
-				}
+				continue;
 			}
-			if (Node.Right >= 0)
+
+			const float Cost = static_cast<float>(AccumCount) * HalfSurfaceArea(AccumMin, AccumMax)
+				+ static_cast<float>(RightCount[i]) * RightArea[i];
+			if (Cost < BestCost)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					Heap.push({ Node.Right, ChildEntry });
-				}
+				BestCost = Cost;
+				BestAxis = Axis;
+				BestBin = i;
 			}
 		}
 	}
 
-	return false;
-}
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
-{
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
-}
-
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
-{
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
-
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
-
-	// 중심점(무게중심) 계산
+	// 모든 중심이 한 점에 모여 있으면 비닝으로 나눌 수 없음
+	if (BestAxis < 0)
+	{
+		return SplitAtMiddle();
+	}
 
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
+	// 리프 비용(삼각형 전부 교차)보다 비싸면 분할하지 않음 (단, 리프 최대 크기는 지킴)
+	const float ParentArea = HalfSurfaceArea(BoundsMin, BoundsMax);
+	const float SplitCost = TraversalCost + (ParentArea > 0.0f ? BestCost / ParentArea : 0.0f);
+	if (Count <= MaxLeafSize && SplitCost >= static_cast<float>(Count))
+	{
+		return false;
+	}
 
-	return TriangleCenter;
-}
+	const float AxisMin = CentroidMin[BestAxis];
+	const float Scale = static_cast<float>(NumBins) / (CentroidMax[BestAxis] - AxisMin);
+	const auto Middle = std::partition(BuildOrder.begin() + Start, BuildOrder.begin() + Start + Count, [&](uint32 Tri)
+	{
+		const float Centroid = BuildTriangles[Tri].Centroid[BestAxis];
+		return std::min(NumBins - 1, static_cast<uint32>((Centroid - AxisMin) * Scale)) <= BestBin;
+	});
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
-{
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
+	OutLeftCount = static_cast<uint32>(Middle - (BuildOrder.begin() + Start));
+	if (OutLeftCount == 0 || OutLeftCount == Count)
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		return SplitAtMiddle();
 	}
-	return Bounds;
+	return true;
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+// 가까운 자식을 먼저 내려가고 먼 자식은 스택에 (진입 거리와 함께) 넣는다.
+// 이미 찾은 교차보다 먼 노드는 꺼낼 때 버린다.
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
 {
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
-
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
+	if (Nodes.IsEmpty())
+	{
+		return false;
+	}
 
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
+	const FVector& Origin = InLocalRay.Origin;
+	const FVector& Direction = InLocalRay.Direction;
+	const FVector InvDir(
+		std::fabs(Direction.X) > 1e-12f ? 1.0f / Direction.X : std::copysign(1e30f, Direction.X),
+		std::fabs(Direction.Y) > 1e-12f ? 1.0f / Direction.Y : std::copysign(1e30f, Direction.Y),
+		std::fabs(Direction.Z) > 1e-12f ? 1.0f / Direction.Z : std::copysign(1e30f, Direction.Z));
 
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
+	float ClosestT = FLT_MAX;
+	float RootEntry = 0.0f;
+	if (!IntersectNode(Nodes[0], Origin, InvDir, ClosestT, RootEntry))
 	{
-		return NodeIndex;
+		return false;
 	}
 
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
-
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
-
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
-
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
+	struct FStackEntry
+	{
+		uint32 NodeIndex;
+		float EntryDistance;
+	};
+	FStackEntry Stack[MaxTraversalStack];
+	int32 StackSize = 0;
+
+	bool bHasHit = false;
+	uint32 NodeIndex = 0;
+	while (true)
+	{
+		const FMeshBVHNode& Node = Nodes[NodeIndex];
+		if (Node.IsLeaf())
+		{
+			const FMeshBVHTriangle* Tri = &Triangles[Node.Offset];
+			for (uint32 i = 0; i < Node.Count; ++i)
+			{
+				float HitT = 0.0f;
+				if (IntersectTriangle(InLocalRay, Tri[i], HitT) && HitT < ClosestT)
+				{
+					ClosestT = HitT;
+					bHasHit = true;
+				}
+			}
+		}
+		else
 		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
+			const uint32 Left = NodeIndex + 1;
+			const uint32 Right = Node.Offset;
+			float LeftEntry = 0.0f, RightEntry = 0.0f;
+			const bool bHitLeft = IntersectNode(Nodes[Left], Origin, InvDir, ClosestT, LeftEntry);
+			const bool bHitRight = IntersectNode(Nodes[Right], Origin, InvDir, ClosestT, RightEntry);
 
-			switch (Axis)
+			if (bHitLeft && bHitRight)
 			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
+				const bool bLeftFirst = LeftEntry <= RightEntry;
+				Stack[StackSize++] = bLeftFirst ? FStackEntry{ Right, RightEntry } : FStackEntry{ Left, LeftEntry };
+				NodeIndex = bLeftFirst ? Left : Right;
+				continue;
 			}
-		});
+			if (bHitLeft || bHitRight)
+			{
+				NodeIndex = bHitLeft ? Left : Right;
+				continue;
+			}
+		}
 
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
+		// 스택에서 아직 더 가까울 수 있는 노드를 꺼냄
+		bool bFound = false;
+		while (StackSize > 0)
+		{
+			const FStackEntry& Entry = Stack[--StackSize];
+			if (Entry.EntryDistance < ClosestT)
+			{
+				NodeIndex = Entry.NodeIndex;
+				bFound = true;
+				break;
+			}
+		}
+		if (!bFound)
+		{
+			break;
+		}
+	}
 
-	return NodeIndex;
+	if (bHasHit)
+	{
+		OutHitDistance = ClosestT;
+	}
+	return bHasHit;
 }
@@ -1,47 +1,79 @@
 ﻿#pragma once
 #include "AABB.h"
 
+/**
+ * 32바이트 BVH 노드 (깊이 우선 순서로 저장)
+ * 내부 노드의 왼쪽 자식은 항상 바로 다음 인덱스이므로 오른쪽 자식 인덱스만 저장한다.
+ */
 struct FMeshBVHNode
 {
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	FVector BoundsMin;
+	uint32 Offset = 0;	// 내부 노드: 오른쪽 자식 인덱스 / 리프: 첫 삼각형 인덱스 (Triangles 배열)
+	FVector BoundsMax;
+	uint32 Count = 0;	// 리프의 삼각형 개수 (0이면 내부 노드)
 
 	bool IsLeaf() const { return Count > 0; }
 };
+static_assert(sizeof(FMeshBVHNode) == 32, "FMeshBVHNode는 32바이트여야 합니다.");
 
-struct FStackItem
+/**
+ * 교차 검사용 삼각형 (리프 순서로 재배치, Möller–Trumbore에 필요한 변을 미리 계산)
+ * 인덱스 / 정점 배열을 거치지 않고 리프의 삼각형을 연속으로 읽는다.
+ */
+struct FMeshBVHTriangle
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	FVector V0;
+	FVector Edge1;	// V1 - V0
+	FVector Edge2;	// V2 - V0
 };
+
 class FMeshBVH
 {
 public:
+	/** 이 개수 이하면 SAH 비용과 상관없이 리프로 만든다. */
+	static constexpr uint32 MinLeafSize = 2;
+	/** 리프 하나의 최대 삼각형 수 */
+	static constexpr uint32 MaxLeafSize = 8;
+	/** SAH 분할 후보 구간 수 (축마다) */
+	static constexpr uint32 NumBins = 16;
+	/** 이보다 큰 노드는 두 자식 서브트리를 잡으로 나눠 만든다. */
+	static constexpr uint32 ParallelBuildThreshold = 16384;
 
+	/** Binned SAH로 트리를 만들고 삼각형을 리프 순서로 재배치한다. (큰 메시는 FJobSystem으로 병렬 구축) */
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	/**
+	 * @brief 로컬 공간 레이와 가장 가까운 교차 거리를 구한다.
+	 * 가까운 자식부터 스택으로 순회하고, 이미 찾은 교차보다 먼 노드는 건너뛴다.
+	 */
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
 
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	int32 GetNumTriangles() const { return Triangles.Num(); }
 
 private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	// 구축 중에만 쓰는 삼각형별 바운드 / 중심
+	struct FBuildTriangle
+	{
+		FVector BoundsMin;
+		FVector BoundsMax;
+		FVector Centroid;
+	};
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	/**
+	 * @brief [Start, Start + Count) 범위의 서브트리를 깊이 우선 순서로 OutNodes 끝에 추가한다.
+	 * 리프의 Offset은 BuildOrder 안의 절대 위치, 내부 노드의 Offset은 OutNodes 안의 인덱스이다.
+	 */
+	void BuildSubtree(uint32 Start, uint32 Count, uint32 Depth, TArray<FMeshBVHNode>& OutNodes);
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	/** SAH로 분할 위치를 찾아 BuildOrder를 나눈다. 분할하지 않는 편이 싸면 false */
+	bool SplitRange(uint32 Start, uint32 Count, uint32 Depth, const FVector& BoundsMin, const FVector& BoundsMax, uint32& OutLeftCount);
 
 private:
-
 	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
-	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
-	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
-};
+	TArray<FMeshBVHTriangle> Triangles;
 
+	// 구축 임시 데이터 (Build가 끝나면 비움)
+	TArray<FBuildTriangle> BuildTriangles;
+	TArray<uint32> BuildOrder;	// 리프 순서의 원본 삼각형 번호
+};
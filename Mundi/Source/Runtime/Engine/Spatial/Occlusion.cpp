@@ -1,228 +1,499 @@
 ﻿#include "pch.h"
 #include "Occlusion.h"
-#include "Frustum.h"
+#include "VertexData.h"
+#include "PlatformTime.h"
+#include <emmintrin.h>
 
-// NDC Z가 [-1..1]인 프로젝션이면 아래 변환을 켜세요.
-// static inline float To01(float z_ndc) { return z_ndc * 0.5f + 0.5f; }
-static inline void Clamp01(float& v) { v = std::max(0.0f, std::min(1.0f, v)); }
+bool FOcclusionCullingManagerCPU::bEnabled = true;
 
-// 헬퍼: 뷰공간 Z → [0..1] 선형
-static inline float LinearizeZ01(float zView, float zNear, float zFar) {
-	// LH 기준, 카메라 앞 z가 + 방향일 때
-	float z = (zView - zNear) / (zFar - zNear);
-	return std::max(0.f, std::min(1.f, z));
-}
-
-// FBound(Min/Max) → 8코너
-static inline void MakeAabbCornersMinMax(const FAABB& B, FVector Corners[8])
+namespace
 {
-	const FVector& mn = B.Min;
-	const FVector& mx = B.Max;
-	Corners[0] = { mn.X, mn.Y, mn.Z };
-	Corners[1] = { mx.X, mn.Y, mn.Z };
-	Corners[2] = { mn.X, mx.Y, mn.Z };
-	Corners[3] = { mx.X, mx.Y, mn.Z };
-	Corners[4] = { mn.X, mn.Y, mx.Z };
-	Corners[5] = { mx.X, mn.Y, mx.Z };
-	Corners[6] = { mn.X, mx.Y, mx.Z };
-	Corners[7] = { mx.X, mx.Y, mx.Z };
-}
+	// 화면 밖으로 크게 벗어난 삼각형은 NDC [-GuardBand, GuardBand]로 잘라 float 에지 함수 정밀도를 유지
+	constexpr float GuardBand = 4.0f;
 
-bool FOcclusionCullingManagerCPU::ComputeRectAndMinZ(
-	const FCandidateDrawable& D, int /*ViewW*/, int /*ViewH*/, FOcclusionRect& OutR)
-{
-	FVector C[8];
-	MakeAabbCornersMinMax(D.Bound, C);
+	// 클리핑 후 다각형 최대 정점 수 (삼각형 3 + 평면 5개)
+	constexpr int32 MaxClipVertices = 8;
 
-	float MinX = +1e9f, MinY = +1e9f, MaxX = -1e9f, MaxY = -1e9f;
-	float MinZLin = +1e9f, MaxZLin = -1e9f; // ★ 선형 깊이(0..1)
+	// 오클루디 최소 깊이에서 빼는 바이어스 (오클루더 자신의 깊이와 같은 값이 부동소수 오차로 가려지지 않도록)
+	constexpr float OccludeeDepthBias = 1e-6f;
+
+	// 동차 좌표 평면 dot(Plane, V) >= 0 이 안쪽: Near(z >= 0), 가드 밴드 좌/우/하/상
+	inline float ClipDistance(const FVector4& V, int32 Plane)
+	{
+		switch (Plane)
+		{
+		case 0: return V.Z;
+		case 1: return GuardBand * V.W + V.X;
+		case 2: return GuardBand * V.W - V.X;
+		case 3: return GuardBand * V.W + V.Y;
+		default: return GuardBand * V.W - V.Y;
+		}
+	}
 
-	int used = 0;
-	for (int i = 0; i < 8; i++)
+	// Sutherland-Hodgman: 평면 하나로 다각형을 자른다.
+	int32 ClipPolygon(const FVector4* In, int32 NumIn, FVector4* Out, int32 Plane)
 	{
-		const float p[4] = { C[i].X, C[i].Y, C[i].Z, 1.0f };
+		int32 NumOut = 0;
+		for (int32 i = 0; i < NumIn; ++i)
+		{
+			const FVector4& A = In[i];
+			const FVector4& B = In[(i + 1) % NumIn];
+			const float DA = ClipDistance(A, Plane);
+			const float DB = ClipDistance(B, Plane);
+
+			if (DA >= 0.0f)
+			{
+				Out[NumOut++] = A;
+			}
+			if ((DA >= 0.0f) != (DB >= 0.0f))
+			{
+				const float T = DA / (DA - DB);
+				Out[NumOut++] = FVector4(
+					A.X + (B.X - A.X) * T,
+					A.Y + (B.Y - A.Y) * T,
+					A.Z + (B.Z - A.Z) * T,
+					A.W + (B.W - A.W) * T);
+			}
+		}
+		return NumOut;
+	}
 
-		// 1) 화면 사각형용: WVP → NDC
-		float c[4];
-		MulPointRow(p, D.WorldViewProj, c);
-		if (c[3] <= 0.0f) continue;
+	inline float HorizontalMax(__m128 V)
+	{
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_cvtss_f32(V);
+	}
+}
 
-		const float invW = 1.0f / c[3];
-		const float ndcX = c[0] * invW;  // -1..1
-		const float ndcY = c[1] * invW;  // -1..1
-		// const float ndcZ = c[2] * invW; // 깊이는 쓰지 않음
+// ────────────────────────────────────────────────────────────────────────────
+// FOcclusionDepthBuffer
+// ────────────────────────────────────────────────────────────────────────────
 
-		const float u = 0.5f * (ndcX + 1.0f);
-		const float v = 0.5f * (ndcY + 1.0f);
+void FOcclusionDepthBuffer::Resize(int32 InWidth, int32 InHeight)
+{
+	const int32 NewTilesX = std::max(1, (InWidth + TileSize - 1) / TileSize);
+	const int32 NewTilesY = std::max(1, (InHeight + TileSize - 1) / TileSize);
 
-		MinX = std::min(MinX, u); MinY = std::min(MinY, v);
-		MaxX = std::max(MaxX, u); MaxY = std::max(MaxY, v);
+	if (NewTilesX != TilesX || NewTilesY != TilesY)
+	{
+		TilesX = NewTilesX;
+		TilesY = NewTilesY;
+		Width = TilesX * TileSize;
+		Height = TilesY * TileSize;
+
+		Depth.resize(static_cast<size_t>(TilesX) * TilesY * TilePixels);
+		TileMaxDepth.resize(static_cast<size_t>(TilesX) * TilesY);
+		HZBLevels.Empty();
+		HZBWidths.Empty();
+		HZBHeights.Empty();
+	}
 
-		// 2) 깊이: WorldView로 뷰 공간 z → 선형 0..1
-		float v4[4];
-		MulPointRow(p, D.WorldView, v4);     // p_world * (World*View) == p_world * View (월드좌표니까 View만 와도 OK)
-		const float zView = v4[2];          // LH: +Z 앞
-		const float zLin01 = LinearizeZ01(zView, D.NearClip, D.FarClip);
+	Clear();
+}
 
-		MinZLin = std::min(MinZLin, zLin01);
-		MaxZLin = std::max(MaxZLin, zLin01);
+void FOcclusionDepthBuffer::Clear()
+{
+	std::fill(Depth.begin(), Depth.end(), 1.0f);
+	std::fill(TileMaxDepth.begin(), TileMaxDepth.end(), 1.0f);
+}
 
-		used++;
-	}
+bool FOcclusionDepthBuffer::RasterizeTriangle(const FVector4& Clip0, const FVector4& Clip1, const FVector4& Clip2)
+{
+	FVector4 PolyA[MaxClipVertices + 1] = { Clip0, Clip1, Clip2 };
+	FVector4 PolyB[MaxClipVertices + 1];
+	int32 NumVertices = 3;
+
+	// 모든 정점이 안쪽인 평면은 건너뛰고, 필요한 평면만 클리핑
+	FVector4* Src = PolyA;
+	FVector4* Dst = PolyB;
+	for (int32 Plane = 0; Plane < 5; ++Plane)
+	{
+		const bool bInside0 = ClipDistance(Clip0, Plane) >= 0.0f;
+		const bool bInside1 = ClipDistance(Clip1, Plane) >= 0.0f;
+		const bool bInside2 = ClipDistance(Clip2, Plane) >= 0.0f;
+		if (bInside0 && bInside1 && bInside2)
+		{
+			continue;
+		}
+		if (!bInside0 && !bInside1 && !bInside2)
+		{
+			return false;
+		}
 
-	if (used == 0) return false;
-	if (MaxX < 0 || MaxY < 0 || MinX > 1 || MinY > 1) return false;
+		NumVertices = ClipPolygon(Src, NumVertices, Dst, Plane);
+		if (NumVertices < 3)
+		{
+			return false;
+		}
+		std::swap(Src, Dst);
+	}
 
-	Clamp01(MinX); Clamp01(MinY); Clamp01(MaxX); Clamp01(MaxY);
-	Clamp01(MinZLin); Clamp01(MaxZLin);
+	// 화면 좌표로 변환 (X/Y: 픽셀, Y는 아래 방향 / Z: NDC 깊이)
+	FVector Screen[MaxClipVertices + 1];
+	for (int32 i = 0; i < NumVertices; ++i)
+	{
+		const float InvW = 1.0f / Src[i].W;
+		Screen[i] = FVector(
+			(Src[i].X * InvW * 0.5f + 0.5f) * static_cast<float>(Width),
+			(0.5f - Src[i].Y * InvW * 0.5f) * static_cast<float>(Height),
+			Src[i].Z * InvW);
+	}
 
-	OutR.MinX = MinX; OutR.MinY = MinY; OutR.MaxX = MaxX; OutR.MaxY = MaxY;
-	OutR.MinZ = MinZLin;   // ★ 선형 깊이
-	OutR.MaxZ = MaxZLin;
-	OutR.ActorIndex = D.ActorIndex;
-	return true;
+	// 볼록 다각형을 팬으로 분할
+	bool bRasterized = false;
+	for (int32 i = 1; i + 1 < NumVertices; ++i)
+	{
+		bRasterized |= RasterizeScreenTriangle(Screen[0], Screen[i], Screen[i + 1]);
+	}
+	return bRasterized;
 }
-void FOcclusionCullingManagerCPU::BuildOccluderDepth(
-	const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH)
+
+bool FOcclusionDepthBuffer::RasterizeScreenTriangle(const FVector& P0, const FVector& In1, const FVector& In2)
 {
-	Grid.Clear();
+	// 양면을 그리므로 면적이 양수가 되도록 정점 순서를 맞춤
+	float Area = (In1.X - P0.X) * (In2.Y - P0.Y) - (In2.X - P0.X) * (In1.Y - P0.Y);
+	if (std::fabs(Area) < 1e-6f)
+	{
+		return false;
+	}
+	const bool bFlip = Area < 0.0f;
+	const FVector& P1 = bFlip ? In2 : In1;
+	const FVector& P2 = bFlip ? In1 : In2;
+	Area = std::fabs(Area);
+
+	// 이미 더 가까운 깊이로 덮인 타일은 건너뛰기 위한 삼각형 최소 깊이
+	const float TriMinZ = std::min(P0.Z, std::min(P1.Z, P2.Z));
+	const float TriMaxZ = std::min(1.0f, std::max(P0.Z, std::max(P1.Z, P2.Z)));
+	if (TriMinZ >= 1.0f)
+	{
+		return false;
+	}
 
-	const int GW = Grid.GetWidth();
-	const int GH = Grid.GetHeight();
+	// 픽셀 전체 [x, x + 1]가 바운드 안에 들어오는 범위 (일부만 덮이는 픽셀은 기록하지 않음)
+	const int32 MinPX = std::max(0, static_cast<int32>(std::ceil(std::min(P0.X, std::min(P1.X, P2.X)))));
+	const int32 MinPY = std::max(0, static_cast<int32>(std::ceil(std::min(P0.Y, std::min(P1.Y, P2.Y)))));
+	const int32 MaxPX = std::min(Width - 1, static_cast<int32>(std::floor(std::max(P0.X, std::max(P1.X, P2.X)))) - 1);
+	const int32 MaxPY = std::min(Height - 1, static_cast<int32>(std::floor(std::max(P0.Y, std::max(P1.Y, P2.Y)))) - 1);
+	if (MinPX > MaxPX || MinPY > MaxPY)
+	{
+		return false;
+	}
 
-	// --- 튜닝 파라미터 ---
-	const float ErodeScale = 0.5f;     // 0.5배 축소
-	const int   Dilate = 1;        // 경계 1px 팽창
-	const int   MinPxEdge = 8;        // 너무 작은 사각형은 erosion 스킵
-	const float MaxCover = 0.6f;     // 화면의 60% 이상 덮으면 erosion 스킵
+	// 에지 함수 E(x, y) = A * x + B * y + C (세 값이 모두 0 이상이면 안쪽)
+	// 안쪽 보수적 래스터화: 픽셀 중심에서 반 픽셀 사각형의 가장 불리한 꼭짓점까지의 변화량
+	// 0.5 * (|A| + |B|)를 C에서 빼 두면, 중심에서 E >= 0인 픽셀은 픽셀 전체가 삼각형 안에 있다.
+	// 일부만 가리는 픽셀에 오클루더 깊이를 쓰면 틈이나 실루엣 바로 뒤의 물체가 컬링되기 때문
+	const FVector* Verts[3] = { &P0, &P1, &P2 };
+	float EdgeA[3], EdgeB[3], EdgeC[3];
+	for (int32 e = 0; e < 3; ++e)
+	{
+		const FVector& A = *Verts[e];
+		const FVector& B = *Verts[(e + 1) % 3];
+		EdgeA[e] = A.Y - B.Y;
+		EdgeB[e] = B.X - A.X;
+		EdgeC[e] = -(EdgeA[e] * A.X + EdgeB[e] * A.Y) - 0.5f * (std::fabs(EdgeA[e]) + std::fabs(EdgeB[e]));
+	}
 
-	for (const auto& D : Occluders)
+	// 깊이 평면 z(x, y) = ZA * x + ZB * y + ZC
+	// 픽셀 중심 값에 반 픽셀 기울기를 더해 픽셀 안에서 가장 먼 깊이를 기록 (오클루더를 실제보다 가깝게 만들지 않음)
+	const float InvArea = 1.0f / Area;
+	const float ZA = ((P1.Z - P0.Z) * (P2.Y - P0.Y) - (P2.Z - P0.Z) * (P1.Y - P0.Y)) * InvArea;
+	const float ZB = ((P2.Z - P0.Z) * (P1.X - P0.X) - (P1.Z - P0.Z) * (P2.X - P0.X)) * InvArea;
+	const float ZC = P0.Z - ZA * P0.X - ZB * P0.Y + 0.5f * (std::fabs(ZA) + std::fabs(ZB));
+
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 ColumnOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const __m128 TriMaxZ4 = _mm_set1_ps(TriMaxZ);
+	const __m128 A0 = _mm_set1_ps(EdgeA[0]), A1 = _mm_set1_ps(EdgeA[1]), A2 = _mm_set1_ps(EdgeA[2]);
+	const __m128 ZA4 = _mm_set1_ps(ZA);
+
+	bool bTouched = false;
+	const int32 MinTX = MinPX / TileSize, MaxTX = MaxPX / TileSize;
+	const int32 MinTY = MinPY / TileSize, MaxTY = MaxPY / TileSize;
+	for (int32 TY = MinTY; TY <= MaxTY; ++TY)
 	{
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
-			continue;
+		const int32 RowBegin = std::max(MinPY, TY * TileSize);
+		const int32 RowEnd = std::min(MaxPY, TY * TileSize + TileSize - 1);
 
-		int minPX = (int)std::floor(R.MinX * GW);
-		int minPY = (int)std::floor(R.MinY * GH);
-		int maxPX = (int)std::ceil(R.MaxX * GW) - 1;
-		int maxPY = (int)std::ceil(R.MaxY * GH) - 1;
-
-		// --- 화면 사각형 erosion(오클루더 영향 완화) ---
-		int w = std::max(0, maxPX - minPX + 1);
-		int h = std::max(0, maxPY - minPY + 1);
-		const bool bigCover =
-			(w >= int(MaxCover * GW)) || (h >= int(MaxCover * GH));
-		if (ErodeScale < 1.0f && w >= MinPxEdge && h >= MinPxEdge && !bigCover)
+		for (int32 TX = MinTX; TX <= MaxTX; ++TX)
 		{
-			const float cx = 0.5f * float(minPX + maxPX);
-			const float cy = 0.5f * float(minPY + maxPY);
-			const float hw = 0.5f * float(w) * ErodeScale;
-			const float hh = 0.5f * float(h) * ErodeScale;
-
-			minPX = int(std::floor(cx - hw));
-			maxPX = int(std::ceil(cx + hw));
-			minPY = int(std::floor(cy - hh));
-			maxPY = int(std::ceil(cy + hh));
+			const int32 TileIndex = TY * TilesX + TX;
+			if (TriMinZ >= TileMaxDepth[TileIndex])
+			{
+				continue;	// 타일 전체가 이미 삼각형보다 가까움
+			}
+			bTouched = true;
+
+			float* TileDepth = &Depth[static_cast<size_t>(TileIndex) * TilePixels];
+			const float TileX = static_cast<float>(TX * TileSize);
+
+			for (int32 PY = RowBegin; PY <= RowEnd; ++PY)
+			{
+				const float CenterY = static_cast<float>(PY) + 0.5f;
+				const __m128 RowE0 = _mm_set1_ps(EdgeB[0] * CenterY + EdgeC[0]);
+				const __m128 RowE1 = _mm_set1_ps(EdgeB[1] * CenterY + EdgeC[1]);
+				const __m128 RowE2 = _mm_set1_ps(EdgeB[2] * CenterY + EdgeC[2]);
+				const __m128 RowZ = _mm_set1_ps(ZB * CenterY + ZC);
+				float* Row = TileDepth + (PY - TY * TileSize) * TileSize;
+
+				for (int32 Group = 0; Group < TileSize; Group += 4)
+				{
+					const __m128 X = _mm_add_ps(_mm_set1_ps(TileX + static_cast<float>(Group)), ColumnOffsets);
+					const __m128 E0 = _mm_add_ps(_mm_mul_ps(A0, X), RowE0);
+					const __m128 E1 = _mm_add_ps(_mm_mul_ps(A1, X), RowE1);
+					const __m128 E2 = _mm_add_ps(_mm_mul_ps(A2, X), RowE2);
+					const __m128 Inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(E0, Zero), _mm_cmpge_ps(E1, Zero)), _mm_cmpge_ps(E2, Zero));
+					if (_mm_movemask_ps(Inside) == 0)
+					{
+						continue;
+					}
+
+					const __m128 Z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(ZA4, X), RowZ), TriMaxZ4);
+					const __m128 Old = _mm_loadu_ps(Row + Group);
+					const __m128 New = _mm_min_ps(Old, Z);
+					_mm_storeu_ps(Row + Group, _mm_or_ps(_mm_and_ps(Inside, New), _mm_andnot_ps(Inside, Old)));
+				}
+			}
+
+			// 타일 최대 깊이 갱신 (완전히 덮인 픽셀만 기록했으므로 HZB도 그 깊이만 MAX로 모음)
+			__m128 TileMax = _mm_loadu_ps(TileDepth);
+			for (int32 i = 4; i < TilePixels; i += 4)
+			{
+				TileMax = _mm_max_ps(TileMax, _mm_loadu_ps(TileDepth + i));
+			}
+			TileMaxDepth[TileIndex] = HorizontalMax(TileMax);
 		}
+	}
+	return bTouched;
+}
 
+void FOcclusionDepthBuffer::BuildHZB()
+{
+	// 레벨 수 계산 후 배열 재사용
+	int32 NumLevels = 1;
+	for (int32 W = Width, H = Height; W > 1 || H > 1; ++NumLevels)
+	{
+		W = (W + 1) / 2;
+		H = (H + 1) / 2;
+	}
+	if (HZBLevels.Num() != NumLevels)
+	{
+		HZBLevels.resize(NumLevels);
+		HZBWidths.resize(NumLevels);
+		HZBHeights.resize(NumLevels);
+	}
 
-		// 화면 경계 클램프
-		minPX = std::max(0, std::min(GW - 1, minPX));
-		minPY = std::max(0, std::min(GH - 1, minPY));
-		maxPX = std::max(0, std::min(GW - 1, maxPX));
-		maxPY = std::max(0, std::min(GH - 1, maxPY));
-		if (minPX > maxPX || minPY > maxPY) continue;
+	// 레벨 0: 타일 순서 → 행 우선
+	HZBWidths[0] = Width;
+	HZBHeights[0] = Height;
+	TArray<float>& Level0 = HZBLevels[0];
+	Level0.resize(static_cast<size_t>(Width) * Height);
+	for (int32 TY = 0; TY < TilesY; ++TY)
+	{
+		for (int32 TX = 0; TX < TilesX; ++TX)
+		{
+			const float* TileDepth = &Depth[static_cast<size_t>(TY * TilesX + TX) * TilePixels];
+			for (int32 Y = 0; Y < TileSize; ++Y)
+			{
+				std::copy_n(TileDepth + Y * TileSize, TileSize, &Level0[static_cast<size_t>(TY * TileSize + Y) * Width + TX * TileSize]);
+			}
+		}
+	}
 
-		Grid.RasterizeRectDepthMin(minPX, minPY, maxPX, maxPY, R.MaxZ);
+	// 상위 레벨: 2x2 최대값 (홀수 크기는 가장자리 텍셀을 한 번 더 읽음)
+	for (int32 Level = 1; Level < NumLevels; ++Level)
+	{
+		const TArray<float>& Src = HZBLevels[Level - 1];
+		const int32 SW = HZBWidths[Level - 1];
+		const int32 SH = HZBHeights[Level - 1];
+		const int32 DW = (SW + 1) / 2;
+		const int32 DH = (SH + 1) / 2;
+		HZBWidths[Level] = DW;
+		HZBHeights[Level] = DH;
+
+		TArray<float>& Dst = HZBLevels[Level];
+		Dst.resize(static_cast<size_t>(DW) * DH);
+		for (int32 Y = 0; Y < DH; ++Y)
+		{
+			const float* Row0 = &Src[static_cast<size_t>(Y * 2) * SW];
+			const float* Row1 = &Src[static_cast<size_t>(std::min(Y * 2 + 1, SH - 1)) * SW];
+			for (int32 X = 0; X < DW; ++X)
+			{
+				const int32 X0 = X * 2;
+				const int32 X1 = std::min(X0 + 1, SW - 1);
+				Dst[static_cast<size_t>(Y) * DW + X] = std::max(std::max(Row0[X0], Row0[X1]), std::max(Row1[X0], Row1[X1]));
+			}
+		}
 	}
 }
 
-// 2) 후보 가시성 판정(HZB 샘플)
-void FOcclusionCullingManagerCPU::TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags)
+bool FOcclusionDepthBuffer::IsRectOccluded(float MinX, float MinY, float MaxX, float MaxY, float MinDepth) const
 {
-	const float eps = 2e-3f;  // 1차 바이어스
-	const float eps2 = 2 * eps;  // 레벨0 재검증 바이어스(조금 더 큼)
-	// --- 크기 보장 ---
-	uint32_t maxId = 0;
-	for (auto& c : Candidates) maxId = std::max(maxId, c.ActorIndex);
+	if (HZBLevels.IsEmpty() || MinDepth <= 0.0f)
+	{
+		return false;
+	}
 
-	if (OutVisibleFlags.size() <= maxId) OutVisibleFlags.resize(maxId + 1, 1);
-	if (VisibleStreak.size() <= maxId) VisibleStreak.resize(maxId + 1, 0);
-	if (OccludedStreak.size() <= maxId) OccludedStreak.resize(maxId + 1, 0);
-	if (LastState.size() <= maxId) LastState.resize(maxId + 1, 1); // 초기=보임
+	// 사각형이 걸치는 모든 픽셀 (부분적으로 걸쳐도 포함)
+	const int32 X0 = std::max(0, static_cast<int32>(std::floor(MinX)));
+	const int32 Y0 = std::max(0, static_cast<int32>(std::floor(MinY)));
+	const int32 X1 = std::min(Width - 1, static_cast<int32>(std::ceil(MaxX)) - 1);
+	const int32 Y1 = std::min(Height - 1, static_cast<int32>(std::ceil(MaxY)) - 1);
+	if (X0 > X1 || Y0 > Y1)
+	{
+		return false;
+	}
 
-	for (const auto& D : Candidates)
+	// 최대 4x4 텍셀이 되는 레벨 선택
+	int32 Level = 0;
+	const int32 NumLevels = HZBLevels.Num();
+	while (Level + 1 < NumLevels && ((X1 >> Level) - (X0 >> Level) >= 4 || (Y1 >> Level) - (Y0 >> Level) >= 4))
 	{
-		uint32_t id = D.ActorIndex;
+		++Level;
+	}
 
-		FOcclusionRect R;
-		if (!ComputeRectAndMinZ(D, ViewW, ViewH, R))
+	const TArray<float>& Texels = HZBLevels[Level];
+	const int32 LevelWidth = HZBWidths[Level];
+	const float TestDepth = MinDepth - OccludeeDepthBias;
+	for (int32 Y = Y0 >> Level; Y <= (Y1 >> Level); ++Y)
+	{
+		const float* Row = &Texels[static_cast<size_t>(Y) * LevelWidth];
+		for (int32 X = X0 >> Level; X <= (X1 >> Level); ++X)
 		{
-			// 화면 밖(또는 w<=0 코너만) → 가려짐으로 처리
-			OutVisibleFlags[id] = 0;
-			// streak 업데이트 (선택): occluded 누적
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
-			LastState[id] = 0;
-			continue;
+			if (Row[X] >= TestDepth)
+			{
+				return false;	// 오클루더가 없거나 오클루디보다 먼 곳이 있음
+			}
 		}
+	}
+	return true;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FOcclusionCullingManagerCPU
+// ────────────────────────────────────────────────────────────────────────────
+
+void FOcclusionCullingManagerCPU::BeginView(const FMatrix& InViewProjection, uint32 ViewWidth, uint32 ViewHeight)
+{
+	RasterStartCycles = FWindowsPlatformTime::Cycles64();
+
+	ViewProjection = InViewProjection;
+	ViewStats.Reset();
+	ViewStats.Views = 1;
+	OccluderCandidates.clear();
+
+	// 가로 BufferWidth 고정, 세로는 뷰 비율
+	const float Aspect = ViewWidth > 0 ? static_cast<float>(ViewHeight) / static_cast<float>(ViewWidth) : 1.0f;
+	const int32 BufferHeight = std::clamp(static_cast<int32>(BufferWidth * Aspect), FOcclusionDepthBuffer::TileSize, BufferWidth * 2);
+	DepthBuffer.Resize(BufferWidth, BufferHeight);
+}
 
-		const float rw = std::max(0.0f, R.MaxX - R.MinX);
-		const float rh = std::max(0.0f, R.MaxY - R.MinY);
-		const float pxW = rw * GetGrid().GetWidth();
-		const float pxH = rh * GetGrid().GetHeight();
+void FOcclusionCullingManagerCPU::RasterizeOccluder(const FMatrix& WorldMatrix, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	const uint32 NumTriangles = static_cast<uint32>(Indices.Num() / 3);
+	if (NumTriangles == 0 || NumTriangles > MaxOccluderTriangles)
+	{
+		return;
+	}
 
-		// --- 작은 사각형 가드: 한 변이라도 2px 미만이면 컬링하지 않음 ---
-		if (std::min(pxW, pxH) < 2.0f)
+	const FMatrix WorldViewProjection = WorldMatrix * ViewProjection;
+	ClipVertices.resize(Vertices.Num());
+	for (int32 i = 0; i < Vertices.Num(); ++i)
+	{
+		ClipVertices[i] = FVector4::FromPoint(Vertices[i].pos) * WorldViewProjection;
+	}
+
+	for (uint32 Tri = 0; Tri < NumTriangles; ++Tri)
+	{
+		const uint32 I0 = Indices[Tri * 3 + 0];
+		const uint32 I1 = Indices[Tri * 3 + 1];
+		const uint32 I2 = Indices[Tri * 3 + 2];
+		if (DepthBuffer.RasterizeTriangle(ClipVertices[I0], ClipVertices[I1], ClipVertices[I2]))
 		{
-			OutVisibleFlags[id] = 1;
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
-			LastState[id] = 1;
-			continue;
+			++ViewStats.RasterizedTriangles;
 		}
+	}
 
-		// --- 보수적 mip 선택 ---
-		int mip = std::max(0, Grid.ChooseMip(rw, rh) - 1);
-		if (pxW < 48.0f || pxH < 48.0f)
-			mip = std::max(0, mip - 1);
+	++ViewStats.Occluders;
+	ViewStats.OccluderTriangles += NumTriangles;
+}
 
+void FOcclusionCullingManagerCPU::BuildHZB()
+{
+	DepthBuffer.BuildHZB();
 
-		// --- MAX HZB 적응형 샘플 ---
-		const float hzbMax = Grid.SampleMaxRectAdaptive(R.MinX, R.MinY, R.MaxX, R.MaxY, mip);
+	const uint64 Now = FWindowsPlatformTime::Cycles64();
+	ViewStats.RasterTimeMS = static_cast<float>(FWindowsPlatformTime::ToMilliseconds(Now - RasterStartCycles));
+	RasterStartCycles = Now;	// 이후는 판정 시간
+}
+
+bool FOcclusionCullingManagerCPU::TestBounds(const FAABB& Bounds, float& OutScreenFraction)
+{
+	++ViewStats.TestedObjects;
 
-		bool occluded = ((hzbMax + eps) <= R.MinZ);
+	const float BufferW = static_cast<float>(DepthBuffer.GetWidth());
+	const float BufferH = static_cast<float>(DepthBuffer.GetHeight());
 
-		// --- 레벨0 정밀 재검증(occluded일 때만) ---
-		if (occluded)
+	float MinX = FLT_MAX, MinY = FLT_MAX, MaxX = -FLT_MAX, MaxY = -FLT_MAX;
+	float MinDepth = FLT_MAX;
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector P(
+			(Corner & 1) ? Bounds.Max.X : Bounds.Min.X,
+			(Corner & 2) ? Bounds.Max.Y : Bounds.Min.Y,
+			(Corner & 4) ? Bounds.Max.Z : Bounds.Min.Z);
+		const FVector4 Clip = FVector4::FromPoint(P) * ViewProjection;
+
+		// Near 평면 앞으로 나온 코너가 있으면 판정하지 않음 (가까이 있는 큰 물체 → 좋은 오클루더 후보)
+		if (Clip.Z < 0.0f || Clip.W <= 0.0f)
 		{
-			if (!Grid.FullyOccludedAtLevel0(R.MinX, R.MinY, R.MaxX, R.MaxY, R.MinZ, eps2))
-				occluded = false;
+			OutScreenFraction = 1.0f;
+			return false;
 		}
 
-		// --- 양방향 히스테리시스(2~3프레임 연속일 때만 상태 전환) ---
-		const int thresh = 2; // 2~3 추천
+		const float InvW = 1.0f / Clip.W;
+		const float SX = (Clip.X * InvW * 0.5f + 0.5f) * BufferW;
+		const float SY = (0.5f - Clip.Y * InvW * 0.5f) * BufferH;
+		MinX = std::min(MinX, SX); MaxX = std::max(MaxX, SX);
+		MinY = std::min(MinY, SY); MaxY = std::max(MaxY, SY);
+		MinDepth = std::min(MinDepth, Clip.Z * InvW);
+	}
 
-		if (occluded)
-		{
-			OccludedStreak[id] = std::min<uint8_t>(255, OccludedStreak[id] + 1);
-			VisibleStreak[id] = 0;
+	const float ClampedW = std::max(0.0f, std::min(MaxX, BufferW) - std::max(MinX, 0.0f));
+	const float ClampedH = std::max(0.0f, std::min(MaxY, BufferH) - std::max(MinY, 0.0f));
+	OutScreenFraction = (ClampedW * ClampedH) / (BufferW * BufferH);
 
-			// 직전이 보임이면, thresh 미만 동안은 보임 유지
-			if (LastState[id] == 1 && OccludedStreak[id] < thresh)
-				occluded = false;
-		}
-		else
-		{
-			VisibleStreak[id] = std::min<uint8_t>(255, VisibleStreak[id] + 1);
-			OccludedStreak[id] = 0;
+	if (!DepthBuffer.IsRectOccluded(MinX, MinY, MaxX, MaxY, MinDepth))
+	{
+		return false;
+	}
 
-			// 직전이 가려짐이면, thresh 미만 동안은 가려짐 유지
-			if (LastState[id] == 0 && VisibleStreak[id] < thresh)
-				occluded = true;
-		}
+	++ViewStats.CulledObjects;
+	return true;
+}
 
-		LastState[id] = occluded ? 0 : 1;
-		OutVisibleFlags[id] = occluded ? 0 : 1;
+void FOcclusionCullingManagerCPU::AddOccluderCandidate(uint32 ObjectUUID, float ScreenFraction)
+{
+	if (ScreenFraction >= MinOccluderScreenFraction)
+	{
+		OccluderCandidates.Add({ ScreenFraction, ObjectUUID });
 	}
-}
\ No newline at end of file
+}
+
+void FOcclusionCullingManagerCPU::EndView()
+{
+	// 화면을 많이 덮는 순으로 상위 MaxOccluders개
+	const int32 NumSelected = std::min(OccluderCandidates.Num(), MaxOccluders);
+	std::partial_sort(OccluderCandidates.begin(), OccluderCandidates.begin() + NumSelected, OccluderCandidates.end(),
+		[](const std::pair<float, uint32>& A, const std::pair<float, uint32>& B) { return A.first > B.first; });
+
+	OccluderUUIDs.clear();
+	for (int32 i = 0; i < NumSelected; ++i)
+	{
+		OccluderUUIDs.insert(OccluderCandidates[i].second);
+	}
+
+	ViewStats.TestTimeMS = static_cast<float>(FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - RasterStartCycles));
+	FOcclusionStatManager::GetInstance().AddViewStats(ViewStats);
+}
@@ -1,257 +1,149 @@
 ﻿#pragma once
-
-struct FVector;
-struct FVector4;
-struct FMatrix; // row-major, p' = p * M 가정(네 컨벤션대로)
-struct FAABB; // AABB
-
-struct FCandidateDrawable
-{
-    uint32_t ActorIndex;   // VisibleFlags 인덱스
-    FAABB   Bound;        // 월드 AABB (Min/Max)
-    FMatrix  WorldViewProj;// 행벡터 기준 WVP
-    FMatrix  WorldView;    // ★ 추가: World-space * View  (여기서는 View만 주면 됨)
-    float    NearClip;        // ★ 추가
-    float    FarClip;         // ★ 추가
-};
-
-// 교체 (MaxZ 추가)
-struct FOcclusionRect
-{
-    float MinX, MinY, MaxX, MaxY; // [0..1]
-    float MinZ;                   // 가장 가까운
-    float MaxZ;                   // 가장 먼      <<--- 추가
-    uint32_t ActorIndex;
-};
-
-// 저해상도 깊이맵 + HZB(min) - CPU 전용
-class FOcclusionGrid
+#include "AABB.h"
+#include "OcclusionStats.h"
+
+struct FNormalVertex;
+
+// ────────────────────────────────────────────────────────────────────────────
+// Occlusion.h
+// CPU 소프트웨어 오클루전 컬링 (저해상도 타일 깊이 버퍼 + HZB)
+//
+// 1) 이전 프레임에 보였던 큰 불투명 메시(오클루더)의 삼각형을 타일 깊이 버퍼에 SSE로 래스터화
+// 2) 깊이 버퍼에서 MAX 피라미드(HZB)를 만들고
+// 3) 절두체 컬링을 통과한 메시의 월드 AABB를 HZB와 비교해 완전히 가려진 것만 제외한다.
+//
+// 깊이는 D3D 투영 그대로의 NDC Z (0 = Near, 1 = Far)를 쓴다.
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @class FOcclusionDepthBuffer
+ * @brief 8x8 픽셀 타일 단위로 저장하는 저해상도 깊이 버퍼와 MAX HZB.
+ *
+ * - 픽셀마다 가장 가까운 오클루더 깊이를 기록한다. (초기값 1 = Far)
+ * - 래스터화는 안쪽 보수적(inner-conservative)이다. 삼각형이 픽셀 전체를 덮을 때만 픽셀 안에서 가장 먼 깊이를 기록해
+ *   실제보다 가리는 영역을 넓히지 않는다. (인접 삼각형이 나눠 덮는 픽셀은 비워 두므로 덜 가릴 수는 있음)
+ * - 타일마다 최대 깊이를 유지해 이미 더 가까운 오클루더로 덮인 타일은 삼각형 단위로 건너뛴다.
+ */
+class FOcclusionDepthBuffer
 {
 public:
-    void Initialize(int InWidth, int InHeight)
-    {
-        Width = InWidth; Height = InHeight;
-        // 교체: 1.0f (Far)
-        Depth.assign(size_t(Width * Height), 1.0f);
-        BuildLevels.clear();
-    }
-    void Clear()
-    {
-        // Clear 도 동일하게 1.0f로
-        std::fill(Depth.begin(), Depth.end(), 1.0f);
-        BuildLevels.clear();
-    }
+	static constexpr int32 TileSize = 8;
+	static constexpr int32 TilePixels = TileSize * TileSize;
 
-    /*
-        왜 R.MaxZ를 쓰는데 min 누적을 하나?
+	/** 크기를 타일 배수로 올려 맞추고 버퍼를 비운다. (크기가 같으면 재할당 없음) */
+	void Resize(int32 InWidth, int32 InHeight);
 
-        오클루더 AABB가 두껍거나 경계 근사 때문에 일부 픽셀이 원래보다 더 멀게 잡힐 수 있다.
+	/** 모든 픽셀을 Far(1)로 되돌린다. */
+	void Clear();
 
-        레벨0은 per-pixel 가장 가까운 오클루더가 들어가야 하므로, 여러 오클루더가 겹칠 때 **min(current, MaxZ)**로 더 가까운 값으로만 낮춘다.
+	/**
+	 * @brief 클립 공간 삼각형 하나를 래스터화한다.
+	 * Near 평면과 가드 밴드로 클리핑한 뒤 양면 모두 그린다. (불투명 패스가 컬링 없이 그리므로)
+	 * @return 한 타일이라도 깊이를 갱신하려고 시도했으면 true
+	 */
+	bool RasterizeTriangle(const FVector4& Clip0, const FVector4& Clip1, const FVector4& Clip2);
 
-        이렇게 해야 상위 레벨의 MAX 피라미드가 보수적이 됨(=오버컬링 방지).
-    */
+	/** 깊이 버퍼에서 MAX 피라미드를 만든다. (레벨 0 = 픽셀) */
+	void BuildHZB();
 
-    void RasterizeRectDepthMin(int MinPX, int MinPY, int MaxPX, int MaxPY, float MaxZ)
-    {
-        MinPX = std::max(0, MinPX); MinPY = std::max(0, MinPY);
-        MaxPX = std::min(Width - 1, MaxPX); MaxPY = std::min(Height - 1, MaxPY);
-        for (int y = MinPY; y <= MaxPY; ++y)
-        {
-            float* Row = &Depth[size_t(y) * Width];
-            for (int x = MinPX; x <= MaxPX; ++x)
-            {
-                Row[x] = std::min(Row[x], MaxZ); // 가장 가까운 깊이로 갱신
-            }
-        }
-    }
+	/**
+	 * @brief 픽셀 사각형 [MinX, MaxX) x [MinY, MaxY) 전체가 MinDepth보다 가까운 오클루더로 덮였는지 검사한다.
+	 * 사각형이 최대 4x4 텍셀이 되는 HZB 레벨을 골라 보수적으로 샘플링한다.
+	 */
+	bool IsRectOccluded(float MinX, float MinY, float MaxX, float MaxY, float MinDepth) const;
 
-    void BuildHZB()
-    {
-        BuildLevels.clear();
-        BuildLevels.push_back(Depth); // level 0
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
 
-        int W = Width, H = Height;
-        while (W > 1 || H > 1)
-        {
-            int NW = std::max(1, W >> 1);
-            int NH = std::max(1, H >> 1);
-            TArray<float> Next(size_t(NW * NH), +FLT_MAX);
-
-            for (int y = 0; y < NH; ++y)
-                for (int x = 0; x < NW; ++x)
-                {
-                    int sx = x * 2, sy = y * 2;
-                    float a = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 0);
-                    float b = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 0);
-                    float c = SampleSafe(BuildLevels.back(), W, H, sx + 0, sy + 1);
-                    float d = SampleSafe(BuildLevels.back(), W, H, sx + 1, sy + 1);
-                    Next[size_t(y) * NW + x] = std::max(std::max(a, b), std::max(c, d));
-                }
-            BuildLevels.push_back(std::move(Next));
-            W = NW; H = NH;
-        }
-    }
-
-    int ChooseMip(float RectW01, float RectH01) const
-    {
-        float pxW = RectW01 * Width;
-        float pxH = RectH01 * Height;
-        float s = std::max(pxW, pxH);
-        int mip = int(std::floor(std::log2(std::max(1.0f, s))));
-        mip = std::max(0, std::min(mip, int(BuildLevels.size() - 1)));
-        return mip;
-    }
-
-    float SampleMaxRect(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        int W = std::max(1, Width >> Mip);
-        int H = std::max(1, Height >> Mip);
-
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
+private:
+	/** 화면 좌표(픽셀) 삼각형을 타일 순회로 래스터화 */
+	bool RasterizeScreenTriangle(const FVector& P0, const FVector& P1, const FVector& P2);
 
-        float cx = 0.5f * (MinX01 + MaxX01);
-        float cy = 0.5f * (MinY01 + MaxY01);
+private:
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 TilesX = 0;
+	int32 TilesY = 0;
+
+	TArray<float> Depth;		// 타일 순서 (타일 안은 행 우선)
+	TArray<float> TileMaxDepth;	// 타일별 최대 깊이 (래스터 조기 기각용)
+
+	// HZB: 레벨별 행 우선 배열, 레벨 0 = 픽셀
+	TArray<TArray<float>> HZBLevels;
+	TArray<int32> HZBWidths;
+	TArray<int32> HZBHeights;
+};
 
-        float s0 = Smp(cx, cy);
-        float s1 = Smp(MinX01, MinY01);
-        float s2 = Smp(MaxX01, MinY01);
-        float s3 = Smp(MinX01, MaxY01);
-        float s4 = Smp(MaxX01, MaxY01);
+/**
+ * @class FOcclusionCullingManagerCPU
+ * @brief 뷰포트 하나의 오클루전 컬링 상태. 오클루더 선택이 프레임 사이에 이어진다.
+ *
+ * 각 FViewport가 소유한다. FViewport::GetOcclusionCuller()가 처음 요청될 때 만들고
+ * FViewport::Cleanup()에서 해제하므로, 뷰포트를 다시 Initialize하면 새 상태로 시작한다.
+ * URenderer::RenderSceneForView는 뷰포트가 없으면 오클루전 컬링을 생략한다.
+ *
+ * 한 뷰의 사용 순서:
+ *   BeginView → (IsOccluder인 메시마다) RasterizeOccluder → BuildHZB
+ *   → (절두체 안의 메시마다) TestBounds / AddOccluderCandidate → EndView
+ *
+ * 오클루더는 UUID로 기억하므로 지난 프레임 오클루더가 소멸해도 안전하며,
+ * 래스터화는 항상 이번 프레임의 월드 행렬로 하므로 오클루더 선택이 틀려도 결과가 틀리지 않는다. (덜 가릴 뿐)
+ */
+class FOcclusionCullingManagerCPU
+{
+public:
+	/** 깊이 버퍼 가로 해상도 (세로는 뷰 비율을 따름) */
+	static constexpr int32 BufferWidth = 256;
+	/** 다음 프레임에 쓸 오클루더 최대 수 */
+	static constexpr int32 MaxOccluders = 64;
+	/** 이보다 삼각형이 많은 메시는 오클루더로 쓰지 않는다. */
+	static constexpr uint32 MaxOccluderTriangles = 4096;
+	/** 화면에서 이 비율 이상을 덮어야 오클루더 후보가 된다. */
+	static constexpr float MinOccluderScreenFraction = 0.01f;
 
-        return std::max(s0, std::max(s1, std::max(s2, std::max(s3, s4)))); // ★ MAX
-    }
-    // FOcclusionGrid 내부에 추가
-    float SampleMaxRectAdaptive(float MinX01, float MinY01, float MaxX01, float MaxY01, int Mip) const
-    {
-        const TArray<float>& L = BuildLevels[size_t(Mip)];
-        const int W = std::max(1, Width >> Mip);
-        const int H = std::max(1, Height >> Mip);
+	static bool IsEnabled() { return bEnabled; }
+	static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
 
-        auto ToPx = [&](float u, float v)->std::pair<int, int> {
-            int x = int(u * W + 0.5f);
-            int y = int(v * H + 0.5f);
-            x = std::max(0, std::min(W - 1, x));
-            y = std::max(0, std::min(H - 1, y));
-            return { x,y };
-            };
-        auto Smp = [&](float u, float v)->float {
-            auto [x, y] = ToPx(u, v);
-            return L[size_t(y) * W + x];
-            };
+	/** 이번 뷰의 ViewProjection과 크기로 깊이 버퍼를 준비한다. */
+	void BeginView(const FMatrix& InViewProjection, uint32 ViewWidth, uint32 ViewHeight);
 
-        // 샘플 밀도: 화면 픽셀 크기에 비례 (최대 5x5)
-        const int grid = ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 80) ? 5 :
-            ((MaxX01 - MinX01) * Width + (MaxY01 - MinY01) * Height > 30) ? 4 : 3;
+	/** 지난 프레임에 고른 오클루더인지 */
+	bool IsOccluder(uint32 ObjectUUID) const { return OccluderUUIDs.count(ObjectUUID) > 0; }
 
-        float best = 0.0f; // MAX 피라미드이므로 최댓값을 모음
-        for (int j = 0; j < grid; j++)
-        {
-            float v = std::lerp(MinY01, MaxY01, (grid == 1) ? 0.5f : float(j) / (grid - 1));
-            for (int i = 0; i < grid; i++)
-            {
-                float u = std::lerp(MinX01, MaxX01, (grid == 1) ? 0.5f : float(i) / (grid - 1));
-                best = std::max(best, Smp(u, v));
-            }
-        }
-        return best;
-    }
-    // FOcclusionGrid 내부에 추가 (레벨0 정밀 검사)
-    bool FullyOccludedAtLevel0(float MinX01, float MinY01, float MaxX01, float MaxY01, float MinZ, float eps2) const
-    {
-        const TArray<float>& L0 = BuildLevels[0];
-        const int W = Width, H = Height;
+	/** 메시 삼각형을 월드 행렬로 변환해 깊이 버퍼에 그린다. */
+	void RasterizeOccluder(const FMatrix& WorldMatrix, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-        int x0 = std::max(0, std::min(W - 1, int(MinX01 * W)));
-        int y0 = std::max(0, std::min(H - 1, int(MinY01 * H)));
-        int x1 = std::max(0, std::min(W - 1, int(MaxX01 * W)));
-        int y1 = std::max(0, std::min(H - 1, int(MaxY01 * H)));
+	/** 오클루더를 다 그린 뒤 호출 */
+	void BuildHZB();
 
-        // 너무 큰 박스는 샘플링 간격을 둠 (성능)
-        const int maxScan = 128 * 128; // 임계 픽셀수
-        int w = std::max(1, x1 - x0 + 1);
-        int h = std::max(1, y1 - y0 + 1);
-        int step = (w * h > maxScan) ? 2 : 1;
+	/**
+	 * @brief 월드 AABB가 오클루더에 완전히 가려졌는지 검사한다.
+	 * @param OutScreenFraction 화면에서 AABB 사각형이 차지하는 비율 (오클루더 후보 점수로 씀)
+	 * @return 가려졌으면 true (Near 평면을 걸치는 등 판정할 수 없으면 false)
+	 */
+	bool TestBounds(const FAABB& Bounds, float& OutScreenFraction);
 
-        for (int y = y0; y <= y1; y += step)
-        {
-            const float* row = &L0[size_t(y) * W];
-            for (int x = x0; x <= x1; x += step)
-            {
-                float z = row[x];           // 레벨0의 MAX-기반 값(=멀리 기록한 것들의 min 축약 결과 아님!)
-                // 주의: 우리는 base에 'MaxZ를 min으로 누적'시켰고, HZB는 최대화했음.
-                // 레벨0에서도 보수성 유지: z + eps2 <= MinZ 일 때만 occluded 픽셀로 간주.
-                if (z + eps2 > MinZ)
-                    return false; // 한 픽셀이라도 덮여있지 않음 → 전체 가림 실패
-            }
-        }
-        return true; // 전부 덮임
-    }
-    int GetWidth()  const { return Width; }
-    int GetHeight() const { return Height; }
+	/** 이번 프레임에 보인 메시를 다음 프레임 오클루더 후보로 등록 */
+	void AddOccluderCandidate(uint32 ObjectUUID, float ScreenFraction);
 
+	/** 후보 중 화면을 많이 덮는 순으로 다음 프레임 오클루더를 고르고 통계를 전역 매니저에 누적한다. */
+	void EndView();
 
-private:
-    static float SampleSafe(const TArray<float>& L, int W, int H, int X, int Y)
-    {
-        X = std::max(0, std::min(W - 1, X));
-        Y = std::max(0, std::min(H - 1, Y));
-        return L[size_t(Y) * W + X];
-    }
+	const FOcclusionStats& GetViewStats() const { return ViewStats; }
 
 private:
-    int Width = 0, Height = 0;
-    TArray<float> Depth;                     // level 0
-    TArray<TArray<float>> BuildLevels;  // [0..N-1], min chain
-
-
-};
-
-// CPU 오클루전 매니저
-class FOcclusionCullingManagerCPU
-{
-public:
-    void Initialize(int GridW, int GridH) { Grid.Initialize(GridW, GridH); }
-    void Shutdown() {}
-
-    // 1) 오클루더로 저해상도 Depth 채우기
-    void BuildOccluderDepth(const TArray<FCandidateDrawable>& Occluders, int ViewW, int ViewH);
-
-    // 2) CPU HZB
-    void BuildHZB() { Grid.BuildHZB(); }
+	static bool bEnabled;
 
-    // 3) 후보 가시성 판정
-    void TestOcclusion(const TArray<FCandidateDrawable>& Candidates, int ViewW, int ViewH, TArray<uint8_t>& OutVisibleFlags);
+	FOcclusionDepthBuffer DepthBuffer;
+	FMatrix ViewProjection;
 
-    const FOcclusionGrid& GetGrid() const { return Grid; }
+	// 다음 프레임 오클루더 (UUID)
+	TSet<uint32> OccluderUUIDs;
+	TArray<std::pair<float, uint32>> OccluderCandidates;	// (화면 비율, UUID)
 
-private:
-    // AABB(Min/Max) → 화면 사각형 + MinZ (★이제 MinZ는 '선형 깊이 0..1')
-    static bool ComputeRectAndMinZ(const FCandidateDrawable& D, int ViewW, int ViewH, FOcclusionRect& OutRect);
-
-    // 행벡터: Out = In(1x4) * M(4x4)
-    static inline void MulPointRow(const float In[4], const FMatrix& M, float Out[4])
-    {
-        Out[0] = In[0] * M.M[0][0] + In[1] * M.M[1][0] + In[2] * M.M[2][0] + In[3] * M.M[3][0];
-        Out[1] = In[0] * M.M[0][1] + In[1] * M.M[1][1] + In[2] * M.M[2][1] + In[3] * M.M[3][1];
-        Out[2] = In[0] * M.M[0][2] + In[1] * M.M[1][2] + In[2] * M.M[2][2] + In[3] * M.M[3][2];
-        Out[3] = In[0] * M.M[0][3] + In[1] * M.M[1][3] + In[2] * M.M[2][3] + In[3] * M.M[3][3];
-    }
+	// 재사용 버퍼 (오클루더 정점의 클립 좌표)
+	TArray<FVector4> ClipVertices;
 
-private:
-    FOcclusionGrid Grid;
-    TArray<uint8_t> VisibleStreak;   // 연속 보임 프레임 수
-    TArray<uint8_t> OccludedStreak;  // 연속 가림 프레임 수
-    TArray<uint8_t> LastState;       // 0=occluded, 1=visible
-};
\ No newline at end of file
+	FOcclusionStats ViewStats;
+	uint64 RasterStartCycles = 0;
+};
@@ -37,7 +37,10 @@ public:
 
     //void RayQueryOrdered(FRay InRay, OUT TArray<std::pair<AActor*, float>>& Candidates);
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
-	void FrustumQuery(FFrustum InFrustum);
+	/** 여러 레이를 한 번에 검사 (시야 검사 등 인접한 레이 묶음용, 히트가 없으면 액터 nullptr / 거리 MaxDistance) */
+	void RayQueryClosestBatch(const TArray<FRay>& InRays, float MaxDistance, OUT TArray<AActor*>& OutActors, OUT TArray<float>& OutHitT);
+	/** @return false면 BVH가 리빌드 대기 중이라 결과를 쓸 수 없음 */
+	bool FrustumQuery(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutComponents) const;
 
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
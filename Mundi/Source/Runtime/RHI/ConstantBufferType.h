@@ -253,7 +253,7 @@ struct CameraBufferType // b7
     float Padding;
 };
 
-// b11: 타일 기반 라이트 컬링 상수 버퍼
+// b11: 타일(클러스터) 기반 라이트 컬링 상수 버퍼
 struct FTileCullingBufferType
 {
     uint32 TileSize;          // 타일 크기 (픽셀, 기본 16)
@@ -262,7 +262,11 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint32 Padding[2];
+    uint32 DepthSliceCount;   // 클러스터 깊이 슬라이스 개수
+    uint32 Padding;
+    float DepthSliceScale;    // Slice = log2(ViewDepth) * Scale + Bias
+    float DepthSliceBias;
+    float Padding2[2];
 };
 
 struct FPointLightShadowBufferType
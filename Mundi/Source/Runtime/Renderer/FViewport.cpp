@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "FViewport.h"
 #include "FViewportClient.h"
+#include "Occlusion.h"
 
 FViewport::FViewport()
 {
@@ -200,6 +201,18 @@ void FViewport::Cleanup()
 	}
 
 	D3DDevice = nullptr;
+
+	// 다시 Initialize되면 이전 뷰의 오클루더 / 깊이 버퍼를 이어 쓰지 않음
+	OcclusionCuller.reset();
+}
+
+FOcclusionCullingManagerCPU* FViewport::GetOcclusionCuller()
+{
+	if (!OcclusionCuller)
+	{
+		OcclusionCuller = std::make_unique<FOcclusionCullingManagerCPU>();
+	}
+	return OcclusionCuller.get();
 }
 
 void FViewport::BeginRenderFrame()
@@ -4,6 +4,7 @@
 #include <d3d11.h>
 
 class FViewportClient;
+class FOcclusionCullingManagerCPU;
 
 /**
  * @brief 뷰포트 클래스 - UE의 FViewport를 모방
@@ -58,6 +59,9 @@ public:
     
     FVector2D GetViewportMousePosition() { return ViewportMousePosition; }
 
+    // 이 뷰포트의 CPU 오클루전 컬링 상태 (처음 요청할 때 생성, 뷰포트와 함께 해제)
+    FOcclusionCullingManagerCPU* GetOcclusionCuller();
+
     // 마우스/키보드 입력 처리
     void ProcessMouseMove(int32 X, int32 Y);
     void ProcessMouseButtonDown(int32 X, int32 Y, int32 Button);
@@ -93,5 +97,8 @@ private:
 
     // 뷰포트 hover 상태 (ImGui::Image용)
     bool bViewportHovered = false;
+
+    // 지난 프레임 오클루더 선택을 다음 프레임으로 넘기는 뷰포트별 상태
+    std::unique_ptr<FOcclusionCullingManagerCPU> OcclusionCuller;
 };
 
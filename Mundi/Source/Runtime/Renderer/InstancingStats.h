@@ -0,0 +1,71 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 자동 인스턴싱 통계 구조체
+// 한 프레임 동안 모든 뷰의 불투명 패스에서 병합된 드로우 콜 정보를 누적
+struct FInstancingStats
+{
+	uint32 OpaqueBatches = 0;       // 병합 전 불투명 배치 수 (= 인스턴싱이 없을 때의 드로우 콜 수)
+	uint32 DrawCalls = 0;           // 병합 후 불투명 패스 드로우 콜 수
+	uint32 InstancedDraws = 0;      // 인스턴스 드로우 콜 수
+	uint32 InstancedBatches = 0;    // 인스턴스 드로우로 합쳐진 배치 수
+	uint32 InstanceBufferBytes = 0; // 링 버퍼 용량 (바이트)
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		OpaqueBatches = 0;
+		DrawCalls = 0;
+		InstancedDraws = 0;
+		InstancedBatches = 0;
+		InstanceBufferBytes = 0;
+	}
+
+	// 인스턴싱으로 줄어든 드로우 콜 수
+	uint32 GetDrawCallsSaved() const
+	{
+		return OpaqueBatches - DrawCalls;
+	}
+};
+
+// 자동 인스턴싱 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FInstancingStatManager
+{
+public:
+	static FInstancingStatManager& GetInstance()
+	{
+		static FInstancingStatManager Instance;
+		return Instance;
+	}
+
+	// 매 프레임 렌더링 시작 시 호출 (URenderer::BeginFrame)
+	void ResetFrameStats()
+	{
+		CurrentStats.Reset();
+	}
+
+	// 뷰 하나의 병합 결과를 누적
+	void AddViewStats(const FInstancingStats& InStats)
+	{
+		CurrentStats.OpaqueBatches += InStats.OpaqueBatches;
+		CurrentStats.DrawCalls += InStats.DrawCalls;
+		CurrentStats.InstancedDraws += InStats.InstancedDraws;
+		CurrentStats.InstancedBatches += InStats.InstancedBatches;
+		CurrentStats.InstanceBufferBytes = InStats.InstanceBufferBytes;
+	}
+
+	// 통계 조회
+	const FInstancingStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+private:
+	FInstancingStatManager() = default;
+	~FInstancingStatManager() = default;
+	FInstancingStatManager(const FInstancingStatManager&) = delete;
+	FInstancingStatManager& operator=(const FInstancingStatManager&) = delete;
+
+	FInstancingStats CurrentStats;
+};
@@ -45,6 +45,10 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	// --- 2. 2D Atlas (t9) ---
 	if (!ShadowAtlasTexture2D)
 	{
+		// 영구 영역 할당기는 아틀라스 텍스처와 수명을 같이 함
+		AtlasAllocator2D.Initialize(ShadowAtlasSize2D);
+		AtlasSlots2D.Empty();
+
 		// 헬퍼 함수를 사용하는 대신, 여기서 직접 생성합니다.
 		ID3D11Device* Device = RHIDevice->GetDevice(); // RHI에서 Device 가져오기
 
@@ -101,6 +105,9 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	// Skip cube shadow creation if CubeArrayCount is 0 (for preview worlds)
 	if (!ShadowAtlasTextureCube && CubeArrayCount > 0 && AtlasSizeCube > 0)
 	{
+		CubeSliceOwners.SetNum(CubeArrayCount, nullptr);
+		CubeFaceContentHashes.SetNum(CubeArrayCount * 6, 0);
+
 		// 3.1. 큐브맵 배열 리소스 생성 (TextureCubeArray)
 		D3D11_TEXTURE2D_DESC CubeDesc = {};
 		CubeDesc.Width = AtlasSizeCube;
@@ -276,6 +283,11 @@ void FLightManager::Release()
 		VSMShadowAtlasTexture2D->Release();
 		VSMShadowAtlasTexture2D = nullptr;
 	}
+
+	AtlasAllocator2D.Reset();
+	AtlasSlots2D.Empty();
+	CubeSliceOwners.Empty();
+	CubeFaceContentHashes.Empty();
 }
 
 void FLightManager::UpdateLightBuffer(D3D11RHI* RHIDevice)
@@ -485,6 +497,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 아틀라스 내용이 지워졌으므로 캐시된 섀도우 뷰도 모두 무효
+	InvalidateShadowCache();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -538,26 +553,79 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 	return true;
 }
 
-// 단순한 아틀라스 로직
+// 영구 아틀라스 할당 (쿼드트리 버디 할당기)
+// 라이트 / 서브뷰별 영역을 프레임 간 유지하고, 요청이 끊겼거나 블록 크기가 바뀐 영역만 반환 후 다시 할당합니다.
 void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
+	++AtlasAllocationFrame;
+
+	// 1. 기존 슬롯 확인 (블록 크기가 같으면 그대로 사용)
+	TArray<int32> PendingRequests;
+	for (int32 RequestIndex = 0; RequestIndex < InOutRequests2D.Num(); ++RequestIndex)
+	{
+		FShadowRenderRequest& Request = InOutRequests2D[RequestIndex];
+		const uint32 BlockSize = AtlasAllocator2D.GetBlockSizeFor(Request.Size);
+		if (BlockSize == 0 || !Request.LightOwner || Request.SubViewIndex < 0)
+		{
+			Request.Size = 0; // 할당 불가 (렌더링 실패)
+			continue;
+		}
 
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
+		TArray<FShadowAtlasSlot>& Slots = AtlasSlots2D[Request.LightOwner];
+		if (Slots.Num() <= Request.SubViewIndex)
+		{
+			Slots.SetNum(Request.SubViewIndex + 1);
+		}
 
-	for (FShadowRenderRequest& Request : InOutRequests2D)
+		FShadowAtlasSlot& Slot = Slots[Request.SubViewIndex];
+		if (Slot.Region.IsValid() && Slot.Region.Size != BlockSize)
+		{
+			AtlasAllocator2D.Free(Slot.Region);
+			Slot = FShadowAtlasSlot();
+		}
+		Slot.LastRequestedFrame = AtlasAllocationFrame;
+
+		if (!Slot.Region.IsValid())
+		{
+			PendingRequests.Add(RequestIndex);
+		}
+	}
+
+	// 2. 이번에 요청되지 않은 슬롯 반환 (라이트 삭제 / 섀도우 끔 / 캐스케이드 수 감소)
+	for (auto It = AtlasSlots2D.begin(); It != AtlasSlots2D.end();)
 	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
+		bool bAnyValid = false;
+		for (FShadowAtlasSlot& Slot : It->second)
 		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
+			if (Slot.Region.IsValid() && Slot.LastRequestedFrame != AtlasAllocationFrame)
+			{
+				AtlasAllocator2D.Free(Slot.Region);
+				Slot = FShadowAtlasSlot();
+			}
+			bAnyValid |= Slot.Region.IsValid() || Slot.LastRequestedFrame == AtlasAllocationFrame;
 		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
+
+		if (bAnyValid)
+		{
+			++It;
+		}
+		else
+		{
+			It = AtlasSlots2D.erase(It);
+		}
+	}
+
+	// 3. 새 영역 할당 (큰 것부터 해야 작은 블록이 큰 블록 자리를 쪼개 놓는 일이 줄어듦)
+	std::stable_sort(PendingRequests.begin(), PendingRequests.end(), [&InOutRequests2D](int32 A, int32 B)
+	{
+		return InOutRequests2D[A].Size > InOutRequests2D[B].Size;
+	});
+
+	for (int32 RequestIndex : PendingRequests)
+	{
+		FShadowRenderRequest& Request = InOutRequests2D[RequestIndex];
+		FShadowAtlasSlot& Slot = AtlasSlots2D[Request.LightOwner][Request.SubViewIndex];
+		if (!AtlasAllocator2D.Allocate(Request.Size, Slot.Region))
 		{
 			Request.Size = 0; // 꽉 참 (렌더링 실패)
 			// Only log error for non-preview worlds (preview worlds have shadows disabled intentionally)
@@ -565,28 +633,36 @@ void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRe
 			{
 				//UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
 			}
+		}
+		Slot.ContentHash = 0;
+	}
+
+	// 4. 뷰포트 / UV 기록 (블록이 요청보다 클 수 있으므로 크기는 요청 크기 사용)
+	for (FShadowRenderRequest& Request : InOutRequests2D)
+	{
+		if (Request.Size == 0)
+		{
 			continue;
 		}
 
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
+		const FShadowAtlasAllocator::FRegion& Region = AtlasSlots2D[Request.LightOwner][Request.SubViewIndex].Region;
+		Request.AtlasViewportOffset = FVector2D((float)Region.X, (float)Region.Y);
 
 		// Pass 2 데이터 (UV) 저장
 		Request.AtlasScaleOffset = FVector4(
 			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
 			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
+			Region.X / (float)ShadowAtlasSize2D,        // OffsetX
+			Region.Y / (float)ShadowAtlasSize2D         // OffsetY
 		);
-
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
 	}
 }
 
+// 큐브 슬라이스도 라이트가 요청하는 동안 같은 슬라이스를 유지합니다.
 void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
-	if (CubeArrayCount == 0)
+	if (CubeArrayCount == 0 || CubeSliceOwners.IsEmpty())
 	{
 		for (FShadowRenderRequest& Request : InOutRequestsCube)
 		{
@@ -596,13 +672,30 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 		return;
 	}
 
-	int AllocatorCube_CurrentSliceIndex = 0;
+	// 1. 이번 프레임에 섀도우를 요청한 라이트 (라이트당 6개의 요청이 들어옴)
+	TArray<ULightComponent*> RequestedLights;
+	for (const FShadowRenderRequest& Request : InOutRequestsCube)
+	{
+		if (Request.Size > 0 && !RequestedLights.Contains(Request.LightOwner))
+		{
+			RequestedLights.Add(Request.LightOwner);
+		}
+	}
 
-	ULightComponent* CurrentLightOwner = nullptr; // 현재 처리 중인 라이트 추적용
-	bool bCurrentLightFailed = false; // 현재 라이트가 슬라이스 할당에 실패했는지 여부
-	// 로컬 변수 대신 FLightManager의 멤버 변수 AllocatorCube_CurrentSliceIndex 사용
+	// 2. 요청이 끊긴 라이트의 슬라이스 반환
+	for (int32 SliceIndex = 0; SliceIndex < CubeSliceOwners.Num(); ++SliceIndex)
+	{
+		if (CubeSliceOwners[SliceIndex] && !RequestedLights.Contains(CubeSliceOwners[SliceIndex]))
+		{
+			CubeSliceOwners[SliceIndex] = nullptr;
+			for (int32 FaceIndex = 0; FaceIndex < 6; ++FaceIndex)
+			{
+				CubeFaceContentHashes[SliceIndex * 6 + FaceIndex] = 0;
+			}
+		}
+	}
 
-	// 요청 리스트 순회 (각 라이트당 6개의 요청이 들어옴)
+	// 3. 기존 슬라이스 재사용, 없으면 빈 슬라이스 할당
 	for (FShadowRenderRequest& Request : InOutRequestsCube)
 	{
 		// 유효하지 않은 요청은 건너뜀 (예: Size가 0인 경우)
@@ -612,44 +705,90 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 			continue;
 		}
 
-		// 라이트가 변경되었는지 확인
-		if (Request.LightOwner != CurrentLightOwner)
+		int32 SliceIndex = CubeSliceOwners.Find(Request.LightOwner);
+		if (SliceIndex < 0)
 		{
-			// 첫 라이트가 아니면서 이전 라이트가 성공적으로 할당되었을 경우, 다음 슬라이스로 이동
-			if (CurrentLightOwner != nullptr && !bCurrentLightFailed)
-			{
-				AllocatorCube_CurrentSliceIndex++; // 다음 슬라이스 인덱스로 증가 (멤버 변수 사용)
-			}
-
-			CurrentLightOwner = Request.LightOwner; // 현재 라이트 갱신
-
-			// 새 라이트가 슬라이스 개수 제한을 초과하는지 확인
-			if (AllocatorCube_CurrentSliceIndex >= CubeArrayCount)
+			SliceIndex = CubeSliceOwners.Find(nullptr);
+			if (SliceIndex >= 0)
 			{
-				bCurrentLightFailed = true; // 이 라이트는 할당 불가
-			}
-			else
-			{
-				bCurrentLightFailed = false; // 이 라이트는 할당 가능
+				CubeSliceOwners[SliceIndex] = Request.LightOwner;
 			}
 		}
 
-		// 현재 라이트가 할당 실패 상태인지 확인
-		if (bCurrentLightFailed)
+		if (SliceIndex < 0)
 		{
-			Request.Size = 0; // 할당 실패 처리
-			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
+			Request.Size = 0; // 할당 실패 처리 (슬라이스 부족)
+			Request.AssignedSliceIndex = -1;
 		}
 		else
 		{
-			// --- [핵심 수정] ---
-			// 성공: 현재 슬라이스 인덱스를 'AssignedSliceIndex' 멤버에 기록
-			Request.AssignedSliceIndex = AllocatorCube_CurrentSliceIndex;
+			Request.AssignedSliceIndex = SliceIndex;
 			// OriginalSubViewIndex는 건드리지 않음
 		}
 	}
 }
 
+bool FLightManager::IsShadowViewCached(const FShadowRenderRequest& Request, uint64 ContentHash) const
+{
+	const uint64* StoredHash = FindShadowViewContentHash(Request);
+	return ContentHash != 0 && StoredHash && *StoredHash == ContentHash;
+}
+
+void FLightManager::SetShadowViewContentHash(const FShadowRenderRequest& Request, uint64 ContentHash)
+{
+	if (uint64* StoredHash = const_cast<uint64*>(FindShadowViewContentHash(Request)))
+	{
+		*StoredHash = ContentHash;
+	}
+}
+
+const uint64* FLightManager::FindShadowViewContentHash(const FShadowRenderRequest& Request) const
+{
+	// 큐브 요청만 슬라이스가 할당됨 (2D 요청은 -1 유지)
+	if (Request.AssignedSliceIndex >= 0)
+	{
+		const int32 FaceIndex = Request.AssignedSliceIndex * 6 + Request.SubViewIndex;
+		if (Request.SubViewIndex < 0 || Request.SubViewIndex >= 6 || FaceIndex >= CubeFaceContentHashes.Num())
+		{
+			return nullptr;
+		}
+		return &CubeFaceContentHashes[FaceIndex];
+	}
+
+	const TArray<FShadowAtlasSlot>* Slots = AtlasSlots2D.Find(Request.LightOwner);
+	if (!Slots || Request.SubViewIndex < 0 || Request.SubViewIndex >= Slots->Num() || !(*Slots)[Request.SubViewIndex].Region.IsValid())
+	{
+		return nullptr;
+	}
+	return &(*Slots)[Request.SubViewIndex].ContentHash;
+}
+
+void FLightManager::InvalidateShadowCache()
+{
+	for (auto& Pair : AtlasSlots2D)
+	{
+		for (FShadowAtlasSlot& Slot : Pair.second)
+		{
+			Slot.ContentHash = 0;
+		}
+	}
+
+	for (uint64& Hash : CubeFaceContentHashes)
+	{
+		Hash = 0;
+	}
+}
+
+float FLightManager::GetShadowAtlasUsage2D() const
+{
+	const uint64 AtlasSize = AtlasAllocator2D.GetAtlasSize();
+	if (AtlasSize == 0)
+	{
+		return 0.0f;
+	}
+	return static_cast<float>(static_cast<double>(AtlasAllocator2D.GetAllocatedTexels()) / static_cast<double>(AtlasSize * AtlasSize));
+}
+
 void FLightManager::ClearAllLightList()
 {
 	AmbientLightList.clear();
@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "ShadowAtlasAllocator.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -159,6 +160,13 @@ public:
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 섀도우 뷰 캐시 ---
+    // 할당된 영역(2D) / 큐브 면에 마지막으로 렌더링한 내용의 해시. 해시가 같으면 다시 그릴 필요가 없음
+    bool IsShadowViewCached(const FShadowRenderRequest& Request, uint64 ContentHash) const;
+    void SetShadowViewContentHash(const FShadowRenderRequest& Request, uint64 ContentHash);
+    void InvalidateShadowCache();
+    float GetShadowAtlasUsage2D() const;
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -182,6 +190,8 @@ private:
     bool bSpotLightDirty = true;
     bool bShadowDataDirty = true;
 
+    const uint64* FindShadowViewContentHash(const FShadowRenderRequest& Request) const;
+
     // --- 섀도우 리소스 ---
     // Atlas 1: 2D 아틀라스 (Spot/Dir용)
     ID3D11Texture2D* ShadowAtlasTexture2D = nullptr;
@@ -210,6 +220,23 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // --- 영구 아틀라스 할당 ---
+    // 2D 아틀라스 영역은 라이트가 요청을 멈추거나 크기가 바뀔 때까지 같은 자리에 유지됩니다.
+    struct FShadowAtlasSlot
+    {
+        FShadowAtlasAllocator::FRegion Region;
+        uint64 ContentHash = 0;     // 0이면 내용 없음 (다시 렌더링 필요)
+        uint32 LastRequestedFrame = 0;
+    };
+    FShadowAtlasAllocator AtlasAllocator2D;
+    // Key: 라이트, Value: SubViewIndex별 슬롯
+    TMap<ULightComponent*, TArray<FShadowAtlasSlot>> AtlasSlots2D;
+    uint32 AtlasAllocationFrame = 0;
+
+    // 큐브 슬라이스 소유 라이트 (nullptr = 빈 슬라이스)와 면별 내용 해시 (Slice * 6 + Face)
+    TArray<ULightComponent*> CubeSliceOwners;
+    TArray<uint64> CubeFaceContentHashes;
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
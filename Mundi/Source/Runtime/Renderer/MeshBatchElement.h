@@ -23,7 +23,7 @@ enum class EBatchRenderMode : uint8
 struct FMeshBatchElement
 {
 	// --- 1. 정렬 키 (Sorting Keys) ---
-	// 렌더러가 상태 변경을 최소화하기 위해 정렬하는 기준입니다.
+	// 렌더러가 상태 변경을 최소화하기 위해 정렬하는 기준입니다. (FMeshDrawKey에 ID로 압축됨)
 	ID3D11VertexShader* VertexShader = nullptr;
 	ID3D11PixelShader* PixelShader = nullptr;
 	ID3D11InputLayout* InputLayout = nullptr;
@@ -72,6 +72,12 @@ struct FMeshBatchElement
 	// 여러 이미터가 하나의 인스턴스 버퍼를 공유할 때 각 이미터의 시작 위치를 지정합니다.
 	uint32 StartInstanceLocation = 0;
 
+	// 자동 인스턴싱용 셰이더 변형 (INSTANCED_WORLD 매크로, 월드 행렬 / ObjectID를 인스턴스 스트림에서 읽음)
+	// 설정된 배치만 FMeshAutoInstancing이 같은 메시를 그리는 다른 배치와 인스턴스 드로우 하나로 병합합니다.
+	ID3D11VertexShader* InstancedVertexShader = nullptr;
+	ID3D11PixelShader* InstancedPixelShader = nullptr;
+	ID3D11InputLayout* InstancedInputLayout = nullptr;
+
 
 	// --- 4. 오브젝트별 데이터 (Per-Object Data) ---
 	// 드로우 콜마다 고유하게 설정되는 데이터입니다. (정렬 키가 아님)
@@ -107,31 +113,4 @@ struct FMeshBatchElement
 
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
-
-
-	/**
-	 * @brief FMeshBatchElement 정렬을 위한 'less than' 연산자입니다.
-	 * TArray::Sort()가 A < B 를 비교하기 위해 이 함수를 호출합니다.
-	 * GPU 상태 변경을 최소화하는 순서로 정렬 키를 비교합니다.
-	 */
-	bool operator<(const FMeshBatchElement& B) const
-	{
-		const FMeshBatchElement& A = *this; // A는 'this' (자신), B는 비교 대상
-
-		// 1순위: 셰이더 프로그램 (VS, PS)
-		if (A.VertexShader != B.VertexShader) return A.VertexShader < B.VertexShader;
-		if (A.PixelShader != B.PixelShader) return A.PixelShader < B.PixelShader;
-
-		// 2순위: 셰이더 파라미터 (Material)
-		if (A.Material != B.Material) return A.Material < B.Material;
-
-		// 3순위: IA(Input Assembler) 상태 (버퍼, 스트라이드, 토폴로지)
-		if (A.VertexBuffer != B.VertexBuffer) return A.VertexBuffer < B.VertexBuffer;
-		if (A.IndexBuffer != B.IndexBuffer) return A.IndexBuffer < B.IndexBuffer;
-		if (A.VertexStride != B.VertexStride) return A.VertexStride < B.VertexStride;
-		if (A.PrimitiveTopology != B.PrimitiveTopology) return A.PrimitiveTopology < B.PrimitiveTopology;
-
-		// 모든 키가 동일하면 순서가 중요하지 않으므로 false 반환 (Stable Sort 보장)
-		return false;
-	}
 };
\ No newline at end of file
@@ -0,0 +1,146 @@
+﻿#include "pch.h"
+#include "MeshDrawKey.h"
+#include "MeshBatchElement.h"
+
+void FMeshDrawKeyBuilder::Reset()
+{
+	VertexShaderIds.Empty();
+	PixelShaderIds.Empty();
+	MaterialIds.Empty();
+	VertexBufferIds.Empty();
+}
+
+uint32 FMeshDrawKeyBuilder::GetId(TMap<const void*, uint32>& Ids, const void* Pointer, uint32 MaxId)
+{
+	if (!Pointer)
+	{
+		return 0;
+	}
+
+	if (const uint32* Id = Ids.Find(Pointer))
+	{
+		return *Id;
+	}
+
+	const uint32 NextId = static_cast<uint32>(Ids.Num()) + 1;
+	const uint32 NewId = NextId < MaxId ? NextId : MaxId;
+	Ids.Add(Pointer, NewId);
+	return NewId;
+}
+
+uint32 FMeshDrawKeyBuilder::GetDepthBits(const FMeshBatchElement& Batch, const FVector& ViewLocation)
+{
+	const FVector Position = { Batch.WorldMatrix.M[3][0], Batch.WorldMatrix.M[3][1], Batch.WorldMatrix.M[3][2] };
+	const float DistanceSquared = (Position - ViewLocation).SizeSquared();
+
+	uint32 Bits;
+	std::memcpy(&Bits, &DistanceSquared, sizeof(Bits));
+	return Bits;
+}
+
+void FMeshDrawKeyBuilder::SortOpaque(const TArray<FMeshBatchElement>& InElements, TArray<int32>& InOutIndices, const FVector& ViewLocation)
+{
+	Keys.SetNum(InOutIndices.Num());
+	for (int32 i = 0; i < InOutIndices.Num(); ++i)
+	{
+		const FMeshBatchElement& Batch = InElements[InOutIndices[i]];
+
+		const uint64 VS = GetId(VertexShaderIds, Batch.VertexShader, 0xFF);
+		const uint64 PS = GetId(PixelShaderIds, Batch.PixelShader, 0xFF);
+		const uint64 Material = GetId(MaterialIds, Batch.Material, 0xFFFF);
+		const uint64 VertexBuffer = GetId(VertexBufferIds, Batch.VertexBuffer, 0xFFFF);
+		// 상위 16비트만 써도 거리 순서는 유지됨 (같은 상태 안에서의 대략적인 앞 → 뒤, Early-Z용)
+		const uint64 Depth = GetDepthBits(Batch, ViewLocation) >> 16;
+
+		Keys[i].Key = (VS << 56) | (PS << 48) | (Material << 32) | (VertexBuffer << 16) | Depth;
+		Keys[i].BatchIndex = InOutIndices[i];
+	}
+
+	SortAndWriteBack(InOutIndices);
+}
+
+void FMeshDrawKeyBuilder::SortTranslucent(const TArray<FMeshBatchElement>& InElements, TArray<int32>& InOutIndices, const FVector& ViewLocation)
+{
+	Keys.SetNum(InOutIndices.Num());
+	for (int32 i = 0; i < InOutIndices.Num(); ++i)
+	{
+		const FMeshBatchElement& Batch = InElements[InOutIndices[i]];
+
+		// 비트를 반전해 먼 배치가 앞에 오도록 함
+		const uint64 Depth = ~GetDepthBits(Batch, ViewLocation);
+		const uint64 VS = GetId(VertexShaderIds, Batch.VertexShader, 0xFF);
+		const uint64 PS = GetId(PixelShaderIds, Batch.PixelShader, 0xFF);
+		const uint64 Material = GetId(MaterialIds, Batch.Material, 0xFFFF);
+
+		Keys[i].Key = (Depth << 32) | (VS << 24) | (PS << 16) | Material;
+		Keys[i].BatchIndex = InOutIndices[i];
+	}
+
+	SortAndWriteBack(InOutIndices);
+}
+
+void FMeshDrawKeyBuilder::SortAndWriteBack(TArray<int32>& InOutIndices)
+{
+	RadixSort(Keys, ScratchKeys);
+
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		InOutIndices[i] = Keys[i].BatchIndex;
+	}
+}
+
+void FMeshDrawKeyBuilder::RadixSort(TArray<FMeshDrawKey>& InOutKeys, TArray<FMeshDrawKey>& Scratch)
+{
+	const int32 Num = InOutKeys.Num();
+	if (Num < 2)
+	{
+		return;
+	}
+
+	// 한 번의 순회로 8개 바이트 자리의 히스토그램을 모두 계산
+	uint32 Histograms[8][256] = {};
+	for (const FMeshDrawKey& DrawKey : InOutKeys)
+	{
+		for (int32 Byte = 0; Byte < 8; ++Byte)
+		{
+			++Histograms[Byte][(DrawKey.Key >> (Byte * 8)) & 0xFF];
+		}
+	}
+
+	Scratch.SetNum(Num);
+	FMeshDrawKey* Source = InOutKeys.data();
+	FMeshDrawKey* Dest = Scratch.data();
+
+	for (int32 Byte = 0; Byte < 8; ++Byte)
+	{
+		uint32* Counts = Histograms[Byte];
+		const uint32 Shift = Byte * 8;
+
+		// 모든 키가 이 바이트에서 같은 값이면 순서가 바뀌지 않으므로 건너뜀 (상위 ID 바이트는 대부분 0)
+		if (Counts[(Source[0].Key >> Shift) & 0xFF] == static_cast<uint32>(Num))
+		{
+			continue;
+		}
+
+		// 누적 합 → 각 버킷의 시작 위치
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+		{
+			const uint32 Count = Counts[Bucket];
+			Counts[Bucket] = Offset;
+			Offset += Count;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Dest[Counts[(Source[i].Key >> Shift) & 0xFF]++] = Source[i];
+		}
+		std::swap(Source, Dest);
+	}
+
+	// 홀수 번 분배했으면 결과가 Scratch에 있으므로 교환
+	if (Source != InOutKeys.data())
+	{
+		InOutKeys.swap(Scratch);
+	}
+}
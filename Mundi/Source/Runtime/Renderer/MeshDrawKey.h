@@ -0,0 +1,63 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+
+/**
+ * @struct FMeshDrawKey
+ * @brief 드로우 정렬용 64비트 키와 배치 인덱스 쌍입니다.
+ *        FMeshBatchElement 전체 대신 16바이트짜리 키만 정렬하고, 그리기는 BatchIndex로 원본 배치를 참조합니다.
+ *
+ * 불투명:  [63..56] VS | [55..48] PS | [47..32] Material | [31..16] VertexBuffer | [15..0] 깊이 (앞 → 뒤)
+ * 반투명:  [63..32] 깊이 (뒤 → 앞) | [31..24] VS | [23..16] PS | [15..0] Material
+ *
+ * 셰이더 / 머티리얼 / 버퍼는 포인터 대신 프레임마다 처음 등장한 순서로 매긴 작은 ID를 사용합니다.
+ * ID가 필드 폭을 넘으면 최댓값으로 묶이므로 상태 변경이 늘어날 뿐 그리기 결과는 같습니다.
+ */
+struct FMeshDrawKey
+{
+	uint64 Key = 0;
+	int32 BatchIndex = 0;
+};
+
+/**
+ * @class FMeshDrawKeyBuilder
+ * @brief 배치 목록에서 FMeshDrawKey를 만들고 기수 정렬(radix sort)합니다.
+ *        ID 테이블과 정렬 버퍼를 재사용하므로 뷰마다 새로 할당하지 않습니다.
+ */
+class FMeshDrawKeyBuilder
+{
+public:
+	/** @brief 프레임(뷰) 단위 ID 테이블을 비웁니다. (버킷 용량은 유지) */
+	void Reset();
+
+	/**
+	 * @brief InOutIndices가 가리키는 불투명 배치를 GPU 상태 → 앞에서 뒤 순서로 정렬합니다.
+	 * @param InElements 수집된 배치 배열
+	 * @param InOutIndices 정렬할 배치 인덱스 목록 (정렬된 순서로 덮어씀)
+	 * @param ViewLocation 깊이 계산 기준 카메라 위치
+	 */
+	void SortOpaque(const TArray<FMeshBatchElement>& InElements, TArray<int32>& InOutIndices, const FVector& ViewLocation);
+
+	/** @brief InOutIndices가 가리키는 반투명 배치를 뒤에서 앞 순서로 정렬합니다. (같은 깊이는 GPU 상태 순) */
+	void SortTranslucent(const TArray<FMeshBatchElement>& InElements, TArray<int32>& InOutIndices, const FVector& ViewLocation);
+
+	/** @brief 64비트 키를 8비트 단위 LSD 기수 정렬합니다. (모든 키가 같은 바이트 자리는 건너뜀, 안정 정렬) */
+	static void RadixSort(TArray<FMeshDrawKey>& InOutKeys, TArray<FMeshDrawKey>& Scratch);
+
+private:
+	/** @brief 포인터에 대한 이번 프레임 ID (nullptr은 0, 최댓값 MaxId로 포화) */
+	static uint32 GetId(TMap<const void*, uint32>& Ids, const void* Pointer, uint32 MaxId);
+
+	/** @brief 배치 월드 위치와 카메라 사이 거리 제곱의 비트 패턴 (양수 float이므로 정수 비교와 순서가 같음) */
+	static uint32 GetDepthBits(const FMeshBatchElement& Batch, const FVector& ViewLocation);
+
+	void SortAndWriteBack(TArray<int32>& InOutIndices);
+
+	TMap<const void*, uint32> VertexShaderIds;
+	TMap<const void*, uint32> PixelShaderIds;
+	TMap<const void*, uint32> MaterialIds;
+	TMap<const void*, uint32> VertexBufferIds;
+
+	TArray<FMeshDrawKey> Keys;
+	TArray<FMeshDrawKey> ScratchKeys;
+};
@@ -0,0 +1,292 @@
+﻿#include "pch.h"
+#include "MeshInstancing.h"
+#include "MeshBatchElement.h"
+#include "InstancingStats.h"
+#include "Shader.h"
+
+bool FMeshAutoInstancing::bEnabled = true;
+
+namespace
+{
+	/** 같은 상태 구간 안의 인스턴스 그룹 (멤버는 Next 체인으로 연결) */
+	struct FInstanceGroup
+	{
+		int32 Head = -1;	// 목록상 첫 멤버 위치
+		int32 Tail = -1;
+		uint32 Count = 0;
+		int32 MergedIndex = -1;	// 병합된 배치 인덱스 (Count < MinInstancesPerDraw면 -1)
+	};
+
+	// 뷰마다 재사용하는 작업 버퍼
+	TArray<FInstanceGroup> Groups;
+	TArray<int32> GroupOfEntry;	// 목록 위치 → 그룹 번호 (-1이면 인스턴싱 불가)
+	TArray<int32> NextInGroup;	// 목록 위치 → 같은 그룹의 다음 멤버 위치
+	TArray<int32> MergedIndices;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FMeshInstanceRingBuffer
+// ────────────────────────────────────────────────────────────────────────────
+
+FMeshInstanceRingBuffer::~FMeshInstanceRingBuffer()
+{
+	Release();
+}
+
+void FMeshInstanceRingBuffer::Release()
+{
+	if (Buffer)
+	{
+		Buffer->Release();
+		Buffer = nullptr;
+	}
+	Capacity = 0;
+	WriteOffset = 0;
+}
+
+FMeshInstanceData* FMeshInstanceRingBuffer::Lock(D3D11RHI* RHIDevice, uint32 Count, uint32& OutStartInstance)
+{
+	if (!RHIDevice || Count == 0)
+	{
+		return nullptr;
+	}
+
+	// 한 번에 쓸 양보다 작으면 2배씩 키워 다시 생성 (이전 버퍼는 바인딩이 풀리면 D3D가 해제)
+	bool bDiscard = false;
+	if (!Buffer || Count > Capacity)
+	{
+		uint32 NewCapacity = Capacity > 0 ? Capacity : InitialCapacity;
+		while (NewCapacity < Count)
+		{
+			NewCapacity *= 2;
+		}
+
+		Release();
+
+		D3D11_BUFFER_DESC Desc = {};
+		Desc.ByteWidth = NewCapacity * sizeof(FMeshInstanceData);
+		Desc.Usage = D3D11_USAGE_DYNAMIC;
+		Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+		if (FAILED(RHIDevice->GetDevice()->CreateBuffer(&Desc, nullptr, &Buffer)))
+		{
+			UE_LOG("[error] FMeshInstanceRingBuffer: 인스턴스 버퍼 생성 실패 (%u instances)", NewCapacity);
+			Buffer = nullptr;
+			return nullptr;
+		}
+		Capacity = NewCapacity;
+		bDiscard = true;
+	}
+
+	// 끝에 닿으면 처음부터 (GPU가 아직 읽는 이전 내용은 드라이버가 새 메모리로 교체)
+	if (WriteOffset + Count > Capacity)
+	{
+		WriteOffset = 0;
+		bDiscard = true;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	const D3D11_MAP MapType = bDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+	if (FAILED(RHIDevice->GetDeviceContext()->Map(Buffer, 0, MapType, 0, &Mapped)))
+	{
+		return nullptr;
+	}
+
+	OutStartInstance = WriteOffset;
+	WriteOffset += Count;
+	return static_cast<FMeshInstanceData*>(Mapped.pData) + OutStartInstance;
+}
+
+void FMeshInstanceRingBuffer::Unlock(D3D11RHI* RHIDevice)
+{
+	RHIDevice->GetDeviceContext()->Unmap(Buffer, 0);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// FMeshAutoInstancing
+// ────────────────────────────────────────────────────────────────────────────
+
+const FShaderMacro& FMeshAutoInstancing::GetInstancedWorldMacro()
+{
+	static const FShaderMacro Macro = { STATIC_FNAME("INSTANCED_WORLD"), STATIC_FNAME("1") };
+	return Macro;
+}
+
+bool FMeshAutoInstancing::CanInstance(const FMeshBatchElement& Batch)
+{
+	return Batch.InstancedVertexShader && Batch.InstancedPixelShader && Batch.InstancedInputLayout
+		&& !Batch.InstanceBuffer && !Batch.BoneMatricesBuffer;
+}
+
+bool FMeshAutoInstancing::IsSameState(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	return A.VertexShader == B.VertexShader
+		&& A.PixelShader == B.PixelShader
+		&& A.Material == B.Material
+		&& A.VertexBuffer == B.VertexBuffer;
+}
+
+bool FMeshAutoInstancing::IsInstanceCompatible(const FMeshBatchElement& A, const FMeshBatchElement& B)
+{
+	return A.IndexBuffer == B.IndexBuffer
+		&& A.IndexCount == B.IndexCount
+		&& A.StartIndex == B.StartIndex
+		&& A.BaseVertexIndex == B.BaseVertexIndex
+		&& A.VertexStride == B.VertexStride
+		&& A.PrimitiveTopology == B.PrimitiveTopology
+		&& A.InstanceShaderResourceView == B.InstanceShaderResourceView
+		&& A.InstanceColor.R == B.InstanceColor.R
+		&& A.InstanceColor.G == B.InstanceColor.G
+		&& A.InstanceColor.B == B.InstanceColor.B
+		&& A.InstanceColor.A == B.InstanceColor.A;
+}
+
+void FMeshAutoInstancing::MergeBatches(TArray<FMeshBatchElement>& InOutElements, TArray<int32>& InOutIndices,
+	FMeshInstanceRingBuffer& InstanceBuffer, D3D11RHI* RHIDevice, FInstancingStats& OutStats)
+{
+	const int32 NumEntries = InOutIndices.Num();
+	OutStats.OpaqueBatches = NumEntries;
+	OutStats.DrawCalls = NumEntries;
+
+	if (!bEnabled || NumEntries < static_cast<int32>(MinInstancesPerDraw))
+	{
+		return;
+	}
+
+	// --- 1. 같은 상태 구간마다 인스턴스 그룹 구성 ---
+	Groups.Empty();
+	GroupOfEntry.SetNum(NumEntries);
+	NextInGroup.SetNum(NumEntries);
+
+	int32 RunStart = 0;
+	while (RunStart < NumEntries)
+	{
+		const FMeshBatchElement& RunBatch = InOutElements[InOutIndices[RunStart]];
+		int32 RunEnd = RunStart + 1;
+		while (RunEnd < NumEntries && IsSameState(RunBatch, InOutElements[InOutIndices[RunEnd]]))
+		{
+			++RunEnd;
+		}
+
+		const int32 FirstGroupInRun = Groups.Num();
+		for (int32 Entry = RunStart; Entry < RunEnd; ++Entry)
+		{
+			GroupOfEntry[Entry] = -1;
+			NextInGroup[Entry] = -1;
+
+			const FMeshBatchElement& Batch = InOutElements[InOutIndices[Entry]];
+			if (!CanInstance(Batch))
+			{
+				continue;
+			}
+
+			// 구간 안의 그룹 수는 메시 섹션 수 정도라 선형 탐색으로 충분
+			int32 GroupIndex = -1;
+			for (int32 Candidate = FirstGroupInRun; Candidate < Groups.Num(); ++Candidate)
+			{
+				if (IsInstanceCompatible(InOutElements[InOutIndices[Groups[Candidate].Head]], Batch))
+				{
+					GroupIndex = Candidate;
+					break;
+				}
+			}
+
+			if (GroupIndex < 0)
+			{
+				GroupIndex = Groups.Emplace();
+				Groups[GroupIndex].Head = Entry;
+			}
+			else
+			{
+				NextInGroup[Groups[GroupIndex].Tail] = Entry;
+			}
+
+			FInstanceGroup& Group = Groups[GroupIndex];
+			Group.Tail = Entry;
+			++Group.Count;
+			GroupOfEntry[Entry] = GroupIndex;
+		}
+
+		RunStart = RunEnd;
+	}
+
+	// --- 2. 인스턴스 데이터를 링 버퍼에 한 번에 기록 ---
+	uint32 TotalInstances = 0;
+	for (const FInstanceGroup& Group : Groups)
+	{
+		if (Group.Count >= MinInstancesPerDraw)
+		{
+			TotalInstances += Group.Count;
+		}
+	}
+
+	if (TotalInstances == 0)
+	{
+		return;
+	}
+
+	uint32 StartInstance = 0;
+	FMeshInstanceData* InstanceData = InstanceBuffer.Lock(RHIDevice, TotalInstances, StartInstance);
+	if (!InstanceData)
+	{
+		return;
+	}
+
+	for (FInstanceGroup& Group : Groups)
+	{
+		if (Group.Count < MinInstancesPerDraw)
+		{
+			continue;
+		}
+
+		// 그룹 첫 배치를 복사해 인스턴스 배치로 만듦 (Add 중 재할당될 수 있으므로 값 복사)
+		FMeshBatchElement Merged = InOutElements[InOutIndices[Group.Head]];
+		Merged.VertexShader = Merged.InstancedVertexShader;
+		Merged.PixelShader = Merged.InstancedPixelShader;
+		Merged.InputLayout = Merged.InstancedInputLayout;
+		Merged.InstanceBuffer = InstanceBuffer.GetBuffer();
+		Merged.InstanceStride = sizeof(FMeshInstanceData);
+		Merged.NumInstances = Group.Count;
+		Merged.StartInstanceLocation = StartInstance;
+		Merged.WorldMatrix = FMatrix::Identity();
+		Merged.ObjectID = 0;
+
+		for (int32 Entry = Group.Head; Entry >= 0; Entry = NextInGroup[Entry])
+		{
+			const FMeshBatchElement& Member = InOutElements[InOutIndices[Entry]];
+			InstanceData->WorldMatrix = Member.WorldMatrix;
+			InstanceData->WorldInverseTranspose = Member.WorldMatrix.InverseAffine().Transpose();
+			InstanceData->ObjectID = Member.ObjectID;
+			++InstanceData;
+		}
+		StartInstance += Group.Count;
+
+		Group.MergedIndex = InOutElements.Num();
+		InOutElements.Add(Merged);
+
+		++OutStats.InstancedDraws;
+		OutStats.InstancedBatches += Group.Count;
+	}
+
+	InstanceBuffer.Unlock(RHIDevice);
+
+	// --- 3. 그릴 목록 재구성 (그룹은 첫 멤버 위치에 한 번만) ---
+	MergedIndices.Empty();
+	for (int32 Entry = 0; Entry < NumEntries; ++Entry)
+	{
+		const int32 GroupIndex = GroupOfEntry[Entry];
+		if (GroupIndex < 0 || Groups[GroupIndex].MergedIndex < 0)
+		{
+			MergedIndices.Add(InOutIndices[Entry]);
+		}
+		else if (Groups[GroupIndex].Head == Entry)
+		{
+			MergedIndices.Add(Groups[GroupIndex].MergedIndex);
+		}
+	}
+	InOutIndices.swap(MergedIndices);
+
+	OutStats.DrawCalls = InOutIndices.Num();
+	OutStats.InstanceBufferBytes = InstanceBuffer.GetCapacityBytes();
+}
@@ -0,0 +1,98 @@
+﻿#pragma once
+
+struct FMeshBatchElement;
+struct FShaderMacro;
+struct FInstancingStats;
+class D3D11RHI;
+
+// ────────────────────────────────────────────────────────────────────────────
+// MeshInstancing.h
+// 같은 메시 / 머티리얼 / 셰이더를 쓰는 불투명 배치를 인스턴스 드로우 하나로 병합
+// ────────────────────────────────────────────────────────────────────────────
+
+/**
+ * 인스턴스 하나의 버텍스 스트림 데이터 (슬롯 1, UberLit의 INSTANCED_WORLD 입력과 일치해야 함)
+ * ModelBufferType(b0)과 ColorBufferType(b3)의 UUID를 인스턴스별로 옮긴 것입니다.
+ */
+struct FMeshInstanceData
+{
+	FMatrix WorldMatrix;			// INSTANCE_WORLD0~3
+	FMatrix WorldInverseTranspose;	// INSTANCE_NORMAL0~3
+	uint32 ObjectID = 0;			// INSTANCE_ID (피킹)
+	uint32 Padding[3] = {};
+};
+
+/**
+ * @class FMeshInstanceRingBuffer
+ * @brief 인스턴스 데이터용 동적 버텍스 버퍼 (링 버퍼)
+ *
+ * 뷰마다 필요한 만큼 이어서 쓰고(WRITE_NO_OVERWRITE), 끝에 닿으면 처음부터 다시 씁니다(WRITE_DISCARD).
+ * 드로우는 StartInstanceLocation으로 자기 구간을 가리키므로 이전 뷰가 쓴 데이터를 덮어쓰지 않습니다.
+ */
+class FMeshInstanceRingBuffer
+{
+public:
+	static constexpr uint32 InitialCapacity = 4096;
+
+	FMeshInstanceRingBuffer() = default;
+	~FMeshInstanceRingBuffer();
+
+	FMeshInstanceRingBuffer(const FMeshInstanceRingBuffer&) = delete;
+	FMeshInstanceRingBuffer& operator=(const FMeshInstanceRingBuffer&) = delete;
+
+	/**
+	 * @brief Count개 인스턴스를 쓸 영역을 맵핑합니다. (용량이 모자라면 버퍼를 키움)
+	 * @param OutStartInstance 쓴 영역의 첫 인스턴스 위치 (DrawIndexedInstanced의 StartInstanceLocation)
+	 * @return 쓰기 포인터 (실패 시 nullptr, 이 경우 Unlock을 호출하지 않음)
+	 */
+	FMeshInstanceData* Lock(D3D11RHI* RHIDevice, uint32 Count, uint32& OutStartInstance);
+	void Unlock(D3D11RHI* RHIDevice);
+
+	ID3D11Buffer* GetBuffer() const { return Buffer; }
+	uint32 GetCapacityBytes() const { return Capacity * sizeof(FMeshInstanceData); }
+
+	void Release();
+
+private:
+	ID3D11Buffer* Buffer = nullptr;
+	uint32 Capacity = 0;		// 인스턴스 단위
+	uint32 WriteOffset = 0;		// 다음에 쓸 인스턴스 위치
+};
+
+/**
+ * @class FMeshAutoInstancing
+ * @brief 정렬된 불투명 배치 목록에서 호환되는 배치를 찾아 인스턴스 드로우로 병합합니다.
+ *
+ * 1. 정렬 키상 연속인 같은 상태 구간(VS / PS / Material / VB) 안에서
+ *    같은 IB 구간, 같은 색상을 쓰는 배치를 그룹으로 묶음 (섹션이 깊이 순으로 섞여 있어도 찾을 수 있음)
+ * 2. MinInstancesPerDraw개 이상인 그룹은 인스턴스 데이터를 링 버퍼에 한 번에 쓰고
+ *    INSTANCED_WORLD 셰이더를 쓰는 배치 하나로 대체 (그룹 첫 배치 위치에 그림)
+ * 3. 인스턴싱 변형 셰이더가 없는 배치(스키닝, UberLit 외 셰이더 등)는 그대로 둠
+ */
+class FMeshAutoInstancing
+{
+public:
+	static constexpr uint32 MinInstancesPerDraw = 2;
+
+	static bool IsEnabled() { return bEnabled; }
+	static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	/** @brief 인스턴싱 변형 셰이더를 컴파일할 때 추가하는 매크로 (INSTANCED_WORLD=1) */
+	static const FShaderMacro& GetInstancedWorldMacro();
+
+	/**
+	 * @brief InOutIndices가 가리키는 배치를 병합합니다.
+	 * @param InOutElements 배치 배열 (병합된 인스턴스 배치가 뒤에 추가됨)
+	 * @param InOutIndices 그릴 순서의 배치 인덱스 목록 (병합 결과로 덮어씀)
+	 * @param OutStats 이 뷰의 병합 통계
+	 */
+	static void MergeBatches(TArray<FMeshBatchElement>& InOutElements, TArray<int32>& InOutIndices,
+		FMeshInstanceRingBuffer& InstanceBuffer, D3D11RHI* RHIDevice, FInstancingStats& OutStats);
+
+private:
+	static bool CanInstance(const FMeshBatchElement& Batch);
+	static bool IsSameState(const FMeshBatchElement& A, const FMeshBatchElement& B);
+	static bool IsInstanceCompatible(const FMeshBatchElement& A, const FMeshBatchElement& B);
+
+	static bool bEnabled;
+};
@@ -0,0 +1,80 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// CPU 오클루전 컬링 통계 구조체
+// 한 프레임 동안 모든 뷰의 오클루더 래스터화 / 가림 판정 결과를 누적
+struct FOcclusionStats
+{
+	uint32 Views = 0;               // 오클루전 컬링을 수행한 뷰 수
+	uint32 Occluders = 0;           // 깊이 버퍼에 그린 오클루더 메시 수
+	uint32 OccluderTriangles = 0;   // 오클루더 삼각형 수
+	uint32 RasterizedTriangles = 0; // 클리핑 / 타일 기각 후 실제로 타일을 순회한 삼각형 수
+	uint32 TestedObjects = 0;       // HZB로 판정한 메시 수 (절두체 컬링 통과분)
+	uint32 CulledObjects = 0;       // 가려져서 제외된 메시 수
+	float RasterTimeMS = 0.0f;      // 래스터화 + HZB 생성 시간
+	float TestTimeMS = 0.0f;        // 가림 판정 시간
+
+	// 모든 통계를 0으로 리셋
+	void Reset()
+	{
+		Views = 0;
+		Occluders = 0;
+		OccluderTriangles = 0;
+		RasterizedTriangles = 0;
+		TestedObjects = 0;
+		CulledObjects = 0;
+		RasterTimeMS = 0.0f;
+		TestTimeMS = 0.0f;
+	}
+
+	// 판정한 메시 중 가려진 비율 (%)
+	float GetCulledPercent() const
+	{
+		return TestedObjects > 0 ? 100.0f * static_cast<float>(CulledObjects) / static_cast<float>(TestedObjects) : 0.0f;
+	}
+};
+
+// CPU 오클루전 컬링 통계 전역 매니저 (싱글톤)
+// UStatsOverlayD2D에서 접근할 수 있도록 전역 통계 제공
+class FOcclusionStatManager
+{
+public:
+	static FOcclusionStatManager& GetInstance()
+	{
+		static FOcclusionStatManager Instance;
+		return Instance;
+	}
+
+	// 매 프레임 렌더링 시작 시 호출 (URenderer::BeginFrame)
+	void ResetFrameStats()
+	{
+		CurrentStats.Reset();
+	}
+
+	// 뷰 하나의 결과를 누적
+	void AddViewStats(const FOcclusionStats& InStats)
+	{
+		CurrentStats.Views += InStats.Views;
+		CurrentStats.Occluders += InStats.Occluders;
+		CurrentStats.OccluderTriangles += InStats.OccluderTriangles;
+		CurrentStats.RasterizedTriangles += InStats.RasterizedTriangles;
+		CurrentStats.TestedObjects += InStats.TestedObjects;
+		CurrentStats.CulledObjects += InStats.CulledObjects;
+		CurrentStats.RasterTimeMS += InStats.RasterTimeMS;
+		CurrentStats.TestTimeMS += InStats.TestTimeMS;
+	}
+
+	// 통계 조회
+	const FOcclusionStats& GetStats() const
+	{
+		return CurrentStats;
+	}
+
+private:
+	FOcclusionStatManager() = default;
+	~FOcclusionStatManager() = default;
+	FOcclusionStatManager(const FOcclusionStatManager&) = delete;
+	FOcclusionStatManager& operator=(const FOcclusionStatManager&) = delete;
+
+	FOcclusionStats CurrentStats;
+};
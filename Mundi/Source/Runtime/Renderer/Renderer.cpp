@@ -32,6 +32,8 @@
 #include "SceneRenderer.h"
 #include "SceneView.h"
 #include "SkinningStats.h"
+#include "InstancingStats.h"
+#include "OcclusionStats.h"
 #include "PlatformTime.h"
 
 #include <Windows.h>
@@ -67,6 +69,8 @@ URenderer::~URenderer()
 		}
 	}
 	DeferredReleaseQueue.Empty();
+
+	MeshInstanceBuffer.Release();
 }
 
 void URenderer::BeginFrame()
@@ -78,8 +82,10 @@ void URenderer::BeginFrame()
 	// 지연 해제 큐 처리 (GPU 안전성 확보)
 	ProcessDeferredReleases();
 
-	// 프레임별 통계 초기화 (데칼, 스키닝)
+	// 프레임별 통계 초기화 (데칼, 스키닝, 인스턴싱, 오클루전)
 	FDecalStatManager::GetInstance().ResetFrameStats();
+	FInstancingStatManager::GetInstance().ResetFrameStats();
+	FOcclusionStatManager::GetInstance().ResetFrameStats();
 
 	// 이전 프레임의 GPU draw 시간 가져오기 (비동기, N-7 프레임 결과)
 	double LastGPUDrawTimeMS = FSkinningStatManager::GetInstance().GetGPUDrawTimeMS(RHIDevice->GetDeviceContext());
@@ -114,8 +120,11 @@ void URenderer::EndFrame()
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// 오클루전 컬링 상태는 뷰포트가 소유합니다. (지난 프레임에 보인 오클루더를 이어서 사용, 뷰포트와 함께 해제)
+	FOcclusionCullingManagerCPU* OcclusionCuller = Viewport ? Viewport->GetOcclusionCuller() : nullptr;
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
-	FSceneRenderer SceneRenderer(World, View, this);
+	FSceneRenderer SceneRenderer(World, View, this, OcclusionCuller);
 
 	// 실제로 렌더를 수행합니다.
 	SceneRenderer.Render();
@@ -155,10 +164,7 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
 
 	if (PickedId == 0)
 		return nullptr;
-	auto it = GUObjectArray.find(PickedId);
-	if (it == GUObjectArray.end())
-		return nullptr;
-	return Cast<UPrimitiveComponent>(it->second);
+	return Cast<UPrimitiveComponent>(GUObjectArray.IndexToObject(PickedId));
 }
 
 void URenderer::InitializeLineBatch()
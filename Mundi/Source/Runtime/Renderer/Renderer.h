@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "RHIDevice.h"
 #include "LineDynamicMesh.h"
+#include "MeshInstancing.h"
 
 class UStaticMeshComponent;
 class UTextRenderComponent;
@@ -74,6 +75,9 @@ public:
 	// Deferred buffer release system (GPU-safe resource management)
 	void DeferredReleaseBuffer(ID3D11Buffer* Buffer);
 
+	// 자동 인스턴싱 인스턴스 데이터 링 버퍼 (모든 뷰가 공유)
+	FMeshInstanceRingBuffer& GetMeshInstanceBuffer() { return MeshInstanceBuffer; }
+
 	// ===== Highlight System (아이템 하이라이트용) =====
 	/** 오브젝트에 하이라이트 추가 (ObjectID 기반) */
 	void AddHighlight(uint32 ObjectID, const FLinearColor& OutlineColor = FLinearColor(1.0f, 0.8f, 0.2f, 1.0f));
@@ -99,6 +103,8 @@ private:
 
 	TArray<FDeferredRelease> DeferredReleaseQueue;
 	void ProcessDeferredReleases();
+
+	FMeshInstanceRingBuffer MeshInstanceBuffer;
 	D3D11RHI* RHIDevice;    // NOTE: 개발 편의성을 위해서 DX11를 종속적으로 사용한다 (URHIDevice를 사용하지 않음)
 
 	// Current viewport size (per FViewport draw); 0 if unset
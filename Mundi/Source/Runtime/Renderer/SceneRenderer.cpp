@@ -23,6 +23,7 @@
 #include "SkeletalMeshComponent.h"
 #include "DecalStatManager.h"
 #include "SkinningStats.h"
+#include "InstancingStats.h"
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "OBB.h"
@@ -47,6 +48,7 @@
 #include "TriangleMeshComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "Hash.h"
 #include "PlatformTime.h"
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
@@ -64,14 +66,16 @@
 #include "RagdollDebugRenderer.h"
 #include "SkyboxComponent.h"
 
-FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer)
+uint32 FSceneRenderer::NextFrustumCullingStamp = 1;
+FMeshBatchCollection FSceneRenderer::FrameMeshBatches;
+
+FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FOcclusionCullingManagerCPU* InOcclusionCuller)
 	: World(InWorld)
 	, View(InView) // 전달받은 FSceneView 저장
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
+	, OcclusionCuller(InOcclusionCuller)
 {
-	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
-
 	// 타일 라이트 컬러 초기화
 	TileLightCuller = std::make_unique<FTileLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
@@ -83,6 +87,7 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 
 FSceneRenderer::~FSceneRenderer()
 {
+	ReleaseMeshBatches();
 }
 
 //====================================================================================
@@ -98,6 +103,16 @@ void FSceneRenderer::Render()
     // 렌더링할 대상 수집 (Cull + Gather)
     GatherVisibleProxies();
 
+	// 가려진 메시 제외 (배치 수집 전에 해야 스키닝 / 배치 생성 비용도 줄어듦)
+	TIME_PROFILE(OcclusionCulling)
+	PerformOcclusionCulling();
+	TIME_PROFILE_END(OcclusionCulling)
+
+	// 메시 배치 수집 (그림자 / 메인 패스 공용, 스키닝도 여기서 한 번만 수행)
+	TIME_PROFILE(MeshBatchCollect)
+	CollectMeshBatches();
+	TIME_PROFILE_END(MeshBatchCollect)
+
 	TIME_PROFILE(ShadowMapPass)
 	RenderShadowMaps();
 	TIME_PROFILE_END(ShadowMapPass)
@@ -311,26 +326,16 @@ void FSceneRenderer::RenderShadowMaps()
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
-	// 2. 그림자 캐스터(Caster) 메시 수집 (반투명 제외 - 깊이만 기록하므로 alpha 정보 표현 불가)
-	TArray<FMeshBatchElement> AllShadowBatches;
-	for (UMeshComponent* MeshComponent : Proxies.Meshes)
-	{
-		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
-		{
-			MeshComponent->CollectMeshBatches(AllShadowBatches, View);
-		}
-	}
+	// 2. 그림자 캐스터(Caster) 배치는 CollectMeshBatches에서 이미 수집됨 (반투명 제외 - 깊이만 기록하므로 alpha 정보 표현 불가)
+	// 섀도우 뷰마다 절두체와 겹치는 캐스터만 골라 그림 (GatherShadowViewCasters)
+	const TArray<FMeshBatchElement>& ShadowElements = FrameMeshBatches.Elements;
+	TArray<int32> ViewCasterBatches;
 
-	// 불투명 배치만 필터링 (단일 패스 O(n))
-	TArray<FMeshBatchElement> ShadowMeshBatches;
-	ShadowMeshBatches.Reserve(AllShadowBatches.Num());
-	for (const FMeshBatchElement& Batch : AllShadowBatches)
-	{
-		if (Batch.RenderMode == EBatchRenderMode::Opaque)
-		{
-			ShadowMeshBatches.Add(Batch);
-		}
-	}
+	// 섀도우 뷰 캐시 통계
+	uint32 CacheHits = 0;
+	uint32 CacheMisses = 0;
+	uint32 CacheUncacheable = 0;
+	uint32 CasterDrawCalls = 0;
 
 	// NOTE: 카메라 오버라이드 기능을 항상 활성화 하기 위해서 그림자를 그릴 곳이 없어도 함수 실행
 	//if (ShadowMeshBatches.IsEmpty()) return;
@@ -423,7 +428,6 @@ void FSceneRenderer::RenderShadowMaps()
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
-			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
 			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
 			switch (ShadowAAType)
 			{
@@ -431,33 +435,50 @@ void FSceneRenderer::RenderShadowMaps()
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
 				break;
 			case EShadowAATechnique::VSM:
-				{
-					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
-					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
-					break;
-				}				
+				RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
+				break;
 			default:
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
 				break;
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
-
+			// 아틀라스 영역은 프레임 간 유지되므로 전체를 지우지 않고, 다시 그리는 영역만 ClearShadowViewport로 지움
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
 			for (FShadowRenderRequest& Request : Requests2D)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
-
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
-
 				FShadowMapData Data;
-				if (Request.Size > 0) // 렌더링 성공
+				if (Request.Size > 0) // 할당 성공
 				{
+					// 라이트와 절두체 안 캐스터가 그대로면 지난번 내용을 재사용
+					const uint64 ContentHash = GatherShadowViewCasters(Request, ViewCasterBatches);
+					if (LightManager->IsShadowViewCached(Request, ContentHash))
+					{
+						++CacheHits;
+					}
+					else
+					{
+						// 뷰포트 설정
+						D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+						RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+						// 영역 초기화 후 뎁스 패스 렌더링
+						ClearShadowViewport();
+						RenderShadowDepthPass(Request, ShadowElements, ViewCasterBatches);
+						LightManager->SetShadowViewContentHash(Request, ContentHash);
+
+						if (ContentHash != 0)
+						{
+							++CacheMisses;
+						}
+						else
+						{
+							++CacheUncacheable;
+						}
+						CasterDrawCalls += ViewCasterBatches.Num();
+					}
+
 					Data.ShadowViewProjMatrix = Request.ViewMatrix * Request.ProjectionMatrix * BiasMatrix;
 					Data.AtlasScaleOffset = Request.AtlasScaleOffset;
 					Data.ShadowBias = Request.LightOwner->GetShadowBias();
@@ -511,9 +532,28 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
+					// 면 단위 캐시 (슬라이스는 라이트가 요청하는 동안 유지됨)
+					const uint64 ContentHash = GatherShadowViewCasters(Request, ViewCasterBatches);
+					if (LightManager->IsShadowViewCached(Request, ContentHash))
+					{
+						++CacheHits;
+						continue;
+					}
+
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					RenderShadowDepthPass(Request, ShadowElements, ViewCasterBatches);
+					LightManager->SetShadowViewContentHash(Request, ContentHash);
+
+					if (ContentHash != 0)
+					{
+						++CacheMisses;
+					}
+					else
+					{
+						++CacheUncacheable;
+					}
+					CasterDrawCalls += ViewCasterBatches.Num();
 				}
 			}
 		}
@@ -530,17 +570,12 @@ void FSceneRenderer::RenderShadowMaps()
 	// ViewProjBufferType 복구 (라이트 시점 Override 일 경우 마지막 라이트 시점으로 설정됨)
 	RHIDevice->SetAndUpdateConstantBuffer(ViewProjBufferType(OriginViewProjBuffer));
 
-	// Release GPU skinning bone buffers
-	for (const FMeshBatchElement& Batch : ShadowMeshBatches)
-	{
-		if (Batch.BoneMatricesBuffer)
-		{
-			Batch.BoneMatricesBuffer->Release();
-		}
-	}
+	FShadowStatManager::GetInstance().UpdateCacheStats(CacheHits, CacheMisses, CacheUncacheable, CasterDrawCalls, LightManager->GetShadowAtlasUsage2D());
+
+	// NOTE: GPU 스키닝 본 버퍼는 메인 패스와 공유하므로 ReleaseMeshBatches에서 한 번만 해제
 }
 
-void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches)
+void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InElements, const TArray<int32>& InShadowBatchIndices)
 {
 	// 1. 뎁스 전용 셰이더 로드
 	UShader* DepthVS = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/DepthOnly_VS.hlsl");
@@ -553,8 +588,8 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	// GPU 스키닝용 셰이더 variant
 	TArray<FShaderMacro> GPUSkinningMacros;
 	FShaderMacro GPUSkinningMacro;
-	GPUSkinningMacro.Name = FName("GPU_SKINNING");
-	GPUSkinningMacro.Definition = FName("1");
+	GPUSkinningMacro.Name = STATIC_FNAME("GPU_SKINNING");
+	GPUSkinningMacro.Definition = STATIC_FNAME("1");
 	GPUSkinningMacros.Add(GPUSkinningMacro);
 	FShaderVariant* GPUSkinningShaderVariant = DepthVS->GetOrCompileShaderVariant(GPUSkinningMacros);
 
@@ -597,8 +632,10 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	RHIDevice->GetDeviceContext()->IASetInputLayout(ShaderVariant->InputLayout);
 	RHIDevice->GetDeviceContext()->VSSetShader(ShaderVariant->VertexShader, nullptr, 0);
 
-	for (const FMeshBatchElement& Batch : InShadowBatches)
+	for (int32 BatchIndex : InShadowBatchIndices)
 	{
+		const FMeshBatchElement& Batch = InElements[BatchIndex];
+
 		// 버퍼 유효성 검사 - null 버퍼는 스킵
 		if (!Batch.VertexBuffer || !Batch.IndexBuffer)
 		{
@@ -653,6 +690,113 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 }
 
 
+namespace
+{
+	// 패딩 없는 POD 값(행렬 / 벡터)의 비트 패턴을 해시에 섞음
+	template<typename T>
+	uint64 HashPodBits(uint64 Seed, const T& Value)
+	{
+		static_assert(sizeof(T) % sizeof(uint32) == 0, "HashPodBits: 4바이트 단위 타입만 지원");
+		const uint8* Bytes = reinterpret_cast<const uint8*>(&Value);
+		for (size_t Offset = 0; Offset < sizeof(T); Offset += sizeof(uint32))
+		{
+			uint32 Word;
+			std::memcpy(&Word, Bytes + Offset, sizeof(uint32));
+			Seed = HashCombine(Seed, Word);
+		}
+		return Seed;
+	}
+
+	uint64 HashPointer(uint64 Seed, const void* Pointer)
+	{
+		return HashCombine(Seed, static_cast<uint64>(reinterpret_cast<uintptr_t>(Pointer)));
+	}
+}
+
+uint64 FSceneRenderer::GatherShadowViewCasters(const FShadowRenderRequest& ShadowRequest, TArray<int32>& OutBatchIndices) const
+{
+	OutBatchIndices.Empty();
+
+	const TArray<FMeshBatchElement>& Elements = FrameMeshBatches.Elements;
+	const TArray<int32>& ShadowBatches = FrameMeshBatches.ShadowOpaque;
+	const TArray<FShadowCasterInfo>& CasterInfos = FrameMeshBatches.ShadowCasterInfos;
+
+	// 섀도우 래스터라이저는 깊이 클리핑을 하므로 near / far 평면 밖 캐스터도 섀도우 맵에 닿지 않음
+	const FFrustum ShadowFrustum = CreateFrustumFromViewProjection(ShadowRequest.ViewMatrix * ShadowRequest.ProjectionMatrix);
+
+	uint64 CasterHashSum = 0;
+	bool bCacheable = true;
+	for (int32 Index = 0; Index < ShadowBatches.Num(); ++Index)
+	{
+		const FShadowCasterInfo& Caster = CasterInfos[Index];
+		if (Caster.bHasBounds && !IsAABBVisible(ShadowFrustum, Caster.Bounds))
+		{
+			continue;
+		}
+
+		const int32 BatchIndex = ShadowBatches[Index];
+		OutBatchIndices.Add(BatchIndex);
+		bCacheable &= !Caster.bDeforming;
+
+		const FMeshBatchElement& Batch = Elements[BatchIndex];
+		uint64 BatchHash = HashPointer(0, Batch.VertexBuffer);
+		BatchHash = HashPointer(BatchHash, Batch.IndexBuffer);
+		BatchHash = HashCombine(BatchHash, Batch.StartIndex);
+		BatchHash = HashCombine(BatchHash, Batch.IndexCount);
+		BatchHash = HashCombine(BatchHash, static_cast<uint32>(Batch.BaseVertexIndex));
+		BatchHash = HashPodBits(BatchHash, Batch.WorldMatrix);
+
+		// 캐스터 수집 순서가 바뀌어도 같은 집합이면 같은 값이 되도록 합산
+		CasterHashSum += BatchHash;
+	}
+
+	if (!bCacheable)
+	{
+		return 0;
+	}
+
+	// 라이트 시점 / 아틀라스 영역 / 깊이 셰이더 입력이 같아야 같은 내용
+	uint64 Hash = HashCombine(CasterHashSum, static_cast<uint64>(OutBatchIndices.Num()));
+	Hash = HashPodBits(Hash, ShadowRequest.ViewMatrix);
+	Hash = HashPodBits(Hash, ShadowRequest.ProjectionMatrix);
+	Hash = HashPodBits(Hash, ShadowRequest.WorldLocation);
+	Hash = HashPodBits(Hash, ShadowRequest.Radius);
+	Hash = HashPodBits(Hash, ShadowRequest.AtlasViewportOffset);
+	Hash = HashCombine(Hash, ShadowRequest.Size);
+	Hash = HashCombine(Hash, static_cast<uint32>(ShadowRequest.SubViewIndex));
+	Hash = HashCombine(Hash, static_cast<uint32>(ShadowRequest.AssignedSliceIndex));
+	Hash = HashCombine(Hash, static_cast<uint64>(World->GetRenderSettings().GetShadowAATechnique()));
+
+	// 0은 "캐시 불가"로 예약
+	return Hash != 0 ? Hash : 1;
+}
+
+void FSceneRenderer::ClearShadowViewport()
+{
+	// D3D11은 DSV의 일부 영역만 지울 수 없으므로 z = 1인 사각형을 GreaterEqual(쓰기)로 그려 현재 뷰포트만 초기화
+	UShader* ClearShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear.hlsl");
+	if (!ClearShader)
+	{
+		return;
+	}
+
+	FShaderVariant* ClearVariant = ClearShader->GetOrCompileShaderVariant();
+	if (!ClearVariant || !ClearVariant->VertexShader || !ClearVariant->PixelShader)
+	{
+		return;
+	}
+
+	// 섀도우 래스터라이저의 깊이 바이어스가 들어가지 않도록 Solid로 그림
+	RHIDevice->RSSetState(ERasterizerMode::Solid);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::GreaterEqual);
+	RHIDevice->GetDeviceContext()->VSSetShader(ClearVariant->VertexShader, nullptr, 0);
+	RHIDevice->GetDeviceContext()->PSSetShader(ClearVariant->PixelShader, nullptr, 0);
+	RHIDevice->DrawFullScreenQuad();
+
+	RHIDevice->RSSetState(ERasterizerMode::Shadows);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+}
+
 //====================================================================================
 // Private 헬퍼 함수 구현
 //====================================================================================
@@ -735,9 +879,10 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
-	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
-	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
-	//PerformFrustumCulling();
+	// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleComponents에 저장됨
+	TIME_PROFILE(FrustumCulling)
+	PerformFrustumCulling();
+	TIME_PROFILE_END(FrustumCulling)
 
 	const bool bDrawStaticMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_StaticMeshes);
 	const bool bDrawSkeletalMeshes = World->GetRenderSettings().IsShowFlagEnabled(EEngineShowFlags::SF_SkeletalMeshes);
@@ -808,7 +953,11 @@ void FSceneRenderer::GatherVisibleProxies()
 
 						if (bShouldAdd)
 						{
-							Proxies.Meshes.Add(MeshComponent);
+							Proxies.ShadowCasters.Add(MeshComponent);
+							if (!IsFrustumCulled(MeshComponent))
+							{
+								Proxies.Meshes.Add(MeshComponent);
+							}
 						}
 					}
 					else if (UBillboardComponent* BillboardComponent = Cast<UBillboardComponent>(PrimitiveComponent); BillboardComponent && bUseBillboard)
@@ -963,7 +1112,8 @@ void FSceneRenderer::PerformTileLightCulling()
 			View->NearClip,
 			View->FarClip,
 			ViewportWidth,
-			ViewportHeight
+			ViewportHeight,
+			View->ProjectionMode == ECameraProjectionMode::Orthographic
 		);
 
 		// 통계를 전역 매니저에 업데이트
@@ -979,6 +1129,12 @@ void FSceneRenderer::PerformTileLightCulling()
 	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
 	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
+	TileCullingBuffer.DepthSliceCount = FTileLightCuller::DepthSliceCount;
+	TileCullingBuffer.Padding = 0;
+	TileCullingBuffer.DepthSliceScale = TileLightCuller->GetDepthSliceScale();
+	TileCullingBuffer.DepthSliceBias = TileLightCuller->GetDepthSliceBias();
+	TileCullingBuffer.Padding2[0] = 0.0f;
+	TileCullingBuffer.Padding2[1] = 0.0f;
 
 	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
 
@@ -995,89 +1151,258 @@ void FSceneRenderer::PerformTileLightCulling()
 
 void FSceneRenderer::PerformFrustumCulling()
 {
-	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
+	PotentiallyVisibleComponents.clear();
+	FrustumCullingEpoch = 0;
 
-	// Todo: 프로스텀 컬링 수행, 추후 프로스텀 컬링이 컴포넌트 단위로 변경되면 적용
+	UWorldPartitionManager* Partition = World->GetPartitionManager();
+	FBVHierarchy* BVH = Partition ? Partition->GetBVH() : nullptr;
+	if (!BVH)
+	{
+		return;
+	}
 
-	//World->GetPartitionManager()->FrustumQuery(ViewFrustum)
+	// 리빌드 대기 중이면 이번 뷰는 컬링하지 않음 (모두 그림)
+	if (!Partition->FrustumQuery(View->ViewFrustum, PotentiallyVisibleComponents))
+	{
+		return;
+	}
 
-	//for (AActor* Actor : World->GetActors())
-	//{
-	//	if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+	// 통과한 컴포넌트에 이번 쿼리 번호를 찍어 GatherVisibleProxies에서 O(1)로 판정
+	FrustumCullingStamp = NextFrustumCullingStamp++;
+	for (UPrimitiveComponent* Component : PotentiallyVisibleComponents)
+	{
+		Component->SetFrustumVisibleStamp(FrustumCullingStamp);
+	}
+	FrustumCullingEpoch = BVH->GetEpoch();
+}
 
-	//	// 절두체 컬링을 통과한 액터만 목록에 추가
-	//	if (ViewFrustum.Intersects(Actor->GetBounds()))
-	//	{
-	//		PotentiallyVisibleActors.Add(Actor);
-	//	}
-	//}
+bool FSceneRenderer::IsFrustumCulled(const UPrimitiveComponent* Component) const
+{
+	// BVH가 현재 바운드를 갖고 있는 컴포넌트만 컬링 (이동 후 파티션 갱신 대기 중이거나 바운드가 없는 컴포넌트는 보수적으로 그림)
+	return FrustumCullingEpoch != 0
+		&& Component->GetPartitionBoundsEpoch() == FrustumCullingEpoch
+		&& Component->GetFrustumVisibleStamp() != FrustumCullingStamp;
 }
 
-void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
+// 오클루더로 쓸 수 있으면 CPU 메시 데이터를 반환 (불투명 스태틱 메시, 삼각형 수 제한)
+static const FStaticMesh* GetOccluderMesh(UMeshComponent* MeshComponent)
 {
-	// --- 1. 수집 (Collect) ---
-	TArray<FMeshBatchElement> AllBatches;
+	UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(MeshComponent);
+	UStaticMesh* StaticMesh = StaticMeshComponent ? StaticMeshComponent->GetStaticMesh() : nullptr;
+	const FStaticMesh* MeshAsset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+	if (!MeshAsset || MeshAsset->Indices.Num() / 3 > static_cast<int32>(FOcclusionCullingManagerCPU::MaxOccluderTriangles))
+	{
+		return nullptr;
+	}
+
+	// 반투명 머티리얼이 하나라도 있으면 뒤가 비쳐 보이므로 제외 (빈 슬롯은 기본 불투명 머티리얼)
+	for (UMaterialInterface* Material : StaticMeshComponent->GetMaterialSlots())
+	{
+		if (Material && Material->GetMaterialInfo().Transparency > 0.0f)
+		{
+			return nullptr;
+		}
+	}
+	return MeshAsset;
+}
+
+void FSceneRenderer::PerformOcclusionCulling()
+{
+	// 절두체 컬링을 하지 않은 뷰(BVH 리빌드 대기)나 가려진 메시도 보이는 와이어프레임은 생략
+	if (!OcclusionCuller || !FOcclusionCullingManagerCPU::IsEnabled() || FrustumCullingEpoch == 0
+		|| View->RenderSettings->GetViewMode() == EViewMode::VMI_Wireframe)
+	{
+		return;
+	}
+
+	OcclusionCuller->BeginView(View->ViewMatrix * View->ProjectionMatrix, View->ViewRect.Width(), View->ViewRect.Height());
+
+	// 1. 지난 프레임에 고른 오클루더 중 이번 뷰에도 보이는 것을 현재 트랜스폼으로 래스터화
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
-		MeshComponent->CollectMeshBatches(AllBatches, View);
+		if (!OcclusionCuller->IsOccluder(MeshComponent->UUID))
+		{
+			continue;
+		}
+		if (const FStaticMesh* MeshAsset = GetOccluderMesh(MeshComponent))
+		{
+			OcclusionCuller->RasterizeOccluder(MeshComponent->GetWorldMatrix(), MeshAsset->Vertices, MeshAsset->Indices);
+		}
+	}
+	OcclusionCuller->BuildHZB();
+
+	// 2. 바운드가 렌더링을 감싸는 메시만 판정하고, 보인 메시는 다음 프레임 오클루더 후보로 등록
+	int32 NumVisible = 0;
+	for (int32 Index = 0; Index < Proxies.Meshes.Num(); ++Index)
+	{
+		UMeshComponent* MeshComponent = Proxies.Meshes[Index];
+		if (MeshComponent->SupportsFrustumCulling())
+		{
+			float ScreenFraction = 0.0f;
+			if (OcclusionCuller->TestBounds(MeshComponent->GetWorldAABB(), ScreenFraction))
+			{
+				MeshComponent->SetOcclusionCulledStamp(FrustumCullingStamp);
+				continue;
+			}
+			if (ScreenFraction >= FOcclusionCullingManagerCPU::MinOccluderScreenFraction && GetOccluderMesh(MeshComponent))
+			{
+				OcclusionCuller->AddOccluderCandidate(MeshComponent->UUID, ScreenFraction);
+			}
+		}
+		Proxies.Meshes[NumVisible++] = MeshComponent;
+	}
+	Proxies.Meshes.resize(NumVisible);
+
+	OcclusionCuller->EndView();
+}
+
+bool FSceneRenderer::IsOcclusionCulled(const UPrimitiveComponent* Component) const
+{
+	// 절두체 쿼리 번호는 뷰마다 새로 발급되므로 이전 뷰에서 가려졌던 표시는 일치하지 않음
+	return FrustumCullingEpoch != 0
+		&& Component->GetOcclusionCulledStamp() == FrustumCullingStamp;
+}
+
+void FSceneRenderer::CollectMeshBatches()
+{
+	ReleaseMeshBatches();
+
+	TArray<FMeshBatchElement>& Elements = FrameMeshBatches.Elements;
+
+	// --- 1. 수집 (Collect) ---
+	// ShadowCasters는 절두체 / 오클루전 컬링 전 목록이므로 화면 안 메시(Proxies.Meshes)를 모두 포함함
+	// (가려진 메시도 화면 밖 메시처럼 그림자는 계속 드리움)
+	// 컴포넌트마다 한 번만 수집하고, 화면 안 / 그림자 캐스터 여부로 패스별 인덱스를 나눔
+	for (UMeshComponent* MeshComponent : Proxies.ShadowCasters)
+	{
+		if (!MeshComponent)
+		{
+			continue;
+		}
+
+		const bool bInView = !IsFrustumCulled(MeshComponent) && !IsOcclusionCulled(MeshComponent);
+		const bool bCastShadow = MeshComponent->IsCastShadows() && MeshComponent->IsVisible();
+		if (!bInView && !bCastShadow)
+		{
+			continue;
+		}
+
+		// 라이트별 캐스터 컬링 / 섀도우 캐시 판정용 정보 (컴포넌트의 모든 배치가 공유)
+		FShadowCasterInfo CasterInfo;
+		if (bCastShadow)
+		{
+			CasterInfo.bHasBounds = MeshComponent->SupportsFrustumCulling();
+			if (CasterInfo.bHasBounds)
+			{
+				CasterInfo.Bounds = MeshComponent->GetWorldAABB();
+			}
+			CasterInfo.bDeforming = Cast<USkinnedMeshComponent>(MeshComponent) != nullptr;
+		}
+
+		const int32 FirstIndex = Elements.Num();
+		MeshComponent->CollectMeshBatches(Elements, View);
+
+		// --- 2. RenderMode별로 분리 (Opaque / Translucent) ---
+		for (int32 Index = FirstIndex; Index < Elements.Num(); ++Index)
+		{
+			if (Elements[Index].RenderMode == EBatchRenderMode::Opaque)
+			{
+				if (bCastShadow)
+				{
+					FrameMeshBatches.ShadowOpaque.Add(Index);
+					FrameMeshBatches.ShadowCasterInfos.Add(CasterInfo);
+				}
+				if (bInView)
+				{
+					FrameMeshBatches.ViewOpaque.Add(Index);
+				}
+			}
+			else if (bInView)
+			{
+				FrameMeshBatches.ViewTranslucent.Add(Index);
+			}
+		}
 	}
 
 	for (UBillboardComponent* BillboardComponent : Proxies.Billboards)
 	{
-		BillboardComponent->CollectMeshBatches(AllBatches, View);
+		const int32 FirstIndex = Elements.Num();
+		BillboardComponent->CollectMeshBatches(Elements, View);
+
+		for (int32 Index = FirstIndex; Index < Elements.Num(); ++Index)
+		{
+			if (Elements[Index].RenderMode == EBatchRenderMode::Opaque)
+			{
+				FrameMeshBatches.ViewOpaque.Add(Index);
+			}
+			else
+			{
+				FrameMeshBatches.ViewTranslucent.Add(Index);
+			}
+		}
 	}
 
 	for (UTextRenderComponent* TextRenderComponent : Proxies.Texts)
 	{
 		// TODO: UTextRenderComponent도 CollectMeshBatches를 통해 FMeshBatchElement를 생성하도록 구현
-		//TextRenderComponent->CollectMeshBatches(AllBatches, View);
+		//TextRenderComponent->CollectMeshBatches(Elements, View);
 	}
 
-	// --- 2. RenderMode별로 분리 (Opaque / Translucent) ---
-	MeshBatchElements.Empty();
-	TranslucentBatchElements.Empty();
-	for (const FMeshBatchElement& Batch : AllBatches)
+	// --- 3. 정렬 (Sort) ---
+	// 패스는 뷰에서 여러 번 그려질 수 있으므로 (와이어프레임 경로 등) 수집 직후 한 번만 정렬
+	// 배치 대신 64비트 키 + 인덱스만 기수 정렬하고 결과 순서를 인덱스 목록에 기록
+	FrameMeshBatches.DrawKeys.Reset();
+	FrameMeshBatches.DrawKeys.SortOpaque(Elements, FrameMeshBatches.ViewOpaque, View->ViewLocation);
+	FrameMeshBatches.DrawKeys.SortTranslucent(Elements, FrameMeshBatches.ViewTranslucent, View->ViewLocation);
+
+	// --- 4. 병합 (Merge) ---
+	// 정렬로 인접해진 같은 메시 / 머티리얼 배치를 인스턴스 드로우로 합침 (그림자 패스는 원본 배치 사용)
+	FInstancingStats InstancingStats;
+	FMeshAutoInstancing::MergeBatches(Elements, FrameMeshBatches.ViewOpaque, OwnerRenderer->GetMeshInstanceBuffer(), RHIDevice, InstancingStats);
+	FInstancingStatManager::GetInstance().AddViewStats(InstancingStats);
+}
+
+void FSceneRenderer::ReleaseMeshBatches()
+{
+	// GPU 스키닝 본 버퍼 해제 (배치마다 AddRef되어 있음)
+	for (const FMeshBatchElement& Batch : FrameMeshBatches.Elements)
 	{
-		if (Batch.RenderMode == EBatchRenderMode::Opaque)
-		{
-			MeshBatchElements.Add(Batch);
-		}
-		else
+		if (Batch.BoneMatricesBuffer)
 		{
-			TranslucentBatchElements.Add(Batch);
+			Batch.BoneMatricesBuffer->Release();
 		}
 	}
 
-	// --- 3. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
+	FrameMeshBatches.Elements.Empty();
+	FrameMeshBatches.ShadowOpaque.Empty();
+	FrameMeshBatches.ShadowCasterInfos.Empty();
+	FrameMeshBatches.ViewOpaque.Empty();
+	FrameMeshBatches.ViewTranslucent.Empty();
+}
 
-	// --- 4. 그리기 (Draw) ---
+void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
+{
+	// 수집 / 분리 / 정렬은 CollectMeshBatches에서 완료됨
 	// GPU 타이머는 Renderer::BeginFrame/EndFrame에서 프레임 레벨로 측정됨
-	DrawMeshBatches(MeshBatchElements, true);
+	DrawMeshBatchList(FrameMeshBatches.Elements, &FrameMeshBatches.ViewOpaque);
 }
 
 void FSceneRenderer::RenderTranslucentPass(EViewMode InRenderViewMode)
 {
-	if (TranslucentBatchElements.IsEmpty())
+	const TArray<int32>& TranslucentBatches = FrameMeshBatches.ViewTranslucent;
+	if (TranslucentBatches.IsEmpty())
 	{
 		return;
 	}
 
-	// Back-to-front 정렬 (반투명 렌더링을 위한 거리 기반 정렬)
-	FVector CameraPosition = View->ViewLocation;
-	TranslucentBatchElements.Sort([&CameraPosition](const FMeshBatchElement& A, const FMeshBatchElement& B)
-	{
-		FVector PosA = { A.WorldMatrix.M[3][0], A.WorldMatrix.M[3][1], A.WorldMatrix.M[3][2] };
-		FVector PosB = { B.WorldMatrix.M[3][0], B.WorldMatrix.M[3][1], B.WorldMatrix.M[3][2] };
-		return (PosA - CameraPosition).SizeSquared() > (PosB - CameraPosition).SizeSquared();
-	});
+	// Back-to-front 정렬은 CollectMeshBatches에서 깊이 키로 완료됨
 
 	// 반투명 렌더 상태 설정: depth read-only, alpha blend, no culling
 	RHIDevice->RSSetState(ERasterizerMode::Solid_NoCull);
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly);
 	RHIDevice->OMSetBlendState(true);
 
-	DrawMeshBatches(TranslucentBatchElements, true);
+	DrawMeshBatchList(FrameMeshBatches.Elements, &TranslucentBatches);
 
 	// 상태 복구
 	RHIDevice->RSSetState(ERasterizerMode::Solid);
@@ -1849,6 +2174,29 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 {
 	if (InMeshBatches.IsEmpty()) return;
 
+	DrawMeshBatchList(InMeshBatches, nullptr);
+
+	// GPU 스키닝 본 버퍼 해제
+	for (const FMeshBatchElement& Batch : InMeshBatches)
+	{
+		if (Batch.BoneMatricesBuffer)
+		{
+			Batch.BoneMatricesBuffer->Release();
+		}
+	}
+
+	// 루프 종료 후 리스트 비우기 (옵션)
+	if (bClearListAfterDraw)
+	{
+		InMeshBatches.Empty();
+	}
+}
+
+void FSceneRenderer::DrawMeshBatchList(const TArray<FMeshBatchElement>& InElements, const TArray<int32>* InIndices)
+{
+	const int32 NumBatches = InIndices ? InIndices->Num() : InElements.Num();
+	if (NumBatches == 0) return;
+
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
 	// NOTE: 파티클 등 투명 오브젝트는 호출 전에 이미 깊이/블렌드 스테이트를 설정했으므로
 	// 여기서 덮어쓰지 않음 (호출자가 상태 관리 책임)
@@ -1880,8 +2228,10 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 4, InitialSamplers);
 
 	// 정렬된 리스트 순회
-	for (const FMeshBatchElement& Batch : InMeshBatches)
+	for (int32 DrawIndex = 0; DrawIndex < NumBatches; ++DrawIndex)
 	{
+		const FMeshBatchElement& Batch = InElements[InIndices ? (*InIndices)[DrawIndex] : DrawIndex];
+
 		// --- 필수 요소 유효성 검사 ---
 		if (!Batch.VertexShader || !Batch.PixelShader || !Batch.VertexBuffer || !Batch.IndexBuffer || Batch.VertexStride == 0)
 		{
@@ -2044,21 +2394,6 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 		}
 	}
-
-	// GPU 스키닝 본 버퍼 해제
-	for (const FMeshBatchElement& Batch : InMeshBatches)
-	{
-		if (Batch.BoneMatricesBuffer)
-		{
-			Batch.BoneMatricesBuffer->Release();
-		}
-	}
-
-	// 루프 종료 후 리스트 비우기 (옵션)
-	if (bClearListAfterDraw)
-	{
-		InMeshBatches.Empty();
-	}
 }
 
 void FSceneRenderer::ApplyScreenEffectsPass()
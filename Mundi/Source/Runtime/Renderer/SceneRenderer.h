@@ -1,5 +1,7 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "MeshDrawKey.h"
+#include "AABB.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
@@ -35,6 +37,7 @@ class ULineComponent;
 class UTriangleMeshComponent;
 class UParticleSystemComponent;
 class USkyboxComponent;
+class FOcclusionCullingManagerCPU;
 
 struct FCandidateDrawable;
 
@@ -42,7 +45,8 @@ struct FCandidateDrawable;
 struct FVisibleRenderProxySet
 {
 	// --- Type 1: Main Scene (PP O, Depth-Test O) ---
-	TArray<UMeshComponent*> Meshes;
+	TArray<UMeshComponent*> Meshes;			// 절두체 / 오클루전 컬링을 통과한 메시
+	TArray<UMeshComponent*> ShadowCasters;	// 그림자 캐스터 후보 (화면 밖에서도 그림자를 드리우므로 컬링 전 목록)
 	TArray<UBillboardComponent*> Billboards; // 인게임 빌보드 (파티클, 잔디 등)
 	TArray<UDecalComponent*> Decals;
 	TArray<UTextRenderComponent*> Texts;
@@ -57,6 +61,25 @@ struct FVisibleRenderProxySet
 	TArray<UPrimitiveComponent*> OverlayPrimitives; // 트랜스폼 기즈모
 };
 
+// 그림자 캐스터 배치의 라이트별 컬링 / 섀도우 캐시 판정용 정보 (ShadowOpaque와 같은 순서)
+struct FShadowCasterInfo
+{
+	FAABB Bounds;
+	bool bHasBounds = false;	// false면 모든 섀도우 뷰에 그림 (바운드가 렌더링을 감싸지 않음)
+	bool bDeforming = false;	// 스키닝 메시처럼 월드 행렬이 같아도 모양이 바뀜 (캐시 불가)
+};
+
+// 한 뷰에서 한 번만 수집한 메시 배치 (그림자 / 불투명 / 씬 깊이 / 반투명 패스가 인덱스로 공유)
+struct FMeshBatchCollection
+{
+	TArray<FMeshBatchElement> Elements;	// 수집된 모든 배치 (컴포넌트당 한 번만 CollectMeshBatches 호출)
+	TArray<int32> ShadowOpaque;		// 그림자 깊이 패스: 그림자를 드리우는 불투명 배치
+	TArray<FShadowCasterInfo> ShadowCasterInfos;	// ShadowOpaque[i]의 캐스터 정보
+	TArray<int32> ViewOpaque;		// 불투명 / 씬 깊이 패스: 절두체 안의 불투명 배치 (GPU 상태 → 앞에서 뒤 순으로 정렬됨)
+	TArray<int32> ViewTranslucent;	// 반투명 패스: 절두체 안의 반투명 배치 (뒤에서 앞 순으로 정렬됨)
+	FMeshDrawKeyBuilder DrawKeys;	// 두 목록의 정렬 키 생성 / 기수 정렬
+};
+
 struct FSceneLocals
 {
 	TArray<UPointLightComponent*> PointLights;
@@ -81,7 +104,8 @@ struct FSceneGlobals
 class FSceneRenderer
 {
 public:
-	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer);
+	/** @param InOcclusionCuller 뷰포트별 CPU 오클루전 컬링 상태 (nullptr이면 오클루전 컬링 생략) */
+	FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* InOwnerRenderer, FOcclusionCullingManagerCPU* InOcclusionCuller = nullptr);
 	~FSceneRenderer();
 
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
@@ -94,7 +118,16 @@ private:
 	void RenderSceneDepthPath();
 
 	void RenderShadowMaps();
-	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
+	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InElements, const TArray<int32>& InShadowBatchIndices);
+
+	/**
+	 * @brief 섀도우 뷰 절두체와 겹치는 캐스터 배치를 모으고 뷰 내용 해시를 계산합니다.
+	 * @return 라이트 / 영역 / 캐스터가 같으면 같은 값. 변형되는 캐스터가 있으면 0 (캐시 불가)
+	 */
+	uint64 GatherShadowViewCasters(const FShadowRenderRequest& ShadowRequest, TArray<int32>& OutBatchIndices) const;
+
+	/** @brief 현재 뷰포트 영역의 섀도우 깊이(와 VSM 모멘트)만 초기값으로 되돌립니다. */
+	void ClearShadowViewport();
 
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
@@ -102,12 +135,30 @@ private:
 	/** @brief 렌더링에 필요한 뷰 행렬, 절두체 등 프레임 데이터를 준비합니다. */
 	void PrepareView();
 
-	/** @brief 월드의 모든 액터를 대상으로 절두체 컬링을 수행합니다. */
+	/** @brief 월드 파티션 BVH로 컴포넌트 단위 절두체 컬링을 수행합니다. (결과: PotentiallyVisibleComponents) */
 	void PerformFrustumCulling();
 
+	/** @brief 이번 뷰의 절두체 컬링에서 제외되었는지 (BVH가 현재 바운드를 모르는 컴포넌트는 항상 false) */
+	bool IsFrustumCulled(const UPrimitiveComponent* Component) const;
+
+	/**
+	 * @brief 지난 프레임 오클루더로 깊이 버퍼를 그리고, 절두체를 통과한 메시 중 완전히 가려진 것을 Proxies.Meshes에서 제외합니다.
+	 * 보인 메시 중 화면을 많이 덮는 것은 다음 프레임 오클루더로 고릅니다.
+	 */
+	void PerformOcclusionCulling();
+
+	/** @brief 이번 뷰의 오클루전 컬링에서 가려졌는지 */
+	bool IsOcclusionCulled(const UPrimitiveComponent* Component) const;
+
 	/** @brief 씬을 순회하며 컬링을 통과한 모든 렌더링 대상을 수집합니다. */
 	void GatherVisibleProxies();
 
+	/** @brief 가시 메시와 그림자 캐스터의 배치를 한 번만 수집해 패스별 인덱스 목록으로 나눕니다. */
+	void CollectMeshBatches();
+
+	/** @brief 수집된 배치가 잡고 있는 GPU 스키닝 본 버퍼를 해제하고 목록을 비웁니다. (용량은 유지) */
+	void ReleaseMeshBatches();
+
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
@@ -119,6 +170,9 @@ private:
 
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
 
+	/** @brief InIndices 순서대로 InElements의 배치를 그립니다. (nullptr이면 전체를 순서대로, 본 버퍼 해제는 호출자 책임) */
+	void DrawMeshBatchList(const TArray<FMeshBatchElement>& InElements, const TArray<int32>* InIndices);
+
 	/** @brief 스카이박스를 렌더링하는 패스입니다. (배경 대체) */
 	void RenderSkyboxPass();
 
@@ -157,6 +211,7 @@ private:
 	FSceneView* View;
 	URenderer* OwnerRenderer;
 	D3D11RHI* RHIDevice;
+	FOcclusionCullingManagerCPU* OcclusionCuller;
 
 	// 수집된 렌더링 대상 목록
 	FVisibleRenderProxySet Proxies;
@@ -167,12 +222,19 @@ private:
 	// 씬 전역 설정
 	FSceneGlobals SceneGlobals;
 
-	// 컬링을 거친 가시성 목록, NOTE: 추후 컴포넌트 단위로 수정
+	// 컬링을 거친 가시성 목록 (BVH가 추적하는 컴포넌트 중 절두체와 겹치는 것)
 	TArray<UPrimitiveComponent*> PotentiallyVisibleComponents;
 
-	// 각 패스에서 수집된 드로우 콜 정보 리스트
+	// 이번 뷰 컬링에 사용한 BVH Epoch (0이면 컬링 생략)와 가시 표시 번호
+	uint32 FrustumCullingEpoch = 0;
+	uint32 FrustumCullingStamp = 0;
+	static uint32 NextFrustumCullingStamp;
+
+	// 씬 메시 배치 (뷰마다 한 번 수집, FSceneRenderer는 뷰마다 생성되므로 용량 재사용을 위해 static)
+	static FMeshBatchCollection FrameMeshBatches;
+
+	// 데칼 / 에디터 프리미티브 등 패스 전용으로 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
-	TArray<FMeshBatchElement> TranslucentBatchElements;
 
 	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
 	std::unique_ptr<FTileLightCuller> TileLightCuller;
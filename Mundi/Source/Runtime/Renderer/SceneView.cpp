@@ -40,6 +40,9 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 		InMinimalViewInfo->ProjectionMode
 	);
 
+	// --- 4. 절두체 (컴포넌트 컬링용) ---
+	ViewFrustum = CreateFrustumFromViewProjection(ViewMatrix * ProjectionMatrix);
+
 	ViewShaderMacros = CreateViewShaderMacros();
 }
 
@@ -77,6 +80,9 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 
 	ProjectionMode = InCamera->GetProjectionMode();
 
+	// 원근/직교 모두 ViewProj에서 바로 평면을 뽑음
+	ViewFrustum = CreateFrustumFromViewProjection(ViewMatrix * ProjectionMatrix);
+
 	ViewShaderMacros = CreateViewShaderMacros();
 }
 
@@ -87,19 +93,19 @@ TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 	switch (RenderSettings->GetViewMode())
 	{
 	case EViewMode::VMI_Lit_Phong:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_PHONG", "1" });
+		ShaderMacros.push_back(FShaderMacro{ STATIC_FNAME("LIGHTING_MODEL_PHONG"), STATIC_FNAME("1") });
 		break;
 	case EViewMode::VMI_Lit_Gouraud:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_GOURAUD", "1" });
+		ShaderMacros.push_back(FShaderMacro{ STATIC_FNAME("LIGHTING_MODEL_GOURAUD"), STATIC_FNAME("1") });
 		break;
 	case EViewMode::VMI_Lit_Lambert:
-		ShaderMacros.push_back(FShaderMacro{ "LIGHTING_MODEL_LAMBERT", "1" });
+		ShaderMacros.push_back(FShaderMacro{ STATIC_FNAME("LIGHTING_MODEL_LAMBERT"), STATIC_FNAME("1") });
 		break;
 	case EViewMode::VMI_Unlit:
 		// 매크로 없음 (Unlit)
 		break;
 	case EViewMode::VMI_WorldNormal:
-		ShaderMacros.push_back(FShaderMacro{ "VIEWMODE_WORLD_NORMAL", "1" });
+		ShaderMacros.push_back(FShaderMacro{ STATIC_FNAME("VIEWMODE_WORLD_NORMAL"), STATIC_FNAME("1") });
 		break;
 	default:
 		// 셰이더를 강제하지 않는 모드는 여기서 처리 가능
@@ -112,16 +118,16 @@ TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
 		EShadowAATechnique Technique = RenderSettings->GetShadowAATechnique();
 		if (Technique == EShadowAATechnique::PCF)
 		{
-			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "1")); // 1 = PCF
+			ShaderMacros.Add(FShaderMacro(STATIC_FNAME("SHADOW_AA_TECHNIQUE"), STATIC_FNAME("1"))); // 1 = PCF
 		}
 		else if (Technique == EShadowAATechnique::VSM)
 		{
-			ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "2")); // 2 = VSM
+			ShaderMacros.Add(FShaderMacro(STATIC_FNAME("SHADOW_AA_TECHNIQUE"), STATIC_FNAME("2"))); // 2 = VSM
 		}
 	}
 	else
 	{
-		ShaderMacros.Add(FShaderMacro("SHADOW_AA_TECHNIQUE", "0")); // 0 = Hard Shadow (AA 끔)
+		ShaderMacros.Add(FShaderMacro(STATIC_FNAME("SHADOW_AA_TECHNIQUE"), STATIC_FNAME("0"))); // 0 = Hard Shadow (AA 끔)
 	}
 
 	return ShaderMacros;
@@ -310,6 +310,12 @@ ID3D11PixelShader* UShader::GetPixelShader(const TArray<FShaderMacro>& InMacros)
 	return nullptr;
 }
 
+bool UShader::SupportsInstancedWorld() const
+{
+	// CreateInputLayout의 인스턴스 스트림 추가 조건과 같아야 함
+	return FilePath.find("UberLit") != FString::npos;
+}
+
 void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& InOutVariant)
 {
 	TArray<D3D11_INPUT_ELEMENT_DESC> descArray = UResourceManager::GetInstance().GetProperInputLayout(InShaderPath);
@@ -318,7 +324,7 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 	bool bHasGPUSkinning = false;
 	for (const FShaderMacro& Macro : InMacros)
 	{
-		if (Macro.Name.ToString() == "GPU_SKINNING")
+		if (Macro.Name == STATIC_FNAME("GPU_SKINNING"))
 		{
 			bHasGPUSkinning = true;
 			break;
@@ -333,6 +339,31 @@ void UShader::CreateInputLayout(ID3D11Device* Device, const FString& InShaderPat
 		descArray.Add({ "BLENDWEIGHT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 80, D3D11_INPUT_PER_VERTEX_DATA, 0 });
 	}
 
+	// 자동 인스턴싱을 사용하는 경우 슬롯 1의 인스턴스 스트림 추가
+	bool bHasInstancedWorld = false;
+	for (const FShaderMacro& Macro : InMacros)
+	{
+		if (Macro.Name == STATIC_FNAME("INSTANCED_WORLD"))
+		{
+			bHasInstancedWorld = true;
+			break;
+		}
+	}
+
+	if (bHasInstancedWorld && InShaderPath.find("UberLit") != FString::npos)
+	{
+		// FMeshInstanceData: WorldMatrix(64) + WorldInverseTranspose(64) + ObjectID(4) + Padding(12)
+		for (uint32 Row = 0; Row < 4; ++Row)
+		{
+			descArray.Add({ "INSTANCE_WORLD", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, Row * 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		}
+		for (uint32 Row = 0; Row < 4; ++Row)
+		{
+			descArray.Add({ "INSTANCE_NORMAL", Row, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 64 + Row * 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+		}
+		descArray.Add({ "INSTANCE_ID", 0, DXGI_FORMAT_R32_UINT, 1, 128, D3D11_INPUT_PER_INSTANCE_DATA, 1 });
+	}
+
 	const D3D11_INPUT_ELEMENT_DESC* layout = descArray.data();
 	uint32 layoutCount = static_cast<uint32>(descArray.size());
 
@@ -54,6 +54,9 @@ public:
 	ID3D11VertexShader* GetVertexShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11PixelShader* GetPixelShader(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
+	/** @brief INSTANCED_WORLD 변형(인스턴스 스트림의 월드 행렬)을 지원하는 셰이더인지 (자동 인스턴싱 대상) */
+	bool SupportsInstancedWorld() const;
+
 	// Hot Reload Support
 	bool IsOutdated() const;
 	bool Reload(ID3D11Device* InDevice);
@@ -0,0 +1,214 @@
+﻿#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize, uint32 InMinBlockSize)
+{
+	// 2의 거듭제곱으로 내림 (버디 분할은 정확히 절반씩 나뉘어야 함)
+	AtlasSize = 0;
+	for (uint32 Size = 1; Size != 0 && Size <= InAtlasSize; Size <<= 1)
+	{
+		AtlasSize = Size;
+	}
+
+	MinBlockSize = InMinBlockSize > 0 ? InMinBlockSize : 1;
+	if (MinBlockSize > AtlasSize)
+	{
+		MinBlockSize = AtlasSize;
+	}
+
+	NumLevels = 0;
+	for (uint32 Size = AtlasSize; Size >= MinBlockSize && Size > 0; Size >>= 1)
+	{
+		++NumLevels;
+	}
+
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	FreeBlocks.Empty();
+	FreeBlocks.SetNum(NumLevels);
+	if (NumLevels > 0)
+	{
+		FreeBlocks[0].Add(PackBlock(0, 0));
+	}
+	AllocatedTexels = 0;
+}
+
+uint32 FShadowAtlasAllocator::GetBlockSizeFor(uint32 RequestedSize) const
+{
+	if (RequestedSize == 0 || RequestedSize > AtlasSize)
+	{
+		return 0;
+	}
+
+	uint32 BlockSize = MinBlockSize;
+	while (BlockSize < RequestedSize)
+	{
+		BlockSize <<= 1;
+	}
+	return BlockSize;
+}
+
+bool FShadowAtlasAllocator::Allocate(uint32 RequestedSize, FRegion& OutRegion)
+{
+	OutRegion = FRegion();
+
+	const uint32 BlockSize = GetBlockSizeFor(RequestedSize);
+	if (BlockSize == 0)
+	{
+		return false;
+	}
+
+	int32 Level = 0;
+	for (uint32 Size = AtlasSize; Size > BlockSize; Size >>= 1)
+	{
+		++Level;
+	}
+
+	uint32 X = 0, Y = 0;
+	if (!AllocateAtLevel(Level, X, Y))
+	{
+		return false;
+	}
+
+	OutRegion.X = X;
+	OutRegion.Y = Y;
+	OutRegion.Size = BlockSize;
+	AllocatedTexels += static_cast<uint64>(BlockSize) * BlockSize;
+	return true;
+}
+
+bool FShadowAtlasAllocator::AllocateAtLevel(int32 Level, uint32& OutX, uint32& OutY)
+{
+	TArray<uint32>& Blocks = FreeBlocks[Level];
+	if (!Blocks.IsEmpty())
+	{
+		// 위쪽 / 왼쪽 블록부터 사용해 빈 공간이 한쪽으로 모이도록 함
+		int32 BestIndex = 0;
+		for (int32 Index = 1; Index < Blocks.Num(); ++Index)
+		{
+			const uint32 Block = Blocks[Index];
+			const uint32 Best = Blocks[BestIndex];
+			if ((Block >> 16) < (Best >> 16) || ((Block >> 16) == (Best >> 16) && (Block & 0xFFFF) < (Best & 0xFFFF)))
+			{
+				BestIndex = Index;
+			}
+		}
+
+		const uint32 Block = Blocks[BestIndex];
+		Blocks.RemoveAtSwap(BestIndex);
+		OutX = Block & 0xFFFF;
+		OutY = Block >> 16;
+		return true;
+	}
+
+	if (Level == 0)
+	{
+		return false;
+	}
+
+	// 한 단계 큰 블록을 4등분해 첫 칸을 쓰고 나머지 셋은 빈 블록으로 등록
+	uint32 ParentX = 0, ParentY = 0;
+	if (!AllocateAtLevel(Level - 1, ParentX, ParentY))
+	{
+		return false;
+	}
+
+	const uint32 Half = AtlasSize >> Level;
+	Blocks.Add(PackBlock(ParentX + Half, ParentY));
+	Blocks.Add(PackBlock(ParentX, ParentY + Half));
+	Blocks.Add(PackBlock(ParentX + Half, ParentY + Half));
+
+	OutX = ParentX;
+	OutY = ParentY;
+	return true;
+}
+
+void FShadowAtlasAllocator::Free(const FRegion& Region)
+{
+	if (!Region.IsValid() || NumLevels == 0)
+	{
+		return;
+	}
+
+	int32 Level = 0;
+	for (uint32 Size = AtlasSize; Size > Region.Size; Size >>= 1)
+	{
+		++Level;
+	}
+	if (Level >= NumLevels)
+	{
+		return;
+	}
+
+	AllocatedTexels -= static_cast<uint64>(Region.Size) * Region.Size;
+
+	uint32 X = Region.X;
+	uint32 Y = Region.Y;
+	uint32 Size = Region.Size;
+
+	// 버디 셋이 모두 비어 있으면 부모로 합치고 한 단계 위에서 반복
+	while (Level > 0)
+	{
+		const uint32 ParentX = X & ~(Size * 2 - 1);
+		const uint32 ParentY = Y & ~(Size * 2 - 1);
+		const uint32 Siblings[4] =
+		{
+			PackBlock(ParentX, ParentY),
+			PackBlock(ParentX + Size, ParentY),
+			PackBlock(ParentX, ParentY + Size),
+			PackBlock(ParentX + Size, ParentY + Size)
+		};
+
+		TArray<uint32>& Blocks = FreeBlocks[Level];
+		const uint32 Self = PackBlock(X, Y);
+
+		int32 FoundIndices[3];
+		int32 NumFound = 0;
+		for (uint32 Sibling : Siblings)
+		{
+			if (Sibling == Self)
+			{
+				continue;
+			}
+			const int32 Found = Blocks.Find(Sibling);
+			if (Found < 0)
+			{
+				break;
+			}
+			FoundIndices[NumFound++] = Found;
+		}
+
+		if (NumFound < 3)
+		{
+			break;
+		}
+
+		// 큰 인덱스부터 지워야 RemoveAtSwap이 다른 인덱스를 건드리지 않음
+		for (int32 i = 0; i < 3; ++i)
+		{
+			for (int32 j = i + 1; j < 3; ++j)
+			{
+				if (FoundIndices[j] > FoundIndices[i])
+				{
+					const int32 Temp = FoundIndices[i];
+					FoundIndices[i] = FoundIndices[j];
+					FoundIndices[j] = Temp;
+				}
+			}
+		}
+		for (int32 Found : FoundIndices)
+		{
+			Blocks.RemoveAtSwap(Found);
+		}
+
+		X = ParentX;
+		Y = ParentY;
+		Size *= 2;
+		--Level;
+	}
+
+	FreeBlocks[Level].Add(PackBlock(X, Y));
+}
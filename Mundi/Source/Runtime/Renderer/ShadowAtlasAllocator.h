@@ -0,0 +1,54 @@
+﻿#pragma once
+
+/**
+ * @class FShadowAtlasAllocator
+ * @brief 정사각형 섀도우 아틀라스용 쿼드트리 버디(buddy) 할당기입니다.
+ *
+ * - 블록 크기는 2의 거듭제곱(AtlasSize >> Level)이며, 부족하면 한 단계 큰 블록을 4등분해 씁니다.
+ * - 해제할 때 같은 부모의 네 블록이 모두 비어 있으면 다시 부모 블록으로 합칩니다.
+ * - 한 번 할당된 영역은 해제 전까지 움직이지 않으므로 라이트의 섀도우 영역이 프레임 간 유지됩니다.
+ *   (매 프레임 전체를 다시 패킹하면 캐시된 섀도우 맵 내용을 재사용할 수 없음)
+ */
+class FShadowAtlasAllocator
+{
+public:
+	struct FRegion
+	{
+		uint32 X = 0;
+		uint32 Y = 0;
+		uint32 Size = 0;	// 블록 크기 (요청 크기 이상인 2의 거듭제곱, 0이면 무효)
+
+		bool IsValid() const { return Size > 0; }
+	};
+
+	/** @brief 아틀라스 크기(2의 거듭제곱으로 내림)와 최소 블록 크기로 초기화합니다. 기존 할당은 모두 사라집니다. */
+	void Initialize(uint32 InAtlasSize, uint32 InMinBlockSize = 128);
+
+	/** @brief RequestedSize 이상인 블록을 할당합니다. 자리가 없으면 false */
+	bool Allocate(uint32 RequestedSize, FRegion& OutRegion);
+
+	/** @brief 블록을 반환하고 가능한 만큼 버디와 합칩니다. */
+	void Free(const FRegion& Region);
+
+	/** @brief 모든 블록을 반환합니다. */
+	void Reset();
+
+	/** @brief RequestedSize를 담는 블록 크기 (아틀라스보다 크면 0) */
+	uint32 GetBlockSizeFor(uint32 RequestedSize) const;
+
+	uint32 GetAtlasSize() const { return AtlasSize; }
+	uint64 GetAllocatedTexels() const { return AllocatedTexels; }
+
+private:
+	bool AllocateAtLevel(int32 Level, uint32& OutX, uint32& OutY);
+
+	static uint32 PackBlock(uint32 X, uint32 Y) { return X | (Y << 16); }
+
+	// 레벨별 빈 블록 (레벨 0 = 아틀라스 전체, X | Y << 16)
+	TArray<TArray<uint32>> FreeBlocks;
+
+	uint32 AtlasSize = 0;
+	uint32 MinBlockSize = 0;
+	int32 NumLevels = 0;
+	uint64 AllocatedTexels = 0;
+};
@@ -21,6 +21,13 @@ struct FShadowStats
 	float ShadowAtlasCubeMemoryMB = 0.0f;
 	float TotalShadowMemoryMB = 0.0f;
 
+	// 섀도우 뷰 캐시 (RenderShadowMaps에서 갱신)
+	uint32 ShadowViewCacheHits = 0;        // 지난 내용을 재사용한 섀도우 뷰
+	uint32 ShadowViewCacheMisses = 0;      // 라이트 / 캐스터가 바뀌어 다시 그린 섀도우 뷰
+	uint32 ShadowViewUncacheable = 0;      // 변형 캐스터(스키닝)가 있어 매번 그리는 섀도우 뷰
+	uint32 ShadowCasterDrawCalls = 0;      // 다시 그린 뷰의 캐스터 드로우 콜 합계
+	float ShadowAtlas2DUsage = 0.0f;       // 2D 아틀라스 할당 비율 (0~1)
+
 	// 모든 통계를 0으로 리셋
 	void Reset()
 	{
@@ -34,6 +41,11 @@ struct FShadowStats
 		ShadowAtlas2DMemoryMB = 0.0f;
 		ShadowAtlasCubeMemoryMB = 0.0f;
 		TotalShadowMemoryMB = 0.0f;
+		ShadowViewCacheHits = 0;
+		ShadowViewCacheMisses = 0;
+		ShadowViewUncacheable = 0;
+		ShadowCasterDrawCalls = 0;
+		ShadowAtlas2DUsage = 0.0f;
 	}
 
 	// 전체 섀도우 캐스팅 라이트 수 계산
@@ -84,6 +96,16 @@ public:
 		CurrentStats = InStats;
 	}
 
+	// 섀도우 뷰 캐시 통계만 갱신 (나머지는 UpdateStats에서 채운 값 유지)
+	void UpdateCacheStats(uint32 Hits, uint32 Misses, uint32 Uncacheable, uint32 CasterDrawCalls, float AtlasUsage2D)
+	{
+		CurrentStats.ShadowViewCacheHits = Hits;
+		CurrentStats.ShadowViewCacheMisses = Misses;
+		CurrentStats.ShadowViewUncacheable = Uncacheable;
+		CurrentStats.ShadowCasterDrawCalls = CasterDrawCalls;
+		CurrentStats.ShadowAtlas2DUsage = AtlasUsage2D;
+	}
+
 	// 통계 조회
 	const FShadowStats& GetStats() const
 	{
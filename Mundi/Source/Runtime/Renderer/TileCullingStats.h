@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "UEContainer.h"
 
-// 타일 기반 라이트 컬링 통계
+// 타일(클러스터) 기반 라이트 컬링 통계
 // 성능 메트릭과 컬링 효율성을 추적
 struct FTileCullingStats
 {
@@ -10,23 +10,31 @@ struct FTileCullingStats
 	uint32 TileCountY = 0;
 	uint32 TotalTileCount = 0;
 
+	// 클러스터 (타일 x 깊이 슬라이스)
+	uint32 DepthSliceCount = 0;
+	uint32 TotalClusterCount = 0;
+	uint32 ActiveClusterCount = 0;  // 라이트가 하나 이상 배정된 클러스터 수
+
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
 	uint32 TotalSpotLights = 0;
 	uint32 TotalLights = 0;
 
-	// 타일당 라이트 통계
+	// 클러스터당 라이트 통계
 	uint32 MinLightsPerTile = 0;
 	uint32 MaxLightsPerTile = 0;
 	float AvgLightsPerTile = 0.0f;
 
 	// 컬링 효율성 메트릭
 	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
-	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
+	uint32 TotalLightTests = 0;     // 전체 라이트-클러스터 테스트 수
 	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	uint32 LightsOutsideView = 0;   // 화면/깊이 범위 밖이라 클러스터 테스트 없이 제외된 라이트 수
+	uint32 LightIndexCount = 0;     // 클러스터 리스트에 기록된 라이트 인덱스 총 개수
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CullingTimeMS = 0.0f;     // CPU 클러스터 배정 시간
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -47,6 +55,9 @@ struct FTileCullingStats
 		TileCountX = 0;
 		TileCountY = 0;
 		TotalTileCount = 0;
+		DepthSliceCount = 0;
+		TotalClusterCount = 0;
+		ActiveClusterCount = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
@@ -56,7 +67,10 @@ struct FTileCullingStats
 		CullingEfficiency = 0.0f;
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
+		LightsOutsideView = 0;
+		LightIndexCount = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CullingTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
 
@@ -66,9 +80,10 @@ struct FTileCullingStats
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
 
-		if (TotalTileCount > 0)
+		const uint32 CellCount = TotalClusterCount > 0 ? TotalClusterCount : TotalTileCount;
+		if (CellCount > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(CellCount);
 		}
 
 		if (TotalLightTests > 0)
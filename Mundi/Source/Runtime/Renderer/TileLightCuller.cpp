@@ -1,6 +1,8 @@
 ﻿#include "pch.h"
 #include "TileLightCuller.h"
-#include <algorithm>
+#include "PlatformTime.h"
+#include <cmath>
+#include <immintrin.h>
 
 FTileLightCuller::FTileLightCuller()
 	: RHI(nullptr)
@@ -8,9 +10,21 @@ FTileLightCuller::FTileLightCuller()
 	, TileCountX(0)
 	, TileCountY(0)
 	, TotalTileCount(0)
+	, TotalClusterCount(0)
+	, ViewportWidth(0)
+	, ViewportHeight(0)
+	, NearDepth(0.0f)
+	, FarDepth(0.0f)
+	, DepthSliceScale(0.0f)
+	, DepthSliceBias(0.0f)
+	, ProjScaleX(1.0f)
+	, ProjScaleY(1.0f)
+	, bOrthographicView(false)
 	, LightIndexBuffer(nullptr)
 	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
 {
+	memset(SliceDepths, 0, sizeof(SliceDepths));
 }
 
 FTileLightCuller::~FTileLightCuller()
@@ -33,367 +47,416 @@ void FTileLightCuller::CullLights(
 	const FMatrix& ProjMatrix,
 	float NearPlane,
 	float FarPlane,
-	UINT ViewportWidth,
-	UINT ViewportHeight)
+	UINT InViewportWidth,
+	UINT InViewportHeight,
+	bool bOrthographic)
 {
-	// 타일 그리드 계산
+	const uint64 CullStart = FWindowsPlatformTime::Cycles64();
+
+	// 클러스터 그리드 계산
+	ViewportWidth = InViewportWidth > 0 ? InViewportWidth : 1;
+	ViewportHeight = InViewportHeight > 0 ? InViewportHeight : 1;
 	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
 	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
 	TotalTileCount = TileCountX * TileCountY;
+	TotalClusterCount = TotalTileCount * DepthSliceCount;
+	bOrthographicView = bOrthographic;
 
 	// 통계 초기화
 	Stats.Reset();
 	Stats.TileCountX = TileCountX;
 	Stats.TileCountY = TileCountY;
+	Stats.DepthSliceCount = DepthSliceCount;
 	Stats.TotalTileCount = TotalTileCount;
+	Stats.TotalClusterCount = TotalClusterCount;
 	Stats.TotalPointLights = PointLights.Num();
 	Stats.TotalSpotLights = SpotLights.Num();
 	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
 
-	// 타일 라이트 인덱스 버퍼 크기 재조정
-	UINT RequiredSize = TotalTileCount * MaxLightsPerTile;
-	if (TileLightIndices.Num() != RequiredSize)
+	// ────────────────────────────────────────────────
+	// 깊이 슬라이스 (지수 분포: 가까운 곳일수록 얇게)
+	// Slice = log2(z) * Scale + Bias, SliceDepths[s] = Near * (Far / Near)^(s / Count)
+	// ────────────────────────────────────────────────
+	NearDepth = NearPlane > 0.01f ? NearPlane : 0.01f;
+	FarDepth = FarPlane > NearDepth + 1.0f ? FarPlane : NearDepth + 1.0f;
+
+	const float LogDepthRatio = std::log2(FarDepth / NearDepth);
+	DepthSliceScale = static_cast<float>(DepthSliceCount) / LogDepthRatio;
+	DepthSliceBias = -static_cast<float>(DepthSliceCount) * std::log2(NearDepth) / LogDepthRatio;
+
+	for (UINT Slice = 0; Slice <= DepthSliceCount; ++Slice)
+	{
+		SliceDepths[Slice] = NearDepth * std::pow(FarDepth / NearDepth, static_cast<float>(Slice) / static_cast<float>(DepthSliceCount));
+	}
+
+	// ────────────────────────────────────────────────
+	// 타일 경계 (NDC → 뷰 공간)
+	// 원근: X_view = NDC * z / P00 이므로 깊이 1 기준 값을 저장, 직교: X_view = NDC / P00
+	// ────────────────────────────────────────────────
+	ProjScaleX = ProjMatrix.M[0][0];
+	ProjScaleY = ProjMatrix.M[1][1];
+	const float InvP00 = 1.0f / ProjScaleX;
+	const float InvP11 = 1.0f / ProjScaleY;
+
+	TileEdgeViewX.SetNum(TileCountX + 1 + 4);
+	for (UINT Edge = 0; Edge < static_cast<UINT>(TileEdgeViewX.Num()); ++Edge)
 	{
-		TileLightIndices.SetNum(RequiredSize);
+		const float NdcX = (static_cast<float>(Edge * TileSize) / static_cast<float>(ViewportWidth)) * 2.0f - 1.0f;
+		TileEdgeViewX[Edge] = NdcX * InvP00;
 	}
 
-	// 버퍼 초기화 (모든 타일의 라이트 개수를 0으로)
-	memset(TileLightIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+	// Y는 화면 아래쪽으로 증가하므로 타일 TileY의 위쪽 경계가 TileEdgeViewY[TileY]
+	TileEdgeViewY.SetNum(TileCountY + 1);
+	for (UINT Edge = 0; Edge <= TileCountY; ++Edge)
+	{
+		const float NdcY = 1.0f - (static_cast<float>(Edge * TileSize) / static_cast<float>(ViewportHeight)) * 2.0f;
+		TileEdgeViewY[Edge] = NdcY * InvP11;
+	}
 
-	// Inverse View-Projection 행렬 계산
-	FMatrix InvViewProj = ProjMatrix.InversePerspectiveProjection() * ViewMatrix.InverseAffine();
+	// 헤더 초기화 (모든 클러스터의 라이트 개수를 0으로)
+	const UINT HeaderSize = TotalClusterCount * 2;
+	ClusterLightData.SetNum(HeaderSize);
+	memset(ClusterLightData.GetData(), 0, HeaderSize * sizeof(uint32));
 
-	// 각 타일에 대해 컬링 수행
-	Stats.MinLightsPerTile = UINT_MAX;
-	Stats.MaxLightsPerTile = 0;
-	uint32 TotalLightsAcrossAllTiles = 0;
+	PairClusters.Empty();
+	PairLights.Empty();
 
-	for (UINT TileY = 0; TileY < TileCountY; ++TileY)
+	// ────────────────────────────────────────────────
+	// 라이트 → 클러스터 배정
+	// ────────────────────────────────────────────────
+	for (int32 i = 0; i < PointLights.Num(); ++i)
 	{
-		for (UINT TileX = 0; TileX < TileCountX; ++TileX)
-		{
-			UINT TileIndex = TileY * TileCountX + TileX;
-			UINT TileDataOffset = TileIndex * MaxLightsPerTile;
-
-			// 타일 프러스텀 생성
-			FFrustum Frustum = CreateTileFrustum(TileX, TileY, InvViewProj, NearPlane, FarPlane);
+		const FPointLightInfo& Light = PointLights[i];
+		const FVector ViewCenter = ViewMatrix.TransformPosition(Light.Position);
 
-			uint32 LightCount = 0;
+		// 라이트 인덱스 저장 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
+		AssignLight(ViewCenter, Light.AttenuationRadius, nullptr, static_cast<uint32>(i));
+	}
 
-			// Point Light 테스트
-			for (int32 i = 0; i < PointLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
-			{
-				Stats.TotalLightTests++;
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		const FSpotLightInfo& Light = SpotLights[i];
+
+		FSpotCone Cone;
+		Cone.Apex = ViewMatrix.TransformPosition(Light.Position);
+		Cone.Direction = ViewMatrix.TransformVector(Light.Direction).GetSafeNormal();
+		Cone.Range = Light.AttenuationRadius;
+
+		// OuterConeAngle은 축 기준 반각 (도 단위)
+		const float HalfAngle = DegreesToRadians(Light.OuterConeAngle);
+		Cone.CosHalfAngle = std::cos(HalfAngle);
+		Cone.SinHalfAngle = std::sin(HalfAngle);
+
+		// 원뿔(구면 부채꼴)을 감싸는 최소 경계 구
+		// 반각 45도 이하: 꼭지점과 밑면 가장자리를 지나는 구, 90도 미만: 밑면 원을 적도로 하는 구, 그 이상: 라이트 구 전체
+		FVector BoundCenter = Cone.Apex;
+		float BoundRadius = Cone.Range;
+		if (Cone.CosHalfAngle >= 0.70710678f)
+		{
+			BoundRadius = Cone.Range / (2.0f * Cone.CosHalfAngle);
+			BoundCenter = Cone.Apex + Cone.Direction * BoundRadius;
+		}
+		else if (Cone.CosHalfAngle > 0.0f)
+		{
+			BoundRadius = Cone.Range * Cone.SinHalfAngle;
+			BoundCenter = Cone.Apex + Cone.Direction * (Cone.Range * Cone.CosHalfAngle);
+		}
 
-				if (TestPointLightAgainstFrustum(PointLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(0=Point), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
-			}
+		// 라이트 인덱스 저장 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
+		AssignLight(BoundCenter, BoundRadius, Cone.CosHalfAngle > 0.0f ? &Cone : nullptr, (1u << 16) | static_cast<uint32>(i));
+	}
 
-			// Spot Light 테스트
-			for (int32 i = 0; i < SpotLights.Num() && LightCount < MaxLightsPerTile - 1; ++i)
-			{
-				Stats.TotalLightTests++;
+	// ────────────────────────────────────────────────
+	// 카운팅 정렬로 클러스터별 연속 리스트 구성
+	// 헤더 오프셋을 구간 끝으로 잡고 쌍을 역순으로 채우면 클러스터 안의 라이트 순서가 유지된다
+	// ────────────────────────────────────────────────
+	const uint32 PairCount = static_cast<uint32>(PairClusters.Num());
+	uint32 RunningOffset = HeaderSize;
 
-				if (TestSpotLightAgainstFrustum(SpotLights[i], Frustum, ViewMatrix))
-				{
-					// 라이트 인덱스 저장 (상위 16비트: 타입(1=Spot), 하위 16비트: 인덱스)
-					TileLightIndices[TileDataOffset + 1 + LightCount] = (1 << 16) | i;
-					LightCount++;
-					Stats.TotalLightsPassed++;
-				}
-			}
+	Stats.MinLightsPerTile = UINT_MAX;
+	Stats.MaxLightsPerTile = 0;
 
-			// 첫 번째 요소에 라이트 개수 저장
-			TileLightIndices[TileDataOffset] = LightCount;
+	for (UINT Cluster = 0; Cluster < TotalClusterCount; ++Cluster)
+	{
+		const uint32 LightCount = ClusterLightData[Cluster * 2 + 1];
+		RunningOffset += LightCount;
+		ClusterLightData[Cluster * 2] = RunningOffset;
 
-			// 통계 업데이트
-			Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
-			Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
-			TotalLightsAcrossAllTiles += LightCount;
+		Stats.MinLightsPerTile = FMath::Min(Stats.MinLightsPerTile, LightCount);
+		Stats.MaxLightsPerTile = FMath::Max(Stats.MaxLightsPerTile, LightCount);
+		if (LightCount > 0)
+		{
+			Stats.ActiveClusterCount++;
 		}
 	}
 
-	// 평균 계산
-	if (TotalTileCount > 0)
+	if (TotalClusterCount == 0)
+	{
+		Stats.MinLightsPerTile = 0;
+	}
+
+	ClusterLightData.SetNum(HeaderSize + PairCount);
+	for (uint32 Pair = PairCount; Pair > 0; --Pair)
 	{
-		Stats.AvgLightsPerTile = static_cast<float>(TotalLightsAcrossAllTiles) / static_cast<float>(TotalTileCount);
+		const uint32 Cluster = PairClusters[Pair - 1];
+		const uint32 WriteOffset = --ClusterLightData[Cluster * 2];
+		ClusterLightData[WriteOffset] = PairLights[Pair - 1];
 	}
 
 	// 컬링 효율성 계산
+	Stats.LightIndexCount = PairCount;
 	Stats.CalculateStats();
 
-	// GPU 버퍼 생성 또는 업데이트
-	if (!LightIndexBuffer)
+	// GPU 버퍼 생성 또는 업데이트 (부족할 때만 두 배로 재생성)
+	const UINT RequiredSize = static_cast<UINT>(ClusterLightData.Num());
+	if (!LightIndexBuffer || RequiredSize > LightIndexBufferCapacity)
 	{
-		// 버퍼 생성
-		HRESULT hr = RHI->CreateStructuredBuffer(
-			sizeof(uint32),
-			RequiredSize,
-			TileLightIndices.GetData(),
-			&LightIndexBuffer
-		);
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		if (LightIndexBuffer)
+		{
+			LightIndexBuffer->Release();
+			LightIndexBuffer = nullptr;
+		}
+
+		UINT NewCapacity = LightIndexBufferCapacity * 2;
+		if (NewCapacity < RequiredSize)
+		{
+			NewCapacity = RequiredSize;
+		}
 
+		HRESULT hr = RHI->CreateStructuredBuffer(sizeof(uint32), NewCapacity, nullptr, &LightIndexBuffer);
 		if (SUCCEEDED(hr))
 		{
 			// SRV 생성
 			RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+			LightIndexBufferCapacity = NewCapacity;
+		}
+		else
+		{
+			LightIndexBufferCapacity = 0;
 		}
-
-		Stats.LightIndexBufferSizeBytes = RequiredSize * sizeof(uint32);
-	}
-	else
-	{
-		// 기존 버퍼 업데이트
-		RHI->UpdateStructuredBuffer(
-			LightIndexBuffer,
-			TileLightIndices.GetData(),
-			RequiredSize * sizeof(uint32)
-		);
 	}
+
+	RHI->UpdateStructuredBuffer(
+		LightIndexBuffer,
+		ClusterLightData.GetData(),
+		RequiredSize * sizeof(uint32)
+	);
+
+	Stats.LightIndexBufferSizeBytes = LightIndexBufferCapacity * sizeof(uint32);
+	Stats.CullingTimeMS = static_cast<float>(FWindowsPlatformTime::ToMilliseconds(FWindowsPlatformTime::Cycles64() - CullStart));
 }
 
-FFrustum FTileLightCuller::CreateTileFrustum(
-	UINT TileX,
-	UINT TileY,
-	const FMatrix& InvViewProj,
-	float NearPlane,
-	float FarPlane)
+void FTileLightCuller::AssignLight(const FVector& ViewCenter, float Radius, const FSpotCone* Cone, uint32 PackedIndex)
 {
-	FFrustum Frustum;
-
-	// 타일의 NDC 좌표 계산
-	// NDC: [-1, 1] 범위, 왼쪽 아래가 (-1, -1), 오른쪽 위가 (1, 1)
-	// 주의: DirectX는 Y축이 위쪽이 양수
-
-	float TileMinX = static_cast<float>(TileX * TileSize);
-	float TileMaxX = static_cast<float>((TileX + 1) * TileSize);
-	float TileMinY = static_cast<float>(TileY * TileSize);
-	float TileMaxY = static_cast<float>((TileY + 1) * TileSize);
-
-	// 뷰포트 크기
-	float ViewportWidth = static_cast<float>(TileCountX * TileSize);
-	float ViewportHeight = static_cast<float>(TileCountY * TileSize);
-
-	// Screen Space -> NDC
-	float NDC_MinX = (TileMinX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MaxX = (TileMaxX / ViewportWidth) * 2.0f - 1.0f;
-	float NDC_MinY = 1.0f - (TileMaxY / ViewportHeight) * 2.0f; // Y축 반전
-	float NDC_MaxY = 1.0f - (TileMinY / ViewportHeight) * 2.0f;
-
-	// 8개의 프러스텀 코너 (NDC 공간)
-	FVector4 FrustumCorners[8];
-
-	// Near plane corners
-	FrustumCorners[0] = FVector4(NDC_MinX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[1] = FVector4(NDC_MaxX, NDC_MinY, 0.0f, 1.0f);
-	FrustumCorners[2] = FVector4(NDC_MaxX, NDC_MaxY, 0.0f, 1.0f);
-	FrustumCorners[3] = FVector4(NDC_MinX, NDC_MaxY, 0.0f, 1.0f);
-
-	// Far plane corners
-	FrustumCorners[4] = FVector4(NDC_MinX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[5] = FVector4(NDC_MaxX, NDC_MinY, 1.0f, 1.0f);
-	FrustumCorners[6] = FVector4(NDC_MaxX, NDC_MaxY, 1.0f, 1.0f);
-	FrustumCorners[7] = FVector4(NDC_MinX, NDC_MaxY, 1.0f, 1.0f);
-
-	// NDC -> World Space 변환
-	FVector WorldCorners[8];
-	for (int i = 0; i < 8; ++i)
+	// ────────────────────────────────────────────────
+	// 1. 깊이 범위 → 슬라이스 범위
+	// ────────────────────────────────────────────────
+	const float MinDepth = ViewCenter.Z - Radius;
+	const float MaxDepth = ViewCenter.Z + Radius;
+	if (MaxDepth < NearDepth || MinDepth > FarDepth || Radius <= 0.0f)
 	{
-		FVector4 WorldPos = FrustumCorners[i] * InvViewProj;
-		WorldPos /= WorldPos.W; // Perspective divide
-		WorldCorners[i] = FVector(WorldPos.X, WorldPos.Y, WorldPos.Z);
+		Stats.LightsOutsideView++;
+		return;
 	}
 
-	// 프러스텀 평면 생성 (외향 법선)
-	// 평면 방정식: Normal · P + Distance = 0
+	const int32 SliceBegin = GetDepthSlice(MinDepth > NearDepth ? MinDepth : NearDepth);
+	const int32 SliceEnd = GetDepthSlice(MaxDepth < FarDepth ? MaxDepth : FarDepth);
 
-	// Left plane (점: 0, 3, 7)
-	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.LeftFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.LeftFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
+	// ────────────────────────────────────────────────
+	// 2. 화면 사각형 (NDC)
+	// 구의 뷰 공간 AABB를 투영한 보수적 범위. X/Z의 최소는 X가 음수면 가장 가까운 깊이, 양수면 가장 먼 깊이에서 나온다
+	// ────────────────────────────────────────────────
+	float MinX = ViewCenter.X - Radius;
+	float MaxX = ViewCenter.X + Radius;
+	float MinY = ViewCenter.Y - Radius;
+	float MaxY = ViewCenter.Y + Radius;
 
-	// Right plane (점: 1, 5, 6)
+	float NdcMinX = -1.0f, NdcMaxX = 1.0f, NdcMinY = -1.0f, NdcMaxY = 1.0f;
+	if (bOrthographicView)
 	{
-		FVector Edge1 = WorldCorners[5] - WorldCorners[1];
-		FVector Edge2 = WorldCorners[6] - WorldCorners[1];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.RightFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.RightFace.Distance = -FVector::Dot(Normal, WorldCorners[1]);
+		NdcMinX = MinX * ProjScaleX;
+		NdcMaxX = MaxX * ProjScaleX;
+		NdcMinY = MinY * ProjScaleY;
+		NdcMaxY = MaxY * ProjScaleY;
 	}
-
-	// Bottom plane (점: 0, 1, 5)
+	else if (MinDepth > NearDepth)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.BottomFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.BottomFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
+		// 가까운 평면과 겹치지 않는 경우만 투영 (겹치면 화면 전체)
+		NdcMinX = (MinX < 0.0f ? MinX / MinDepth : MinX / MaxDepth) * ProjScaleX;
+		NdcMaxX = (MaxX > 0.0f ? MaxX / MinDepth : MaxX / MaxDepth) * ProjScaleX;
+		NdcMinY = (MinY < 0.0f ? MinY / MinDepth : MinY / MaxDepth) * ProjScaleY;
+		NdcMaxY = (MaxY > 0.0f ? MaxY / MinDepth : MaxY / MaxDepth) * ProjScaleY;
 	}
 
-	// Top plane (점: 2, 3, 7)
+	if (NdcMaxX < -1.0f || NdcMinX > 1.0f || NdcMaxY < -1.0f || NdcMinY > 1.0f)
 	{
-		FVector Edge1 = WorldCorners[3] - WorldCorners[2];
-		FVector Edge2 = WorldCorners[7] - WorldCorners[2];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.TopFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.TopFace.Distance = -FVector::Dot(Normal, WorldCorners[2]);
+		Stats.LightsOutsideView++;
+		return;
 	}
 
-	// Near plane (점: 0, 1, 2)
+	const int32 TileBeginX = NdcToTileX(NdcMinX);
+	const int32 TileEndX = NdcToTileX(NdcMaxX);
+	const int32 TileBeginY = NdcToTileY(NdcMaxY);  // NDC Y가 클수록 화면 위쪽 (작은 타일 Y)
+	const int32 TileEndY = NdcToTileY(NdcMinY);
+
+	// ────────────────────────────────────────────────
+	// 3. 범위 안 클러스터를 X 방향 4개씩 SIMD 테스트
+	// ────────────────────────────────────────────────
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 Half = _mm_set1_ps(0.5f);
+	const __m128 LaneOffsets = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+
+	// Point 라이트 구 (Spot이면 꼭지점 중심, 반지름 = Range)
+	const FVector SphereCenter = Cone ? Cone->Apex : ViewCenter;
+	const float SphereRadius = Cone ? Cone->Range : Radius;
+	const __m128 CenterX = _mm_set1_ps(SphereCenter.X);
+	const __m128 CenterY = _mm_set1_ps(SphereCenter.Y);
+	const __m128 CenterZ = _mm_set1_ps(SphereCenter.Z);
+	const __m128 RadiusSq = _mm_set1_ps(SphereRadius * SphereRadius);
+
+	for (int32 Slice = SliceBegin; Slice <= SliceEnd; ++Slice)
 	{
-		FVector Edge1 = WorldCorners[1] - WorldCorners[0];
-		FVector Edge2 = WorldCorners[2] - WorldCorners[0];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.NearFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.NearFace.Distance = -FVector::Dot(Normal, WorldCorners[0]);
-	}
+		const float SliceNear = SliceDepths[Slice];
+		const float SliceFar = SliceDepths[Slice + 1];
+		const __m128 SliceNearV = _mm_set1_ps(SliceNear);
+		const __m128 SliceFarV = _mm_set1_ps(SliceFar);
+
+		// Z 축 거리 (슬라이스 안이면 0)
+		const __m128 DistZ = _mm_add_ps(
+			_mm_max_ps(_mm_sub_ps(SliceNearV, CenterZ), Zero),
+			_mm_max_ps(_mm_sub_ps(CenterZ, SliceFarV), Zero));
+		const __m128 DistZSq = _mm_mul_ps(DistZ, DistZ);
+
+		for (int32 TileY = TileBeginY; TileY <= TileEndY; ++TileY)
+		{
+			// 타일 Y 범위 (원근이면 슬라이스 near/far 양쪽에서의 값 중 바깥쪽)
+			const float TopEdge = TileEdgeViewY[TileY];
+			const float BottomEdge = TileEdgeViewY[TileY + 1];
+			float BoxMinY = BottomEdge;
+			float BoxMaxY = TopEdge;
+			if (!bOrthographicView)
+			{
+				BoxMinY = BottomEdge < 0.0f ? BottomEdge * SliceFar : BottomEdge * SliceNear;
+				BoxMaxY = TopEdge > 0.0f ? TopEdge * SliceFar : TopEdge * SliceNear;
+			}
+			const __m128 BoxMinYV = _mm_set1_ps(BoxMinY);
+			const __m128 BoxMaxYV = _mm_set1_ps(BoxMaxY);
 
-	// Far plane (점: 4, 6, 5)
-	{
-		FVector Edge1 = WorldCorners[6] - WorldCorners[4];
-		FVector Edge2 = WorldCorners[5] - WorldCorners[4];
-		FVector Normal = FVector::Cross(Edge1, Edge2).GetSafeNormal();
-		Frustum.FarFace.Normal = FVector4(Normal.X, Normal.Y, Normal.Z, 0.0f);
-		Frustum.FarFace.Distance = -FVector::Dot(Normal, WorldCorners[4]);
-	}
+			const __m128 DistY = _mm_add_ps(
+				_mm_max_ps(_mm_sub_ps(BoxMinYV, CenterY), Zero),
+				_mm_max_ps(_mm_sub_ps(CenterY, BoxMaxYV), Zero));
+			const __m128 DistYZSq = _mm_add_ps(_mm_mul_ps(DistY, DistY), DistZSq);
 
-	return Frustum;
-}
+			const uint32 RowClusterBase = static_cast<uint32>(Slice) * TotalTileCount + static_cast<uint32>(TileY) * TileCountX;
 
-bool FTileLightCuller::TestPointLightAgainstFrustum(
-	const FPointLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	// Point Light는 구체로 근사
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+			for (int32 TileX = TileBeginX; TileX <= TileEndX; TileX += 4)
+			{
+				// 타일 4개의 X 범위
+				const __m128 LeftEdge = _mm_loadu_ps(&TileEdgeViewX[TileX]);
+				const __m128 RightEdge = _mm_loadu_ps(&TileEdgeViewX[TileX + 1]);
+				__m128 BoxMinXV = LeftEdge;
+				__m128 BoxMaxXV = RightEdge;
+				if (!bOrthographicView)
+				{
+					BoxMinXV = _mm_min_ps(_mm_mul_ps(LeftEdge, SliceNearV), _mm_mul_ps(LeftEdge, SliceFarV));
+					BoxMaxXV = _mm_max_ps(_mm_mul_ps(RightEdge, SliceNearV), _mm_mul_ps(RightEdge, SliceFarV));
+				}
 
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+				// 구-AABB: 가장 가까운 점까지 거리² <= r²
+				const __m128 DistX = _mm_add_ps(
+					_mm_max_ps(_mm_sub_ps(BoxMinXV, CenterX), Zero),
+					_mm_max_ps(_mm_sub_ps(CenterX, BoxMaxXV), Zero));
+				const __m128 DistSq = _mm_add_ps(_mm_mul_ps(DistX, DistX), DistYZSq);
+				__m128 PassMask = _mm_cmple_ps(DistSq, RadiusSq);
 
-bool FTileLightCuller::TestSpotLightAgainstFrustum(
-	const FSpotLightInfo& Light,
-	const FFrustum& Frustum,
-	const FMatrix& ViewMatrix)
-{
-	FVector LightPos = Light.Position;
-	float Radius = Light.AttenuationRadius;
+				// 범위를 넘는 레인 제거
+				const __m128 LaneTileX = _mm_add_ps(_mm_set1_ps(static_cast<float>(TileX)), LaneOffsets);
+				PassMask = _mm_and_ps(PassMask, _mm_cmple_ps(LaneTileX, _mm_set1_ps(static_cast<float>(TileEndX))));
 
-	// Spot Light도 구체로 근사
-	return SphereIntersectsFrustum(LightPos, Radius, Frustum);
-}
+				const int32 LaneCount = (TileEndX - TileX + 1) < 4 ? (TileEndX - TileX + 1) : 4;
+				Stats.TotalLightTests += LaneCount;
 
-bool FTileLightCuller::SphereIntersectsFrustum(
-	const FVector& Center,
-	float Radius,
-	const FFrustum& Frustum)
-{
-	// 구체가 모든 평면의 앞쪽(양수)에 있으면 프러스텀 내부
-	// 하나라도 뒤쪽(음수)에 있고 거리가 반지름보다 크면 외부
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
-
-	for (int i = 0; i < 6; ++i)
-	{
-		// 평면 방정식: Normal · P + Distance = 0
-		// 점 P에서 평면까지의 부호 있는 거리 = Normal · P + Distance
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-		float SignedDistance = FVector::Dot(Normal3D, Center) + Planes[i]->Distance;
+				// 원뿔-경계구 테스트 (클러스터 AABB의 경계 구가 원뿔 밖에 있으면 제외)
+				if (Cone && _mm_movemask_ps(PassMask) != 0)
+				{
+					const __m128 BoxCenterX = _mm_mul_ps(_mm_add_ps(BoxMinXV, BoxMaxXV), Half);
+					const __m128 BoxCenterY = _mm_mul_ps(_mm_add_ps(BoxMinYV, BoxMaxYV), Half);
+					const __m128 BoxCenterZ = _mm_mul_ps(_mm_add_ps(SliceNearV, SliceFarV), Half);
+					const __m128 ExtentX = _mm_mul_ps(_mm_sub_ps(BoxMaxXV, BoxMinXV), Half);
+					const __m128 ExtentY = _mm_mul_ps(_mm_sub_ps(BoxMaxYV, BoxMinYV), Half);
+					const __m128 ExtentZ = _mm_mul_ps(_mm_sub_ps(SliceFarV, SliceNearV), Half);
+					const __m128 BoxRadius = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(ExtentX, ExtentX), _mm_mul_ps(ExtentY, ExtentY)), _mm_mul_ps(ExtentZ, ExtentZ)));
+
+					const __m128 ToBoxX = _mm_sub_ps(BoxCenterX, CenterX);
+					const __m128 ToBoxY = _mm_sub_ps(BoxCenterY, CenterY);
+					const __m128 ToBoxZ = _mm_sub_ps(BoxCenterZ, CenterZ);
+					const __m128 LengthSq = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(ToBoxX, ToBoxX), _mm_mul_ps(ToBoxY, ToBoxY)), _mm_mul_ps(ToBoxZ, ToBoxZ));
+
+					// 축 방향 거리와 축에서 떨어진 거리
+					const __m128 AxisDist = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(ToBoxX, _mm_set1_ps(Cone->Direction.X)),
+						_mm_mul_ps(ToBoxY, _mm_set1_ps(Cone->Direction.Y))),
+						_mm_mul_ps(ToBoxZ, _mm_set1_ps(Cone->Direction.Z)));
+					const __m128 RadialDist = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(LengthSq, _mm_mul_ps(AxisDist, AxisDist)), Zero));
+
+					// 원뿔 표면까지의 거리 = cos * Radial - sin * Axis
+					const __m128 ConeDist = _mm_sub_ps(
+						_mm_mul_ps(_mm_set1_ps(Cone->CosHalfAngle), RadialDist),
+						_mm_mul_ps(_mm_set1_ps(Cone->SinHalfAngle), AxisDist));
+
+					const __m128 InsideCone = _mm_cmple_ps(ConeDist, BoxRadius);
+					const __m128 BehindApex = _mm_cmplt_ps(AxisDist, _mm_sub_ps(Zero, BoxRadius));
+					PassMask = _mm_and_ps(PassMask, _mm_andnot_ps(BehindApex, InsideCone));
+				}
 
-		// 구체가 평면 뒤쪽에 완전히 있으면 교차하지 않음
-		if (SignedDistance < -Radius)
-		{
-			return false;
+				const int32 PassBits = _mm_movemask_ps(PassMask);
+				for (int32 Lane = 0; PassBits != 0 && Lane < LaneCount; ++Lane)
+				{
+					if ((PassBits & (1 << Lane)) == 0)
+					{
+						continue;
+					}
+
+					const uint32 ClusterIndex = RowClusterBase + static_cast<uint32>(TileX + Lane);
+					PairClusters.Add(ClusterIndex);
+					PairLights.Add(PackedIndex);
+					ClusterLightData[ClusterIndex * 2 + 1]++;
+					Stats.TotalLightsPassed++;
+				}
+			}
 		}
 	}
-
-	return true;
 }
 
-bool FTileLightCuller::ConeIntersectsFrustum(
-	const FVector& Apex,
-	const FVector& Direction,
-	float Height,
-	float CosHalfAngle,
-	const FFrustum& Frustum)
+int32 FTileLightCuller::GetDepthSlice(float ViewDepth) const
 {
-	// 원뿔-프러스텀 교차 테스트
-	float SinHalfAngle = sqrt(1.0f - CosHalfAngle * CosHalfAngle);
-
-	// 원뿔 밑면의 반지름
-	float BaseRadius = Height * SinHalfAngle;
-
-	// 경계 구체의 중심은 원뿔 축을 따라 이동
-	float K = (CosHalfAngle > 0.707f) ? 0.5f : (0.5f + 0.5f * SinHalfAngle);
-	FVector SphereCenter = Apex + Direction * (Height * K);
-
-	// 경계 구체의 반지름 (원뿔의 꼭지점과 밑면 가장자리를 모두 포함)
-	float SphereRadius;
-	if (CosHalfAngle > 0.707f) // 각도가 45도 이하 (좁은 원뿔)
-	{
-		// 좁은 원뿔: 밑면 중심에서 가장자리까지의 거리
-		SphereRadius = sqrt(BaseRadius * BaseRadius + (Height * 0.5f) * (Height * 0.5f));
-	}
-	else // 각도가 45도 이상 (넓은 원뿔)
-	{
-		// 넓은 원뿔: 더 보수적인 반지름 사용
-		SphereRadius = Height * 0.866f; // sqrt(3)/2 ≈ 0.866
-	}
-
-	// 2. 경계 구체가 프러스텀과 교차하는지 먼저 테스트 (빠른 거부)
-	if (!SphereIntersectsFrustum(SphereCenter, SphereRadius, Frustum))
+	const float Slice = std::floor(std::log2(ViewDepth) * DepthSliceScale + DepthSliceBias);
+	if (Slice <= 0.0f)
 	{
-		return false;
+		return 0;
 	}
+	return Slice >= static_cast<float>(DepthSliceCount - 1) ? static_cast<int32>(DepthSliceCount - 1) : static_cast<int32>(Slice);
+}
 
-	// 3. 추가 정밀 테스트: 원뿔 끝점(밑면 중심)도 체크
-	FVector ConeEnd = Apex + Direction * Height;
-
-	// 6개 평면 각각에 대해 테스트
-	const FPlane* Planes[6] = {
-		&Frustum.LeftFace,
-		&Frustum.RightFace,
-		&Frustum.TopFace,
-		&Frustum.BottomFace,
-		&Frustum.NearFace,
-		&Frustum.FarFace
-	};
-
-	// 원뿔의 꼭지점과 끝점이 모두 같은 평면 뒤쪽에 있는지 확인
-	for (int i = 0; i < 6; ++i)
-	{
-		FVector Normal3D(Planes[i]->Normal.X, Planes[i]->Normal.Y, Planes[i]->Normal.Z);
-
-		float ApexDistance = FVector::Dot(Normal3D, Apex) + Planes[i]->Distance;
-		float EndDistance = FVector::Dot(Normal3D, ConeEnd) + Planes[i]->Distance;
-
-		// 두 점이 모두 평면 뒤쪽에 있고, 밑면 반지름보다 멀리 있으면 완전히 외부
-		if (ApexDistance < -BaseRadius && EndDistance < -BaseRadius)
-		{
-			return false;
-		}
-	}
+int32 FTileLightCuller::NdcToTileX(float NdcX) const
+{
+	const float Pixel = (NdcX * 0.5f + 0.5f) * static_cast<float>(ViewportWidth);
+	const int32 Tile = static_cast<int32>(std::floor(Pixel / static_cast<float>(TileSize)));
+	return Tile < 0 ? 0 : (Tile >= static_cast<int32>(TileCountX) ? static_cast<int32>(TileCountX) - 1 : Tile);
+}
 
-	// 모든 테스트를 통과하면 교차한다고 판단
-	return true;
+int32 FTileLightCuller::NdcToTileY(float NdcY) const
+{
+	const float Pixel = (0.5f - NdcY * 0.5f) * static_cast<float>(ViewportHeight);
+	const int32 Tile = static_cast<int32>(std::floor(Pixel / static_cast<float>(TileSize)));
+	return Tile < 0 ? 0 : (Tile >= static_cast<int32>(TileCountY) ? static_cast<int32>(TileCountY) - 1 : Tile);
 }
 
 ID3D11ShaderResourceView* FTileLightCuller::GetLightIndexBufferSRV()
@@ -415,5 +478,8 @@ void FTileLightCuller::Release()
 		LightIndexBuffer = nullptr;
 	}
 
-	TileLightIndices.Empty();
+	LightIndexBufferCapacity = 0;
+	ClusterLightData.Empty();
+	PairClusters.Empty();
+	PairLights.Empty();
 }
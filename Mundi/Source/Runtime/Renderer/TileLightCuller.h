@@ -2,20 +2,34 @@
 #include "LightManager.h"
 #include "TileCullingStats.h"
 #include "D3D11RHI.h"
-#include "Frustum.h"
 
-// 타일 기반 라이트 컬링을 CPU에서 수행하는 클래스
-// Conservative(near, far) frustum 방식으로 각 타일에 영향을 주는 라이트를 계산
+/**
+ * 클러스터(3D froxel) 기반 라이트 컬링을 CPU에서 수행하는 클래스
+ *
+ * - 화면을 TileSize 픽셀 타일로, 뷰 깊이를 지수 분포 슬라이스로 나눈 TileCountX x TileCountY x DepthSliceCount 클러스터
+ * - 라이트마다 뷰 공간 경계 구의 화면 사각형/깊이 범위를 한 번만 계산하고, 그 범위의 클러스터만 SSE로 4개씩 테스트
+ *   (Point: 구-AABB, Spot: 구-AABB + 원뿔-경계구)
+ * - 통과한 (클러스터, 라이트) 쌍을 카운팅 정렬로 모아 클러스터별 연속 인덱스 리스트를 만든다
+ *
+ * Structured Buffer 레이아웃 (t2, uint):
+ *   [ClusterIndex * 2]     = 라이트 인덱스 시작 오프셋 (버퍼 기준 절대 위치)
+ *   [ClusterIndex * 2 + 1] = 라이트 개수
+ *   [ClusterCount * 2 ~]   = 라이트 인덱스 (상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스)
+ * ClusterIndex = Slice * (TileCountX * TileCountY) + TileY * TileCountX + TileX
+ */
 class FTileLightCuller
 {
 public:
+	// 깊이 슬라이스 개수 (LightingCommon.hlsl은 상수 버퍼의 DepthSliceCount를 사용)
+	static constexpr UINT DepthSliceCount = 16;
+
 	FTileLightCuller();
 	~FTileLightCuller();
 
 	// 초기화 (Structured Buffer 생성)
 	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
 
-	// 타일 컬링 수행 (매 프레임 호출)
+	// 클러스터 컬링 수행 (매 프레임 호출)
 	void CullLights(
 		const TArray<FPointLightInfo>& PointLights,
 		const TArray<FSpotLightInfo>& SpotLights,
@@ -24,12 +38,17 @@ public:
 		float NearPlane,
 		float FarPlane,
 		UINT ViewportWidth,
-		UINT ViewportHeight
+		UINT ViewportHeight,
+		bool bOrthographic = false
 	);
 
 	// 컬링 결과를 Structured Buffer에 업데이트하고 SRV 반환
 	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
 
+	// 셰이더의 깊이 슬라이스 계산용 (Slice = log2(ViewDepth) * Scale + Bias)
+	float GetDepthSliceScale() const { return DepthSliceScale; }
+	float GetDepthSliceBias() const { return DepthSliceBias; }
+
 	// 통계 정보 반환
 	const FTileCullingStats& GetStats() const { return Stats; }
 
@@ -37,30 +56,24 @@ public:
 	void Release();
 
 private:
-	// 타일 프러스텀 생성 (Conservative near/far 방식)
-	FFrustum CreateTileFrustum(
-		UINT TileX,
-		UINT TileY,
-		const FMatrix& InvViewProj,
-		float NearPlane,
-		float FarPlane
-	);
-
-	// 라이트가 타일 프러스텀과 교차하는지 테스트
-	bool TestPointLightAgainstFrustum(const FPointLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-	bool TestSpotLightAgainstFrustum(const FSpotLightInfo& Light, const FFrustum& Frustum, const FMatrix& ViewMatrix);
-
-	// 구체와 프러스텀 교차 테스트
-	bool SphereIntersectsFrustum(const FVector& Center, float Radius, const FFrustum& Frustum);
-
-	// 원뿔과 프러스텀 교차 테스트 (SpotLight용)
-	bool ConeIntersectsFrustum(
-		const FVector& Apex,           // 원뿔 꼭지점 (라이트 위치)
-		const FVector& Direction,      // 원뿔 방향 (정규화됨)
-		float Height,                  // 원뿔 높이 (AttenuationRadius)
-		float CosHalfAngle,            // cos(OuterConeAngle / 2)
-		const FFrustum& Frustum
-	);
+	// 라이트 하나의 뷰 공간 범위를 구하고 겹치는 클러스터에 (클러스터, 라이트) 쌍을 추가
+	// Cone이 nullptr이면 Point Light (구만 테스트)
+	struct FSpotCone
+	{
+		FVector Apex;          // 뷰 공간 꼭지점 (라이트 위치)
+		FVector Direction;     // 뷰 공간 방향 (정규화됨)
+		float Range;           // AttenuationRadius
+		float CosHalfAngle;
+		float SinHalfAngle;
+	};
+	void AssignLight(const FVector& ViewCenter, float Radius, const FSpotCone* Cone, uint32 PackedIndex);
+
+	// 뷰 깊이 → 슬라이스 인덱스 (셰이더의 CalculateDepthSlice와 같은 식)
+	int32 GetDepthSlice(float ViewDepth) const;
+
+	// NDC 좌표 → 타일 인덱스 (범위 밖은 클램프)
+	int32 NdcToTileX(float NdcX) const;
+	int32 NdcToTileY(float NdcY) const;
 
 private:
 	D3D11RHI* RHI;
@@ -70,18 +83,38 @@ private:
 	UINT TileCountX;        // 가로 타일 개수
 	UINT TileCountY;        // 세로 타일 개수
 	UINT TotalTileCount;    // 전체 타일 개수
-
-	// 타일당 최대 라이트 개수 (보수적으로 설정)
-	static constexpr UINT MaxLightsPerTile = 256;
-
-	// 타일별 라이트 인덱스 저장
-	// [TileIndex * MaxLightsPerTile] 위치에 라이트 개수 저장
-	// [TileIndex * MaxLightsPerTile + 1 ~ ...] 위치에 라이트 인덱스 저장
-	TArray<uint32> TileLightIndices;
+	UINT TotalClusterCount; // 전체 클러스터 개수 (타일 x 슬라이스)
+
+	// 프레임별 뷰 정보
+	UINT ViewportWidth;
+	UINT ViewportHeight;
+	float NearDepth;
+	float FarDepth;
+	float DepthSliceScale;
+	float DepthSliceBias;
+	float ProjScaleX;       // 투영 행렬 P00 (뷰 X → NDC X)
+	float ProjScaleY;       // 투영 행렬 P11
+	bool bOrthographicView;
+
+	// 슬라이스 경계 깊이 [DepthSliceCount + 1]
+	float SliceDepths[DepthSliceCount + 1];
+
+	// 타일 경계의 뷰 공간 좌표 (원근: 깊이 1 기준 기울기, 직교: 절대 좌표)
+	// X는 SIMD 4개 로드를 위해 끝에 여유분을 둔다
+	TArray<float> TileEdgeViewX;
+	TArray<float> TileEdgeViewY;
+
+	// (클러스터, 라이트) 쌍 (카운팅 정렬 입력, 프레임마다 재사용)
+	TArray<uint32> PairClusters;
+	TArray<uint32> PairLights;
+
+	// GPU로 올라가는 헤더 + 라이트 인덱스 리스트
+	TArray<uint32> ClusterLightData;
 
 	// GPU 리소스
 	ID3D11Buffer* LightIndexBuffer;
 	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;  // 원소 개수
 
 	// 통계
 	FTileCullingStats Stats;
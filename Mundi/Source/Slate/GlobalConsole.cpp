@@ -1,10 +1,17 @@
 ﻿#include "pch.h"
 #include "Widgets/ConsoleWidget.h"
+#include <mutex>
 
 IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+namespace
+{
+    // 잡 시스템 워커(에셋 프리로드 등)에서도 로그를 남기므로 위젯 추가는 직렬화
+    std::mutex ConsoleLogLock;
+}
+
 void UGlobalConsole::Initialize()
 {
     // Nothing special to initialize
@@ -53,6 +60,7 @@ void UGlobalConsole::LogV(const char* fmt, va_list args)
     // 에디터에서는 ConsoleWidget에도 출력
     if (ConsoleWidget)
     {
+        std::lock_guard<std::mutex> Guard(ConsoleLogLock);
         va_list args_copy;
         va_copy(args_copy, args);
         ConsoleWidget->VAddLog(fmt, args_copy);
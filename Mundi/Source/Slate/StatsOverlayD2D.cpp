@@ -16,6 +16,8 @@
 #include "SkinningStats.h"
 #include "SkinnedMeshComponent.h"
 #include "ParticleStats.h"
+#include "InstancingStats.h"
+#include "OcclusionStats.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -175,7 +177,7 @@ static void DrawTextBlock(
 
 void UStatsOverlayD2D::Draw()
 {
-	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning) || !SwapChain)
+	if (!bInitialized || (!bShowFPS && !bShowMemory && !bShowPicking && !bShowDecal && !bShowTileCulling && !bShowLights && !bShowShadow && !bShowSkinning && !bShowParticles && !bShowInstancing && !bShowOcclusion) || !SwapChain)
 	{
 		return;
 	}
@@ -249,15 +251,31 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
-
-		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
+		double SlabMb = static_cast<double>(FMemoryManager::GetSlabCommittedBytes()) / (1024.0 * 1024.0);
+
+		// 클래스별 생존 객체 (바이트 내림차순 상위 N개)
+		constexpr int32 MaxClassLines = 8;
+		TArray<FMemoryManager::FClassStats> ClassStats;
+		FMemoryManager::GetClassStats(ClassStats);
+		const int32 NumClassLines = std::min(ClassStats.Num(), MaxClassLines);
+
+		wchar_t Buf[1024];
+		int Len = swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu\nSlab Committed: %.1f MB",
+			Mb, static_cast<unsigned long long>(FMemoryManager::GetTotalAllocationCount()), SlabMb);
+		for (int32 i = 0; i < NumClassLines && Len > 0; ++i)
+		{
+			const FMemoryManager::FClassStats& Stats = ClassStats[i];
+			Len += swprintf_s(Buf + Len, std::size(Buf) - Len, L"\n%hs: %d (%.1f KB)",
+				Stats.Class->Name, Stats.LiveCount, static_cast<double>(Stats.LiveBytes) / 1024.0);
+		}
 
-		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
+		const float MemoryPanelWidth = 300.0f;
+		const float MemoryPanelHeight = 66.0f + 17.0f * NumClassLines;
+		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + MemoryPanelWidth, NextY + MemoryPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, Rc, BrushBlack, BrushLightGreen);
 
-		NextY += PanelHeight + Space;
+		NextY += MemoryPanelHeight + Space;
 	}
 
 	if (bShowDecal)
@@ -293,20 +311,24 @@ void UStatsOverlayD2D::Draw()
 		const FTileCullingStats& TileStats = FTileCullingStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Tile Culling Stats]\nClusters: %u x %u x %u (Active %u)\nLights: %u (P:%u S:%u, Off:%u)\nMin/Avg/Max: %u / %.2f / %u\nCulling Eff: %.1f%%\nIndices: %u (Buffer %u KB)\nCPU: %.3f ms",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
-			TileStats.TotalTileCount,
+			TileStats.DepthSliceCount,
+			TileStats.ActiveClusterCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
+			TileStats.LightsOutsideView,
 			TileStats.MinLightsPerTile,
 			TileStats.AvgLightsPerTile,
 			TileStats.MaxLightsPerTile,
 			TileStats.CullingEfficiency,
-			TileStats.LightIndexBufferSizeBytes / 1024);
+			TileStats.LightIndexCount,
+			TileStats.LightIndexBufferSizeBytes / 1024,
+			TileStats.CullingTimeMS);
 
-		const float tilePanelHeight = 160.0f;
+		const float tilePanelHeight = 180.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + tilePanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushCyan);
 
@@ -337,7 +359,7 @@ void UStatsOverlayD2D::Draw()
 		const FShadowStats& ShadowStats = FShadowStatManager::GetInstance().GetStats();
 
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB",
+		swprintf_s(Buf, L"[Shadow Stats]\nShadow Lights: %u\n  Point: %u\n  Spot: %u\n  Directional: %u\n\nAtlas 2D: %u x %u (%.1f MB)\nAtlas Cube: %u x %u x %u (%.1f MB)\n\nTotal Memory: %.1f MB\n\nAtlas 2D Used: %.1f%%\nView Cache Hit: %u  Miss: %u\nUncacheable: %u\nCaster Draws: %u",
 			ShadowStats.TotalShadowCastingLights,
 			ShadowStats.ShadowCastingPointLights,
 			ShadowStats.ShadowCastingSpotLights,
@@ -349,9 +371,14 @@ void UStatsOverlayD2D::Draw()
 			ShadowStats.ShadowAtlasCubeSize,
 			ShadowStats.ShadowCubeArrayCount,
 			ShadowStats.ShadowAtlasCubeMemoryMB,
-			ShadowStats.TotalShadowMemoryMB);
-
-		const float shadowPanelHeight = 260.0f;
+			ShadowStats.TotalShadowMemoryMB,
+			ShadowStats.ShadowAtlas2DUsage * 100.0f,
+			ShadowStats.ShadowViewCacheHits,
+			ShadowStats.ShadowViewCacheMisses,
+			ShadowStats.ShadowViewUncacheable,
+			ShadowStats.ShadowCasterDrawCalls);
+
+		const float shadowPanelHeight = 340.0f;
 		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + shadowPanelHeight);
 		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushDeepPink);
 
@@ -497,6 +524,48 @@ void UStatsOverlayD2D::Draw()
 		NextY += particlePanelHeight + Space;
 	}
 
+	if (bShowInstancing)
+	{
+		const FInstancingStats& InstancingStats = FInstancingStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Instancing Stats]\nOpaque Batches: %u\nDraw Calls: %u\nSaved: %u\nInstanced Draws: %u\n  Batches: %u\nBuffer: %u KB",
+			InstancingStats.OpaqueBatches,
+			InstancingStats.DrawCalls,
+			InstancingStats.GetDrawCallsSaved(),
+			InstancingStats.InstancedDraws,
+			InstancingStats.InstancedBatches,
+			InstancingStats.InstanceBufferBytes / 1024);
+
+		const float instancingPanelHeight = 140.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + instancingPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushLightGreen);
+
+		NextY += instancingPanelHeight + Space;
+	}
+
+	if (bShowOcclusion)
+	{
+		const FOcclusionStats& OcclusionStats = FOcclusionStatManager::GetInstance().GetStats();
+
+		wchar_t Buf[512];
+		swprintf_s(Buf, L"[Occlusion Stats]\nTested: %u\nCulled: %u (%.1f%%)\nOccluders: %u\n  Triangles: %u\n  Rasterized: %u\nRaster: %.3f ms\nTest: %.3f ms",
+			OcclusionStats.TestedObjects,
+			OcclusionStats.CulledObjects,
+			OcclusionStats.GetCulledPercent(),
+			OcclusionStats.Occluders,
+			OcclusionStats.OccluderTriangles,
+			OcclusionStats.RasterizedTriangles,
+			OcclusionStats.RasterTimeMS,
+			OcclusionStats.TestTimeMS);
+
+		const float occlusionPanelHeight = 170.0f;
+		D2D1_RECT_F rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + occlusionPanelHeight);
+		DrawTextBlock(D2DContext, TextFormat, Buf, rc, BrushBlack, BrushOrange);
+
+		NextY += occlusionPanelHeight + Space;
+	}
+
 	D2DContext->EndDraw();
 	D2DContext->SetTarget(nullptr);
 
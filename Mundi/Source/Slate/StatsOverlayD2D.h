@@ -20,6 +20,8 @@ public:
     void SetShowShadow(bool b) { bShowShadow = b; }
     void SetShowSkinning(bool b) { bShowSkinning = b; }
     void SetShowParticles(bool b) { bShowParticles = b; }
+    void SetShowInstancing(bool b) { bShowInstancing = b; }
+    void SetShowOcclusion(bool b) { bShowOcclusion = b; }
     void ToggleFPS() { bShowFPS = !bShowFPS; }
     void ToggleMemory() { bShowMemory = !bShowMemory; }
     void TogglePicking() { bShowPicking = !bShowPicking; }
@@ -29,6 +31,8 @@ public:
     void ToggleShadow() { bShowShadow = !bShowShadow; }
     void ToggleSkinning() { bShowSkinning = !bShowSkinning; }
     void ToggleParticles() { bShowParticles = !bShowParticles; }
+    void ToggleInstancing() { bShowInstancing = !bShowInstancing; }
+    void ToggleOcclusion() { bShowOcclusion = !bShowOcclusion; }
     bool IsFPSVisible() const { return bShowFPS; }
     bool IsMemoryVisible() const { return bShowMemory; }
     bool IsPickingVisible() const { return bShowPicking; }
@@ -38,6 +42,8 @@ public:
     bool IsShadowVisible() const { return bShowShadow; }
     bool IsSkinningVisible() const { return bShowSkinning; }
     bool IsParticlesVisible() const { return bShowParticles; }
+    bool IsInstancingVisible() const { return bShowInstancing; }
+    bool IsOcclusionVisible() const { return bShowOcclusion; }
 
 private:
     UStatsOverlayD2D() = default;
@@ -59,6 +65,8 @@ private:
     bool bShowLights = false;
     bool bShowSkinning = false;
     bool bShowParticles = false;
+    bool bShowInstancing = false;
+    bool bShowOcclusion = false;
 
     ID3D11Device* D3DDevice = nullptr;
     ID3D11DeviceContext* D3DContext = nullptr;
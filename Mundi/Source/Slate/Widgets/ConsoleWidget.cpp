@@ -5,6 +5,13 @@
 #include "StatsOverlayD2D.h"
 #include "SlateManager.h"
 #include "SkinnedMeshComponent.h"
+#include "CPUSkinning.h"
+#include "ParticleSoA.h"
+#include "ParticleTickManager.h"
+#include "MeshInstancing.h"
+#include "Occlusion.h"
+#include "BVHierarchy.h"
+#include "ObjParser.h"
 #include "PlatformCrashHandler.h"
 #include <windows.h>
 #include <cstdarg>
@@ -54,11 +61,22 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT SKINNING");
 	HelpCommandList.Add("SKINNING GPU");
 	HelpCommandList.Add("SKINNING CPU");
+	HelpCommandList.Add("BENCH SKINNING <vertices>");
+	HelpCommandList.Add("BENCH PARTICLES <particles>");
+	HelpCommandList.Add("BENCH ISA <iterations>");
+	HelpCommandList.Add("BENCH OBJ <triangles>");
+	HelpCommandList.Add("BENCH RAY <objects>");
+	HelpCommandList.Add("BENCH DELEGATE <broadcasts>");
+	HelpCommandList.Add("PARTICLE PARALLEL <0|1>");
 	HelpCommandList.Add("STAT ALL");
 	HelpCommandList.Add("STAT NONE");
 	HelpCommandList.Add("STAT LIGHT");
 	HelpCommandList.Add("STAT SHADOW");
 	HelpCommandList.Add("STAT PARTICLES");
+	HelpCommandList.Add("STAT INSTANCING");
+	HelpCommandList.Add("INSTANCING <0|1>");
+	HelpCommandList.Add("STAT OCCLUSION");
+	HelpCommandList.Add("OCCLUSION <0|1>");
 	HelpCommandList.Add("MINIDUMP");
 	HelpCommandList.Add("CAUSECRASH");
 	HelpCommandList.Add("CRASHIN <seconds>");
@@ -368,6 +386,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		AddLog("- STAT LIGHT");
 		AddLog("- STAT SHADOW");
 		AddLog("- STAT PARTICLES");
+		AddLog("- STAT INSTANCING");
+		AddLog("- STAT OCCLUSION");
 		AddLog("- STAT ALL");
 		AddLog("- STAT NONE");
 	}
@@ -406,6 +426,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(true);
 		UStatsOverlayD2D::Get().SetShowShadow(true);
 		UStatsOverlayD2D::Get().SetShowParticles(true);
+		UStatsOverlayD2D::Get().SetShowInstancing(true);
+		UStatsOverlayD2D::Get().SetShowOcclusion(true);
 		AddLog("STAT: ON");
 	}
 	else if (Stricmp(command_line, "STAT SKINNING") == 0)
@@ -423,6 +445,16 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().ToggleParticles();
 		AddLog("STAT PARTICLES TOGGLED");
 	}
+	else if (Stricmp(command_line, "STAT INSTANCING") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleInstancing();
+		AddLog("STAT INSTANCING TOGGLED");
+	}
+	else if (Stricmp(command_line, "STAT OCCLUSION") == 0)
+	{
+		UStatsOverlayD2D::Get().ToggleOcclusion();
+		AddLog("STAT OCCLUSION TOGGLED");
+	}
 	else if (Stricmp(command_line, "STAT NONE") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(false);
@@ -433,6 +465,8 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		UStatsOverlayD2D::Get().SetShowSkinning(false);
 		UStatsOverlayD2D::Get().SetShowShadow(false);
 		UStatsOverlayD2D::Get().SetShowParticles(false);
+		UStatsOverlayD2D::Get().SetShowInstancing(false);
+		UStatsOverlayD2D::Get().SetShowOcclusion(false);
 		AddLog("STAT: OFF");
 	}
 	else if (Strnicmp(command_line, "SKINNING GPU", 12) == 0)
@@ -471,6 +505,69 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 
 		AddLog("CPU Skinning enabled globally (all worlds)");
 	}
+	else if (Strnicmp(command_line, "BENCH SKINNING", 14) == 0)
+	{
+		// CPU 스키닝 커널 벤치마크 (스칼라 / SIMD / SIMD + 멀티스레드)
+		const int NumVertices = atoi(command_line + 14);
+		AddLog("Running CPU skinning benchmark...");
+		FCPUSkinning::RunBenchmark(NumVertices > 0 ? NumVertices : 100000);
+	}
+	else if (Strnicmp(command_line, "BENCH PARTICLES", 15) == 0)
+	{
+		// 파티클 업데이트 벤치마크 (AoS / SoA + SSE)
+		const int NumParticles = atoi(command_line + 15);
+		AddLog("Running particle layout benchmark...");
+		FParticleSoAData::RunBenchmark(NumParticles > 0 ? NumParticles : 100000);
+	}
+	else if (Strnicmp(command_line, "BENCH ISA", 9) == 0)
+	{
+		// IsChildOf 벤치마크 (Super 체인 / pre-order 구간 검사)
+		const int Iterations = atoi(command_line + 9);
+		AddLog("Running IsA benchmark...");
+		UClass::RunIsABenchmark(Iterations > 0 ? Iterations : 100);
+	}
+	else if (Strnicmp(command_line, "BENCH OBJ", 9) == 0)
+	{
+		// OBJ 파서 벤치마크 (getline + stringstream / 버퍼 / 버퍼 + 멀티스레드)
+		const int NumTriangles = atoi(command_line + 9);
+		AddLog("Running OBJ parser benchmark...");
+		FObjParser::RunBenchmark(NumTriangles > 0 ? NumTriangles : 2000000);
+	}
+	else if (Strnicmp(command_line, "BENCH RAY", 9) == 0)
+	{
+		// 월드 BVH 레이 쿼리 벤치마크 (priority_queue / 스택 + SSE / 4-레이 패킷)
+		const int NumObjects = atoi(command_line + 9);
+		AddLog("Running BVH ray query benchmark...");
+		FBVHierarchy::RunRayBenchmark(NumObjects > 0 ? NumObjects : 100000);
+	}
+	else if (Strnicmp(command_line, "BENCH DELEGATE", 14) == 0)
+	{
+		// 델리게이트 Broadcast 벤치마크 (리스너 1 / 8 / 64개)
+		const int Iterations = atoi(command_line + 14);
+		AddLog("Running delegate broadcast benchmark...");
+		FDelegateBenchmark::RunBenchmark(Iterations > 0 ? Iterations : 200000);
+	}
+	else if (Strnicmp(command_line, "PARTICLE PARALLEL", 17) == 0)
+	{
+		// 월드 파티클 틱 단계의 이미터 병렬 시뮬레이션 토글
+		const bool bEnable = atoi(command_line + 17) != 0;
+		FParticleTickManager::SetParallelTickEnabled(bEnable);
+		AddLog("Particle parallel tick: %s", bEnable ? "ON" : "OFF");
+	}
+	else if (Strnicmp(command_line, "INSTANCING", 10) == 0)
+	{
+		// 동일 스태틱 메시 배치 자동 인스턴싱 토글
+		const bool bEnable = atoi(command_line + 10) != 0;
+		FMeshAutoInstancing::SetEnabled(bEnable);
+		AddLog("Auto instancing: %s", bEnable ? "ON" : "OFF");
+	}
+	else if (Strnicmp(command_line, "OCCLUSION", 9) == 0)
+	{
+		// CPU 오클루전 컬링 토글
+		const bool bEnable = atoi(command_line + 9) != 0;
+		FOcclusionCullingManagerCPU::SetEnabled(bEnable);
+		AddLog("Occlusion culling: %s", bEnable ? "ON" : "OFF");
+	}
 	else if (Stricmp(command_line, "MINIDUMP") == 0)
 	{
 		AddLog("Generating MiniDump...");
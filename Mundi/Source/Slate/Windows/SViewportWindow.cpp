@@ -1438,6 +1438,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				UStatsOverlayD2D::Get().SetShowShadow(false);
 				UStatsOverlayD2D::Get().SetShowSkinning(false);
 				UStatsOverlayD2D::Get().SetShowParticles(false);
+				UStatsOverlayD2D::Get().SetShowInstancing(false);
 			}
 
 			if (ImGui::IsItemHovered())
@@ -1547,6 +1548,16 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				ImGui::SetTooltip("파티클 시스템 통계를 표시합니다. (시스템 수, 이미터 수, 파티클 수, 메모리 사용량)");
 			}
 
+			bool bInstancingStats = UStatsOverlayD2D::Get().IsInstancingVisible();
+			if (ImGui::Checkbox(" INSTANCING", &bInstancingStats))
+			{
+				UStatsOverlayD2D::Get().ToggleInstancing();
+			}
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("자동 인스턴싱 통계를 표시합니다. (병합 전후 드로우 콜 수, 절약된 드로우 콜 수)");
+			}
+
 			ImGui::EndMenu();
 		}
 
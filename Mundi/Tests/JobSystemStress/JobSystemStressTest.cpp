@@ -0,0 +1,274 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+#include <chrono>
+#include <random>
+#include <thread>
+
+// ────────────────────────────────────────────────────────────────────────────
+// JobSystemStressTest.cpp
+// FJobSystem 헤드리스 스트레스 테스트 (ParallelFor / 중첩 ParallelFor / 랜덤 DAG / Work Stealing)
+// 실패하면 위치를 출력하고 0이 아닌 값으로 종료한다.
+// ────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+	int32 GNumFailures = 0;
+
+#define STRESS_CHECK(Condition) \
+	do \
+	{ \
+		if (!(Condition)) \
+		{ \
+			std::printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #Condition); \
+			++GNumFailures; \
+		} \
+	} while (0)
+
+	/** 스케줄러가 잡 사이를 섞을 수 있도록 약간의 일을 한다. */
+	uint32 Spin(uint32 Iterations)
+	{
+		volatile uint32 Value = 0;
+		for (uint32 i = 0; i < Iterations; ++i)
+		{
+			Value = Value * 1664525u + 1013904223u;
+		}
+		return Value;
+	}
+
+	/** 모든 인덱스가 정확히 한 번씩 호출되는지 */
+	void TestParallelFor()
+	{
+		const int32 Sizes[] = { 0, 1, 7, 64, 1000, 100000 };
+		const int32 BatchSizes[] = { 0, 1, 3, 64, 4096 };
+
+		for (int32 Num : Sizes)
+		{
+			for (int32 BatchSize : BatchSizes)
+			{
+				std::vector<std::atomic<int32>> Visits(static_cast<size_t>(Num));
+				FJobSystem::ParallelFor(Num, BatchSize, [&Visits](int32 Index)
+				{
+					Visits[Index].fetch_add(1, std::memory_order_relaxed);
+				});
+
+				int32 NumWrong = 0;
+				for (const std::atomic<int32>& Visit : Visits)
+				{
+					NumWrong += Visit.load() != 1 ? 1 : 0;
+				}
+				STRESS_CHECK(NumWrong == 0);
+			}
+		}
+
+		// 구간 버전: 구간이 겹치지 않고 [0, Num)을 빠짐없이 덮어야 한다.
+		const int32 Num = 12345;
+		std::atomic<int64> Sum{ 0 };
+		std::atomic<int32> NumRanges{ 0 };
+		FJobSystem::ParallelForRange(Num, 100, [&Sum, &NumRanges](int32 Start, int32 End)
+		{
+			int64 LocalSum = 0;
+			for (int32 Index = Start; Index < End; ++Index)
+			{
+				LocalSum += Index;
+			}
+			Sum.fetch_add(LocalSum, std::memory_order_relaxed);
+			NumRanges.fetch_add(1, std::memory_order_relaxed);
+		});
+		STRESS_CHECK(Sum.load() == int64(Num) * (Num - 1) / 2);
+		// 워커가 없으면 나누지 않고 한 번에 호출한다.
+		STRESS_CHECK(NumRanges.load() == (FJobSystem::GetNumWorkers() > 0 ? (Num + 99) / 100 : 1));
+	}
+
+	/** 배치 안에서 다시 ParallelFor (워커가 기다리는 동안 다른 잡을 실행해야 교착되지 않음) */
+	void TestNestedParallelFor()
+	{
+		const int32 Outer = 64;
+		const int32 Inner = 2000;
+		std::vector<std::atomic<int32>> Visits(static_cast<size_t>(Outer * Inner));
+
+		FJobSystem::ParallelFor(Outer, 1, [&Visits, Inner](int32 OuterIndex)
+		{
+			FJobSystem::ParallelFor(Inner, 16, [&Visits, Inner, OuterIndex](int32 InnerIndex)
+			{
+				Spin(50);
+				Visits[OuterIndex * Inner + InnerIndex].fetch_add(1, std::memory_order_relaxed);
+			});
+
+			// 3단 중첩
+			FJobSystem::ParallelFor(8, 1, [](int32)
+			{
+				FJobSystem::ParallelFor(32, 4, [](int32) { Spin(20); });
+			});
+		});
+
+		int32 NumWrong = 0;
+		for (const std::atomic<int32>& Visit : Visits)
+		{
+			NumWrong += Visit.load() != 1 ? 1 : 0;
+		}
+		STRESS_CHECK(NumWrong == 0);
+	}
+
+	/**
+	 * 랜덤 DAG: 각 노드는 앞쪽 노드 몇 개를 선행 잡으로 가진다.
+	 * 실행 시점에 모든 선행 노드가 이미 끝났는지 확인한다.
+	 */
+	void TestRandomGraphs(uint32 Seed, int32 NumGraphs)
+	{
+		std::mt19937 Random(Seed);
+
+		for (int32 Graph = 0; Graph < NumGraphs; ++Graph)
+		{
+			const int32 NumNodes = 200 + static_cast<int32>(Random() % 800);
+
+			std::vector<std::vector<int32>> Prerequisites(static_cast<size_t>(NumNodes));
+			for (int32 Node = 1; Node < NumNodes; ++Node)
+			{
+				const int32 NumEdges = static_cast<int32>(Random() % 4);
+				for (int32 Edge = 0; Edge < NumEdges; ++Edge)
+				{
+					Prerequisites[Node].push_back(static_cast<int32>(Random() % Node));
+				}
+			}
+
+			std::vector<std::atomic<int32>> Finished(static_cast<size_t>(NumNodes));
+			std::atomic<int32> NumOrderViolations{ 0 };
+			std::vector<FJobHandle> Jobs(static_cast<size_t>(NumNodes));
+
+			for (int32 Node = 0; Node < NumNodes; ++Node)
+			{
+				std::vector<FJobHandle> PrerequisiteJobs;
+				for (int32 Prerequisite : Prerequisites[Node])
+				{
+					PrerequisiteJobs.push_back(Jobs[Prerequisite]);
+				}
+
+				const uint32 Work = Random() % 200;
+				Jobs[Node] = FJobSystem::Dispatch([&Prerequisites, &Finished, &NumOrderViolations, Node, Work]()
+				{
+					for (int32 Prerequisite : Prerequisites[Node])
+					{
+						if (Finished[Prerequisite].load(std::memory_order_acquire) == 0)
+						{
+							NumOrderViolations.fetch_add(1, std::memory_order_relaxed);
+						}
+					}
+					Spin(Work);
+					Finished[Node].store(1, std::memory_order_release);
+				}, PrerequisiteJobs);
+			}
+
+			FJobSystem::WaitAll(Jobs);
+
+			int32 NumUnfinished = 0;
+			for (int32 Node = 0; Node < NumNodes; ++Node)
+			{
+				NumUnfinished += (Finished[Node].load() == 0 || !Jobs[Node]->IsCompleted()) ? 1 : 0;
+			}
+			STRESS_CHECK(NumOrderViolations.load() == 0);
+			STRESS_CHECK(NumUnfinished == 0);
+		}
+	}
+
+	/** 여러 외부 스레드가 동시에 DAG를 만들고 기다린다. */
+	void TestConcurrentProducers()
+	{
+		std::vector<std::thread> Producers;
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			Producers.emplace_back([i]() { TestRandomGraphs(1000 + i, 10); });
+		}
+		for (std::thread& Producer : Producers)
+		{
+			Producer.join();
+		}
+	}
+
+	/** 한 워커 큐에 몰아 넣은 잡을 다른 워커가 훔쳐 가는지 */
+	void TestWorkStealing()
+	{
+		if (FJobSystem::GetNumWorkers() < 2)
+		{
+			std::printf("  (skipped: needs at least 2 workers)\n");
+			return;
+		}
+
+		FJobSystem::ResetStats();
+
+		const int32 NumChildren = 2000;
+		std::atomic<int32> NumExecuted{ 0 };
+
+		// 워커 안에서 Dispatch한 잡은 그 워커의 큐에만 들어가므로 나머지 워커는 Steal로만 가져갈 수 있다.
+		FJobHandle Root = FJobSystem::Dispatch([&NumExecuted, NumChildren]()
+		{
+			std::vector<FJobHandle> Children;
+			Children.reserve(NumChildren);
+			for (int32 i = 0; i < NumChildren; ++i)
+			{
+				Children.push_back(FJobSystem::Dispatch([&NumExecuted]()
+				{
+					Spin(2000);
+					NumExecuted.fetch_add(1, std::memory_order_relaxed);
+				}));
+			}
+			FJobSystem::WaitAll(Children);
+		});
+		FJobSystem::Wait(Root);
+
+		const FJobSystem::FStats Stats = FJobSystem::GetStats();
+		std::printf("  executed %llu, stolen %llu\n",
+			static_cast<unsigned long long>(Stats.ExecutedJobs), static_cast<unsigned long long>(Stats.StolenJobs));
+
+		STRESS_CHECK(NumExecuted.load() == NumChildren);
+		STRESS_CHECK(Stats.StolenJobs > 0);
+	}
+
+	void RunTest(const char* Name, void (*Test)())
+	{
+		const int32 FailuresBefore = GNumFailures;
+		const auto Start = std::chrono::steady_clock::now();
+
+		std::printf("[ RUN  ] %s\n", Name);
+		Test();
+
+		const double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		std::printf("[ %s ] %s (%.1f ms)\n", GNumFailures == FailuresBefore ? " OK " : "FAIL", Name, Ms);
+	}
+
+	void RunAllTests()
+	{
+		RunTest("ParallelFor", &TestParallelFor);
+		RunTest("NestedParallelFor", &TestNestedParallelFor);
+		RunTest("RandomGraphs", []() { TestRandomGraphs(12345, 50); });
+		RunTest("ConcurrentProducers", &TestConcurrentProducers);
+		RunTest("WorkStealing", &TestWorkStealing);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	// 사용법: JobSystemStress [워커 수] [반복 횟수]
+	const uint32 NumWorkers = argc > 1 ? static_cast<uint32>(std::atoi(argv[1])) : 0;
+	const int32 NumRounds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 3;
+
+	// 워커 0개 (호출 스레드에서 즉시 실행) 경로도 같은 테스트로 확인
+	std::printf("== inline (no workers) ==\n");
+	RunAllTests();
+
+	FJobSystem::Initialize(NumWorkers);
+	std::printf("== %u workers ==\n", FJobSystem::GetNumWorkers());
+	for (int32 Round = 0; Round < NumRounds; ++Round)
+	{
+		RunAllTests();
+	}
+	FJobSystem::Shutdown();
+
+	// 종료 후 재초기화
+	FJobSystem::Initialize(2);
+	std::printf("== reinitialized, %u workers ==\n", FJobSystem::GetNumWorkers());
+	RunAllTests();
+	FJobSystem::Shutdown();
+
+	std::printf(GNumFailures == 0 ? "All tests passed\n" : "%d check(s) failed\n", GNumFailures);
+	return GNumFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,9 @@
+﻿#pragma once
+
+// JobSystem.cpp가 포함하는 pch.h 대신 쓰는 헤드리스 빌드용 최소 헤더
+// (엔진 pch.h는 windows.h / D3D / UObject까지 끌어오므로 여기서는 표준 라이브러리만 포함)
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>